@@ -102,6 +102,7 @@ EnvironmentOptions::EnvironmentOptions()
   mPanMinimumDistance(-1),
   mPanMinimumEvents(-1),
   mGlesCallTime(0),
+  mUpdateThreadCount( 1 ),
   mWindowWidth( 0 ),
   mWindowHeight( 0 )
 {
@@ -209,6 +210,11 @@ int EnvironmentOptions::GetMinimumPanEvents() const
   return mPanMinimumEvents;
 }
 
+unsigned int EnvironmentOptions::GetUpdateThreadCount() const
+{
+  return mUpdateThreadCount;
+}
+
 unsigned int EnvironmentOptions::GetWindowWidth() const
 {
   return mWindowWidth;
@@ -328,6 +334,12 @@ void EnvironmentOptions::ParseEnvironmentOptions()
     mGlesCallTime = glesCallTime;
   }
 
+  int updateThreadCount(1);
+  if ( GetIntegerEnvironmentVariable( DALI_ENV_UPDATE_THREAD_COUNT, updateThreadCount ) && updateThreadCount > 0 )
+  {
+    mUpdateThreadCount = updateThreadCount;
+  }
+
   int windowWidth(0), windowHeight(0);
   if ( GetIntegerEnvironmentVariable( DALI_WINDOW_WIDTH, windowWidth ) && GetIntegerEnvironmentVariable( DALI_WINDOW_HEIGHT, windowHeight ) )
   {
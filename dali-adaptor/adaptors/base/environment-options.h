@@ -155,6 +155,11 @@ public:
    */
   int GetMinimumPanEvents() const;
 
+  /**
+   * @return The number of threads used to update the scene-graph, including the update-thread ( 1 = no worker threads )
+   */
+  unsigned int GetUpdateThreadCount() const;
+
   /**
    * @return The width of the window
    */
@@ -215,6 +220,7 @@ private: // Data
   int mPanMinimumDistance;                        ///< minimum distance required before pan starts
   int mPanMinimumEvents;                          ///< minimum events required before pan starts
   int mGlesCallTime;                              ///< time in seconds between status updates
+  unsigned int mUpdateThreadCount;                ///< number of threads used to update the scene-graph
   unsigned int mWindowWidth;                      ///< width of the window
   unsigned int mWindowHeight;                     ///< height of the window
 
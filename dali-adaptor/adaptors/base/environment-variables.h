@@ -79,6 +79,11 @@ namespace Adaptor
 
 #define DALI_GLES_CALL_TIME "DALI_GLES_CALL_TIME"
 
+/**
+ * The number of threads used to update the scene-graph, including the update-thread
+ */
+#define DALI_ENV_UPDATE_THREAD_COUNT "DALI_UPDATE_THREAD_COUNT"
+
 #define DALI_WINDOW_WIDTH "DALI_WINDOW_WIDTH"
 
 #define DALI_WINDOW_HEIGHT "DALI_WINDOW_HEIGHT"
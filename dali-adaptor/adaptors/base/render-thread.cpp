@@ -195,10 +195,16 @@ bool RenderThread::Run()
         // Render
         DALI_LOG_INFO( gRenderLogFilter, Debug::Verbose, "RenderThread::Run. 3 - Core.Render()\n");
 
+        // Only the regions which changed since the back buffer was presented are redrawn, if its age is known
+        renderStatus.SetBufferAge( mEGL->GetBufferAge() );
+
         mThreadSynchronization.AddPerformanceMarker( PerformanceInterface::RENDER_START );
         mCore.Render( renderStatus );
         mThreadSynchronization.AddPerformanceMarker( PerformanceInterface::RENDER_END );
 
+        // Present only the damaged region when the buffers are swapped, if supported
+        mEGL->SetDamagedRect( renderStatus.GetDamagedRect() );
+
         // Decrement the count of how far update is ahead of render
         mThreadSynchronization.RenderFinished();
 
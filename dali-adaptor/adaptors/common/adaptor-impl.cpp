@@ -142,6 +142,11 @@ void Adaptor::Initialize( Dali::Configuration::ContextLoss configuration )
 
   mCore = Integration::Core::New( *this, *mPlatformAbstraction, *mGLES, *eglSyncImpl, *mGestureManager, dataRetentionPolicy );
 
+  if( mEnvironmentOptions->GetUpdateThreadCount() > 1u )
+  {
+    mCore->SetUpdateThreadCount( mEnvironmentOptions->GetUpdateThreadCount() );
+  }
+
   const unsigned int timeInterval = mEnvironmentOptions->GetObjectProfilerInterval();
   if( 0u < timeInterval )
   {
@@ -26,6 +26,10 @@
 // INTERNAL INCLUDES
 #include <egl-interface.h>
 
+#ifndef EGL_BUFFER_AGE_EXT
+#define EGL_BUFFER_AGE_EXT 0x313D // From EGL_EXT_buffer_age
+#endif
+
 namespace Dali
 {
 
@@ -103,6 +107,16 @@ public:
    */
   virtual void SwapBuffers();
 
+  /**
+   * @copydoc Dali::EglInterface::GetBufferAge
+   */
+  virtual unsigned int GetBufferAge();
+
+  /**
+   * @copydoc Dali::EglInterface::SetDamagedRect
+   */
+  virtual void SetDamagedRect( const Rect<int>& damagedRect );
+
   /**
    * Performs an OpenGL copy buffers command
    */
@@ -164,6 +178,15 @@ public:
    */
   EGLContext GetContext() const;
 
+private:
+
+  /**
+   * Find the optional extensions, which present partial updates of the surface.
+   */
+  void InitializeExtensions();
+
+  typedef EGLBoolean (EGLAPIENTRY *SwapBuffersWithDamageFunction)( EGLDisplay display, EGLSurface surface, EGLint* rects, EGLint rectCount );
+
 private:
 
   Vector<EGLint>       mContextAttribs;
@@ -182,6 +205,11 @@ private:
   bool                 mContextCurrent;
   bool                 mIsWindow;
   ColorDepth           mColorDepth;
+
+  SwapBuffersWithDamageFunction mSwapBuffersWithDamage; ///< eglSwapBuffersWithDamageKHR or EXT, or NULL if not supported
+  EGLint               mDamagedRect[4];          ///< The region presented by the next swap (x, y, width, height)
+  bool                 mIsDamagedRectSet;        ///< Whether the next swap only presents mDamagedRect
+  bool                 mIsBufferAgeSupported;    ///< Whether EGL_EXT_buffer_age is supported
 };
 
 } // namespace Adaptor
@@ -65,6 +65,24 @@ public:
     /* Do nothing in main implementation */
   }
 
+  bool IsInstancedDrawingSupported()
+  {
+#if DALI_GLES_VERSION >= 30
+    return true;
+#else
+    return false;
+#endif // DALI_GLES_VERSION >= 30
+  }
+
+  bool IsVertexArrayObjectSupported()
+  {
+#if DALI_GLES_VERSION >= 30
+    return true;
+#else
+    return false;
+#endif // DALI_GLES_VERSION >= 30
+  }
+
   /* OpenGL ES 2.0 */
 
   void ActiveTexture (GLenum texture)
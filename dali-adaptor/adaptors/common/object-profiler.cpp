@@ -98,6 +98,15 @@ void ObjectProfiler::DisplayInstanceCounts()
   }
 
   LogMessage(Debug::DebugInfo, "Number of image actors using Quad style: %d\n", quadCount);
+
+  MemoryPoolOccupancyContainer occupancy;
+  GetMemoryPoolOccupancy( occupancy );
+
+  for( MemoryPoolOccupancyContainer::ConstIterator iter = occupancy.Begin(), end = occupancy.End(); iter != end; ++iter )
+  {
+    LogMessage( Debug::DebugInfo, "%-30s: % 4u / % 4u pooled  Memory MemorySize: ~% 6.1f kB\n",
+                iter->name, iter->allocationCount, iter->capacity, ( iter->capacity * iter->objectSize ) / 1024.0f );
+  }
 }
 
 bool ObjectProfiler::OnTimeout()
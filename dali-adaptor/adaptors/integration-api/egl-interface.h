@@ -18,6 +18,9 @@
  *
  */
 
+// EXTERNAL INCLUDES
+#include <dali/public-api/math/rect.h>
+
 namespace Dali
 {
 
@@ -54,6 +57,18 @@ public:
    */
   virtual void SwapBuffers() = 0;
 
+  /**
+   * Query the age of the back buffer, i.e. the number of frames since its contents were presented.
+   * @return The age of the buffer, or zero if its contents are undefined.
+   */
+  virtual unsigned int GetBufferAge() = 0;
+
+  /**
+   * Set the region of the surface which changed since the previous frame; the next swap only presents this region, if supported.
+   * @param[in] damagedRect The damaged region in window coordinates, with the origin at the bottom-left of the surface.
+   */
+  virtual void SetDamagedRect( const Rect<int>& damagedRect ) = 0;
+
   /**
    * Performs an OpenGL copy buffers command
    */
@@ -21,6 +21,7 @@
 #include <gl/egl-implementation.h>
 
 // EXTERNAL INCLUDES
+#include <cstring>
 #include <dali/integration-api/debug.h>
 #include <dali/public-api/common/dali-common.h>
 #include <dali/public-api/common/dali-vector.h>
@@ -59,7 +60,10 @@ EglImplementation::EglImplementation()
     mIsOwnSurface(true),
     mContextCurrent(false),
     mIsWindow(true),
-    mColorDepth(COLOR_DEPTH_24)
+    mColorDepth(COLOR_DEPTH_24),
+    mSwapBuffersWithDamage(NULL),
+    mIsDamagedRectSet(false),
+    mIsBufferAgeSupported(false)
 {
 }
 
@@ -91,6 +95,8 @@ bool EglImplementation::InitializeGles( EGLNativeDisplayType display, bool isOwn
     }
     eglBindAPI(EGL_OPENGL_ES_API);
 
+    InitializeExtensions();
+
     mContextAttribs.Clear();
 
 #if DALI_GLES_VERSION >= 30
@@ -279,7 +285,58 @@ bool EglImplementation::IsGlesInitialized() const
 
 void EglImplementation::SwapBuffers()
 {
-  eglSwapBuffers( mEglDisplay, mEglSurface );
+  if( mIsDamagedRectSet && mSwapBuffersWithDamage )
+  {
+    mSwapBuffersWithDamage( mEglDisplay, mEglSurface, mDamagedRect, 1 );
+  }
+  else
+  {
+    eglSwapBuffers( mEglDisplay, mEglSurface );
+  }
+  mIsDamagedRectSet = false;
+}
+
+unsigned int EglImplementation::GetBufferAge()
+{
+  EGLint age = 0;
+  if( mIsBufferAgeSupported && mIsWindow && mEglSurface )
+  {
+    if( !eglQuerySurface( mEglDisplay, mEglSurface, EGL_BUFFER_AGE_EXT, &age ) )
+    {
+      age = 0;
+    }
+  }
+  return ( age > 0 ) ? static_cast< unsigned int >( age ) : 0u;
+}
+
+void EglImplementation::SetDamagedRect( const Rect<int>& damagedRect )
+{
+  // An empty region presents the whole surface
+  mIsDamagedRectSet = !damagedRect.IsEmpty();
+  mDamagedRect[0] = damagedRect.x;
+  mDamagedRect[1] = damagedRect.y;
+  mDamagedRect[2] = damagedRect.width;
+  mDamagedRect[3] = damagedRect.height;
+}
+
+void EglImplementation::InitializeExtensions()
+{
+  const char* extensions = eglQueryString( mEglDisplay, EGL_EXTENSIONS );
+  if( NULL == extensions )
+  {
+    return;
+  }
+
+  mIsBufferAgeSupported = ( NULL != strstr( extensions, "EGL_EXT_buffer_age" ) );
+
+  if( NULL != strstr( extensions, "EGL_KHR_swap_buffers_with_damage" ) )
+  {
+    mSwapBuffersWithDamage = reinterpret_cast< SwapBuffersWithDamageFunction >( eglGetProcAddress( "eglSwapBuffersWithDamageKHR" ) );
+  }
+  else if( NULL != strstr( extensions, "EGL_EXT_swap_buffers_with_damage" ) )
+  {
+    mSwapBuffersWithDamage = reinterpret_cast< SwapBuffersWithDamageFunction >( eglGetProcAddress( "eglSwapBuffersWithDamageEXT" ) );
+  }
 }
 
 void EglImplementation::CopyBuffers()
@@ -17,10 +17,13 @@
 
 #include <dali-test-suite-utils.h>
 #include "platform-abstractions/portable/image-operations.h"
+#include "platform-abstractions/portable/image-operations-simd.h"
+#include "platform-abstractions/portable/band-worker-pool.h"
 #include <dali/devel-api/common/ref-counted-dali-vector.h>
 
 #include <sys/mman.h>
 #include <unistd.h>
+#include <time.h>
 
 using namespace Dali::Internal::Platform;
 
@@ -1522,3 +1525,590 @@ int UtcDaliImageOperationsBilinearFilter1BPP(void)
 
   END_TEST;
 }
+
+namespace
+{
+
+typedef void (*HalveScanlineFunction)( unsigned char * pixels, unsigned int width );
+typedef void (*AverageScanlinesFunction)( const unsigned char * scanline1, const unsigned char * scanline2, unsigned char * outputScanline, unsigned int width );
+typedef void (*DownscaleInPlacePow2Function)( unsigned char * pixels, unsigned int inputWidth, unsigned int inputHeight, unsigned int desiredWidth, unsigned int desiredHeight, BoxDimensionTest dimensionTest, unsigned int& outWidth, unsigned int& outHeight );
+typedef void (*LinearSampleFunction)( const unsigned char * __restrict__ inPixels, ImageDimensions inputDimensions, unsigned char * __restrict__ outPixels, ImageDimensions desiredDimensions );
+
+/**
+ * @brief The vector instruction sets to check against the scalar code.
+ */
+const InstructionSet VECTOR_INSTRUCTION_SETS[] = { InstructionSetSSE2, InstructionSetAVX2, InstructionSetNEON };
+const unsigned int NUM_VECTOR_INSTRUCTION_SETS = sizeof(VECTOR_INSTRUCTION_SETS) / sizeof(VECTOR_INSTRUCTION_SETS[0]);
+
+/**
+ * @brief The number of random inputs each kernel is checked with.
+ */
+const unsigned int NUM_RANDOM_CROSS_CHECKS = 200u;
+
+/**
+ * @brief Fill a buffer with random bytes, plus some spare ones at the end to catch overruns.
+ */
+void MakeRandomBytes( Dali::Vector<uint8_t>& bytes, unsigned int numBytes )
+{
+  bytes.Resize( numBytes + 64u );
+  for( unsigned int i = 0; i < bytes.Count(); ++i )
+  {
+    bytes[i] = RandomComponent8();
+  }
+}
+
+/**
+ * @brief Run a halving function over a copy of a random scanline with the instruction set given.
+ */
+void HalveScanlineWith( InstructionSet instructionSet, HalveScanlineFunction halveScanline, const Dali::Vector<uint8_t>& input, unsigned int width, Dali::Vector<uint8_t>& output )
+{
+  output = input;
+  SetInstructionSet( instructionSet );
+  halveScanline( &output[0], width );
+}
+
+/**
+ * @brief Run an averaging function over random scanlines with the instruction set given, in place like the downscaling does if inPlace is set.
+ */
+void AverageScanlinesWith( InstructionSet instructionSet, AverageScanlinesFunction averageScanlines, const Dali::Vector<uint8_t>& input1, const Dali::Vector<uint8_t>& input2, unsigned int width, bool inPlace, Dali::Vector<uint8_t>& output )
+{
+  output = input1;
+  SetInstructionSet( instructionSet );
+  if( inPlace )
+  {
+    averageScanlines( &output[0], &input2[0], &output[0], width );
+  }
+  else
+  {
+    averageScanlines( &input1[0], &input2[0], &output[0], width );
+  }
+}
+
+/**
+ * @brief Check the halving of random scanlines of a pixel format matches the scalar code with every instruction set supported.
+ */
+void CrossCheckHalveScanline( HalveScanlineFunction halveScanline, unsigned int bytesPerPixel, const char * const location )
+{
+  Dali::Vector<uint8_t> input;
+  Dali::Vector<uint8_t> reference;
+  Dali::Vector<uint8_t> output;
+  for( unsigned int check = 0; check < NUM_RANDOM_CROSS_CHECKS; ++check )
+  {
+    const unsigned int width = 2u + RandomInRange( 300u );
+    MakeRandomBytes( input, width * bytesPerPixel );
+    HalveScanlineWith( InstructionSetScalar, halveScanline, input, width, reference );
+
+    for( unsigned int set = 0; set < NUM_VECTOR_INSTRUCTION_SETS; ++set )
+    {
+      if( IsInstructionSetSupported( VECTOR_INSTRUCTION_SETS[set] ) )
+      {
+        HalveScanlineWith( VECTOR_INSTRUCTION_SETS[set], halveScanline, input, width, output );
+        DALI_TEST_EQUALS( 0, memcmp( &reference[0], &output[0], reference.Count() ), location );
+      }
+    }
+  }
+}
+
+/**
+ * @brief Check the averaging of random scanlines of a pixel format matches the scalar code with every instruction set supported.
+ */
+void CrossCheckAverageScanlines( AverageScanlinesFunction averageScanlines, unsigned int bytesPerPixel, const char * const location )
+{
+  Dali::Vector<uint8_t> input1;
+  Dali::Vector<uint8_t> input2;
+  Dali::Vector<uint8_t> reference;
+  Dali::Vector<uint8_t> output;
+  for( unsigned int check = 0; check < NUM_RANDOM_CROSS_CHECKS; ++check )
+  {
+    const unsigned int width = RandomInRange( 300u );
+    const bool inPlace = check & 1u;
+    MakeRandomBytes( input1, width * bytesPerPixel );
+    MakeRandomBytes( input2, width * bytesPerPixel );
+    AverageScanlinesWith( InstructionSetScalar, averageScanlines, input1, input2, width, inPlace, reference );
+
+    for( unsigned int set = 0; set < NUM_VECTOR_INSTRUCTION_SETS; ++set )
+    {
+      if( IsInstructionSetSupported( VECTOR_INSTRUCTION_SETS[set] ) )
+      {
+        AverageScanlinesWith( VECTOR_INSTRUCTION_SETS[set], averageScanlines, input1, input2, width, inPlace, output );
+        DALI_TEST_EQUALS( 0, memcmp( &reference[0], &output[0], reference.Count() ), location );
+      }
+    }
+  }
+}
+
+/**
+ * @brief Check the downscaling of random images of a pixel format matches the scalar code with every instruction set supported.
+ */
+void CrossCheckDownscaleInPlacePow2( DownscaleInPlacePow2Function downscale, unsigned int bytesPerPixel, const char * const location )
+{
+  Dali::Vector<uint8_t> input;
+  Dali::Vector<uint8_t> reference;
+  Dali::Vector<uint8_t> output;
+  for( unsigned int check = 0; check < NUM_RANDOM_CROSS_CHECKS / 10u; ++check )
+  {
+    const unsigned int inputWidth = 1u + RandomInRange( 400u );
+    const unsigned int inputHeight = 1u + RandomInRange( 100u );
+    const unsigned int desiredWidth = 1u + RandomInRange( inputWidth );
+    const unsigned int desiredHeight = 1u + RandomInRange( inputHeight );
+    MakeRandomBytes( input, inputWidth * inputHeight * bytesPerPixel );
+
+    unsigned int referenceWidth, referenceHeight;
+    reference = input;
+    SetInstructionSet( InstructionSetScalar );
+    downscale( &reference[0], inputWidth, inputHeight, desiredWidth, desiredHeight, BoxDimensionTestBoth, referenceWidth, referenceHeight );
+
+    for( unsigned int set = 0; set < NUM_VECTOR_INSTRUCTION_SETS; ++set )
+    {
+      if( IsInstructionSetSupported( VECTOR_INSTRUCTION_SETS[set] ) )
+      {
+        unsigned int outWidth, outHeight;
+        output = input;
+        SetInstructionSet( VECTOR_INSTRUCTION_SETS[set] );
+        downscale( &output[0], inputWidth, inputHeight, desiredWidth, desiredHeight, BoxDimensionTestBoth, outWidth, outHeight );
+        DALI_TEST_EQUALS( referenceWidth, outWidth, location );
+        DALI_TEST_EQUALS( referenceHeight, outHeight, location );
+        DALI_TEST_EQUALS( 0, memcmp( &reference[0], &output[0], reference.Count() ), location );
+      }
+    }
+  }
+}
+
+/**
+ * @brief Check the sampling of random images of a pixel format matches the scalar code with every instruction set supported.
+ */
+void CrossCheckLinearSample( LinearSampleFunction linearSample, unsigned int bytesPerPixel, const char * const location )
+{
+  Dali::Vector<uint8_t> input;
+  Dali::Vector<uint8_t> reference;
+  Dali::Vector<uint8_t> output;
+  for( unsigned int check = 0; check < NUM_RANDOM_CROSS_CHECKS / 10u; ++check )
+  {
+    // The scanline after the last one is read unless the height is reduced, so it always is:
+    const ImageDimensions inputDimensions( 1u + RandomInRange( 300u ), 2u + RandomInRange( 100u ) );
+    const ImageDimensions desiredDimensions( 1u + RandomInRange( 300u ), 1u + RandomInRange( inputDimensions.GetHeight() - 2u ) );
+    const unsigned int outputBytes = desiredDimensions.GetWidth() * desiredDimensions.GetHeight() * bytesPerPixel;
+    MakeRandomBytes( input, inputDimensions.GetWidth() * inputDimensions.GetHeight() * bytesPerPixel );
+
+    reference.Resize( outputBytes );
+    SetInstructionSet( InstructionSetScalar );
+    linearSample( &input[0], inputDimensions, &reference[0], desiredDimensions );
+
+    for( unsigned int set = 0; set < NUM_VECTOR_INSTRUCTION_SETS; ++set )
+    {
+      if( IsInstructionSetSupported( VECTOR_INSTRUCTION_SETS[set] ) )
+      {
+        output.Resize( outputBytes );
+        SetInstructionSet( VECTOR_INSTRUCTION_SETS[set] );
+        linearSample( &input[0], inputDimensions, &output[0], desiredDimensions );
+        DALI_TEST_EQUALS( 0, memcmp( &reference[0], &output[0], outputBytes ), location );
+      }
+    }
+  }
+}
+
+/**
+ * @brief Seconds since some fixed point, for the benchmarks.
+ */
+double GetTimeSeconds()
+{
+  timespec time;
+  clock_gettime( CLOCK_MONOTONIC, &time );
+  return time.tv_sec + time.tv_nsec * 1e-9;
+}
+
+} //< namespace unnamed
+
+/**
+ * @brief Test the vector kernels halve scanlines of every pixel format exactly as the scalar code does.
+ */
+int UtcDaliImageOperationsSimdHalveScanlines(void)
+{
+  srand48( 53 * 59 );
+  const InstructionSet defaultInstructionSet = GetInstructionSet();
+
+  CrossCheckHalveScanline( HalveScanlineInPlaceRGB888, 3u, TEST_LOCATION );
+  CrossCheckHalveScanline( HalveScanlineInPlaceRGBA8888, 4u, TEST_LOCATION );
+  CrossCheckHalveScanline( HalveScanlineInPlaceRGB565, 2u, TEST_LOCATION );
+  CrossCheckHalveScanline( HalveScanlineInPlace2Bytes, 2u, TEST_LOCATION );
+  CrossCheckHalveScanline( HalveScanlineInPlace1Byte, 1u, TEST_LOCATION );
+
+  SetInstructionSet( defaultInstructionSet );
+  END_TEST;
+}
+
+/**
+ * @brief Test the vector kernels average scanlines of every pixel format exactly as the scalar code does.
+ */
+int UtcDaliImageOperationsSimdAverageScanlines(void)
+{
+  srand48( 61 * 67 );
+  const InstructionSet defaultInstructionSet = GetInstructionSet();
+
+  CrossCheckAverageScanlines( AverageScanlines1, 1u, TEST_LOCATION );
+  CrossCheckAverageScanlines( AverageScanlines2, 2u, TEST_LOCATION );
+  CrossCheckAverageScanlines( AverageScanlines3, 3u, TEST_LOCATION );
+  CrossCheckAverageScanlines( AverageScanlinesRGBA8888, 4u, TEST_LOCATION );
+  CrossCheckAverageScanlines( AverageScanlinesRGB565, 2u, TEST_LOCATION );
+
+  SetInstructionSet( defaultInstructionSet );
+  END_TEST;
+}
+
+/**
+ * @brief Test whole images of every pixel format are box filtered exactly as the scalar code does.
+ */
+int UtcDaliImageOperationsSimdDownscaleInPlacePow2(void)
+{
+  srand48( 71 * 73 );
+  const InstructionSet defaultInstructionSet = GetInstructionSet();
+
+  CrossCheckDownscaleInPlacePow2( DownscaleInPlacePow2RGB888, 3u, TEST_LOCATION );
+  CrossCheckDownscaleInPlacePow2( DownscaleInPlacePow2RGBA8888, 4u, TEST_LOCATION );
+  CrossCheckDownscaleInPlacePow2( DownscaleInPlacePow2RGB565, 2u, TEST_LOCATION );
+  CrossCheckDownscaleInPlacePow2( DownscaleInPlacePow2ComponentPair, 2u, TEST_LOCATION );
+  CrossCheckDownscaleInPlacePow2( DownscaleInPlacePow2SingleBytePerPixel, 1u, TEST_LOCATION );
+
+  SetInstructionSet( defaultInstructionSet );
+  END_TEST;
+}
+
+/**
+ * @brief Test images are point sampled exactly as the scalar code does.
+ */
+int UtcDaliImageOperationsSimdPointSample(void)
+{
+  srand48( 79 * 83 );
+  const InstructionSet defaultInstructionSet = GetInstructionSet();
+
+  Dali::Vector<uint8_t> input;
+  Dali::Vector<uint8_t> reference;
+  Dali::Vector<uint8_t> output;
+  for( unsigned int check = 0; check < NUM_RANDOM_CROSS_CHECKS / 10u; ++check )
+  {
+    const unsigned int inputWidth = 1u + RandomInRange( 300u );
+    const unsigned int inputHeight = 1u + RandomInRange( 100u );
+    const unsigned int desiredWidth = 1u + RandomInRange( 300u );
+    const unsigned int desiredHeight = 1u + RandomInRange( 100u );
+    MakeRandomBytes( input, inputWidth * inputHeight * 4u );
+
+    reference.Resize( desiredWidth * desiredHeight * 4u );
+    SetInstructionSet( InstructionSetScalar );
+    PointSample4BPP( &input[0], inputWidth, inputHeight, &reference[0], desiredWidth, desiredHeight );
+
+    for( unsigned int set = 0; set < NUM_VECTOR_INSTRUCTION_SETS; ++set )
+    {
+      if( IsInstructionSetSupported( VECTOR_INSTRUCTION_SETS[set] ) )
+      {
+        output.Resize( reference.Count() );
+        SetInstructionSet( VECTOR_INSTRUCTION_SETS[set] );
+        PointSample4BPP( &input[0], inputWidth, inputHeight, &output[0], desiredWidth, desiredHeight );
+        DALI_TEST_EQUALS( 0, memcmp( &reference[0], &output[0], reference.Count() ), TEST_LOCATION );
+      }
+    }
+  }
+
+  SetInstructionSet( defaultInstructionSet );
+  END_TEST;
+}
+
+/**
+ * @brief Test images of every pixel format are bilinear filtered exactly as the scalar code does.
+ */
+int UtcDaliImageOperationsSimdLinearSample(void)
+{
+  srand48( 89 * 97 );
+  const InstructionSet defaultInstructionSet = GetInstructionSet();
+
+  CrossCheckLinearSample( LinearSample1BPP, 1u, TEST_LOCATION );
+  CrossCheckLinearSample( LinearSample2BPP, 2u, TEST_LOCATION );
+  CrossCheckLinearSample( LinearSampleRGB565, 2u, TEST_LOCATION );
+  CrossCheckLinearSample( LinearSample3BPP, 3u, TEST_LOCATION );
+  CrossCheckLinearSample( LinearSample4BPP, 4u, TEST_LOCATION );
+
+  SetInstructionSet( defaultInstructionSet );
+  END_TEST;
+}
+
+/**
+ * @brief Benchmark of the megapixels per second of the RGBA8888 image operations with each instruction set supported.
+ */
+int UtcDaliImageOperationsSimdBenchmark(void)
+{
+  const InstructionSet defaultInstructionSet = GetInstructionSet();
+  const unsigned int inputWidth = 1920u;
+  const unsigned int inputHeight = 1080u;
+  const double inputMegapixels = inputWidth * inputHeight * 1e-6;
+  const unsigned int repeats = 8u;
+
+  Dali::Vector<uint8_t> input;
+  Dali::Vector<uint8_t> scratch;
+  Dali::Vector<uint8_t> output;
+  MakeRandomBytes( input, inputWidth * inputHeight * 4u );
+  output.Resize( inputWidth * inputHeight * 4u );
+
+  const InstructionSet instructionSets[] = { InstructionSetScalar, InstructionSetSSE2, InstructionSetAVX2, InstructionSetNEON };
+  const char * const instructionSetNames[] = { "Scalar", "SSE2", "AVX2", "NEON" };
+  for( unsigned int set = 0; set < sizeof(instructionSets) / sizeof(instructionSets[0]); ++set )
+  {
+    if( !SetInstructionSet( instructionSets[set] ) )
+    {
+      continue;
+    }
+
+    double boxFilterSeconds = 0.0;
+    for( unsigned int repeat = 0; repeat < repeats; ++repeat )
+    {
+      scratch = input;
+      unsigned int outWidth, outHeight;
+      const double start = GetTimeSeconds();
+      DownscaleInPlacePow2RGBA8888( &scratch[0], inputWidth, inputHeight, inputWidth / 4u, inputHeight / 4u, BoxDimensionTestBoth, outWidth, outHeight );
+      boxFilterSeconds += GetTimeSeconds() - start;
+    }
+
+    double start = GetTimeSeconds();
+    for( unsigned int repeat = 0; repeat < repeats; ++repeat )
+    {
+      PointSample4BPP( &input[0], inputWidth, inputHeight, &output[0], inputWidth * 2u / 3u, inputHeight * 2u / 3u );
+    }
+    const double pointSampleSeconds = GetTimeSeconds() - start;
+
+    start = GetTimeSeconds();
+    for( unsigned int repeat = 0; repeat < repeats; ++repeat )
+    {
+      LinearSample4BPP( &input[0], ImageDimensions( inputWidth, inputHeight ), &output[0], ImageDimensions( inputWidth * 2u / 3u, inputHeight * 2u / 3u ) );
+    }
+    const double linearSampleSeconds = GetTimeSeconds() - start;
+
+    tet_printf( "%s: box filter %.1f, point sample %.1f, linear sample %.1f input megapixels per second.\n", instructionSetNames[set],
+                inputMegapixels * repeats / boxFilterSeconds, inputMegapixels * repeats / pointSampleSeconds, inputMegapixels * repeats / linearSampleSeconds );
+  }
+
+  SetInstructionSet( defaultInstructionSet );
+
+  // The benchmark is only informative, so pass if the operations completed:
+  DALI_TEST_EQUALS( true, true, TEST_LOCATION );
+
+  END_TEST;
+}
+
+/**
+ * @brief Box filter a large image in bands on a pool of the given number of worker threads,
+ * and assert it matches the scanline by scanline filtering of it.
+ */
+void TestBandsDownscaleInPlacePow2( unsigned int workerCount, const char * const location )
+{
+  BandWorkerPool::Start( workerCount );
+
+  srand48( 101 * 103 );
+  const unsigned int inputWidth = 1030u;
+  const unsigned int inputHeight = 1202u;
+
+  Dali::Vector<uint8_t> input;
+  MakeRandomBytes( input, inputWidth * inputHeight * 4u );
+
+  // Halve the image twice a pair of scanlines at a time, as the downscaling does for small images:
+  Dali::Vector<uint8_t> reference = input;
+  Dali::Vector<uint8_t> scanline1;
+  Dali::Vector<uint8_t> scanline2;
+  unsigned int referenceWidth = inputWidth, referenceHeight = inputHeight;
+  for( unsigned int pass = 0; pass < 2u; ++pass )
+  {
+    const unsigned int lastWidth = referenceWidth;
+    referenceWidth >>= 1u;
+    referenceHeight >>= 1u;
+    for( unsigned int y = 0; y < referenceHeight; ++y )
+    {
+      scanline1.Resize( lastWidth * 4u );
+      scanline2.Resize( lastWidth * 4u );
+      memcpy( &scanline1[0], &reference[y * 2u * lastWidth * 4u], lastWidth * 4u );
+      memcpy( &scanline2[0], &reference[( y * 2u + 1u ) * lastWidth * 4u], lastWidth * 4u );
+      HalveScanlineInPlaceRGBA8888( &scanline1[0], lastWidth );
+      HalveScanlineInPlaceRGBA8888( &scanline2[0], lastWidth );
+      AverageScanlinesRGBA8888( &scanline1[0], &scanline2[0], &reference[y * referenceWidth * 4u], referenceWidth );
+    }
+  }
+
+  unsigned int outWidth, outHeight;
+  Dali::Vector<uint8_t> output = input;
+  DownscaleInPlacePow2RGBA8888( &output[0], inputWidth, inputHeight, inputWidth / 4u, inputHeight / 4u, BoxDimensionTestBoth, outWidth, outHeight );
+
+  DALI_TEST_EQUALS( referenceWidth, outWidth, location );
+  DALI_TEST_EQUALS( referenceHeight, outHeight, location );
+  DALI_TEST_EQUALS( 0, memcmp( &reference[0], &output[0], outWidth * outHeight * 4u ), location );
+
+  BandWorkerPool::Shutdown();
+}
+
+/**
+ * @brief Test a large image, which is box filtered in bands on several threads, matches the scanline by scanline filtering of it.
+ */
+int UtcDaliImageOperationsBandsDownscaleInPlacePow2(void)
+{
+  TestBandsDownscaleInPlacePow2( 3u, TEST_LOCATION );
+  END_TEST;
+}
+
+/**
+ * @brief Test a large image is box filtered in bands correctly without worker threads, as on a single core machine.
+ */
+int UtcDaliImageOperationsBandsDownscaleInPlacePow2NoWorkers(void)
+{
+  TestBandsDownscaleInPlacePow2( 0u, TEST_LOCATION );
+  END_TEST;
+}
+
+/**
+ * @brief Test a large image, which is point sampled in bands on several threads, matches sampling it pixel by pixel.
+ */
+int UtcDaliImageOperationsBandsPointSample(void)
+{
+  srand48( 107 * 109 );
+  const unsigned int inputWidth = 1280u;
+  const unsigned int inputHeight = 960u;
+  const unsigned int desiredWidth = 901u;
+  const unsigned int desiredHeight = 677u;
+
+  Dali::Vector<uint8_t> input;
+  MakeRandomBytes( input, inputWidth * inputHeight * 4u );
+  const uint32_t * const inPixels = reinterpret_cast<const uint32_t*>( &input[0] );
+
+  Dali::Vector<uint32_t> output;
+  output.Resize( desiredWidth * desiredHeight );
+  PointSample4BPP( &input[0], inputWidth, inputHeight, reinterpret_cast<uint8_t*>( &output[0] ), desiredWidth, desiredHeight );
+
+  const unsigned int deltaX = ( inputWidth << 16u ) / desiredWidth;
+  const unsigned int deltaY = ( inputHeight << 16u ) / desiredHeight;
+  unsigned int mismatches = 0u;
+  for( unsigned int y = 0; y < desiredHeight; ++y )
+  {
+    const unsigned int inY = ( y * deltaY + ( 1u << 15u ) ) >> 16u;
+    for( unsigned int x = 0; x < desiredWidth; ++x )
+    {
+      const unsigned int inX = ( x * deltaX + ( 1u << 15u ) ) >> 16u;
+      mismatches += output[y * desiredWidth + x] != inPixels[inY * inputWidth + inX];
+    }
+  }
+  DALI_TEST_EQUALS( 0u, mismatches, TEST_LOCATION );
+
+  END_TEST;
+}
+
+/**
+ * @brief Test a large image, which is bilinear filtered in bands on several threads, comes out the same every time.
+ */
+int UtcDaliImageOperationsBandsLinearSample(void)
+{
+  srand48( 113 * 127 );
+  const ImageDimensions inputDimensions( 1280u, 960u );
+  const ImageDimensions desiredDimensions( 901u, 677u );
+  const unsigned int outputBytes = desiredDimensions.GetWidth() * desiredDimensions.GetHeight() * 3u;
+
+  Dali::Vector<uint8_t> input;
+  MakeRandomBytes( input, inputDimensions.GetWidth() * inputDimensions.GetHeight() * 3u );
+
+  Dali::Vector<uint8_t> reference;
+  reference.Resize( outputBytes );
+  LinearSample3BPP( &input[0], inputDimensions, &reference[0], desiredDimensions );
+
+  Dali::Vector<uint8_t> output;
+  output.Resize( outputBytes );
+  for( unsigned int repeat = 0; repeat < 8u; ++repeat )
+  {
+    memset( &output[0], 0, outputBytes );
+    LinearSample3BPP( &input[0], inputDimensions, &output[0], desiredDimensions );
+    DALI_TEST_EQUALS( 0, memcmp( &reference[0], &output[0], outputBytes ), TEST_LOCATION );
+  }
+
+  END_TEST;
+}
+
+namespace
+{
+
+/**
+ * @brief Downscale a random image scanline by scanline, and check it matches downscaling it whole.
+ */
+void CheckScanlineDownscaler( Pixel::Format pixelFormat, ImageDimensions inputDimensions, ImageDimensions requestedDimensions, FittingMode::Type fittingMode, SamplingMode::Type samplingMode, const char * const location )
+{
+  const unsigned int bytesPerPixel = Pixel::GetBytesPerPixel( pixelFormat );
+  const unsigned int inputWidth = inputDimensions.GetWidth();
+  const unsigned int inputHeight = inputDimensions.GetHeight();
+  const unsigned int scanlineBytes = inputWidth * bytesPerPixel;
+
+  Dali::Vector<uint8_t> input;
+  MakeRandomBytes( input, scanlineBytes * inputHeight );
+
+  Integration::BitmapPtr wholeBitmap = Integration::Bitmap::New( Integration::Bitmap::BITMAP_2D_PACKED_PIXELS, ResourcePolicy::OWNED_DISCARD );
+  uint8_t * const wholePixels = wholeBitmap->GetPackedPixelsProfile()->ReserveBuffer( pixelFormat, inputWidth, inputHeight, inputWidth, inputHeight );
+  memcpy( wholePixels, &input[0], scanlineBytes * inputHeight );
+  const Integration::BitmapPtr reference = ApplyAttributesToBitmap( wholeBitmap, requestedDimensions, fittingMode, samplingMode );
+
+  Integration::BitmapPtr streamedBitmap = Integration::Bitmap::New( Integration::Bitmap::BITMAP_2D_PACKED_PIXELS, ResourcePolicy::OWNED_DISCARD );
+  ScanlineDownscaler downscaler( *streamedBitmap, pixelFormat, inputDimensions, requestedDimensions, fittingMode, samplingMode );
+  DALI_TEST_EQUALS( true, downscaler.IsDownscaling(), location );
+  for( unsigned int y = 0; y < inputHeight; ++y )
+  {
+    memcpy( downscaler.GetScanline(), &input[y * scanlineBytes], scanlineBytes );
+    downscaler.PushScanline();
+  }
+  DALI_TEST_EQUALS( true, downscaler.Finish(), location );
+
+  DALI_TEST_EQUALS( reference->GetImageWidth(), streamedBitmap->GetImageWidth(), location );
+  DALI_TEST_EQUALS( reference->GetImageHeight(), streamedBitmap->GetImageHeight(), location );
+  DALI_TEST_EQUALS( 0, memcmp( reference->GetBuffer(), streamedBitmap->GetBuffer(), reference->GetImageWidth() * reference->GetImageHeight() * bytesPerPixel ), location );
+}
+
+} // namespace
+
+/**
+ * @brief Test downscaling an image a scanline at a time as it is decoded gives the same bitmap as downscaling it whole.
+ */
+int UtcDaliImageOperationsScanlineDownscaler(void)
+{
+  srand48( 131 * 137 );
+  const Pixel::Format formats[] = { Pixel::RGBA8888, Pixel::RGB888, Pixel::RGB565, Pixel::LA88, Pixel::L8 };
+  const FittingMode::Type fittingModes[] = { FittingMode::SHRINK_TO_FIT, FittingMode::SCALE_TO_FILL, FittingMode::FIT_WIDTH, FittingMode::FIT_HEIGHT };
+  const SamplingMode::Type samplingModes[] = { SamplingMode::BOX, SamplingMode::NEAREST, SamplingMode::LINEAR, SamplingMode::BOX_THEN_NEAREST, SamplingMode::BOX_THEN_LINEAR };
+
+  for( unsigned int format = 0; format < sizeof(formats) / sizeof(formats[0]); ++format )
+  {
+    for( unsigned int fittingMode = 0; fittingMode < sizeof(fittingModes) / sizeof(fittingModes[0]); ++fittingMode )
+    {
+      for( unsigned int samplingMode = 0; samplingMode < sizeof(samplingModes) / sizeof(samplingModes[0]); ++samplingMode )
+      {
+        CheckScanlineDownscaler( formats[format], ImageDimensions( 301u, 207u ), ImageDimensions( 64u, 48u ), fittingModes[fittingMode], samplingModes[samplingMode], TEST_LOCATION );
+        CheckScanlineDownscaler( formats[format], ImageDimensions( 517u, 390u ), ImageDimensions( 97u, 0u ), fittingModes[fittingMode], samplingModes[samplingMode], TEST_LOCATION );
+      }
+    }
+  }
+
+  END_TEST;
+}
+
+/**
+ * @brief Test the scanline downscaler leaves images which are not made smaller to be decoded whole, and notices images cut short.
+ */
+int UtcDaliImageOperationsScanlineDownscalerNops(void)
+{
+  Integration::BitmapPtr bitmap = Integration::Bitmap::New( Integration::Bitmap::BITMAP_2D_PACKED_PIXELS, ResourcePolicy::OWNED_DISCARD );
+
+  ScanlineDownscaler noRequest( *bitmap, Pixel::RGBA8888, ImageDimensions( 64u, 64u ), ImageDimensions(), FittingMode::SHRINK_TO_FIT, SamplingMode::BOX );
+  DALI_TEST_CHECK( !noRequest.IsDownscaling() );
+  ScanlineDownscaler upscale( *bitmap, Pixel::RGBA8888, ImageDimensions( 64u, 64u ), ImageDimensions( 128u, 128u ), FittingMode::SHRINK_TO_FIT, SamplingMode::BOX_THEN_LINEAR );
+  DALI_TEST_CHECK( !upscale.IsDownscaling() );
+  ScanlineDownscaler compressed( *bitmap, Pixel::COMPRESSED_R11_EAC, ImageDimensions( 64u, 64u ), ImageDimensions( 16u, 16u ), FittingMode::SHRINK_TO_FIT, SamplingMode::BOX );
+  DALI_TEST_CHECK( !compressed.IsDownscaling() );
+  DALI_TEST_CHECK( bitmap->GetBuffer() == 0 );
+
+  ScanlineDownscaler truncated( *bitmap, Pixel::RGB888, ImageDimensions( 64u, 64u ), ImageDimensions( 16u, 16u ), FittingMode::SHRINK_TO_FIT, SamplingMode::BOX );
+  DALI_TEST_CHECK( truncated.IsDownscaling() );
+  for( unsigned int y = 0; y < 40u; ++y )
+  {
+    memset( truncated.GetScanline(), 0xff, 64u * 3u );
+    truncated.PushScanline();
+  }
+  DALI_TEST_CHECK( !truncated.Finish() );
+
+  END_TEST;
+}
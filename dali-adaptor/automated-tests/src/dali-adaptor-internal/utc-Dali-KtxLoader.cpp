@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <iostream>
+#include <stdlib.h>
+#include <unistd.h>
+#include <dali-test-suite-utils.h>
+
+#include "platform-abstractions/tizen/image-loaders/loader-ktx.h"
+#include "platform-abstractions/portable/file-closer.h"
+#include "platform-abstractions/portable/mapped-file.h"
+#include "image-loaders.h"
+
+using namespace Dali;
+using Dali::Internal::Platform::MappedFile;
+using Dali::Internal::Platform::MappedFilePtr;
+using Dali::Internal::Platform::FileCloser;
+
+namespace
+{
+
+class StubKtxLoaderClient : public TizenPlatform::ResourceLoadingClient
+{
+public:
+  virtual void InterruptionPoint() const {}
+};
+
+// An 8x8 ETC1 texture is four 8 byte blocks:
+const unsigned int KTX_WIDTH = 8u;
+const unsigned int KTX_HEIGHT = 8u;
+const unsigned int KTX_IMAGE_BYTES = 32u;
+const unsigned int KTX_HEADER_BYTES = 64u;
+
+/**
+ * Write a KTX file holding an ETC1 texture with recognisable image bytes to a temporary file.
+ * @param[in] imageByteCount The size of the image data to write into the file, which may be more than is written to make a truncated file.
+ * @return The path of the file.
+ */
+std::string WriteKtxFile( uint32_t imageByteCount )
+{
+  const uint8_t identifier[] = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x31, 0x31, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+  const uint32_t fields[] =
+  {
+    0x04030201, // endianness
+    0,          // glType
+    1,          // glTypeSize
+    0,          // glFormat
+    0x8D64,     // glInternalFormat ETC1_RGB8_OES
+    0x1907,     // glBaseInternalFormat RGB
+    KTX_WIDTH,
+    KTX_HEIGHT,
+    0,          // pixelDepth
+    0,          // numberOfArrayElements
+    1,          // numberOfFaces
+    1,          // numberOfMipmapLevels
+    0           // bytesOfKeyValueData
+  };
+
+  char path[] = "/tmp/utc-Dali-KtxLoader-XXXXXX";
+  const int fd = mkstemp( path );
+  DALI_TEST_CHECK( fd >= 0 );
+  FILE* const fp = fdopen( fd, "wb" );
+  AutoCloseFile autoClose( fp );
+
+  fwrite( identifier, 1, sizeof(identifier), fp );
+  fwrite( fields, 1, sizeof(fields), fp );
+  fwrite( &imageByteCount, 1, sizeof(imageByteCount), fp );
+  for( unsigned int i = 0; i < KTX_IMAGE_BYTES; ++i )
+  {
+    fputc( i + 1, fp );
+  }
+
+  return path;
+}
+
+/**
+ * Check a bitmap holds the image bytes written by WriteKtxFile().
+ */
+void CheckKtxBitmap( Integration::Bitmap& bitmap, const char * const location )
+{
+  DALI_TEST_EQUALS( KTX_WIDTH, bitmap.GetImageWidth(), location );
+  DALI_TEST_EQUALS( KTX_HEIGHT, bitmap.GetImageHeight(), location );
+  DALI_TEST_EQUALS( Pixel::COMPRESSED_RGB8_ETC1, bitmap.GetPixelFormat(), location );
+  DALI_TEST_EQUALS( static_cast<std::size_t>( KTX_IMAGE_BYTES ), bitmap.GetBufferSize(), location );
+
+  unsigned int mismatches = 0u;
+  for( unsigned int i = 0; i < KTX_IMAGE_BYTES; ++i )
+  {
+    mismatches += bitmap.GetBuffer()[i] != i + 1;
+  }
+  DALI_TEST_EQUALS( 0u, mismatches, location );
+}
+
+} // namespace
+
+
+void ktx_loader_startup(void)
+{
+}
+
+void ktx_loader_cleanup(void)
+{
+}
+
+int UtcDaliKtxLoaderMappedFile(void)
+{
+  const std::string path = WriteKtxFile( KTX_IMAGE_BYTES );
+  {
+    MappedFilePtr mappedFile( new MappedFile( path.c_str() ) );
+    DALI_TEST_CHECK( mappedFile->IsMapped() );
+    DALI_TEST_EQUALS( static_cast<std::size_t>( KTX_HEADER_BYTES + 4u + KTX_IMAGE_BYTES ), mappedFile->GetSize(), TEST_LOCATION );
+
+    FileCloser fileCloser( *mappedFile, path.c_str(), "rb" );
+    DALI_TEST_CHECK( fileCloser.GetFile() != NULL );
+    const TizenPlatform::ImageLoader::Input input( fileCloser.GetFile(), TizenPlatform::ImageLoader::ScalingParameters(), true, mappedFile.Get() );
+
+    Integration::BitmapPtr bitmap = Integration::Bitmap::New( Integration::Bitmap::BITMAP_COMPRESSED, ResourcePolicy::OWNED_DISCARD );
+    DALI_TEST_CHECK( TizenPlatform::LoadBitmapFromKtx( StubKtxLoaderClient(), input, *bitmap ) );
+    CheckKtxBitmap( *bitmap, TEST_LOCATION );
+
+    // The image bytes are used where they lie in the mapping, which the bitmap keeps until it discards them:
+    DALI_TEST_CHECK( bitmap->GetBuffer() == mappedFile->GetData() + KTX_HEADER_BYTES + 4u );
+    DALI_TEST_EQUALS( 2, mappedFile->ReferenceCount(), TEST_LOCATION );
+    bitmap->DiscardBuffer();
+    DALI_TEST_CHECK( bitmap->GetBuffer() == NULL );
+    DALI_TEST_EQUALS( 1, mappedFile->ReferenceCount(), TEST_LOCATION );
+  }
+  unlink( path.c_str() );
+
+  END_TEST;
+}
+
+int UtcDaliKtxLoaderFile(void)
+{
+  const std::string path = WriteKtxFile( KTX_IMAGE_BYTES );
+  {
+    FILE* const fp = fopen( path.c_str(), "rb" );
+    AutoCloseFile autoClose( fp );
+    DALI_TEST_CHECK( fp != NULL );
+    const TizenPlatform::ImageLoader::Input input( fp );
+
+    Integration::BitmapPtr bitmap = Integration::Bitmap::New( Integration::Bitmap::BITMAP_COMPRESSED, ResourcePolicy::OWNED_DISCARD );
+    DALI_TEST_CHECK( TizenPlatform::LoadBitmapFromKtx( StubKtxLoaderClient(), input, *bitmap ) );
+    CheckKtxBitmap( *bitmap, TEST_LOCATION );
+  }
+  unlink( path.c_str() );
+
+  END_TEST;
+}
+
+int UtcDaliKtxLoaderMappedFileTruncated(void)
+{
+  // The image data claims to be twice as long as it is:
+  const std::string path = WriteKtxFile( KTX_IMAGE_BYTES * 2u );
+  {
+    MappedFilePtr mappedFile( new MappedFile( path.c_str() ) );
+    FileCloser fileCloser( *mappedFile, path.c_str(), "rb" );
+    const TizenPlatform::ImageLoader::Input input( fileCloser.GetFile(), TizenPlatform::ImageLoader::ScalingParameters(), true, mappedFile.Get() );
+
+    Integration::BitmapPtr bitmap = Integration::Bitmap::New( Integration::Bitmap::BITMAP_COMPRESSED, ResourcePolicy::OWNED_DISCARD );
+    DALI_TEST_CHECK( !TizenPlatform::LoadBitmapFromKtx( StubKtxLoaderClient(), input, *bitmap ) );
+    DALI_TEST_EQUALS( 1, mappedFile->ReferenceCount(), TEST_LOCATION );
+  }
+  unlink( path.c_str() );
+
+  END_TEST;
+}
+
+int UtcDaliMappedFileMissing(void)
+{
+  MappedFilePtr mappedFile( new MappedFile( "/tmp/utc-Dali-KtxLoader-does-not-exist.ktx" ) );
+  DALI_TEST_CHECK( !mappedFile->IsMapped() );
+  DALI_TEST_CHECK( mappedFile->GetData() == NULL );
+  DALI_TEST_EQUALS( static_cast<std::size_t>( 0u ), mappedFile->GetSize(), TEST_LOCATION );
+
+  // Reading falls back to stdio, which fails for a missing file too:
+  FileCloser fileCloser( *mappedFile, "/tmp/utc-Dali-KtxLoader-does-not-exist.ktx", "rb" );
+  DALI_TEST_CHECK( fileCloser.GetFile() == NULL );
+
+  END_TEST;
+}
@@ -33,6 +33,8 @@ void TestGlAbstraction::Initialize()
   mCompileStatus = GL_TRUE;
   mLinkStatus = GL_TRUE;
 
+  mIsInstancedDrawingSupported = false;
+  mIsVertexArrayObjectSupported = false;
   mGetAttribLocationResult = 0;
   mGetErrorResult = 0;
   mGetStringResult = NULL;
@@ -60,6 +62,7 @@ void TestGlAbstraction::Initialize()
 
   mLastShaderIdUsed = 0;
   mLastProgramIdUsed = 0;
+  mLastVertexArrayIdUsed = 0;
   mLastUniformIdUsed = 0;
   mLastShaderCompiled = 0;
   mLastClearBitMask = 0;
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "utc-image-loading-common.h"
+
+#include <algorithm>
+#include "platform-abstractions/portable/image-operations.h"
+
+void utc_image_loading_throughput_startup(void)
+{
+  utc_dali_loading_startup();
+}
+
+void utc_image_loading_throughput_cleanup(void)
+{
+  utc_dali_loading_cleanup();
+}
+
+namespace
+{
+
+/**
+ * Collect completed loads until the expected number have completed or the
+ * time allowed for known loads has passed.
+ */
+void DrainLoads( ResourceCollector& resourceSink, const unsigned expectedCompletions )
+{
+  const double startDrainTime = GetTimeMilliseconds( *gAbstraction );
+  gAbstraction->GetResources( resourceSink );
+  while( resourceSink.mGrandTotalCompletions < expectedCompletions && GetTimeMilliseconds( *gAbstraction ) - startDrainTime < MAX_MILLIS_TO_WAIT_FOR_KNOWN_LOADS )
+  {
+    usleep( 1000 );
+    gAbstraction->GetResources( resourceSink );
+  }
+}
+
+} // anon namespace
+
+/**
+ * @brief Benchmark of the number of images loaded per second.
+ *
+ * Loads lots and reports the rate they completed at, as the loads are spread
+ * over the worker threads of the resource loader.
+ */
+int UtcDaliLoadThroughput(void)
+{
+  tet_printf( "Running load throughput test.\n" );
+
+  DALI_ASSERT_ALWAYS( gAbstraction != 0 );
+
+  Dali::Integration::BitmapResourceType bitmapResourceType;
+  Dali::Integration::LoadResourcePriority priority = Dali::Integration::LoadPriorityNormal;
+  Dali::Internal::Platform::ResourceCollector resourceSink;
+  unsigned loadsLaunched = 0;
+
+  const double startTime = GetTimeMilliseconds( *gAbstraction );
+
+  for( unsigned loadGroup = 0; loadGroup < NUM_LOAD_GROUPS_TO_ISSUE; ++loadGroup )
+  {
+    for( unsigned validImage = 0; validImage < NUM_VALID_IMAGES; ++validImage )
+    {
+      Dali::Integration::ResourceRequest request( loadGroup * NUM_VALID_IMAGES + validImage + 1, bitmapResourceType, VALID_IMAGES[validImage], priority );
+      gAbstraction->LoadResource( request );
+    }
+    loadsLaunched += NUM_VALID_IMAGES;
+  }
+
+  DrainLoads( resourceSink, loadsLaunched );
+
+  const double elapsedMillis = std::max( GetTimeMilliseconds( *gAbstraction ) - startTime, 1.0 );
+  tet_printf( "Loaded %u images in %.1f ms: %.1f images per second.\n", resourceSink.mGrandTotalCompletions, elapsedMillis, resourceSink.mGrandTotalCompletions * 1000.0 / elapsedMillis );
+
+  DALI_TEST_CHECK( loadsLaunched == resourceSink.mGrandTotalCompletions );
+  DALI_TEST_CHECK( loadsLaunched == resourceSink.mSuccessCounts.size() );
+  DALI_TEST_CHECK( 0 == resourceSink.mFailureCounts.size() );
+
+  // Check that each success was reported exactly once, whichever thread loaded it:
+  for( ResourceCounterMap::const_iterator it = resourceSink.mSuccessCounts.begin(), end = resourceSink.mSuccessCounts.end(); it != end; ++it )
+  {
+    DALI_TEST_CHECK( it->second == 1u );
+  }
+
+  END_TEST;
+}
+
+/**
+ * @brief Test case for load priority.
+ *
+ * Queue lots of loads while the loader is suspended, followed by one of the
+ * highest priority, and be sure that load is not left until the end.
+ */
+int UtcDaliLoadPriorityOrder(void)
+{
+  tet_printf( "Running load priority order test.\n" );
+
+  DALI_ASSERT_ALWAYS( gAbstraction != 0 );
+
+  Dali::Integration::BitmapResourceType bitmapResourceType;
+  Dali::Internal::Platform::ResourceCollector resourceSink;
+
+  // The loader threads are created by the first load, so they can be suspended afterwards:
+  gAbstraction->LoadResource( ResourceRequest( 1, bitmapResourceType, VALID_IMAGES[0], LoadPriorityNormal ) );
+  DrainLoads( resourceSink, 1 );
+  DALI_TEST_CHECK( 1 == resourceSink.mGrandTotalCompletions );
+
+  gAbstraction->Suspend();
+
+  const unsigned numNormalLoads = NUM_VALID_IMAGES * 20;
+  for( unsigned load = 0; load < numNormalLoads; ++load )
+  {
+    gAbstraction->LoadResource( ResourceRequest( load + 2, bitmapResourceType, VALID_IMAGES[load % NUM_VALID_IMAGES], LoadPriorityNormal ) );
+  }
+  const ResourceId highestId = numNormalLoads + 2;
+  gAbstraction->LoadResource( ResourceRequest( highestId, bitmapResourceType, VALID_IMAGES[0], LoadPriorityHighest ) );
+  const unsigned loadsLaunched = numNormalLoads + 2;
+
+  gAbstraction->Resume();
+  DrainLoads( resourceSink, loadsLaunched );
+
+  DALI_TEST_CHECK( loadsLaunched == resourceSink.mGrandTotalCompletions );
+  DALI_TEST_CHECK( 0 == resourceSink.mFailureCounts.size() );
+
+  // The highest priority load was queued last but is taken first, so only the
+  // loads started alongside it on the other threads can complete before it:
+  const ResourceSequence& sequence = resourceSink.mCompletionSequence;
+  const unsigned highestPosition = std::find( sequence.begin(), sequence.end(), highestId ) - sequence.begin();
+  tet_printf( "Highest priority load completed at position %u of %u.\n", highestPosition, loadsLaunched );
+  DALI_TEST_CHECK( highestPosition < loadsLaunched / 2 );
+
+  END_TEST;
+}
+
+/**
+ * @brief Benchmark of the time taken to downscale a 4K image to a thumbnail.
+ *
+ * The test images decode to fewer pixels than the image operations split into
+ * bands, so a synthetic bitmap is scaled directly. This times the first box
+ * filter passes, which are spread over the band worker pool, plus the final
+ * linear sample.
+ */
+int UtcDaliLoadTimeToThumbnail(void)
+{
+  tet_printf( "Running time to thumbnail test.\n" );
+
+  DALI_ASSERT_ALWAYS( gAbstraction != 0 );
+
+  const unsigned int width = 3840u;
+  const unsigned int height = 2160u;
+  const unsigned numScalings = 10;
+
+  Integration::BitmapPtr source = Integration::Bitmap::New( Integration::Bitmap::BITMAP_2D_PACKED_PIXELS, ResourcePolicy::OWNED_RETAIN );
+  PixelBuffer* const pixels = source->GetPackedPixelsProfile()->ReserveBuffer( Pixel::RGBA8888, width, height, width, height );
+  for( unsigned int i = 0; i < width * height * 4u; ++i )
+  {
+    pixels[i] = static_cast<PixelBuffer>( i * 7u );
+  }
+
+  unsigned thumbnailsScaled = 0;
+  const double startTime = GetTimeMilliseconds( *gAbstraction );
+  for( unsigned scaling = 0; scaling < numScalings; ++scaling )
+  {
+    Integration::BitmapPtr thumbnail = DownscaleBitmap( *source, ImageDimensions( 200, 200 ), FittingMode::SHRINK_TO_FIT, SamplingMode::BOX_THEN_LINEAR );
+    if( thumbnail && thumbnail->GetImageWidth() <= 200u && thumbnail->GetImageHeight() <= 200u )
+    {
+      ++thumbnailsScaled;
+    }
+  }
+  const double elapsedMillis = std::max( GetTimeMilliseconds( *gAbstraction ) - startTime, 1.0 );
+  tet_printf( "%ux%u: %.2f ms to thumbnail.\n", width, height, elapsedMillis / numScalings );
+
+  DALI_TEST_CHECK( thumbnailsScaled == numScalings );
+
+  END_TEST;
+}
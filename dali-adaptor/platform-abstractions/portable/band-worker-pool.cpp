@@ -0,0 +1,281 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "band-worker-pool.h"
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <unistd.h>
+#include <dali/public-api/common/dali-common.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Platform
+{
+
+namespace
+{
+
+// The most threads a task is spread over; the scaling passes are limited by memory bandwidth beyond this
+const unsigned int MAX_THREADS = 8u;
+
+/**
+ * @return The number of worker threads to start: one less than the cores, as the calling thread works too.
+ */
+unsigned int GetWorkerCountForCores()
+{
+  const long cores = sysconf( _SC_NPROCESSORS_ONLN );
+  if( cores <= 1 )
+  {
+    return 0u;
+  }
+  return std::min( static_cast<unsigned int>( cores ), MAX_THREADS ) - 1u;
+}
+
+/**
+ * @brief Holds a mutex locked for its lifetime.
+ */
+class ScopedLock
+{
+public:
+  ScopedLock( pthread_mutex_t& mutex )
+  : mMutex( mutex )
+  {
+    pthread_mutex_lock( &mMutex );
+  }
+
+  ~ScopedLock()
+  {
+    pthread_mutex_unlock( &mMutex );
+  }
+
+private:
+  // Undefined
+  ScopedLock( const ScopedLock& );
+
+  // Undefined
+  ScopedLock& operator=( const ScopedLock& );
+
+  pthread_mutex_t& mMutex;
+};
+
+pthread_mutex_t gPoolMutex = PTHREAD_MUTEX_INITIALIZER; ///< Guards the creation and destruction of the pool
+BandWorkerPool* gPool = NULL;                            ///< The pool, created the first time a large image is scaled
+
+} // unnamed namespace
+
+BandWorkerPool::Job::Job( Task& bandTask, unsigned int rows, unsigned int bandRows )
+: task( bandTask ),
+  numRows( rows ),
+  rowsPerBand( bandRows ),
+  numBands( ( rows + bandRows - 1u ) / bandRows ),
+  nextBand( 0u ),
+  completedBands( 0u )
+{
+}
+
+BandWorkerPool& BandWorkerPool::Get()
+{
+  // Created by whichever loader thread gets here first
+  ScopedLock lock( gPoolMutex );
+  if( !gPool )
+  {
+    gPool = new BandWorkerPool( GetWorkerCountForCores() );
+  }
+  return *gPool;
+}
+
+void BandWorkerPool::Start( unsigned int workerCount )
+{
+  Shutdown();
+
+  ScopedLock lock( gPoolMutex );
+  gPool = new BandWorkerPool( workerCount );
+}
+
+void BandWorkerPool::Shutdown()
+{
+  BandWorkerPool* pool( NULL );
+  {
+    ScopedLock lock( gPoolMutex );
+    pool = gPool;
+    gPool = NULL;
+  }
+
+  // Joins the worker threads
+  delete pool;
+}
+
+BandWorkerPool::BandWorkerPool( unsigned int workerCount )
+: mWorkers(),
+  mJobs(),
+  mTerminating( false )
+{
+  // A condition variable for each thing waited for, as the workers and the threads waiting for their jobs wait at once
+  pthread_mutex_init( &mMutex, NULL );
+  pthread_cond_init( &mBandsQueued, NULL );
+  pthread_cond_init( &mBandsCompleted, NULL );
+
+  mWorkers.Resize( workerCount );
+  for( unsigned int i = 0; i < workerCount; ++i )
+  {
+    const int error = pthread_create( &mWorkers[i], NULL, WorkerEntryFunc, this );
+    DALI_ASSERT_ALWAYS( !error && "Error in pthread_create()" );
+  }
+}
+
+BandWorkerPool::~BandWorkerPool()
+{
+  {
+    ScopedLock lock( mMutex );
+    mTerminating = true;
+
+    // wake threads
+    pthread_cond_broadcast( &mBandsQueued );
+  }
+
+  // wait for threads to exit
+  for( Dali::Vector<pthread_t>::Iterator iter = mWorkers.Begin(), endIter = mWorkers.End(); iter != endIter; ++iter )
+  {
+    pthread_join( *iter, NULL );
+  }
+
+  pthread_cond_destroy( &mBandsCompleted );
+  pthread_cond_destroy( &mBandsQueued );
+  pthread_mutex_destroy( &mMutex );
+}
+
+unsigned int BandWorkerPool::GetThreadCount() const
+{
+  return mWorkers.Count() + 1u;
+}
+
+void BandWorkerPool::ProcessBands( Task& task, unsigned int numRows, unsigned int rowsPerBand )
+{
+  if( numRows == 0u )
+  {
+    return;
+  }
+  rowsPerBand = std::max( rowsPerBand, 1u );
+
+  Job job( task, numRows, rowsPerBand );
+  if( mWorkers.Empty() || job.numBands == 1u )
+  {
+    // The bands are still processed one by one, as callers rely on the output of each being in its own rows
+    for( unsigned int band = 0u; band < job.numBands; ++band )
+    {
+      const unsigned int firstRow = band * rowsPerBand;
+      task.ProcessBand( firstRow, std::min( firstRow + rowsPerBand, numRows ) );
+    }
+    return;
+  }
+
+  {
+    ScopedLock lock( mMutex );
+    mJobs.push_back( &job );
+
+    // Wake the workers to take bands of the job
+    pthread_cond_broadcast( &mBandsQueued );
+  }
+
+  // Work on the bands of this job until none are left to hand out, as this thread would only wait otherwise:
+  for( ;; )
+  {
+    unsigned int band = 0u;
+    {
+      ScopedLock lock( mMutex );
+      if( job.nextBand == job.numBands )
+      {
+        break;
+      }
+      band = job.nextBand++;
+      if( job.nextBand == job.numBands )
+      {
+        mJobs.erase( std::find( mJobs.begin(), mJobs.end(), &job ) );
+      }
+    }
+    ProcessBand( job, band );
+  }
+
+  // Wait for the bands still being processed by the workers
+  ScopedLock lock( mMutex );
+  while( job.completedBands < job.numBands )
+  {
+    pthread_cond_wait( &mBandsCompleted, &mMutex );
+  }
+}
+
+void BandWorkerPool::ProcessBand( Job& job, unsigned int band )
+{
+  const unsigned int firstRow = band * job.rowsPerBand;
+  const unsigned int endRow = std::min( firstRow + job.rowsPerBand, job.numRows );
+  job.task.ProcessBand( firstRow, endRow );
+
+  ScopedLock lock( mMutex );
+  ++job.completedBands;
+  if( job.completedBands == job.numBands )
+  {
+    // Wake the threads waiting for their jobs, as several may be waiting on the pool at once
+    pthread_cond_broadcast( &mBandsCompleted );
+  }
+}
+
+BandWorkerPool::Job& BandWorkerPool::TakeBand( unsigned int& band )
+{
+  Job& job = *mJobs.front();
+  band = job.nextBand++;
+  if( job.nextBand == job.numBands )
+  {
+    mJobs.pop_front();
+  }
+  return job;
+}
+
+void BandWorkerPool::WorkerLoop()
+{
+  for( ;; )
+  {
+    Job* job = NULL;
+    unsigned int band = 0u;
+    {
+      ScopedLock lock( mMutex );
+      while( mJobs.empty() && !mTerminating )
+      {
+        pthread_cond_wait( &mBandsQueued, &mMutex );
+      }
+      if( mTerminating )
+      {
+        return;
+      }
+      job = &TakeBand( band );
+    }
+    ProcessBand( *job, band );
+  }
+}
+
+void* BandWorkerPool::WorkerEntryFunc( void* pool )
+{
+  static_cast<BandWorkerPool*>( pool )->WorkerLoop();
+  return NULL;
+}
+
+} /* namespace Platform */
+} /* namespace Internal */
+} /* namespace Dali */
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef DALI_INTERNAL_PLATFORM_BAND_WORKER_POOL_H_
+#define DALI_INTERNAL_PLATFORM_BAND_WORKER_POOL_H_
+
+// EXTERNAL INCLUDES
+#include <pthread.h>
+#include <deque>
+#include <dali/public-api/common/dali-vector.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Platform
+{
+
+/**
+ * @brief A pool of threads shared by the image operations to process the rows
+ * of large images in horizontal bands in parallel.
+ *
+ * The thread which asks for a task to be done works on its bands too, so
+ * several loader threads can use the pool at once without waiting on each
+ * other's tasks.
+ */
+class BandWorkerPool
+{
+public:
+
+  /**
+   * @brief An operation on the rows of an image which can be done a band of rows at a time.
+   */
+  class Task
+  {
+  public:
+
+    /**
+     * @brief Process a band of rows.
+     *
+     * This is called on several threads at once for different bands, so it
+     * must only write the part of the output belonging to its own band.
+     * @param[in] firstRow The first row of the band.
+     * @param[in] endRow One past the last row of the band.
+     */
+    virtual void ProcessBand( unsigned int firstRow, unsigned int endRow ) = 0;
+
+  protected:
+
+    /**
+     * @brief Tasks are not deleted through this interface.
+     */
+    virtual ~Task() {}
+  };
+
+  /**
+   * @brief Get the pool, creating its threads the first time it is asked for.
+   */
+  static BandWorkerPool& Get();
+
+  /**
+   * @brief Create the pool with a given number of worker threads, replacing the current one.
+   *
+   * Otherwise the pool has a worker for each core but one, e.g. none on a
+   * single core machine; this lets tests choose.
+   * @pre No thread is using the pool.
+   * @param[in] workerCount The number of worker threads, which may be zero.
+   */
+  static void Start( unsigned int workerCount );
+
+  /**
+   * @brief Stop the threads of the pool, if it was created.
+   *
+   * This is called when the platform abstraction is destroyed, rather than
+   * leaving the threads to be joined by a static destructor at exit.
+   * @pre No thread is using the pool, e.g. the loader threads have stopped.
+   */
+  static void Shutdown();
+
+  /**
+   * @return The number of threads a task can be spread over, including the calling one.
+   */
+  unsigned int GetThreadCount() const;
+
+  /**
+   * @brief Do a task over a number of rows, in bands spread over the pool and the calling thread.
+   *
+   * Returns when all the bands have been processed.
+   * @param[in] task The task to do.
+   * @param[in] numRows The number of rows to process.
+   * @param[in] rowsPerBand The number of rows in each band but the last.
+   */
+  void ProcessBands( Task& task, unsigned int numRows, unsigned int rowsPerBand );
+
+private:
+
+  /**
+   * @brief The progress of a task through its bands.
+   */
+  struct Job
+  {
+    Job( Task& task, unsigned int numRows, unsigned int rowsPerBand );
+
+    Task& task;
+    const unsigned int numRows;
+    const unsigned int rowsPerBand;
+    const unsigned int numBands;
+    unsigned int nextBand;        ///< The next band to hand out
+    unsigned int completedBands;  ///< The number of bands processed
+  };
+
+  typedef std::deque<Job*> JobQueue;
+
+  /**
+   * @brief Constructor, which starts the worker threads.
+   * @param[in] workerCount The number of threads to start.
+   */
+  BandWorkerPool( unsigned int workerCount );
+
+  /**
+   * @brief Destructor, which stops the worker threads.
+   */
+  ~BandWorkerPool();
+
+  /**
+   * @brief Process the band of a job handed out to this thread, and record its completion.
+   * @param[in] job The job.
+   * @param[in] band The band of the job.
+   */
+  void ProcessBand( Job& job, unsigned int band );
+
+  /**
+   * @brief Hand out the next band of the job at the front of the queue, removing the job once all its bands are handed out.
+   * @pre The caller holds mMutex and the queue is not empty.
+   * @param[out] band The band handed out.
+   * @return The job the band belongs to.
+   */
+  Job& TakeBand( unsigned int& band );
+
+  /**
+   * @brief The loop of the worker threads, which process bands until the pool is destroyed.
+   */
+  void WorkerLoop();
+
+  /**
+   * @brief The entry function of the worker threads.
+   * @param[in] pool The pool.
+   */
+  static void* WorkerEntryFunc( void* pool );
+
+  // Undefined
+  BandWorkerPool( const BandWorkerPool& );
+
+  // Undefined
+  BandWorkerPool& operator=( const BandWorkerPool& );
+
+private:
+
+  Dali::Vector<pthread_t> mWorkers;         ///< The worker threads
+  JobQueue                mJobs;            ///< The jobs with bands not handed out yet
+  pthread_mutex_t         mMutex;           ///< Guards the jobs and their progress
+  pthread_cond_t          mBandsQueued;     ///< Signalled when a job is queued, or the pool is destroyed
+  pthread_cond_t          mBandsCompleted;  ///< Signalled when the last band of a job is completed
+  bool                    mTerminating;
+};
+
+} /* namespace Platform */
+} /* namespace Internal */
+} /* namespace Dali */
+
+#endif /* DALI_INTERNAL_PLATFORM_BAND_WORKER_POOL_H_ */
@@ -18,6 +18,7 @@
  */
 
 // INTERNAL INCLUDES
+#include "mapped-file.h"
 
 // EXTERNAL INCLUDES
 #include <cstdio>
@@ -67,6 +68,24 @@ public:
     }
   }
 
+  /**
+   * @brief Construct a FileCloser guarding a FILE* for reading out of a file mapped into memory,
+   * or for reading the file with stdio if it could not be mapped.
+   * @param[in] mappedFile The file mapped into memory, which must outlive the FileCloser.
+   * @param[in] filename The path the file was mapped from.
+   * @param[in] mode The mode to open the file in, which must be for reading.
+   */
+  FileCloser( const MappedFile& mappedFile, const char * const filename, const char * const mode ) :
+    mFile( mappedFile.IsMapped() ? fmemopen( const_cast<uint8_t*>( mappedFile.GetData() ), mappedFile.GetSize(), mode ) : fopen( filename, mode ) )
+  {
+    DALI_ASSERT_DEBUG( mode != 0 && mode[0] == 'r' && "Mapped files are read-only." );
+
+    if( mFile == 0 )
+    {
+      DALI_LOG_WARNING( "File open failed for: \"%s\" in mode: \"%s\".\n", filename, mode );
+    }
+  }
+
    /**
     * @brief Destroy the FileCloser and clean up its FILE*.
     */
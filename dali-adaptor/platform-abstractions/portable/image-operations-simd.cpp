@@ -0,0 +1,704 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "image-operations-simd.h"
+
+// EXTERNAL INCLUDES
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+
+// AVX2 kernels are compiled with a function attribute and only run if the CPU supports them:
+#if defined(__GNUC__) && ( __GNUC__ > 4 || ( __GNUC__ == 4 && __GNUC_MINOR__ >= 9 ) )
+#include <immintrin.h>
+#define DALI_IMAGE_OPERATIONS_AVX2
+#define DALI_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+// NEON kernels are used when the build targets NEON, as the ARM toolchains cannot enable it per function:
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#define DALI_IMAGE_OPERATIONS_NEON
+#endif
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Platform
+{
+
+namespace
+{
+
+// Scalar kernels, which leave all the work to the scalar loops:
+
+unsigned int AverageBytesScalar( const uint8_t*, const uint8_t*, uint8_t*, unsigned int )
+{
+  return 0u;
+}
+
+unsigned int AveragePixelsRGB565Scalar( const uint16_t*, const uint16_t*, uint16_t*, unsigned int )
+{
+  return 0u;
+}
+
+unsigned int HalveScanlineScalar( uint8_t*, unsigned int )
+{
+  return 0u;
+}
+
+unsigned int PointSampleScanline4BPPScalar( const uint32_t*, uint32_t*, unsigned int, unsigned int )
+{
+  return 0u;
+}
+
+unsigned int LinearSampleScanline4BPPScalar( const uint8_t*, const uint8_t*, uint8_t*, unsigned int, unsigned int, unsigned int, unsigned int )
+{
+  return 0u;
+}
+
+const ScanlineKernels SCALAR_KERNELS =
+{
+  AverageBytesScalar,
+  AveragePixelsRGB565Scalar,
+  HalveScanlineScalar,
+  HalveScanlineScalar,
+  HalveScanlineScalar,
+  HalveScanlineScalar,
+  HalveScanlineScalar,
+  PointSampleScanline4BPPScalar,
+  LinearSampleScanline4BPPScalar
+};
+
+#if defined(__SSE2__)
+
+/**
+ * @brief Average 16 pairs of bytes, rounding down like AverageComponent().
+ *
+ * _mm_avg_epu8 rounds up, so the carry of the odd sums is taken off.
+ */
+inline __m128i AverageBytesRoundDownSSE2( __m128i a, __m128i b )
+{
+  return _mm_sub_epi8( _mm_avg_epu8( a, b ), _mm_and_si128( _mm_xor_si128( a, b ), _mm_set1_epi8( 1 ) ) );
+}
+
+/**
+ * @brief Average one bit-field of packed pixels in lanes of up to 16 bits, rounding down.
+ *
+ * (a & b) + ((a ^ b) >> 1) is (a + b) >> 1 without the carry out of 16 bits.
+ */
+inline __m128i AverageFieldSSE2( __m128i a, __m128i b, __m128i mask )
+{
+  const __m128i fieldA = _mm_and_si128( a, mask );
+  const __m128i fieldB = _mm_and_si128( b, mask );
+  const __m128i average = _mm_add_epi16( _mm_and_si128( fieldA, fieldB ), _mm_srli_epi16( _mm_xor_si128( fieldA, fieldB ), 1 ) );
+  return _mm_and_si128( average, mask );
+}
+
+/** @brief Average RGB565 pixels in lanes of up to 16 bits like AveragePixelRGB565(). */
+inline __m128i AveragePixelsRGB565SSE2( __m128i a, __m128i b )
+{
+  return _mm_or_si128( _mm_or_si128( AverageFieldSSE2( a, b, _mm_set1_epi16( 0xf800 ) ),
+                                     AverageFieldSSE2( a, b, _mm_set1_epi16( 0x7e0 ) ) ),
+                                     AverageFieldSSE2( a, b, _mm_set1_epi16( 0x1f ) ) );
+}
+
+/**
+ * @brief Pack the low 16 bits of the 32 bit lanes of two vectors into one.
+ *
+ * _mm_packs_epi32 saturates signed values, so the lanes are biased into its range and back.
+ */
+inline __m128i PackLowHalvesSSE2( __m128i a, __m128i b )
+{
+  const __m128i bias = _mm_set1_epi32( 0x8000 );
+  const __m128i packed = _mm_packs_epi32( _mm_sub_epi32( a, bias ), _mm_sub_epi32( b, bias ) );
+  return _mm_xor_si128( packed, _mm_set1_epi16( static_cast<short>( 0x8000 ) ) );
+}
+
+unsigned int AverageBytesSSE2( const uint8_t* in1, const uint8_t* in2, uint8_t* out, unsigned int count )
+{
+  unsigned int i = 0;
+  for( ; i + 16u <= count; i += 16u )
+  {
+    const __m128i a = _mm_loadu_si128( reinterpret_cast<const __m128i*>( in1 + i ) );
+    const __m128i b = _mm_loadu_si128( reinterpret_cast<const __m128i*>( in2 + i ) );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( out + i ), AverageBytesRoundDownSSE2( a, b ) );
+  }
+  return i;
+}
+
+unsigned int AveragePixelsRGB565SSE2( const uint16_t* in1, const uint16_t* in2, uint16_t* out, unsigned int count )
+{
+  unsigned int i = 0;
+  for( ; i + 8u <= count; i += 8u )
+  {
+    const __m128i a = _mm_loadu_si128( reinterpret_cast<const __m128i*>( in1 + i ) );
+    const __m128i b = _mm_loadu_si128( reinterpret_cast<const __m128i*>( in2 + i ) );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( out + i ), AveragePixelsRGB565SSE2( a, b ) );
+  }
+  return i;
+}
+
+unsigned int HalveScanline1ByteSSE2( uint8_t* pixels, unsigned int width )
+{
+  const __m128i lowBytes = _mm_set1_epi16( 0xff );
+  unsigned int outPixel = 0;
+  for( ; ( outPixel + 16u ) * 2u <= width; outPixel += 16u )
+  {
+    const __m128i in1 = _mm_loadu_si128( reinterpret_cast<const __m128i*>( pixels + outPixel * 2u ) );
+    const __m128i in2 = _mm_loadu_si128( reinterpret_cast<const __m128i*>( pixels + outPixel * 2u + 16u ) );
+
+    // Average the even and odd bytes in 16 bit lanes:
+    const __m128i average1 = _mm_srli_epi16( _mm_add_epi16( _mm_and_si128( in1, lowBytes ), _mm_srli_epi16( in1, 8 ) ), 1 );
+    const __m128i average2 = _mm_srli_epi16( _mm_add_epi16( _mm_and_si128( in2, lowBytes ), _mm_srli_epi16( in2, 8 ) ), 1 );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( pixels + outPixel ), _mm_packus_epi16( average1, average2 ) );
+  }
+  return outPixel;
+}
+
+unsigned int HalveScanline2BytesSSE2( uint8_t* pixels, unsigned int width )
+{
+  const __m128i lowHalves = _mm_set1_epi32( 0xffff );
+  unsigned int outPixel = 0;
+  for( ; ( outPixel + 8u ) * 2u <= width; outPixel += 8u )
+  {
+    const __m128i in1 = _mm_loadu_si128( reinterpret_cast<const __m128i*>( pixels + outPixel * 4u ) );
+    const __m128i in2 = _mm_loadu_si128( reinterpret_cast<const __m128i*>( pixels + outPixel * 4u + 16u ) );
+
+    // Each pair of pixels is a 32 bit lane:
+    const __m128i average1 = AverageBytesRoundDownSSE2( _mm_and_si128( in1, lowHalves ), _mm_srli_epi32( in1, 16 ) );
+    const __m128i average2 = AverageBytesRoundDownSSE2( _mm_and_si128( in2, lowHalves ), _mm_srli_epi32( in2, 16 ) );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( pixels + outPixel * 2u ), PackLowHalvesSSE2( average1, average2 ) );
+  }
+  return outPixel;
+}
+
+unsigned int HalveScanlineRGB888SSE2( uint8_t* pixels, unsigned int width )
+{
+  const __m128i firstPixel = _mm_setr_epi8( -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 );
+  const __m128i thirdPixel = _mm_setr_epi8( 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0 );
+  unsigned int outPixel = 0;
+
+  // Two pairs of pixels at a time, as long as a whole vector can be loaded:
+  for( ; outPixel * 6u + 16u <= width * 3u; outPixel += 2u )
+  {
+    const __m128i in = _mm_loadu_si128( reinterpret_cast<const __m128i*>( pixels + outPixel * 6u ) );
+    const __m128i average = AverageBytesRoundDownSSE2( in, _mm_srli_si128( in, 3 ) );
+    const __m128i packed = _mm_or_si128( _mm_and_si128( average, firstPixel ), _mm_srli_si128( _mm_and_si128( average, thirdPixel ), 3 ) );
+
+    // Store exactly the 6 bytes of the two output pixels:
+    const uint32_t firstBytes = _mm_cvtsi128_si32( packed );
+    const uint16_t lastBytes = _mm_extract_epi16( packed, 2 );
+    memcpy( pixels + outPixel * 3u, &firstBytes, sizeof( firstBytes ) );
+    memcpy( pixels + outPixel * 3u + 4u, &lastBytes, sizeof( lastBytes ) );
+  }
+  return outPixel;
+}
+
+unsigned int HalveScanlineRGBA8888SSE2( uint8_t* pixels, unsigned int width )
+{
+  unsigned int outPixel = 0;
+  for( ; ( outPixel + 4u ) * 2u <= width; outPixel += 4u )
+  {
+    const __m128 in1 = _mm_castsi128_ps( _mm_loadu_si128( reinterpret_cast<const __m128i*>( pixels + outPixel * 8u ) ) );
+    const __m128 in2 = _mm_castsi128_ps( _mm_loadu_si128( reinterpret_cast<const __m128i*>( pixels + outPixel * 8u + 16u ) ) );
+    const __m128i even = _mm_castps_si128( _mm_shuffle_ps( in1, in2, _MM_SHUFFLE( 2, 0, 2, 0 ) ) );
+    const __m128i odd = _mm_castps_si128( _mm_shuffle_ps( in1, in2, _MM_SHUFFLE( 3, 1, 3, 1 ) ) );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( pixels + outPixel * 4u ), AverageBytesRoundDownSSE2( even, odd ) );
+  }
+  return outPixel;
+}
+
+unsigned int HalveScanlineRGB565SSE2( uint8_t* pixels, unsigned int width )
+{
+  const __m128i lowHalves = _mm_set1_epi32( 0xffff );
+  unsigned int outPixel = 0;
+  for( ; ( outPixel + 8u ) * 2u <= width; outPixel += 8u )
+  {
+    const __m128i in1 = _mm_loadu_si128( reinterpret_cast<const __m128i*>( pixels + outPixel * 4u ) );
+    const __m128i in2 = _mm_loadu_si128( reinterpret_cast<const __m128i*>( pixels + outPixel * 4u + 16u ) );
+    const __m128i average1 = AveragePixelsRGB565SSE2( _mm_and_si128( in1, lowHalves ), _mm_srli_epi32( in1, 16 ) );
+    const __m128i average2 = AveragePixelsRGB565SSE2( _mm_and_si128( in2, lowHalves ), _mm_srli_epi32( in2, 16 ) );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( pixels + outPixel * 2u ), PackLowHalvesSSE2( average1, average2 ) );
+  }
+  return outPixel;
+}
+
+/**
+ * @brief Blend the components of two pixels horizontally like WeightedBlendIntToFixed1616().
+ * @param[in] left, right The components of two pixels in 16 bit lanes.
+ * @param[out] blended1, blended2 The 16.16 fixed-point blends of the components of each pixel.
+ */
+inline void HorizontalBlendSSE2( __m128i left, __m128i right, __m128i leftWeights, __m128i rightWeights, __m128i& blended1, __m128i& blended2 )
+{
+  // The full 32 bit products of the 16 bit lanes:
+  const __m128i leftLow = _mm_mullo_epi16( left, leftWeights );
+  const __m128i leftHigh = _mm_mulhi_epu16( left, leftWeights );
+  const __m128i rightLow = _mm_mullo_epi16( right, rightWeights );
+  const __m128i rightHigh = _mm_mulhi_epu16( right, rightWeights );
+
+  blended1 = _mm_add_epi32( _mm_unpacklo_epi16( leftLow, leftHigh ), _mm_unpacklo_epi16( rightLow, rightHigh ) );
+  blended2 = _mm_add_epi32( _mm_unpackhi_epi16( leftLow, leftHigh ), _mm_unpackhi_epi16( rightLow, rightHigh ) );
+}
+
+/**
+ * @brief Blend the 16.16 fixed-point components of a pixel vertically like WeightedBlendFixed1616ToFixed1632(), and round them.
+ */
+inline __m128i VerticalBlendSSE2( __m128i top, __m128i bottom, __m128i topWeight, __m128i bottomWeight )
+{
+  const __m128i rounding = _mm_set_epi32( 0, 0x80000000, 0, 0x80000000 );
+
+  // Components 0 and 2, then 1 and 3, blended in 64 bits:
+  const __m128i even = _mm_add_epi64( _mm_add_epi64( _mm_mul_epu32( top, topWeight ), _mm_mul_epu32( bottom, bottomWeight ) ), rounding );
+  const __m128i odd = _mm_add_epi64( _mm_add_epi64( _mm_mul_epu32( _mm_srli_epi64( top, 32 ), topWeight ),
+                                                    _mm_mul_epu32( _mm_srli_epi64( bottom, 32 ), bottomWeight ) ), rounding );
+
+  // The integer parts back in 32 bit lanes:
+  return _mm_or_si128( _mm_srli_epi64( even, 32 ), _mm_and_si128( odd, _mm_set_epi32( -1, 0, -1, 0 ) ) );
+}
+
+unsigned int LinearSampleScanline4BPPSSE2( const uint8_t* inScanline1, const uint8_t* inScanline2, uint8_t* outScanline, unsigned int desiredWidth, unsigned int deltaX, unsigned int inputWidth, unsigned int yWeight )
+{
+  const uint32_t* const in1 = reinterpret_cast<const uint32_t*>( inScanline1 );
+  const uint32_t* const in2 = reinterpret_cast<const uint32_t*>( inScanline2 );
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i topWeight = _mm_set1_epi32( 65535u - yWeight );
+  const __m128i bottomWeight = _mm_set1_epi32( yWeight );
+
+  // Two output pixels at a time:
+  unsigned int outX = 0;
+  unsigned int inX = 0;
+  for( ; outX + 2u <= desiredWidth; outX += 2u )
+  {
+    // The taps are found exactly as LinearSampleGeneric() finds them:
+    const unsigned int integerX1a = inX >> 16u;
+    const unsigned int integerX2a = integerX1a >= inputWidth ? integerX1a : integerX1a + 1;
+    const unsigned int weightA = inX & 65535u;
+    inX += deltaX;
+    const unsigned int integerX1b = inX >> 16u;
+    const unsigned int integerX2b = integerX1b >= inputWidth ? integerX1b : integerX1b + 1;
+    const unsigned int weightB = inX & 65535u;
+    inX += deltaX;
+
+    const __m128i topLeft     = _mm_unpacklo_epi8( _mm_unpacklo_epi32( _mm_cvtsi32_si128( in1[integerX1a] ), _mm_cvtsi32_si128( in1[integerX1b] ) ), zero );
+    const __m128i topRight    = _mm_unpacklo_epi8( _mm_unpacklo_epi32( _mm_cvtsi32_si128( in1[integerX2a] ), _mm_cvtsi32_si128( in1[integerX2b] ) ), zero );
+    const __m128i bottomLeft  = _mm_unpacklo_epi8( _mm_unpacklo_epi32( _mm_cvtsi32_si128( in2[integerX1a] ), _mm_cvtsi32_si128( in2[integerX1b] ) ), zero );
+    const __m128i bottomRight = _mm_unpacklo_epi8( _mm_unpacklo_epi32( _mm_cvtsi32_si128( in2[integerX2a] ), _mm_cvtsi32_si128( in2[integerX2b] ) ), zero );
+
+    const short a = static_cast<short>( weightA );
+    const short b = static_cast<short>( weightB );
+    const short inverseA = static_cast<short>( 65535u - weightA );
+    const short inverseB = static_cast<short>( 65535u - weightB );
+    const __m128i rightWeights = _mm_setr_epi16( a, a, a, a, b, b, b, b );
+    const __m128i leftWeights = _mm_setr_epi16( inverseA, inverseA, inverseA, inverseA, inverseB, inverseB, inverseB, inverseB );
+
+    __m128i top1, top2, bottom1, bottom2;
+    HorizontalBlendSSE2( topLeft, topRight, leftWeights, rightWeights, top1, top2 );
+    HorizontalBlendSSE2( bottomLeft, bottomRight, leftWeights, rightWeights, bottom1, bottom2 );
+
+    const __m128i pixel1 = VerticalBlendSSE2( top1, bottom1, topWeight, bottomWeight );
+    const __m128i pixel2 = VerticalBlendSSE2( top2, bottom2, topWeight, bottomWeight );
+    const __m128i packed = _mm_packus_epi16( _mm_packs_epi32( pixel1, pixel2 ), zero );
+    _mm_storel_epi64( reinterpret_cast<__m128i*>( outScanline + outX * 4u ), packed );
+  }
+  return outX;
+}
+
+const ScanlineKernels SSE2_KERNELS =
+{
+  AverageBytesSSE2,
+  AveragePixelsRGB565SSE2,
+  HalveScanline1ByteSSE2,
+  HalveScanline2BytesSSE2,
+  HalveScanlineRGB888SSE2,
+  HalveScanlineRGBA8888SSE2,
+  HalveScanlineRGB565SSE2,
+  PointSampleScanline4BPPScalar, // No gather before AVX2
+  LinearSampleScanline4BPPSSE2
+};
+
+#endif // __SSE2__
+
+#if defined(DALI_IMAGE_OPERATIONS_AVX2)
+
+/** @copydoc AverageBytesRoundDownSSE2 */
+DALI_TARGET_AVX2 inline __m256i AverageBytesRoundDownAVX2( __m256i a, __m256i b )
+{
+  return _mm256_sub_epi8( _mm256_avg_epu8( a, b ), _mm256_and_si256( _mm256_xor_si256( a, b ), _mm256_set1_epi8( 1 ) ) );
+}
+
+DALI_TARGET_AVX2 unsigned int AverageBytesAVX2( const uint8_t* in1, const uint8_t* in2, uint8_t* out, unsigned int count )
+{
+  unsigned int i = 0;
+  for( ; i + 32u <= count; i += 32u )
+  {
+    const __m256i a = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( in1 + i ) );
+    const __m256i b = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( in2 + i ) );
+    _mm256_storeu_si256( reinterpret_cast<__m256i*>( out + i ), AverageBytesRoundDownAVX2( a, b ) );
+  }
+
+  // The SSE2 kernel takes the next 16 bytes, if there are enough:
+  return i + AverageBytesSSE2( in1 + i, in2 + i, out + i, count - i );
+}
+
+DALI_TARGET_AVX2 unsigned int HalveScanlineRGBA8888AVX2( uint8_t* pixels, unsigned int width )
+{
+  unsigned int outPixel = 0;
+  for( ; ( outPixel + 8u ) * 2u <= width; outPixel += 8u )
+  {
+    const __m256 in1 = _mm256_castsi256_ps( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( pixels + outPixel * 8u ) ) );
+    const __m256 in2 = _mm256_castsi256_ps( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( pixels + outPixel * 8u + 32u ) ) );
+
+    // The shuffles work within 128 bit lanes, so the averaged pixels are put back in order after:
+    const __m256i even = _mm256_castps_si256( _mm256_shuffle_ps( in1, in2, _MM_SHUFFLE( 2, 0, 2, 0 ) ) );
+    const __m256i odd = _mm256_castps_si256( _mm256_shuffle_ps( in1, in2, _MM_SHUFFLE( 3, 1, 3, 1 ) ) );
+    const __m256i average = _mm256_permute4x64_epi64( AverageBytesRoundDownAVX2( even, odd ), _MM_SHUFFLE( 3, 1, 2, 0 ) );
+    _mm256_storeu_si256( reinterpret_cast<__m256i*>( pixels + outPixel * 4u ), average );
+  }
+  return outPixel;
+}
+
+DALI_TARGET_AVX2 unsigned int PointSampleScanline4BPPAVX2( const uint32_t* inScanline, uint32_t* outScanline, unsigned int desiredWidth, unsigned int deltaX )
+{
+  const __m256i laneOffsets = _mm256_mullo_epi32( _mm256_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7 ), _mm256_set1_epi32( deltaX ) );
+  const __m256i half = _mm256_set1_epi32( 1 << 15 );
+  unsigned int outX = 0;
+  for( ; outX + 8u <= desiredWidth; outX += 8u )
+  {
+    // Round the fixed-point x coordinates to the nearest input pixels, as PointSampleAddressablePixels() does:
+    const __m256i inX = _mm256_add_epi32( _mm256_set1_epi32( outX * deltaX ), laneOffsets );
+    const __m256i integerX = _mm256_srli_epi32( _mm256_add_epi32( inX, half ), 16 );
+    const __m256i sampled = _mm256_i32gather_epi32( reinterpret_cast<const int*>( inScanline ), integerX, 4 );
+    _mm256_storeu_si256( reinterpret_cast<__m256i*>( outScanline + outX ), sampled );
+  }
+  return outX;
+}
+
+const ScanlineKernels AVX2_KERNELS =
+{
+  AverageBytesAVX2,
+  AveragePixelsRGB565SSE2,
+  HalveScanline1ByteSSE2,
+  HalveScanline2BytesSSE2,
+  HalveScanlineRGB888SSE2,
+  HalveScanlineRGBA8888AVX2,
+  HalveScanlineRGB565SSE2,
+  PointSampleScanline4BPPAVX2,
+  LinearSampleScanline4BPPSSE2
+};
+
+#endif // DALI_IMAGE_OPERATIONS_AVX2
+
+#if defined(DALI_IMAGE_OPERATIONS_NEON)
+
+/** @brief Average one bit-field of RGB565 pixels, rounding down. */
+inline uint16x8_t AverageFieldNEON( uint16x8_t a, uint16x8_t b, uint16x8_t mask )
+{
+  return vandq_u16( vhaddq_u16( vandq_u16( a, mask ), vandq_u16( b, mask ) ), mask );
+}
+
+/** @brief Average RGB565 pixels like AveragePixelRGB565(). */
+inline uint16x8_t AveragePixelsRGB565NEON( uint16x8_t a, uint16x8_t b )
+{
+  return vorrq_u16( vorrq_u16( AverageFieldNEON( a, b, vdupq_n_u16( 0xf800 ) ),
+                               AverageFieldNEON( a, b, vdupq_n_u16( 0x7e0 ) ) ),
+                               AverageFieldNEON( a, b, vdupq_n_u16( 0x1f ) ) );
+}
+
+/** @brief Average the pairs of neighbouring bytes of a vector, rounding down. */
+inline uint8x8_t AveragePairsNEON( uint8x16_t bytes )
+{
+  return vshrn_n_u16( vpaddlq_u8( bytes ), 1 );
+}
+
+unsigned int AverageBytesNEON( const uint8_t* in1, const uint8_t* in2, uint8_t* out, unsigned int count )
+{
+  unsigned int i = 0;
+  for( ; i + 16u <= count; i += 16u )
+  {
+    // The halving add rounds down like AverageComponent():
+    vst1q_u8( out + i, vhaddq_u8( vld1q_u8( in1 + i ), vld1q_u8( in2 + i ) ) );
+  }
+  return i;
+}
+
+unsigned int AveragePixelsRGB565NEON( const uint16_t* in1, const uint16_t* in2, uint16_t* out, unsigned int count )
+{
+  unsigned int i = 0;
+  for( ; i + 8u <= count; i += 8u )
+  {
+    vst1q_u16( out + i, AveragePixelsRGB565NEON( vld1q_u16( in1 + i ), vld1q_u16( in2 + i ) ) );
+  }
+  return i;
+}
+
+unsigned int HalveScanline1ByteNEON( uint8_t* pixels, unsigned int width )
+{
+  unsigned int outPixel = 0;
+  for( ; ( outPixel + 16u ) * 2u <= width; outPixel += 16u )
+  {
+    const uint8x16x2_t in = vld2q_u8( pixels + outPixel * 2u );
+    vst1q_u8( pixels + outPixel, vhaddq_u8( in.val[0], in.val[1] ) );
+  }
+  return outPixel;
+}
+
+unsigned int HalveScanline2BytesNEON( uint8_t* pixels, unsigned int width )
+{
+  unsigned int outPixel = 0;
+  for( ; ( outPixel + 16u ) * 2u <= width; outPixel += 16u )
+  {
+    // The components of the even and odd pixels:
+    const uint8x16x4_t in = vld4q_u8( pixels + outPixel * 4u );
+    uint8x16x2_t out;
+    out.val[0] = vhaddq_u8( in.val[0], in.val[2] );
+    out.val[1] = vhaddq_u8( in.val[1], in.val[3] );
+    vst2q_u8( pixels + outPixel * 2u, out );
+  }
+  return outPixel;
+}
+
+unsigned int HalveScanlineRGB888NEON( uint8_t* pixels, unsigned int width )
+{
+  unsigned int outPixel = 0;
+  for( ; ( outPixel + 8u ) * 2u <= width; outPixel += 8u )
+  {
+    const uint8x16x3_t in = vld3q_u8( pixels + outPixel * 6u );
+    uint8x8x3_t out;
+    out.val[0] = AveragePairsNEON( in.val[0] );
+    out.val[1] = AveragePairsNEON( in.val[1] );
+    out.val[2] = AveragePairsNEON( in.val[2] );
+    vst3_u8( pixels + outPixel * 3u, out );
+  }
+  return outPixel;
+}
+
+unsigned int HalveScanlineRGBA8888NEON( uint8_t* pixels, unsigned int width )
+{
+  unsigned int outPixel = 0;
+  for( ; ( outPixel + 8u ) * 2u <= width; outPixel += 8u )
+  {
+    const uint8x16x4_t in = vld4q_u8( pixels + outPixel * 8u );
+    uint8x8x4_t out;
+    out.val[0] = AveragePairsNEON( in.val[0] );
+    out.val[1] = AveragePairsNEON( in.val[1] );
+    out.val[2] = AveragePairsNEON( in.val[2] );
+    out.val[3] = AveragePairsNEON( in.val[3] );
+    vst4_u8( pixels + outPixel * 4u, out );
+  }
+  return outPixel;
+}
+
+unsigned int HalveScanlineRGB565NEON( uint8_t* pixels, unsigned int width )
+{
+  uint16_t* const alignedPixels = reinterpret_cast<uint16_t*>( pixels );
+  unsigned int outPixel = 0;
+  for( ; ( outPixel + 8u ) * 2u <= width; outPixel += 8u )
+  {
+    const uint16x8x2_t in = vld2q_u16( alignedPixels + outPixel * 2u );
+    vst1q_u16( alignedPixels + outPixel, AveragePixelsRGB565NEON( in.val[0], in.val[1] ) );
+  }
+  return outPixel;
+}
+
+/**
+ * @brief Blend the components of a pixel vertically like WeightedBlendFixed1616ToFixed1632(), and round them.
+ */
+inline uint32x4_t VerticalBlendNEON( uint32x4_t top, uint32x4_t bottom, uint32x2_t topWeight, uint32x2_t bottomWeight )
+{
+  const uint64x2_t rounding = vdupq_n_u64( 1u << 31u );
+  const uint64x2_t low = vaddq_u64( vmlal_u32( vmull_u32( vget_low_u32( top ), topWeight ), vget_low_u32( bottom ), bottomWeight ), rounding );
+  const uint64x2_t high = vaddq_u64( vmlal_u32( vmull_u32( vget_high_u32( top ), topWeight ), vget_high_u32( bottom ), bottomWeight ), rounding );
+  return vcombine_u32( vshrn_n_u64( low, 32 ), vshrn_n_u64( high, 32 ) );
+}
+
+unsigned int LinearSampleScanline4BPPNEON( const uint8_t* inScanline1, const uint8_t* inScanline2, uint8_t* outScanline, unsigned int desiredWidth, unsigned int deltaX, unsigned int inputWidth, unsigned int yWeight )
+{
+  const uint32_t* const in1 = reinterpret_cast<const uint32_t*>( inScanline1 );
+  const uint32_t* const in2 = reinterpret_cast<const uint32_t*>( inScanline2 );
+  const uint32x2_t topWeight = vdup_n_u32( 65535u - yWeight );
+  const uint32x2_t bottomWeight = vdup_n_u32( yWeight );
+
+  // Two output pixels at a time:
+  unsigned int outX = 0;
+  unsigned int inX = 0;
+  for( ; outX + 2u <= desiredWidth; outX += 2u )
+  {
+    // The taps are found exactly as LinearSampleGeneric() finds them:
+    const unsigned int integerX1a = inX >> 16u;
+    const unsigned int integerX2a = integerX1a >= inputWidth ? integerX1a : integerX1a + 1;
+    const unsigned int weightA = inX & 65535u;
+    inX += deltaX;
+    const unsigned int integerX1b = inX >> 16u;
+    const unsigned int integerX2b = integerX1b >= inputWidth ? integerX1b : integerX1b + 1;
+    const unsigned int weightB = inX & 65535u;
+    inX += deltaX;
+
+    const uint16x8_t topLeft     = vmovl_u8( vreinterpret_u8_u32( vset_lane_u32( in1[integerX1b], vdup_n_u32( in1[integerX1a] ), 1 ) ) );
+    const uint16x8_t topRight    = vmovl_u8( vreinterpret_u8_u32( vset_lane_u32( in1[integerX2b], vdup_n_u32( in1[integerX2a] ), 1 ) ) );
+    const uint16x8_t bottomLeft  = vmovl_u8( vreinterpret_u8_u32( vset_lane_u32( in2[integerX1b], vdup_n_u32( in2[integerX1a] ), 1 ) ) );
+    const uint16x8_t bottomRight = vmovl_u8( vreinterpret_u8_u32( vset_lane_u32( in2[integerX2b], vdup_n_u32( in2[integerX2a] ), 1 ) ) );
+
+    const uint16x4_t rightWeightA = vdup_n_u16( weightA );
+    const uint16x4_t rightWeightB = vdup_n_u16( weightB );
+    const uint16x4_t leftWeightA = vdup_n_u16( 65535u - weightA );
+    const uint16x4_t leftWeightB = vdup_n_u16( 65535u - weightB );
+
+    // Horizontal blends in 16.16 fixed-point like WeightedBlendIntToFixed1616():
+    const uint32x4_t top1    = vmlal_u16( vmull_u16( vget_low_u16( topLeft ), leftWeightA ), vget_low_u16( topRight ), rightWeightA );
+    const uint32x4_t top2    = vmlal_u16( vmull_u16( vget_high_u16( topLeft ), leftWeightB ), vget_high_u16( topRight ), rightWeightB );
+    const uint32x4_t bottom1 = vmlal_u16( vmull_u16( vget_low_u16( bottomLeft ), leftWeightA ), vget_low_u16( bottomRight ), rightWeightA );
+    const uint32x4_t bottom2 = vmlal_u16( vmull_u16( vget_high_u16( bottomLeft ), leftWeightB ), vget_high_u16( bottomRight ), rightWeightB );
+
+    const uint32x4_t pixel1 = VerticalBlendNEON( top1, bottom1, topWeight, bottomWeight );
+    const uint32x4_t pixel2 = VerticalBlendNEON( top2, bottom2, topWeight, bottomWeight );
+    vst1_u8( outScanline + outX * 4u, vmovn_u16( vcombine_u16( vmovn_u32( pixel1 ), vmovn_u32( pixel2 ) ) ) );
+  }
+  return outX;
+}
+
+const ScanlineKernels NEON_KERNELS =
+{
+  AverageBytesNEON,
+  AveragePixelsRGB565NEON,
+  HalveScanline1ByteNEON,
+  HalveScanline2BytesNEON,
+  HalveScanlineRGB888NEON,
+  HalveScanlineRGBA8888NEON,
+  HalveScanlineRGB565NEON,
+  PointSampleScanline4BPPScalar, // No gather
+  LinearSampleScanline4BPPNEON
+};
+
+#endif // DALI_IMAGE_OPERATIONS_NEON
+
+/** @return The fastest instruction set the CPU supports. */
+InstructionSet GetBestInstructionSet()
+{
+  if( IsInstructionSetSupported( InstructionSetAVX2 ) )
+  {
+    return InstructionSetAVX2;
+  }
+  if( IsInstructionSetSupported( InstructionSetSSE2 ) )
+  {
+    return InstructionSetSSE2;
+  }
+  if( IsInstructionSetSupported( InstructionSetNEON ) )
+  {
+    return InstructionSetNEON;
+  }
+  return InstructionSetScalar;
+}
+
+/** @return The instruction set in use, chosen the first time it is needed. */
+InstructionSet& SelectedInstructionSet()
+{
+  // Initialised once, even with several loader threads calling this
+  static InstructionSet instructionSet = GetBestInstructionSet();
+  return instructionSet;
+}
+
+} // unnamed namespace
+
+const ScanlineKernels& GetScanlineKernels()
+{
+  switch( SelectedInstructionSet() )
+  {
+#if defined(__SSE2__)
+    case InstructionSetSSE2:
+    {
+      return SSE2_KERNELS;
+    }
+#endif
+#if defined(DALI_IMAGE_OPERATIONS_AVX2)
+    case InstructionSetAVX2:
+    {
+      return AVX2_KERNELS;
+    }
+#endif
+#if defined(DALI_IMAGE_OPERATIONS_NEON)
+    case InstructionSetNEON:
+    {
+      return NEON_KERNELS;
+    }
+#endif
+    default:
+    {
+      return SCALAR_KERNELS;
+    }
+  }
+}
+
+bool IsInstructionSetSupported( InstructionSet instructionSet )
+{
+  switch( instructionSet )
+  {
+    case InstructionSetScalar:
+    {
+      return true;
+    }
+    case InstructionSetSSE2:
+    {
+#if defined(__SSE2__)
+      return true;
+#else
+      return false;
+#endif
+    }
+    case InstructionSetAVX2:
+    {
+#if defined(DALI_IMAGE_OPERATIONS_AVX2)
+      __builtin_cpu_init();
+      return __builtin_cpu_supports( "avx2" );
+#else
+      return false;
+#endif
+    }
+    case InstructionSetNEON:
+    {
+#if defined(DALI_IMAGE_OPERATIONS_NEON)
+      return true;
+#else
+      return false;
+#endif
+    }
+  }
+  return false;
+}
+
+InstructionSet GetInstructionSet()
+{
+  return SelectedInstructionSet();
+}
+
+bool SetInstructionSet( InstructionSet instructionSet )
+{
+  if( !IsInstructionSetSupported( instructionSet ) )
+  {
+    return false;
+  }
+  SelectedInstructionSet() = instructionSet;
+  return true;
+}
+
+} /* namespace Platform */
+} /* namespace Internal */
+} /* namespace Dali */
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef DALI_INTERNAL_PLATFORM_IMAGE_OPERATIONS_SIMD_H_
+#define DALI_INTERNAL_PLATFORM_IMAGE_OPERATIONS_SIMD_H_
+
+// EXTERNAL INCLUDES
+#include <stdint.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Platform
+{
+
+/**
+ * @brief The instruction sets the scanline kernels of the image operations can be run with.
+ */
+enum InstructionSet
+{
+  InstructionSetScalar, ///< No vector kernels: the plain loops of image-operations.cpp do all the work.
+  InstructionSetSSE2,
+  InstructionSetAVX2,   ///< AVX2 kernels where they are faster, SSE2 ones otherwise.
+  InstructionSetNEON
+};
+
+/**
+ * @brief Vector implementations of the inner loops of the image operations.
+ *
+ * Each kernel processes as much of its scanline as fits its vector width and
+ * returns how far it got. The scalar code in image-operations.cpp finishes the
+ * remainder, so the results are bit-exact whichever instruction set is used.
+ */
+struct ScanlineKernels
+{
+  /**
+   * @brief Average the bytes at corresponding positions of two arrays, rounding down like AverageComponent().
+   * @return The number of bytes averaged.
+   */
+  unsigned int (*AverageBytes)( const uint8_t* in1, const uint8_t* in2, uint8_t* out, unsigned int count );
+
+  /**
+   * @brief Average the RGB565 pixels at corresponding positions of two arrays like AveragePixelRGB565().
+   * @return The number of pixels averaged.
+   */
+  unsigned int (*AveragePixelsRGB565)( const uint16_t* in1, const uint16_t* in2, uint16_t* out, unsigned int count );
+
+  /**
+   * @brief Average pairs of neighbouring pixels of a scanline in place, from its start.
+   * @return The number of output pixels written.
+   */
+  unsigned int (*HalveScanline1Byte)( uint8_t* pixels, unsigned int width );
+  unsigned int (*HalveScanline2Bytes)( uint8_t* pixels, unsigned int width );    ///< @copydoc HalveScanline1Byte
+  unsigned int (*HalveScanlineRGB888)( uint8_t* pixels, unsigned int width );    ///< @copydoc HalveScanline1Byte
+  unsigned int (*HalveScanlineRGBA8888)( uint8_t* pixels, unsigned int width );  ///< @copydoc HalveScanline1Byte
+  unsigned int (*HalveScanlineRGB565)( uint8_t* pixels, unsigned int width );    ///< @copydoc HalveScanline1Byte
+
+  /**
+   * @brief Point sample a scanline of 4 byte pixels, from its start.
+   * @param[in] deltaX The 16.16 fixed-point step through the input for each output pixel.
+   * @return The number of output pixels written.
+   */
+  unsigned int (*PointSampleScanline4BPP)( const uint32_t* inScanline, uint32_t* outScanline, unsigned int desiredWidth, unsigned int deltaX );
+
+  /**
+   * @brief Bilinear filter a scanline of 4 byte pixels from two input scanlines, from its start, like BilinearFilter1Component().
+   * @param[in] deltaX The 16.16 fixed-point step through the input for each output pixel.
+   * @param[in] inputWidth The width of the input scanlines.
+   * @param[in] yWeight The 0.16 fixed-point weight of the second scanline.
+   * @return The number of output pixels written.
+   */
+  unsigned int (*LinearSampleScanline4BPP)( const uint8_t* inScanline1, const uint8_t* inScanline2, uint8_t* outScanline, unsigned int desiredWidth, unsigned int deltaX, unsigned int inputWidth, unsigned int yWeight );
+};
+
+/**
+ * @brief Get the kernels of the instruction set in use.
+ *
+ * This is the fastest one the CPU supports, unless another was selected with SetInstructionSet().
+ */
+const ScanlineKernels& GetScanlineKernels();
+
+/**
+ * @return Whether the kernels of an instruction set are compiled in and supported by the CPU.
+ */
+bool IsInstructionSetSupported( InstructionSet instructionSet );
+
+/**
+ * @return The instruction set of the kernels in use.
+ */
+InstructionSet GetInstructionSet();
+
+/**
+ * @brief Select the instruction set of the kernels, to compare them in tests and benchmarks.
+ * @return False if the instruction set is not supported, in which case the kernels are not changed.
+ */
+bool SetInstructionSet( InstructionSet instructionSet );
+
+} /* namespace Platform */
+} /* namespace Internal */
+} /* namespace Dali */
+
+#endif /* DALI_INTERNAL_PLATFORM_IMAGE_OPERATIONS_SIMD_H_ */
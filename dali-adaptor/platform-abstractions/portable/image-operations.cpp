@@ -21,10 +21,13 @@
 #include <cstring>
 #include <stddef.h>
 #include <cmath>
+#include <algorithm>
 #include <dali/integration-api/debug.h>
 #include <dali/public-api/math/vector2.h>
 
 // INTERNAL INCLUDES
+#include "image-operations-simd.h"
+#include "band-worker-pool.h"
 
 namespace Dali
 {
@@ -90,6 +93,25 @@ struct Pixel2Bytes
 Debug::Filter* gImageOpsLogFilter = Debug::Filter::New( Debug::NoLogging, false, "LOG_IMAGE_OPERATIONS" );
 #endif
 
+/**
+ * @brief Passes over images with fewer pixels than this are done on the
+ * calling thread alone, as handing out bands would cost more than it saves.
+ */
+const unsigned int MIN_PIXELS_FOR_BANDS = 512u * 512u;
+
+/** @brief The fewest rows to put in a band. */
+const unsigned int MIN_ROWS_PER_BAND = 16u;
+
+/**
+ * @brief Work out how many rows to put in each band of a pass, giving each
+ * thread of the band worker pool a couple of bands to balance the load.
+ */
+unsigned int GetRowsPerBand( unsigned int numRows )
+{
+  const unsigned int numBands = BandWorkerPool::Get().GetThreadCount() * 2u;
+  return std::max( ( numRows + numBands - 1u ) / numBands, MIN_ROWS_PER_BAND );
+}
+
 /** @return The greatest even number less than or equal to the argument. */
 inline unsigned int EvenDown( const unsigned int a )
 {
@@ -421,12 +443,21 @@ BitmapPtr ApplyAttributesToBitmap( BitmapPtr bitmap, ImageDimensions dimensions,
   return bitmap;
 }
 
-BitmapPtr CropForScaleToFill( BitmapPtr bitmap, ImageDimensions desiredDimensions )
+namespace
+{
+
+/**
+ * @brief Work out how much ScaleToFill scaling mode crops from the edges of an image.
+ *
+ * @param[out] columnsToTrim The number of columns to remove from each of the left and right edges.
+ * @param[out] scanlinesToTrim The number of scanlines to remove from each of the top and bottom edges.
+ */
+void CalculateScaleToFillTrim( unsigned inputWidth, unsigned inputHeight, ImageDimensions desiredDimensions, unsigned& columnsToTrim, unsigned& scanlinesToTrim )
 {
-  const unsigned inputWidth = bitmap->GetImageWidth();
-  const unsigned inputHeight = bitmap->GetImageHeight();
   const unsigned desiredWidth = desiredDimensions.GetWidth();
   const unsigned desiredHeight = desiredDimensions.GetHeight();
+  columnsToTrim = 0;
+  scanlinesToTrim = 0;
 
   if( desiredWidth < 1U || desiredHeight < 1U )
   {
@@ -448,44 +479,54 @@ BitmapPtr CropForScaleToFill( BitmapPtr bitmap, ImageDimensions desiredDimension
 
     // Work out how many pixels to trim from top and bottom, and left and right:
     // (We only ever do one dimension)
-    const unsigned scanlinesToTrim = trimTopAndBottom ? fabsf( (scaledDims.y - inputHeight) * 0.5f ) : 0;
-    const unsigned columnsToTrim = trimTopAndBottom ? 0 : fabsf( (scaledDims.x - inputWidth) * 0.5f );
+    scanlinesToTrim = trimTopAndBottom ? fabsf( (scaledDims.y - inputHeight) * 0.5f ) : 0;
+    columnsToTrim = trimTopAndBottom ? 0 : fabsf( (scaledDims.x - inputWidth) * 0.5f );
 
     DALI_LOG_INFO( gImageOpsLogFilter, Debug::Concise, "Bitmap, desired(%f, %f), loaded(%u,%u), cut_target(%f, %f), trimmed(%u, %u), vertical = %s.\n", desiredDims.x, desiredDims.y, inputWidth, inputHeight, scaledDims.x, scaledDims.y, columnsToTrim, scanlinesToTrim, trimTopAndBottom ? "true" : "false" );
+  }
+}
+
+} // namespace - unnamed
+
+BitmapPtr CropForScaleToFill( BitmapPtr bitmap, ImageDimensions desiredDimensions )
+{
+  const unsigned inputWidth = bitmap->GetImageWidth();
+  const unsigned inputHeight = bitmap->GetImageHeight();
+  unsigned columnsToTrim, scanlinesToTrim;
+  CalculateScaleToFillTrim( inputWidth, inputHeight, desiredDimensions, columnsToTrim, scanlinesToTrim );
 
-    // Make a new bitmap with the central part of the loaded one if required:
-    if( scanlinesToTrim > 0 || columnsToTrim > 0 )
+  // Make a new bitmap with the central part of the loaded one if required:
+  if( scanlinesToTrim > 0 || columnsToTrim > 0 )
+  {
+    const unsigned newWidth = inputWidth - 2 * columnsToTrim;
+    const unsigned newHeight = inputHeight - 2 * scanlinesToTrim;
+    BitmapPtr croppedBitmap = Integration::Bitmap::New( Integration::Bitmap::BITMAP_2D_PACKED_PIXELS, ResourcePolicy::OWNED_DISCARD );
+    Integration::Bitmap::PackedPixelsProfile * packedView = croppedBitmap->GetPackedPixelsProfile();
+    DALI_ASSERT_DEBUG( packedView );
+    const Pixel::Format pixelFormat = bitmap->GetPixelFormat();
+    packedView->ReserveBuffer( pixelFormat, newWidth, newHeight, newWidth, newHeight );
+
+    const unsigned bytesPerPixel = Pixel::GetBytesPerPixel( pixelFormat );
+
+    const PixelBuffer * const srcPixels = bitmap->GetBuffer() + scanlinesToTrim * inputWidth * bytesPerPixel;
+    PixelBuffer * const destPixels = croppedBitmap->GetBuffer();
+    DALI_ASSERT_DEBUG( srcPixels && destPixels );
+
+    // Optimize to a single memcpy if the left and right edges don't need a crop, else copy a scanline at a time:
+    if( columnsToTrim == 0 )
     {
-      const unsigned newWidth = inputWidth - 2 * columnsToTrim;
-      const unsigned newHeight = inputHeight - 2 * scanlinesToTrim;
-      BitmapPtr croppedBitmap = Integration::Bitmap::New( Integration::Bitmap::BITMAP_2D_PACKED_PIXELS, ResourcePolicy::OWNED_DISCARD );
-      Integration::Bitmap::PackedPixelsProfile * packedView = croppedBitmap->GetPackedPixelsProfile();
-      DALI_ASSERT_DEBUG( packedView );
-      const Pixel::Format pixelFormat = bitmap->GetPixelFormat();
-      packedView->ReserveBuffer( pixelFormat, newWidth, newHeight, newWidth, newHeight );
-
-      const unsigned bytesPerPixel = Pixel::GetBytesPerPixel( pixelFormat );
-
-      const PixelBuffer * const srcPixels = bitmap->GetBuffer() + scanlinesToTrim * inputWidth * bytesPerPixel;
-      PixelBuffer * const destPixels = croppedBitmap->GetBuffer();
-      DALI_ASSERT_DEBUG( srcPixels && destPixels );
-
-      // Optimize to a single memcpy if the left and right edges don't need a crop, else copy a scanline at a time:
-      if( trimTopAndBottom )
-      {
-        memcpy( destPixels, srcPixels, newHeight * newWidth * bytesPerPixel );
-      }
-      else
+      memcpy( destPixels, srcPixels, newHeight * newWidth * bytesPerPixel );
+    }
+    else
+    {
+      for( unsigned y = 0; y < newHeight; ++y )
       {
-        for( unsigned y = 0; y < newHeight; ++y )
-        {
-          memcpy( &destPixels[y * newWidth * bytesPerPixel], &srcPixels[y * inputWidth * bytesPerPixel + columnsToTrim * bytesPerPixel], newWidth * bytesPerPixel );
-        }
+        memcpy( &destPixels[y * newWidth * bytesPerPixel], &srcPixels[y * inputWidth * bytesPerPixel + columnsToTrim * bytesPerPixel], newWidth * bytesPerPixel );
       }
-
-      // Overwrite the loaded bitmap with the cropped version:
-      bitmap = croppedBitmap;
     }
+
+    // Overwrite the loaded bitmap with the cropped version:
+    bitmap = croppedBitmap;
   }
 
   return bitmap;
@@ -599,6 +640,70 @@ bool ContinueScaling( BoxDimensionTest test, unsigned int scaledWidth, unsigned
   return keepScaling;
 }
 
+/**
+ * @brief One pass of the iterative box filter, which halves a band of scanline
+ * pairs of an image in place.
+ *
+ * The output scanlines of a band are packed in from the start of its first
+ * input scanline, so a band never writes over the input of another. The
+ * bands after the first have to be moved into place after the pass.
+ */
+template<
+  int BYTES_PER_PIXEL,
+  void (*HalveScanlineInPlace)( unsigned char * const pixels, const unsigned int width ),
+  void (*AverageScanlines) ( const unsigned char * const scanline1, const unsigned char * const __restrict__ scanline2, unsigned char* const outputScanline, const unsigned int width )
+>
+class BoxFilterBandTask : public BandWorkerPool::Task
+{
+public:
+
+  /**
+   * @brief Constructor.
+   * @param[in] pixels The image.
+   * @param[in] lastWidth The width of the image before the pass.
+   * @param[in] scaledWidth The width of the image after the pass.
+   */
+  BoxFilterBandTask( unsigned char * const pixels, const unsigned int lastWidth, const unsigned int scaledWidth )
+  : mPixels( pixels ),
+    mLastWidth( lastWidth ),
+    mScaledWidth( scaledWidth )
+  {
+  }
+
+  /**
+   * @copydoc BandWorkerPool::Task::ProcessBand
+   */
+  virtual void ProcessBand( unsigned int firstRow, unsigned int endRow )
+  {
+    unsigned char * const bandPixels = &mPixels[firstRow * 2 * mLastWidth * BYTES_PER_PIXEL];
+
+    // Scale pairs of scanlines until any spare one at the end is dropped:
+    for( unsigned int y = 0; y < endRow - firstRow; ++y )
+    {
+      // Scale two scanlines horizontally:
+      HalveScanlineInPlace( &bandPixels[y * 2 * mLastWidth * BYTES_PER_PIXEL], mLastWidth );
+      HalveScanlineInPlace( &bandPixels[(y * 2 + 1) * mLastWidth * BYTES_PER_PIXEL], mLastWidth );
+
+      // Scale vertical pairs of pixels while the last two scanlines are still warm in
+      // the CPU cache(s):
+      // Note, better access patterns for cache-coherence are possible for very large
+      // images but even a 4k wide RGB888 image will use just 24kB of cache (4k pixels
+      // * 3 Bpp * 2 scanlines) for two scanlines on the first iteration.
+      AverageScanlines(
+          &bandPixels[y * 2 * mLastWidth * BYTES_PER_PIXEL],
+          &bandPixels[(y * 2 + 1) * mLastWidth * BYTES_PER_PIXEL],
+          &bandPixels[y * mScaledWidth * BYTES_PER_PIXEL],
+          mScaledWidth );
+    }
+  }
+
+private:
+
+  unsigned char * const mPixels;
+  const unsigned int mLastWidth;
+  const unsigned int mScaledWidth;
+};
+
 /**
  * @brief A shared implementation of the overall iterative box filter
  * downscaling algorithm.
@@ -634,30 +739,30 @@ void DownscaleInPlacePow2Generic( unsigned char * const pixels,
   while( ContinueScaling( dimensionTest, scaledWidth, scaledHeight, desiredWidth, desiredHeight ) )
   {
     const unsigned int lastWidth = scaledWidth;
+    const unsigned int lastHeight = scaledHeight;
     scaledWidth  >>= 1u;
     scaledHeight >>= 1u;
 
     DALI_LOG_INFO( gImageOpsLogFilter, Dali::Integration::Log::Verbose, "Scaling to %u\t%u.\n", scaledWidth, scaledHeight );
 
-    const unsigned int lastScanlinePair = scaledHeight - 1;
-
-    // Scale pairs of scanlines until any spare one at the end is dropped:
-    for( unsigned int y = 0; y <= lastScanlinePair; ++y )
+    BoxFilterBandTask<BYTES_PER_PIXEL, HalveScanlineInPlace, AverageScanlines> task( pixels, lastWidth, scaledWidth );
+    if( lastWidth * lastHeight < MIN_PIXELS_FOR_BANDS )
     {
-      // Scale two scanlines horizontally:
-      HalveScanlineInPlace( &pixels[y * 2 * lastWidth * BYTES_PER_PIXEL], lastWidth );
-      HalveScanlineInPlace( &pixels[(y * 2 + 1) * lastWidth * BYTES_PER_PIXEL], lastWidth );
+      task.ProcessBand( 0, scaledHeight );
+    }
+    else
+    {
+      // Large images are filtered in bands on several threads:
+      const unsigned int rowsPerBand = GetRowsPerBand( scaledHeight );
+      BandWorkerPool::Get().ProcessBands( task, scaledHeight, rowsPerBand );
 
-      // Scale vertical pairs of pixels while the last two scanlines are still warm in
-      // the CPU cache(s):
-      // Note, better access patterns for cache-coherence are possible for very large
-      // images but even a 4k wide RGB888 image will use just 24kB of cache (4k pixels
-      // * 3 Bpp * 2 scanlines) for two scanlines on the first iteration.
-      AverageScanlines(
-          &pixels[y * 2 * lastWidth * BYTES_PER_PIXEL],
-          &pixels[(y * 2 + 1) * lastWidth * BYTES_PER_PIXEL],
-          &pixels[y * scaledWidth * BYTES_PER_PIXEL],
-          scaledWidth );
+      // Move the output of each band after the first down to follow the one before it.
+      // A band only moves over its own output and the input of the bands before it:
+      for( unsigned int firstRow = rowsPerBand; firstRow < scaledHeight; firstRow += rowsPerBand )
+      {
+        const unsigned int rows = std::min( rowsPerBand, scaledHeight - firstRow );
+        memmove( &pixels[firstRow * scaledWidth * BYTES_PER_PIXEL], &pixels[firstRow * 2 * lastWidth * BYTES_PER_PIXEL], rows * scaledWidth * BYTES_PER_PIXEL );
+      }
     }
   }
 
@@ -674,7 +779,10 @@ void HalveScanlineInPlaceRGB888( unsigned char * const pixels, const unsigned in
 
   const unsigned int lastPair = EvenDown( width - 2 );
 
-  for( unsigned int pixel = 0, outPixel = 0; pixel <= lastPair; pixel += 2, ++outPixel )
+  // The vector kernel halves as many pixels as it can and the remainder are done here:
+  const unsigned int vectorOutPixels = GetScanlineKernels().HalveScanlineRGB888( pixels, width );
+
+  for( unsigned int pixel = vectorOutPixels * 2, outPixel = vectorOutPixels; pixel <= lastPair; pixel += 2, ++outPixel )
   {
     // Load all the byte pixel components we need:
     const unsigned int c11 = pixels[pixel * 3];
@@ -700,7 +808,10 @@ void HalveScanlineInPlaceRGBA8888( unsigned char * const pixels, const unsigned
 
   const unsigned int lastPair = EvenDown( width - 2 );
 
-  for( unsigned int pixel = 0, outPixel = 0; pixel <= lastPair; pixel += 2, ++outPixel )
+  // The vector kernel halves as many pixels as it can and the remainder are done here:
+  const unsigned int vectorOutPixels = GetScanlineKernels().HalveScanlineRGBA8888( pixels, width );
+
+  for( unsigned int pixel = vectorOutPixels * 2, outPixel = vectorOutPixels; pixel <= lastPair; pixel += 2, ++outPixel )
   {
     const uint32_t averaged = AveragePixelRGBA8888( alignedPixels[pixel], alignedPixels[pixel + 1] );
     alignedPixels[outPixel] = averaged;
@@ -716,7 +827,10 @@ void HalveScanlineInPlaceRGB565( unsigned char * pixels, unsigned int width )
 
   const unsigned int lastPair = EvenDown( width - 2 );
 
-  for( unsigned int pixel = 0, outPixel = 0; pixel <= lastPair; pixel += 2, ++outPixel )
+  // The vector kernel halves as many pixels as it can and the remainder are done here:
+  const unsigned int vectorOutPixels = GetScanlineKernels().HalveScanlineRGB565( pixels, width );
+
+  for( unsigned int pixel = vectorOutPixels * 2, outPixel = vectorOutPixels; pixel <= lastPair; pixel += 2, ++outPixel )
   {
     const uint32_t averaged = AveragePixelRGB565( alignedPixels[pixel], alignedPixels[pixel + 1] );
     alignedPixels[outPixel] = averaged;
@@ -729,7 +843,10 @@ void HalveScanlineInPlace2Bytes( unsigned char * const pixels, const unsigned in
 
   const unsigned int lastPair = EvenDown( width - 2 );
 
-  for( unsigned int pixel = 0, outPixel = 0; pixel <= lastPair; pixel += 2, ++outPixel )
+  // The vector kernel halves as many pixels as it can and the remainder are done here:
+  const unsigned int vectorOutPixels = GetScanlineKernels().HalveScanline2Bytes( pixels, width );
+
+  for( unsigned int pixel = vectorOutPixels * 2, outPixel = vectorOutPixels; pixel <= lastPair; pixel += 2, ++outPixel )
   {
     // Load all the byte pixel components we need:
     const unsigned int c11 = pixels[pixel * 2];
@@ -749,7 +866,10 @@ void HalveScanlineInPlace1Byte( unsigned char * const pixels, const unsigned int
 
   const unsigned int lastPair = EvenDown( width - 2 );
 
-  for( unsigned int pixel = 0, outPixel = 0; pixel <= lastPair; pixel += 2, ++outPixel )
+  // The vector kernel halves as many pixels as it can and the remainder are done here:
+  const unsigned int vectorOutPixels = GetScanlineKernels().HalveScanline1Byte( pixels, width );
+
+  for( unsigned int pixel = vectorOutPixels * 2, outPixel = vectorOutPixels; pixel <= lastPair; pixel += 2, ++outPixel )
   {
     // Load all the byte pixel components we need:
     const unsigned int c1 = pixels[pixel];
@@ -771,7 +891,9 @@ void AverageScanlines1( const unsigned char * const scanline1,
 {
   DebugAssertDualScanlineParameters( scanline1, scanline2, outputScanline, width );
 
-  for( unsigned int component = 0; component < width; ++component )
+  const unsigned int vectorComponents = GetScanlineKernels().AverageBytes( scanline1, scanline2, outputScanline, width );
+
+  for( unsigned int component = vectorComponents; component < width; ++component )
   {
     outputScanline[component] = AverageComponent( scanline1[component], scanline2[component] );
   }
@@ -784,7 +906,9 @@ void AverageScanlines2( const unsigned char * const scanline1,
 {
   DebugAssertDualScanlineParameters( scanline1, scanline2, outputScanline, width * 2 );
 
-  for( unsigned int component = 0; component < width * 2; ++component )
+  const unsigned int vectorComponents = GetScanlineKernels().AverageBytes( scanline1, scanline2, outputScanline, width * 2 );
+
+  for( unsigned int component = vectorComponents; component < width * 2; ++component )
   {
     outputScanline[component] = AverageComponent( scanline1[component], scanline2[component] );
   }
@@ -797,7 +921,9 @@ void AverageScanlines3( const unsigned char * const scanline1,
 {
   DebugAssertDualScanlineParameters( scanline1, scanline2, outputScanline, width * 3 );
 
-  for( unsigned int component = 0; component < width * 3; ++component )
+  const unsigned int vectorComponents = GetScanlineKernels().AverageBytes( scanline1, scanline2, outputScanline, width * 3 );
+
+  for( unsigned int component = vectorComponents; component < width * 3; ++component )
   {
     outputScanline[component] = AverageComponent( scanline1[component], scanline2[component] );
   }
@@ -817,7 +943,9 @@ void AverageScanlinesRGBA8888( const unsigned char * const scanline1,
   const uint32_t* const alignedScanline2 = reinterpret_cast<const uint32_t*>(scanline2);
   uint32_t* const alignedOutput = reinterpret_cast<uint32_t*>(outputScanline);
 
-  for( unsigned int pixel = 0; pixel < width; ++pixel )
+  const unsigned int vectorPixels = GetScanlineKernels().AverageBytes( scanline1, scanline2, outputScanline, width * 4 ) / 4;
+
+  for( unsigned int pixel = vectorPixels; pixel < width; ++pixel )
   {
     alignedOutput[pixel] = AveragePixelRGBA8888( alignedScanline1[pixel], alignedScanline2[pixel] );
   }
@@ -837,7 +965,9 @@ void AverageScanlinesRGB565( const unsigned char * const scanline1,
   const uint16_t* const alignedScanline2 = reinterpret_cast<const uint16_t*>(scanline2);
   uint16_t* const alignedOutput = reinterpret_cast<uint16_t*>(outputScanline);
 
-  for( unsigned int pixel = 0; pixel < width; ++pixel )
+  const unsigned int vectorPixels = GetScanlineKernels().AveragePixelsRGB565( alignedScanline1, alignedScanline2, alignedOutput, width );
+
+  for( unsigned int pixel = vectorPixels; pixel < width; ++pixel )
   {
     alignedOutput[pixel] = AveragePixelRGB565( alignedScanline1[pixel], alignedScanline2[pixel] );
   }
@@ -967,19 +1097,132 @@ namespace
 {
 
 /**
- * @brief Point sample an image to a new resolution (like GL_NEAREST).
+ * @brief A function which resamples a range of rows of an image into a second image.
+ */
+typedef void (*SampleRowsFunction)( const uint8_t * inPixels,
+                                    unsigned int inputWidth,
+                                    unsigned int inputHeight,
+                                    uint8_t * outPixels,
+                                    unsigned int desiredWidth,
+                                    unsigned int desiredHeight,
+                                    unsigned int firstRow,
+                                    unsigned int endRow );
+
+/**
+ * @brief A resampling of an image into a second one, done a band of output rows at a time.
+ */
+class SampleBandTask : public BandWorkerPool::Task
+{
+public:
+
+  SampleBandTask( SampleRowsFunction sampleRows, const uint8_t * inPixels, unsigned int inputWidth, unsigned int inputHeight, uint8_t * outPixels, unsigned int desiredWidth, unsigned int desiredHeight )
+  : mSampleRows( sampleRows ),
+    mInPixels( inPixels ),
+    mOutPixels( outPixels ),
+    mInputWidth( inputWidth ),
+    mInputHeight( inputHeight ),
+    mDesiredWidth( desiredWidth ),
+    mDesiredHeight( desiredHeight )
+  {
+  }
+
+  /**
+   * @copydoc BandWorkerPool::Task::ProcessBand
+   */
+  virtual void ProcessBand( unsigned int firstRow, unsigned int endRow )
+  {
+    mSampleRows( mInPixels, mInputWidth, mInputHeight, mOutPixels, mDesiredWidth, mDesiredHeight, firstRow, endRow );
+  }
+
+private:
+
+  const SampleRowsFunction mSampleRows;
+  const uint8_t * const mInPixels;
+  uint8_t * const mOutPixels;
+  const unsigned int mInputWidth;
+  const unsigned int mInputHeight;
+  const unsigned int mDesiredWidth;
+  const unsigned int mDesiredHeight;
+};
+
+/**
+ * @brief Resample an image, in bands on several threads if the output is large.
+ *
+ * The rows are sampled by the same code in either case, so the output does not
+ * depend on how it was split up.
+ */
+void SampleInBands( SampleRowsFunction sampleRows,
+                    const uint8_t * inPixels,
+                    unsigned int inputWidth,
+                    unsigned int inputHeight,
+                    uint8_t * outPixels,
+                    unsigned int desiredWidth,
+                    unsigned int desiredHeight,
+                    unsigned int bytesPerPixel )
+{
+  // A band of an in-place sampling could overwrite the input of another:
+  const bool separateBuffers = outPixels >= inPixels + inputWidth * inputHeight * bytesPerPixel ||
+                               inPixels >= outPixels + desiredWidth * desiredHeight * bytesPerPixel;
+
+  if( !separateBuffers || desiredWidth * desiredHeight < MIN_PIXELS_FOR_BANDS )
+  {
+    sampleRows( inPixels, inputWidth, inputHeight, outPixels, desiredWidth, desiredHeight, 0u, desiredHeight );
+  }
+  else
+  {
+    SampleBandTask task( sampleRows, inPixels, inputWidth, inputHeight, outPixels, desiredWidth, desiredHeight );
+    BandWorkerPool::Get().ProcessBands( task, desiredHeight, GetRowsPerBand( desiredHeight ) );
+  }
+}
+
+/**
+ * @brief Point sample a scanline of an image to a new width.
+ * @param[in] deltaX The 16.16 fixed-point step through the input for each output pixel.
+ */
+template<typename PIXEL>
+void PointSampleAddressablePixelScanline( const uint8_t * inScanline,
+                                          uint8_t * outScanline,
+                                          unsigned int desiredWidth,
+                                          unsigned int deltaX )
+{
+  const PIXEL* const inAligned = reinterpret_cast<const PIXEL*>(inScanline);
+  PIXEL* const outAligned = reinterpret_cast<PIXEL*>(outScanline);
+
+  // Pixels of 4 bytes can be gathered by a vector kernel, leaving the remainder to be sampled here:
+  unsigned int vectorOutX = 0;
+  if( sizeof(PIXEL) == 4u )
+  {
+    vectorOutX = GetScanlineKernels().PointSampleScanline4BPP( reinterpret_cast<const uint32_t*>(inAligned), reinterpret_cast<uint32_t*>(outAligned), desiredWidth, deltaX );
+  }
+
+  unsigned int inX = vectorOutX * deltaX;
+  for( unsigned int outX = vectorOutX; outX < desiredWidth; ++outX )
+  {
+    // Round the fixed-point x coordinate to an integer:
+    const unsigned int integerX = (inX + (1u << 15u)) >> 16u;
+    const PIXEL* const inPixelAddress = &inAligned[integerX];
+    const PIXEL pixel = *inPixelAddress;
+    outAligned[outX] = pixel;
+    inX += deltaX;
+  }
+}
+
+/**
+ * @brief Point sample a range of rows of an image to a new resolution (like GL_NEAREST).
  *
  * Template is used purely as a type-safe code generator in this one
  * compilation unit. Generated code is inlined into type-specific wrapper
  * functions below which are exported to rest of module.
  */
 template<typename PIXEL>
-inline void PointSampleAddressablePixels( const uint8_t * inPixels,
-                                   unsigned int inputWidth,
-                                   unsigned int inputHeight,
-                                   uint8_t * outPixels,
-                                   unsigned int desiredWidth,
-                                   unsigned int desiredHeight )
+void PointSampleAddressablePixelRows( const uint8_t * inPixels,
+                                      unsigned int inputWidth,
+                                      unsigned int inputHeight,
+                                      uint8_t * outPixels,
+                                      unsigned int desiredWidth,
+                                      unsigned int desiredHeight,
+                                      unsigned int firstRow,
+                                      unsigned int endRow )
 {
   DALI_ASSERT_DEBUG( ((desiredWidth <= inputWidth && desiredHeight <= inputHeight) ||
       outPixels >= inPixels + inputWidth * inputHeight * sizeof(PIXEL) || outPixels <= inPixels - desiredWidth * desiredHeight * sizeof(PIXEL)) &&
@@ -996,8 +1239,8 @@ inline void PointSampleAddressablePixels( const uint8_t * inPixels,
   const unsigned int deltaX = (inputWidth  << 16u) / desiredWidth;
   const unsigned int deltaY = (inputHeight << 16u) / desiredHeight;
 
-  unsigned int inY = 0;
-  for( unsigned int outY = 0; outY < desiredHeight; ++outY )
+  unsigned int inY = firstRow * deltaY;
+  for( unsigned int outY = firstRow; outY < endRow; ++outY )
   {
     // Round fixed point y coordinate to nearest integer:
     const unsigned int integerY = (inY + (1u << 15u)) >> 16u;
@@ -1008,16 +1251,7 @@ inline void PointSampleAddressablePixels( const uint8_t * inPixels,
     DALI_ASSERT_DEBUG( reinterpret_cast<const uint8_t*>(inScanline) < ( inPixels + inputWidth * inputHeight * sizeof(PIXEL) ) );
     DALI_ASSERT_DEBUG( reinterpret_cast<uint8_t*>(outScanline) < ( outPixels + desiredWidth * desiredHeight * sizeof(PIXEL) ) );
 
-    unsigned int inX = 0;
-    for( unsigned int outX = 0; outX < desiredWidth; ++outX )
-    {
-      // Round the fixed-point x coordinate to an integer:
-      const unsigned int integerX = (inX + (1u << 15u)) >> 16u;
-      const PIXEL* const inPixelAddress = &inScanline[integerX];
-      const PIXEL pixel = *inPixelAddress;
-      outScanline[outX] = pixel;
-      inX += deltaX;
-    }
+    PointSampleAddressablePixelScanline<PIXEL>( reinterpret_cast<const uint8_t*>(inScanline), reinterpret_cast<uint8_t*>(outScanline), desiredWidth, deltaX );
     inY += deltaY;
   }
 }
@@ -1032,7 +1266,7 @@ void PointSample4BPP( const unsigned char * inPixels,
                       unsigned int desiredWidth,
                       unsigned int desiredHeight )
 {
-  PointSampleAddressablePixels<uint32_t>( inPixels, inputWidth, inputHeight, outPixels, desiredWidth, desiredHeight );
+  SampleInBands( PointSampleAddressablePixelRows<uint32_t>, inPixels, inputWidth, inputHeight, outPixels, desiredWidth, desiredHeight, sizeof(uint32_t) );
 }
 
 // RGB565, LA88
@@ -1043,7 +1277,7 @@ void PointSample2BPP( const unsigned char * inPixels,
                       unsigned int desiredWidth,
                       unsigned int desiredHeight )
 {
-  PointSampleAddressablePixels<uint16_t>( inPixels, inputWidth, inputHeight, outPixels, desiredWidth, desiredHeight );
+  SampleInBands( PointSampleAddressablePixelRows<uint16_t>, inPixels, inputWidth, inputHeight, outPixels, desiredWidth, desiredHeight, sizeof(uint16_t) );
 }
 
 // L8, A8
@@ -1054,18 +1288,61 @@ void PointSample1BPP( const unsigned char * inPixels,
                       unsigned int desiredWidth,
                       unsigned int desiredHeight )
 {
-  PointSampleAddressablePixels<uint8_t>( inPixels, inputWidth, inputHeight, outPixels, desiredWidth, desiredHeight );
+  SampleInBands( PointSampleAddressablePixelRows<uint8_t>, inPixels, inputWidth, inputHeight, outPixels, desiredWidth, desiredHeight, sizeof(uint8_t) );
 }
 
-/* RGB888
+namespace
+{
+
+/**
+ * @brief Point sample a scanline of an RGB888 image to a new width.
+ *
  * RGB888 is a special case as its pixels are not aligned addressable units.
+ * @param[in] deltaX The 16.16 fixed-point step through the input for each output pixel.
  */
-void PointSample3BPP( const uint8_t * inPixels,
-                      unsigned int inputWidth,
-                      unsigned int inputHeight,
-                      uint8_t * outPixels,
-                      unsigned int desiredWidth,
-                      unsigned int desiredHeight )
+void PointSample3BPPScanline( const uint8_t * inScanline,
+                              uint8_t * outScanline,
+                              unsigned int desiredWidth,
+                              unsigned int deltaX )
+{
+  const unsigned int BYTES_PER_PIXEL = 3;
+  unsigned int inX = 0; //< 16.16 fixed-point input image x-coord.
+
+  for( unsigned int outX = 0; outX < desiredWidth * BYTES_PER_PIXEL; outX += BYTES_PER_PIXEL )
+  {
+    // Round the fixed-point input coordinate to the address of the input pixel to sample:
+    const unsigned int integerX = (inX + (1u << 15u)) >> 16u;
+    const uint8_t* const inPixelAddress = &inScanline[integerX * BYTES_PER_PIXEL];
+
+    // Issue loads for all pixel color components up-front:
+    const unsigned int c0 = inPixelAddress[0];
+    const unsigned int c1 = inPixelAddress[1];
+    const unsigned int c2 = inPixelAddress[2];
+    ///@ToDo: Optimise - Benchmark one 32bit load that will be unaligned 2/3 of the time + 3 rotate and masks, versus these three aligned byte loads, versus using an RGB packed, aligned(1) struct and letting compiler pick a strategy.
+
+    // Output the pixel components:
+    outScanline[outX]     = c0;
+    outScanline[outX + 1] = c1;
+    outScanline[outX + 2] = c2;
+
+    // Increment the fixed-point input coordinate:
+    inX += deltaX;
+  }
+}
+
+/**
+ * @brief Point sample a range of rows of an RGB888 image.
+ *
+ * RGB888 is a special case as its pixels are not aligned addressable units.
+ */
+void PointSample3BPPRows( const uint8_t * inPixels,
+                          unsigned int inputWidth,
+                          unsigned int inputHeight,
+                          uint8_t * outPixels,
+                          unsigned int desiredWidth,
+                          unsigned int desiredHeight,
+                          unsigned int firstRow,
+                          unsigned int endRow )
 {
   if( inputWidth < 1u || inputHeight < 1u || desiredWidth < 1u || desiredHeight < 1u )
   {
@@ -1080,39 +1357,34 @@ void PointSample3BPP( const uint8_t * inPixels,
   // Step through output image in whole integer pixel steps while tracking the
   // corresponding locations in the input image using 16.16 fixed-point
   // coordinates:
-  unsigned int inY = 0; //< 16.16 fixed-point input image y-coord.
-  for( unsigned int outY = 0; outY < desiredHeight; ++outY )
+  unsigned int inY = firstRow * deltaY; //< 16.16 fixed-point input image y-coord.
+  for( unsigned int outY = firstRow; outY < endRow; ++outY )
   {
     const unsigned int integerY = (inY + (1u << 15u)) >> 16u;
     const uint8_t* const inScanline = &inPixels[inputWidth * integerY * BYTES_PER_PIXEL];
     uint8_t* const outScanline = &outPixels[desiredWidth * outY * BYTES_PER_PIXEL];
-    unsigned int inX = 0; //< 16.16 fixed-point input image x-coord.
 
-    for( unsigned int outX = 0; outX < desiredWidth * BYTES_PER_PIXEL; outX += BYTES_PER_PIXEL )
-    {
-      // Round the fixed-point input coordinate to the address of the input pixel to sample:
-      const unsigned int integerX = (inX + (1u << 15u)) >> 16u;
-      const uint8_t* const inPixelAddress = &inScanline[integerX * BYTES_PER_PIXEL];
-
-      // Issue loads for all pixel color components up-front:
-      const unsigned int c0 = inPixelAddress[0];
-      const unsigned int c1 = inPixelAddress[1];
-      const unsigned int c2 = inPixelAddress[2];
-      ///@ToDo: Optimise - Benchmark one 32bit load that will be unaligned 2/3 of the time + 3 rotate and masks, versus these three aligned byte loads, versus using an RGB packed, aligned(1) struct and letting compiler pick a strategy.
-
-      // Output the pixel components:
-      outScanline[outX]     = c0;
-      outScanline[outX + 1] = c1;
-      outScanline[outX + 2] = c2;
-
-      // Increment the fixed-point input coordinate:
-      inX += deltaX;
-    }
+    PointSample3BPPScanline( inScanline, outScanline, desiredWidth, deltaX );
 
     inY += deltaY;
   }
 }
 
+}
+
+/* RGB888
+ * RGB888 is a special case as its pixels are not aligned addressable units.
+ */
+void PointSample3BPP( const uint8_t * inPixels,
+                      unsigned int inputWidth,
+                      unsigned int inputHeight,
+                      uint8_t * outPixels,
+                      unsigned int desiredWidth,
+                      unsigned int desiredHeight )
+{
+  SampleInBands( PointSample3BPPRows, inPixels, inputWidth, inputHeight, outPixels, desiredWidth, desiredHeight, 3u );
+}
+
 // Dispatch to a format-appropriate point sampling function:
 void PointSample( const unsigned char * inPixels,
                   unsigned int inputWidth,
@@ -1203,7 +1475,59 @@ inline Pixel4Bytes BilinearFilter4Bytes( Pixel4Bytes tl, Pixel4Bytes tr, Pixel4B
 }
 
 /**
- * @brief Generic version of bilinear sampling image resize function.
+ * @brief Bilinear filter a scanline of an image to a new width from the two
+ * input scanlines it falls between.
+ * @param[in] deltaX The 16.16 fixed-point step through the input for each output pixel.
+ * @param[in] inputYWeight The 0.16 fixed-point weight of the second input scanline.
+ */
+template<
+  typename PIXEL,
+  PIXEL (*BilinearFilter) ( PIXEL tl, PIXEL tr, PIXEL bl, PIXEL br, unsigned int fractBlendHorizontal, unsigned int fractBlendVertical )
+>
+void LinearSampleScanline( const uint8_t * __restrict__ inScanline1,
+                           const uint8_t * __restrict__ inScanline2,
+                           unsigned int inputWidth,
+                           uint8_t * __restrict__ outScanline,
+                           unsigned int desiredWidth,
+                           unsigned int deltaX,
+                           unsigned int inputYWeight )
+{
+  const PIXEL* const inAligned1 = reinterpret_cast<const PIXEL*>(inScanline1);
+  const PIXEL* const inAligned2 = reinterpret_cast<const PIXEL*>(inScanline2);
+  PIXEL* const outAligned = reinterpret_cast<PIXEL*>(outScanline);
+
+  // Pixels of 4 bytes are filtered by a vector kernel, leaving the remainder to be filtered here:
+  unsigned int vectorOutX = 0;
+  if( sizeof(PIXEL) == 4u )
+  {
+    vectorOutX = GetScanlineKernels().LinearSampleScanline4BPP( inScanline1, inScanline2, outScanline, desiredWidth, deltaX, inputWidth, inputYWeight );
+  }
+
+  unsigned int inX = vectorOutX * deltaX;
+  for( unsigned int outX = vectorOutX; outX < desiredWidth; ++outX )
+  {
+    // Work out the two pixel scanline offsets for this cluster of four samples:
+    const unsigned int integerX1 = inX >> 16u;
+    const unsigned int integerX2 = integerX1 >= inputWidth ? integerX1 : integerX1 + 1;
+
+    // Execute the loads:
+    const PIXEL pixel1 = inAligned1[integerX1];
+    const PIXEL pixel2 = inAligned2[integerX1];
+    const PIXEL pixel3 = inAligned1[integerX2];
+    const PIXEL pixel4 = inAligned2[integerX2];
+    ///@ToDo Optimise - for 1 and 2  and 4 byte types to execute a single 2, 4, or 8 byte load per pair (caveat clamping) and let half of them be unaligned.
+
+    // Weighted bilinear filter:
+    const unsigned int inputXWeight = inX & 65535u;
+    outAligned[outX] = BilinearFilter( pixel1, pixel3, pixel2, pixel4, inputXWeight, inputYWeight );
+
+    inX += deltaX;
+  }
+}
+
+/**
+ * @brief Generic version of bilinear sampling image resize function, for a
+ * range of rows of the output image.
  * @note Limited to one compilation unit and exposed through type-specific
  * wrapper functions below.
  */
@@ -1212,16 +1536,15 @@ template<
   PIXEL (*BilinearFilter) ( PIXEL tl, PIXEL tr, PIXEL bl, PIXEL br, unsigned int fractBlendHorizontal, unsigned int fractBlendVertical ),
   bool DEBUG_ASSERT_ALIGNMENT
 >
-inline void LinearSampleGeneric( const unsigned char * __restrict__ inPixels,
-                       ImageDimensions inputDimensions,
+void LinearSampleRows( const unsigned char * __restrict__ inPixels,
+                       unsigned int inputWidth,
+                       unsigned int inputHeight,
                        unsigned char * __restrict__ outPixels,
-                       ImageDimensions desiredDimensions )
+                       unsigned int desiredWidth,
+                       unsigned int desiredHeight,
+                       unsigned int firstRow,
+                       unsigned int endRow )
 {
-  const unsigned int inputWidth = inputDimensions.GetWidth();
-  const unsigned int inputHeight = inputDimensions.GetHeight();
-  const unsigned int desiredWidth = desiredDimensions.GetWidth();
-  const unsigned int desiredHeight = desiredDimensions.GetHeight();
-
   DALI_ASSERT_DEBUG( ((outPixels >= inPixels + inputWidth   * inputHeight   * sizeof(PIXEL)) ||
                       (inPixels >= outPixels + desiredWidth * desiredHeight * sizeof(PIXEL))) &&
                      "Input and output buffers cannot overlap.");
@@ -1240,8 +1563,8 @@ inline void LinearSampleGeneric( const unsigned char * __restrict__ inPixels,
   const unsigned int deltaX = (inputWidth  << 16u) / desiredWidth;
   const unsigned int deltaY = (inputHeight << 16u) / desiredHeight;
 
-  unsigned int inY = 0;
-  for( unsigned int outY = 0; outY < desiredHeight; ++outY )
+  unsigned int inY = firstRow * deltaY;
+  for( unsigned int outY = firstRow; outY < endRow; ++outY )
   {
     PIXEL* const outScanline = &outAligned[desiredWidth * outY];
 
@@ -1256,26 +1579,8 @@ inline void LinearSampleGeneric( const unsigned char * __restrict__ inPixels,
     const PIXEL* const inScanline1 = &inAligned[inputWidth * integerY1];
     const PIXEL* const inScanline2 = &inAligned[inputWidth * integerY2];
 
-    unsigned int inX = 0;
-    for( unsigned int outX = 0; outX < desiredWidth; ++outX )
-    {
-      // Work out the two pixel scanline offsets for this cluster of four samples:
-      const unsigned int integerX1 = inX >> 16u;
-      const unsigned int integerX2 = integerX1 >= inputWidth ? integerX1 : integerX1 + 1;
-
-      // Execute the loads:
-      const PIXEL pixel1 = inScanline1[integerX1];
-      const PIXEL pixel2 = inScanline2[integerX1];
-      const PIXEL pixel3 = inScanline1[integerX2];
-      const PIXEL pixel4 = inScanline2[integerX2];
-      ///@ToDo Optimise - for 1 and 2  and 4 byte types to execute a single 2, 4, or 8 byte load per pair (caveat clamping) and let half of them be unaligned.
-
-      // Weighted bilinear filter:
-      const unsigned int inputXWeight = inX & 65535u;
-      outScanline[outX] = BilinearFilter( pixel1, pixel3, pixel2, pixel4, inputXWeight, inputYWeight );
-
-      inX += deltaX;
-    }
+    LinearSampleScanline<PIXEL, BilinearFilter>( reinterpret_cast<const uint8_t*>(inScanline1), reinterpret_cast<const uint8_t*>(inScanline2), inputWidth,
+                                                 reinterpret_cast<uint8_t*>(outScanline), desiredWidth, deltaX, inputYWeight );
     inY += deltaY;
   }
 }
@@ -1289,7 +1594,8 @@ void LinearSample1BPP( const unsigned char * __restrict__ inPixels,
                        unsigned char * __restrict__ outPixels,
                        ImageDimensions desiredDimensions )
 {
-  LinearSampleGeneric<uint8_t, BilinearFilter1BPPByte, false>( inPixels, inputDimensions, outPixels, desiredDimensions );
+  SampleInBands( LinearSampleRows<uint8_t, BilinearFilter1BPPByte, false>, inPixels, inputDimensions.GetWidth(), inputDimensions.GetHeight(),
+                 outPixels, desiredDimensions.GetWidth(), desiredDimensions.GetHeight(), sizeof(uint8_t) );
 }
 
 void LinearSample2BPP( const unsigned char * __restrict__ inPixels,
@@ -1297,7 +1603,8 @@ void LinearSample2BPP( const unsigned char * __restrict__ inPixels,
                        unsigned char * __restrict__ outPixels,
                        ImageDimensions desiredDimensions )
 {
-  LinearSampleGeneric<Pixel2Bytes, BilinearFilter2Bytes, true>( inPixels, inputDimensions, outPixels, desiredDimensions );
+  SampleInBands( LinearSampleRows<Pixel2Bytes, BilinearFilter2Bytes, true>, inPixels, inputDimensions.GetWidth(), inputDimensions.GetHeight(),
+                 outPixels, desiredDimensions.GetWidth(), desiredDimensions.GetHeight(), sizeof(Pixel2Bytes) );
 }
 
 void LinearSampleRGB565( const unsigned char * __restrict__ inPixels,
@@ -1305,7 +1612,8 @@ void LinearSampleRGB565( const unsigned char * __restrict__ inPixels,
                        unsigned char * __restrict__ outPixels,
                        ImageDimensions desiredDimensions )
 {
-  LinearSampleGeneric<PixelRGB565, BilinearFilterRGB565, true>( inPixels, inputDimensions, outPixels, desiredDimensions );
+  SampleInBands( LinearSampleRows<PixelRGB565, BilinearFilterRGB565, true>, inPixels, inputDimensions.GetWidth(), inputDimensions.GetHeight(),
+                 outPixels, desiredDimensions.GetWidth(), desiredDimensions.GetHeight(), sizeof(PixelRGB565) );
 }
 
 void LinearSample3BPP( const unsigned char * __restrict__ inPixels,
@@ -1313,7 +1621,8 @@ void LinearSample3BPP( const unsigned char * __restrict__ inPixels,
                        unsigned char * __restrict__ outPixels,
                        ImageDimensions desiredDimensions )
 {
-  LinearSampleGeneric<Pixel3Bytes, BilinearFilterRGB888, false>( inPixels, inputDimensions, outPixels, desiredDimensions );
+  SampleInBands( LinearSampleRows<Pixel3Bytes, BilinearFilterRGB888, false>, inPixels, inputDimensions.GetWidth(), inputDimensions.GetHeight(),
+                 outPixels, desiredDimensions.GetWidth(), desiredDimensions.GetHeight(), sizeof(Pixel3Bytes) );
 }
 
 void LinearSample4BPP( const unsigned char * __restrict__ inPixels,
@@ -1321,7 +1630,8 @@ void LinearSample4BPP( const unsigned char * __restrict__ inPixels,
                        unsigned char * __restrict__ outPixels,
                        ImageDimensions desiredDimensions )
 {
-  LinearSampleGeneric<Pixel4Bytes, BilinearFilter4Bytes, true>( inPixels, inputDimensions, outPixels, desiredDimensions );
+  SampleInBands( LinearSampleRows<Pixel4Bytes, BilinearFilter4Bytes, true>, inPixels, inputDimensions.GetWidth(), inputDimensions.GetHeight(),
+                 outPixels, desiredDimensions.GetWidth(), desiredDimensions.GetHeight(), sizeof(Pixel4Bytes) );
 }
 
 // Dispatch to a format-appropriate linear sampling function:
@@ -1365,6 +1675,308 @@ void LinearSample( const unsigned char * __restrict__ inPixels,
   }
 }
 
+ScanlineDownscaler::ScanlineDownscaler( Integration::Bitmap& bitmap,
+                                        Pixel::Format pixelFormat,
+                                        ImageDimensions inputDimensions,
+                                        ImageDimensions requestedDimensions,
+                                        FittingMode::Type fittingMode,
+                                        SamplingMode::Type samplingMode )
+: mBitmap( bitmap ),
+  mPixelFormat( pixelFormat ),
+  mBytesPerPixel( Pixel::GetBytesPerPixel( pixelFormat ) ),
+  mInputWidth( inputDimensions.GetWidth() ),
+  mInputHeight( inputDimensions.GetHeight() ),
+  mInputRow( 0u ),
+  mBoxPasses( 0u ),
+  mHalveScanline( NULL ),
+  mAverageScanlines( NULL ),
+  mShrunkWidth( inputDimensions.GetWidth() ),
+  mShrunkHeight( inputDimensions.GetHeight() ),
+  mShrunkRow( 0u ),
+  mLinearSampleScanline( NULL ),
+  mPointSampleScanline( NULL ),
+  mFilteredWidth( 0u ),
+  mFilteredHeight( 0u ),
+  mFilteredRow( 0u ),
+  mDeltaX( 0u ),
+  mDeltaY( 0u ),
+  mColumnsToTrim( 0u ),
+  mScanlinesToTrim( 0u ),
+  mOutputWidth( 0u ),
+  mOutputPixels( NULL ),
+  mScanline(),
+  mBoxScanlines(),
+  mBoxScanlineOffsets(),
+  mBoxScanlinePending(),
+  mSampleScanlines(),
+  mFilteredScanline()
+{
+  // Pick the scanline functions for the pixel format, leaving the image to be decoded whole if there are none:
+  if( pixelFormat == Pixel::RGBA8888 )
+  {
+    mHalveScanline = HalveScanlineInPlaceRGBA8888;
+    mAverageScanlines = AverageScanlinesRGBA8888;
+  }
+  else if( pixelFormat == Pixel::RGB888 )
+  {
+    mHalveScanline = HalveScanlineInPlaceRGB888;
+    mAverageScanlines = AverageScanlines3;
+  }
+  else if( pixelFormat == Pixel::RGB565 )
+  {
+    mHalveScanline = HalveScanlineInPlaceRGB565;
+    mAverageScanlines = AverageScanlinesRGB565;
+  }
+  else if( pixelFormat == Pixel::LA88 )
+  {
+    mHalveScanline = HalveScanlineInPlace2Bytes;
+    mAverageScanlines = AverageScanlines2;
+  }
+  else if( pixelFormat == Pixel::L8 || pixelFormat == Pixel::A8 )
+  {
+    mHalveScanline = HalveScanlineInPlace1Byte;
+    mAverageScanlines = AverageScanlines1;
+  }
+  else
+  {
+    DALI_LOG_INFO( gImageOpsLogFilter, Dali::Integration::Log::Verbose, "Image not downscaled as it is decoded: unsupported pixel format: %u.\n", unsigned(pixelFormat) );
+    return;
+  }
+
+  // Follow the decisions ApplyAttributesToBitmap() makes for the whole image:
+  const ImageDimensions desiredDimensions = CalculateDesiredDimensions( inputDimensions, requestedDimensions );
+  const unsigned int desiredWidth = desiredDimensions.GetWidth();
+  const unsigned int desiredHeight = desiredDimensions.GetHeight();
+  if( desiredWidth == 0u || desiredHeight == 0u || ( desiredWidth >= mInputWidth && desiredHeight >= mInputHeight ) )
+  {
+    return;
+  }
+
+  if( samplingMode == SamplingMode::BOX || samplingMode == SamplingMode::BOX_THEN_NEAREST || samplingMode == SamplingMode::BOX_THEN_LINEAR )
+  {
+    const BoxDimensionTest dimensionTest = DimensionTestForScalingMode( fittingMode );
+    while( ContinueScaling( dimensionTest, mShrunkWidth, mShrunkHeight, desiredWidth, desiredHeight ) )
+    {
+      mShrunkWidth >>= 1u;
+      mShrunkHeight >>= 1u;
+      ++mBoxPasses;
+    }
+  }
+
+  const ImageDimensions filteredDimensions = FitToScalingMode( desiredDimensions, ImageDimensions( mShrunkWidth, mShrunkHeight ), fittingMode );
+  mFilteredWidth = filteredDimensions.GetWidth();
+  mFilteredHeight = filteredDimensions.GetHeight();
+  if( mFilteredWidth == 0u || mFilteredHeight == 0u )
+  {
+    // Leave images fitted to nothing to the whole image path:
+    return;
+  }
+  if( mFilteredWidth < mShrunkWidth || mFilteredHeight < mShrunkHeight )
+  {
+    if( samplingMode == SamplingMode::LINEAR || samplingMode == SamplingMode::BOX_THEN_LINEAR )
+    {
+      if( pixelFormat == Pixel::RGB888 )
+      {
+        mLinearSampleScanline = LinearSampleScanline<Pixel3Bytes, BilinearFilterRGB888>;
+      }
+      else if( pixelFormat == Pixel::RGBA8888 )
+      {
+        mLinearSampleScanline = LinearSampleScanline<Pixel4Bytes, BilinearFilter4Bytes>;
+      }
+      else if( pixelFormat == Pixel::L8 || pixelFormat == Pixel::A8 )
+      {
+        mLinearSampleScanline = LinearSampleScanline<uint8_t, BilinearFilter1BPPByte>;
+      }
+      else if( pixelFormat == Pixel::LA88 )
+      {
+        mLinearSampleScanline = LinearSampleScanline<Pixel2Bytes, BilinearFilter2Bytes>;
+      }
+      else
+      {
+        mLinearSampleScanline = LinearSampleScanline<PixelRGB565, BilinearFilterRGB565>;
+      }
+    }
+    else if( samplingMode == SamplingMode::NEAREST || samplingMode == SamplingMode::BOX_THEN_NEAREST )
+    {
+      if( pixelFormat == Pixel::RGB888 )
+      {
+        mPointSampleScanline = PointSample3BPPScanline;
+      }
+      else if( pixelFormat == Pixel::RGBA8888 )
+      {
+        mPointSampleScanline = PointSampleAddressablePixelScanline<uint32_t>;
+      }
+      else if( pixelFormat == Pixel::RGB565 || pixelFormat == Pixel::LA88 )
+      {
+        mPointSampleScanline = PointSampleAddressablePixelScanline<uint16_t>;
+      }
+      else
+      {
+        mPointSampleScanline = PointSampleAddressablePixelScanline<uint8_t>;
+      }
+    }
+  }
+
+  if( !mLinearSampleScanline && !mPointSampleScanline )
+  {
+    // Nothing to do unless the box filter shrinks the image:
+    if( mBoxPasses == 0u )
+    {
+      return;
+    }
+    mFilteredWidth = mShrunkWidth;
+    mFilteredHeight = mShrunkHeight;
+  }
+  mDeltaX = ( mShrunkWidth << 16u ) / mFilteredWidth;
+  mDeltaY = ( mShrunkHeight << 16u ) / mFilteredHeight;
+
+  if( fittingMode == FittingMode::SCALE_TO_FILL )
+  {
+    CalculateScaleToFillTrim( mFilteredWidth, mFilteredHeight, desiredDimensions, mColumnsToTrim, mScanlinesToTrim );
+  }
+  mOutputWidth = mFilteredWidth - 2u * mColumnsToTrim;
+  const unsigned int outputHeight = mFilteredHeight - 2u * mScanlinesToTrim;
+
+  DALI_LOG_INFO( gImageOpsLogFilter, Dali::Integration::Log::Verbose, "Downscaling as decoded (%u, %u) -> box filtered (%u, %u) -> sampled (%u, %u) -> cropped (%u, %u).\n",
+                 mInputWidth, mInputHeight, mShrunkWidth, mShrunkHeight, mFilteredWidth, mFilteredHeight, mOutputWidth, outputHeight );
+
+  // One scanline for each pass of the box filter, each half the width of the one before:
+  mScanline.Resize( mInputWidth * mBytesPerPixel );
+  mBoxScanlineOffsets.Resize( mBoxPasses );
+  mBoxScanlinePending.Resize( mBoxPasses, false );
+  unsigned int boxScanlinesSize = 0u;
+  for( unsigned int pass = 0; pass < mBoxPasses; ++pass )
+  {
+    mBoxScanlineOffsets[pass] = boxScanlinesSize;
+    boxScanlinesSize += ( mInputWidth >> ( pass + 1u ) ) * mBytesPerPixel;
+  }
+  mBoxScanlines.Resize( boxScanlinesSize );
+
+  // Linear sampling blends the last two box filtered scanlines. They have a spare pixel on the end for the filter to read at the right edge:
+  if( mLinearSampleScanline )
+  {
+    mSampleScanlines.Resize( 2u * ( mShrunkWidth + 1u ) * mBytesPerPixel, 0u );
+  }
+  mFilteredScanline.Resize( mFilteredWidth * mBytesPerPixel );
+
+  mOutputPixels = bitmap.GetPackedPixelsProfile()->ReserveBuffer( pixelFormat, mOutputWidth, outputHeight, mOutputWidth, outputHeight );
+}
+
+bool ScanlineDownscaler::IsDownscaling() const
+{
+  return mOutputPixels != NULL;
+}
+
+uint8_t* ScanlineDownscaler::GetScanline()
+{
+  return mScanline.Begin();
+}
+
+void ScanlineDownscaler::PushScanline()
+{
+  if( mOutputPixels && mInputRow < mInputHeight )
+  {
+    ++mInputRow;
+    BoxFilterScanline( 0u, mScanline.Begin() );
+  }
+}
+
+bool ScanlineDownscaler::Finish()
+{
+  if( !mOutputPixels || mFilteredRow < mFilteredHeight )
+  {
+    return false;
+  }
+
+  // Examine the pixels left to see if all are opaque, as ApplyAttributesToBitmap() does:
+  if( Pixel::HasAlpha( mPixelFormat ) )
+  {
+    mBitmap.GetPackedPixelsProfile()->TestForTransparency();
+  }
+  return true;
+}
+
+void ScanlineDownscaler::BoxFilterScanline( unsigned int pass, uint8_t * scanline )
+{
+  if( pass == mBoxPasses )
+  {
+    SampleScanline( scanline );
+    return;
+  }
+
+  // Halve the scanline and then average it with the first of the pair, as DownscaleInPlacePow2() does:
+  const unsigned int lastWidth = mInputWidth >> pass;
+  const unsigned int scaledWidth = lastWidth >> 1u;
+  uint8_t * const firstScanline = &mBoxScanlines[mBoxScanlineOffsets[pass]];
+  mHalveScanline( scanline, lastWidth );
+  if( !mBoxScanlinePending[pass] )
+  {
+    memcpy( firstScanline, scanline, scaledWidth * mBytesPerPixel );
+    mBoxScanlinePending[pass] = true;
+  }
+  else
+  {
+    mAverageScanlines( firstScanline, scanline, firstScanline, scaledWidth );
+    mBoxScanlinePending[pass] = false;
+    BoxFilterScanline( pass + 1u, firstScanline );
+  }
+}
+
+void ScanlineDownscaler::SampleScanline( const uint8_t * scanline )
+{
+  const unsigned int shrunkRow = mShrunkRow++;
+
+  if( mLinearSampleScanline )
+  {
+    const unsigned int stride = ( mShrunkWidth + 1u ) * mBytesPerPixel;
+    memcpy( &mSampleScanlines[( shrunkRow & 1u ) * stride], scanline, mShrunkWidth * mBytesPerPixel );
+
+    // Filter each output scanline whose second input scanline has arrived:
+    while( mFilteredRow < mFilteredHeight )
+    {
+      const unsigned int inY = mFilteredRow * mDeltaY;
+      const unsigned int integerY1 = inY >> 16u;
+      const unsigned int integerY2 = std::min( integerY1 + 1u, mShrunkHeight - 1u );
+      if( integerY2 > shrunkRow )
+      {
+        break;
+      }
+      mLinearSampleScanline( &mSampleScanlines[( integerY1 & 1u ) * stride], &mSampleScanlines[( integerY2 & 1u ) * stride], mShrunkWidth,
+                             mFilteredScanline.Begin(), mFilteredWidth, mDeltaX, inY & 65535u );
+      OutputScanline( mFilteredScanline.Begin() );
+    }
+  }
+  else if( mPointSampleScanline )
+  {
+    // Sample each output scanline nearest to this input scanline:
+    while( mFilteredRow < mFilteredHeight )
+    {
+      const unsigned int integerY = std::min( ( mFilteredRow * mDeltaY + ( 1u << 15u ) ) >> 16u, mShrunkHeight - 1u );
+      if( integerY > shrunkRow )
+      {
+        break;
+      }
+      mPointSampleScanline( scanline, mFilteredScanline.Begin(), mFilteredWidth, mDeltaX );
+      OutputScanline( mFilteredScanline.Begin() );
+    }
+  }
+  else
+  {
+    OutputScanline( scanline );
+  }
+}
+
+void ScanlineDownscaler::OutputScanline( const uint8_t * scanline )
+{
+  const unsigned int row = mFilteredRow++;
+
+  // Drop the scanlines cropped from the top and bottom, and the columns cropped from the sides:
+  if( row >= mScanlinesToTrim && row < mFilteredHeight - mScanlinesToTrim )
+  {
+    memcpy( &mOutputPixels[( row - mScanlinesToTrim ) * mOutputWidth * mBytesPerPixel], &scanline[mColumnsToTrim * mBytesPerPixel], mOutputWidth * mBytesPerPixel );
+  }
+}
+
 } /* namespace Platform */
 } /* namespace Internal */
 } /* namespace Dali */
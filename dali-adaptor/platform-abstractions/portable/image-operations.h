@@ -23,6 +23,7 @@
 
 // INTERNAL INCLUDES
 #include <dali/integration-api/bitmap.h>
+#include <dali/public-api/common/dali-vector.h>
 #include <dali/public-api/images/image-operations.h>
 
 namespace Dali
@@ -86,6 +87,127 @@ Integration::BitmapPtr ApplyAttributesToBitmap( Integration::BitmapPtr bitmap, I
  * @note The input bitmap pixel buffer may be modified and used as scratch working space for efficiency, so it must be discarded.
  **/
 Integration::BitmapPtr DownscaleBitmap( Integration::Bitmap& bitmap, ImageDimensions desired, FittingMode::Type fittingMode, SamplingMode::Type samplingMode );
+
+/**
+ * @brief Downscales an image a scanline at a time as a loader decodes it.
+ *
+ * The bitmap made is the one ApplyAttributesToBitmap() would make of the whole
+ * decoded image, but only a few scanlines of the image and of each halving of
+ * it by the box filter are held at once, so the memory needed is proportional
+ * to the size of the output rather than to the size of the image.
+ *
+ * @note The last scanline of the image is repeated rather than read past the
+ * end of the image for linear sampling which does not reduce the height.
+ */
+class ScanlineDownscaler
+{
+public:
+
+  /**
+   * @brief Constructor, which reserves the buffer of the output bitmap if the image is to be downscaled.
+   * @param[in] bitmap The bitmap to write the downscaled image to.
+   * @param[in] pixelFormat The format of the scanlines decoded.
+   * @param[in] inputDimensions The dimensions of the image decoded.
+   * @param[in] requestedDimensions The dimensions requested, as passed to ApplyAttributesToBitmap().
+   * @param[in] fittingMode The fitting mode, as passed to ApplyAttributesToBitmap().
+   * @param[in] samplingMode The sampling mode, as passed to ApplyAttributesToBitmap().
+   */
+  ScanlineDownscaler( Integration::Bitmap& bitmap,
+                      Pixel::Format pixelFormat,
+                      ImageDimensions inputDimensions,
+                      ImageDimensions requestedDimensions,
+                      FittingMode::Type fittingMode,
+                      SamplingMode::Type samplingMode );
+
+  /**
+   * @brief Whether the attributes requested make the image smaller, so it is worth decoding it through this.
+   *
+   * If not, the bitmap is untouched and the image should be decoded into it whole.
+   */
+  bool IsDownscaling() const;
+
+  /**
+   * @return The buffer to decode the next scanline of the image into, of the width of the image.
+   */
+  uint8_t* GetScanline();
+
+  /**
+   * @brief Downscale the scanline decoded into the buffer returned by GetScanline().
+   */
+  void PushScanline();
+
+  /**
+   * @brief Finish off the bitmap once every scanline of the image has been pushed.
+   * @return False if some scanlines of the image were not pushed, leaving the bitmap incomplete.
+   */
+  bool Finish();
+
+private:
+
+  typedef void (*HalveScanlineFunction)( unsigned char * pixels, unsigned int width );
+  typedef void (*AverageScanlinesFunction)( const unsigned char * scanline1, const unsigned char * __restrict__ scanline2, unsigned char * outputScanline, unsigned int width );
+  typedef void (*LinearSampleScanlineFunction)( const uint8_t * __restrict__ inScanline1, const uint8_t * __restrict__ inScanline2, unsigned int inputWidth,
+                                                uint8_t * __restrict__ outScanline, unsigned int desiredWidth, unsigned int deltaX, unsigned int inputYWeight );
+  typedef void (*PointSampleScanlineFunction)( const uint8_t * inScanline, uint8_t * outScanline, unsigned int desiredWidth, unsigned int deltaX );
+
+  /**
+   * @brief Halve a scanline in one pass of the box filter, averaging it with
+   * the one before it and passing the result on if it is the second of a pair.
+   * @param[in] pass The pass of the box filter.
+   * @param[in,out] scanline The scanline, which is halved in place.
+   */
+  void BoxFilterScanline( unsigned int pass, uint8_t * scanline );
+
+  /**
+   * @brief Sample the output scanlines which can be made once a scanline of the box filtered image is available.
+   * @param[in] scanline The scanline of the box filtered image.
+   */
+  void SampleScanline( const uint8_t * scanline );
+
+  /**
+   * @brief Write the next scanline of the sampled image to the bitmap, unless it is cropped away.
+   * @param[in] scanline The scanline of the sampled image.
+   */
+  void OutputScanline( const uint8_t * scanline );
+
+  // Undefined
+  ScanlineDownscaler( const ScanlineDownscaler& );
+
+  // Undefined
+  ScanlineDownscaler& operator=( const ScanlineDownscaler& );
+
+private:
+
+  Integration::Bitmap&          mBitmap;
+  const Pixel::Format           mPixelFormat;
+  const unsigned int            mBytesPerPixel;
+  const unsigned int            mInputWidth;
+  const unsigned int            mInputHeight;
+  unsigned int                  mInputRow;              ///< The number of scanlines of the image pushed
+  unsigned int                  mBoxPasses;             ///< The number of times the box filter halves the image
+  HalveScanlineFunction         mHalveScanline;
+  AverageScanlinesFunction      mAverageScanlines;
+  unsigned int                  mShrunkWidth;           ///< The width of the image after the box filter
+  unsigned int                  mShrunkHeight;          ///< The height of the image after the box filter
+  unsigned int                  mShrunkRow;             ///< The number of scanlines the box filter has output
+  LinearSampleScanlineFunction  mLinearSampleScanline;  ///< Set if the box filtered image is linear sampled
+  PointSampleScanlineFunction   mPointSampleScanline;   ///< Set if the box filtered image is point sampled
+  unsigned int                  mFilteredWidth;         ///< The width of the image after sampling
+  unsigned int                  mFilteredHeight;        ///< The height of the image after sampling
+  unsigned int                  mFilteredRow;           ///< The number of scanlines sampled
+  unsigned int                  mDeltaX;                ///< The 16.16 fixed-point step through the box filtered image for each sampled pixel
+  unsigned int                  mDeltaY;                ///< The 16.16 fixed-point step through the box filtered image for each sampled scanline
+  unsigned int                  mColumnsToTrim;         ///< The columns cropped from each side of the sampled image
+  unsigned int                  mScanlinesToTrim;       ///< The scanlines cropped from the top and bottom of the sampled image
+  unsigned int                  mOutputWidth;
+  uint8_t*                      mOutputPixels;          ///< The buffer of the bitmap, or NULL if the image is not downscaled
+  Dali::Vector<uint8_t>         mScanline;              ///< The scanline of the image being decoded
+  Dali::Vector<uint8_t>         mBoxScanlines;          ///< The first of the pair of scanlines being halved by each pass of the box filter
+  Dali::Vector<unsigned int>    mBoxScanlineOffsets;    ///< The offset of the scanline of each pass in mBoxScanlines
+  Dali::Vector<bool>            mBoxScanlinePending;    ///< Whether each pass of the box filter is holding the first of a pair of scanlines
+  Dali::Vector<uint8_t>         mSampleScanlines;       ///< The last two scanlines of the box filtered image, for linear sampling
+  Dali::Vector<uint8_t>         mFilteredScanline;      ///< A sampled scanline, before cropping
+};
 /**@}*/
 
 /**
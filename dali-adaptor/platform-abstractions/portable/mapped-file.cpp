@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "mapped-file.h"
+
+// EXTERNAL INCLUDES
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <dali/integration-api/debug.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Platform
+{
+
+MappedFile::MappedFile( const char * const filename )
+: mData( NULL ),
+  mSize( 0 )
+{
+  DALI_ASSERT_DEBUG( filename != 0 && "Cant map a null filename." );
+
+  const int fd = open( filename, O_RDONLY );
+  if( fd < 0 )
+  {
+    return;
+  }
+
+  struct stat fileStatus;
+  if( fstat( fd, &fileStatus ) == 0 && S_ISREG( fileStatus.st_mode ) && fileStatus.st_size > 0 )
+  {
+    const std::size_t size = static_cast<std::size_t>( fileStatus.st_size );
+    void * const data = mmap( NULL, size, PROT_READ, MAP_PRIVATE, fd, 0 );
+    if( data != MAP_FAILED )
+    {
+      mData = static_cast<const uint8_t*>( data );
+      mSize = size;
+    }
+    else
+    {
+      DALI_LOG_WARNING( "File mapping failed for: \"%s\".\n", filename );
+    }
+  }
+
+  // The mapping stays valid once the descriptor it was made through is closed:
+  close( fd );
+}
+
+MappedFile::~MappedFile()
+{
+  if( mData )
+  {
+    munmap( const_cast<uint8_t*>( mData ), mSize );
+  }
+}
+
+} /* namespace Platform */
+} /* namespace Internal */
+} /* namespace Dali */
@@ -0,0 +1,104 @@
+#ifndef _DALI_INTERNAL_PLATFORM_MAPPED_FILE_H__
+#define _DALI_INTERNAL_PLATFORM_MAPPED_FILE_H__
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstddef>
+#include <stdint.h>
+#include <dali/public-api/object/ref-object.h>
+#include <dali/public-api/common/intrusive-ptr.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Platform
+{
+
+class MappedFile;
+typedef IntrusivePtr<MappedFile> MappedFilePtr;
+
+/**
+ * @brief A whole file mapped read-only into memory, so it can be decoded
+ * without being read into a buffer first.
+ *
+ * It is reference counted so a bitmap can keep the mapping alive while its
+ * pixels point into it.
+ * Mapping fails for files which are empty or not on a filesystem supporting
+ * it, in which case callers should fall back to reading the file with stdio.
+ */
+class MappedFile : public RefObject
+{
+public:
+
+  /**
+   * @brief Map the file at the path passed in.
+   * @param[in] filename The path of the file.
+   */
+  MappedFile( const char * const filename );
+
+  /**
+   * @return Whether the file was mapped.
+   */
+  bool IsMapped() const
+  {
+    return mData != NULL;
+  }
+
+  /**
+   * @return The contents of the file, or NULL if it was not mapped.
+   */
+  const uint8_t* GetData() const
+  {
+    return mData;
+  }
+
+  /**
+   * @return The size of the file in bytes, or zero if it was not mapped.
+   */
+  std::size_t GetSize() const
+  {
+    return mSize;
+  }
+
+protected:
+
+  /**
+   * @brief Unmap the file. A reference counted object may only be deleted by calling Unreference().
+   */
+  virtual ~MappedFile();
+
+private:
+
+  // Undefined
+  MappedFile( const MappedFile& );
+
+  // Undefined
+  MappedFile& operator=( const MappedFile& );
+
+private:
+
+  const uint8_t* mData;
+  std::size_t    mSize;
+};
+
+} /* namespace Platform */
+} /* namespace Internal */
+} /* namespace Dali */
+
+#endif /* _DALI_INTERNAL_PLATFORM_MAPPED_FILE_H__ */
@@ -25,6 +25,14 @@
 
 namespace Dali
 {
+namespace Internal
+{
+namespace Platform
+{
+class MappedFile;
+} // Platform
+} // Internal
+
 namespace TizenPlatform
 {
 namespace ImageLoader
@@ -51,11 +59,13 @@ public:
    */
 struct Input
 {
-  Input( FILE* file, ScalingParameters scalingParameters = ScalingParameters(), bool reorientationRequested = true ) :
-    file(file), scalingParameters(scalingParameters), reorientationRequested(reorientationRequested) {}
+  Input( FILE* file, ScalingParameters scalingParameters = ScalingParameters(), bool reorientationRequested = true, Internal::Platform::MappedFile* mappedFile = NULL ) :
+    file(file), scalingParameters(scalingParameters), reorientationRequested(reorientationRequested), mappedFile(mappedFile), scalingApplied(false) {}
   FILE* file;
   ScalingParameters scalingParameters;
   bool reorientationRequested;
+  Internal::Platform::MappedFile* mappedFile; ///< The whole file mapped into memory for loaders which can decode straight out of it, or NULL. The file reads the same bytes.
+  mutable bool scalingApplied; ///< Set by a loader which scaled the image to the scaling parameters as it decoded it, so they are not applied again.
 };
 
 } // ImageLoader
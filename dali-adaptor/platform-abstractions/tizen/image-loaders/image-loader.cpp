@@ -248,7 +248,7 @@ bool GetBitmapLoaderFunctions( FILE *fp,
 namespace ImageLoader
 {
 
-bool ConvertStreamToBitmap( const ResourceType& resourceType, std::string path, FILE * const fp, const ResourceLoadingClient& client, BitmapPtr& ptr )
+bool ConvertStreamToBitmap( const ResourceType& resourceType, std::string path, FILE * const fp, const ResourceLoadingClient& client, BitmapPtr& ptr, Internal::Platform::MappedFile* mappedFile )
 {
   DALI_LOG_TRACE_METHOD( gLogFilter );
   DALI_ASSERT_DEBUG( ResourceBitmap == resourceType.id );
@@ -273,7 +273,7 @@ bool ConvertStreamToBitmap( const ResourceType& resourceType, std::string path,
       DALI_LOG_SET_OBJECT_STRING( bitmap, path );
       const BitmapResourceType& resType = static_cast<const BitmapResourceType&>( resourceType );
       const ScalingParameters scalingParameters( resType.size, resType.scalingMode, resType.samplingMode );
-      const ImageLoader::Input input( fp, scalingParameters, resType.orientationCorrection );
+      const ImageLoader::Input input( fp, scalingParameters, resType.orientationCorrection, mappedFile );
 
       // Check for cancellation now we have hit the filesystem, done some allocation, and burned some cycles:
       // This won't do anything from synchronous API, it's only useful when called from another thread.
@@ -288,9 +288,12 @@ bool ConvertStreamToBitmap( const ResourceType& resourceType, std::string path,
         bitmap = 0;
       }
 
-      // Apply the requested image attributes if not interrupted:
+      // Apply the requested image attributes if not interrupted, unless the decoder already did as it went:
       client.InterruptionPoint(); // Note: By design, this can throw an exception
-      bitmap = Internal::Platform::ApplyAttributesToBitmap( bitmap, resType.size, resType.scalingMode, resType.samplingMode );
+      if( !input.scalingApplied )
+      {
+        bitmap = Internal::Platform::ApplyAttributesToBitmap( bitmap, resType.size, resType.scalingMode, resType.samplingMode );
+      }
     }
     else
     {
@@ -307,11 +310,12 @@ ResourcePointer LoadResourceSynchronously( const Integration::ResourceType& reso
   ResourcePointer resource;
   BitmapPtr bitmap = 0;
 
-  Internal::Platform::FileCloser fc( resourcePath.c_str(), "rb");
+  Internal::Platform::MappedFilePtr mappedFile( new Internal::Platform::MappedFile( resourcePath.c_str() ) );
+  Internal::Platform::FileCloser fc( *mappedFile, resourcePath.c_str(), "rb");
   FILE * const fp = fc.GetFile();
   if( fp != NULL )
   {
-    bool result = ConvertStreamToBitmap( resourceType, resourcePath, fp, StubbedResourceLoadingClient(), bitmap );
+    bool result = ConvertStreamToBitmap( resourceType, resourcePath, fp, StubbedResourceLoadingClient(), bitmap, mappedFile->IsMapped() ? mappedFile.Get() : NULL );
     if( result && bitmap )
     {
       resource.Reset(bitmap.Get());
@@ -28,6 +28,14 @@
 
 namespace Dali
 {
+namespace Internal
+{
+namespace Platform
+{
+class MappedFile;
+} // Platform
+} // Internal
+
 namespace TizenPlatform
 {
 namespace ImageLoader
@@ -39,9 +47,10 @@ namespace ImageLoader
  * @param[in] fp File Pointer. Closed on exit.
  * @param[in] client The component that is initiating the conversion.
  * @param[out] bitmap Pointer to write bitmap to
+ * @param[in] mappedFile The file fp reads mapped into memory, for decoders which can read it directly, or NULL.
  * @return true on success, false on failure
  */
-bool ConvertStreamToBitmap( const Integration::ResourceType& resourceType, std::string path, FILE * const fp, const ResourceLoadingClient& client, Integration::BitmapPtr& ptr);
+bool ConvertStreamToBitmap( const Integration::ResourceType& resourceType, std::string path, FILE * const fp, const ResourceLoadingClient& client, Integration::BitmapPtr& ptr, Internal::Platform::MappedFile* mappedFile = NULL );
 
 /**
  * Convert a bitmap and write to a file stream.
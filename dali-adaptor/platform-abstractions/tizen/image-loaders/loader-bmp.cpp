@@ -23,6 +23,8 @@
 
 #include <cstdlib>
 
+#include "image-operations.h"
+
 namespace Dali
 {
 using Integration::Bitmap;
@@ -1039,6 +1041,52 @@ bool DecodeRLE8(FILE *fp,
   return true;
 }
 
+/**
+ * function to decode 24 bpp BI_RGB rows from the top of the image down, pushing each through a downscaler.
+ * @param[in]  fp         The file to read from
+ * @param[in]  downscaler The downscaler to push the rows through
+ * @param[in]  height     bmp height
+ * @param[in]  offset     offset from the start of the file to bmp image data
+ * @param[in]  topDown    indicate image data is read from bottom or from top
+ * @param[in]  rowStride  The bytes in each row of pixels
+ * @param[in]  padding    padded to a u_int32 boundary for each line
+ * @return true, if decode successful, false otherwise
+ */
+bool DownscaleRGB24(FILE *fp,
+                    Internal::Platform::ScanlineDownscaler& downscaler,
+                    unsigned int height,
+                    long offset,
+                    bool topDown,
+                    unsigned int rowStride,
+                    unsigned int padding)
+{
+  for(unsigned int yPos = 0; yPos < height; yPos ++)
+  {
+    // Rows stored bottom up are read back to front, as the downscaler takes them from the top down
+    const long rowOffset = offset + static_cast<long>( topDown ? yPos : (height-1)-yPos ) * ( rowStride + padding );
+    if ( fseek(fp, rowOffset, SEEK_SET) )
+    {
+      DALI_LOG_ERROR("Error seeking BMP data\n");
+      return false;
+    }
+
+    PixelBuffer *pixelsPtr = downscaler.GetScanline();
+    if (fread(pixelsPtr, 1, rowStride, fp) != rowStride)
+    {
+      DALI_LOG_ERROR("Error reading the BMP image\n");
+      return false;
+    }
+    for(unsigned int i = 0; i < rowStride; i += 3)
+    {
+      unsigned char temp = pixelsPtr[i];
+      pixelsPtr[i] = pixelsPtr[i + 2];
+      pixelsPtr[i + 2] = temp;
+    }
+    downscaler.PushScanline();
+  }
+  return downscaler.Finish();
+}
+
 } // unnamed namespace
 
 bool LoadBmpHeader( const ImageLoader::Input& input, unsigned int& width, unsigned int& height )
@@ -1194,6 +1242,19 @@ bool LoadBitmapFromBmp( const ResourceLoadingClient& client, const ImageLoader::
     padding = 4 - padding;
   }
 
+  // Downscale 24 bpp images as their rows are read, rather than holding the whole image first:
+  if( infoHeader.bitsPerPixel == 24 && ( customizedFormat == BMP_NOTEXIST || customizedFormat == BMP_RGB24V5 ) )
+  {
+    const ImageLoader::ScalingParameters& scaling = input.scalingParameters;
+    Internal::Platform::ScanlineDownscaler downscaler( bitmap, Pixel::RGB888, ImageDimensions( width, height ), scaling.dimensions, scaling.scalingMode, scaling.samplingMode );
+    if( downscaler.IsDownscaling() )
+    {
+      const long offset = customizedFormat == BMP_RGB24V5 ? static_cast<long>( fileHeader.offset ) : ftell( fp );
+      input.scalingApplied = DownscaleRGB24( fp, downscaler, height, offset, topDown, rowStride, padding );
+      return input.scalingApplied;
+    }
+  }
+
   PixelBuffer *pixels =  NULL;
   int imageW = infoHeader.width;
   int pixelBufferW = 0;
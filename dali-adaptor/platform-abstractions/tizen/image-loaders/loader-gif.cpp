@@ -23,6 +23,8 @@
 #include <dali/integration-api/debug.h>
 #include <dali/integration-api/bitmap.h>
 
+#include "image-operations.h"
+
 namespace Dali
 {
 using Integration::Bitmap;
@@ -156,6 +158,37 @@ bool DecodeImage( GifFileType* gifInfo, PixelBuffer* decodedData, const unsigned
   return true;
 }
 
+/// Decode the lines of a GIF image which is not interlaced one at a time, converting each to RGB888 and pushing it through a downscaler.
+bool DownscaleImage( GifFileType* gifInfo, const GifColorType* color, const unsigned int width, const unsigned int height, Internal::Platform::ScanlineDownscaler& downscaler )
+{
+  // Only one line of the image is decoded at a time:
+  PixelBuffer* decodedLine( new PixelBuffer[ width * sizeof( GifPixelType ) ] );
+  AutoDeleteBuffer autoDeleteBuffer( decodedLine );
+
+  for ( unsigned int row = 0; row < height; ++row )
+  {
+    if ( DGifGetLine( gifInfo, decodedLine, width ) == GIF_ERROR )
+    {
+      DALI_LOG_ERROR( "GIF Loader: Error reading non-interlaced GIF\n" );
+      return false;
+    }
+
+    PixelBuffer* pixels = downscaler.GetScanline();
+    for ( unsigned int column = 0; column < width; ++column )
+    {
+      unsigned char index = decodedLine[column];
+
+      pixels[0] = color[index].Red;
+      pixels[1] = color[index].Green;
+      pixels[2] = color[index].Blue;
+      pixels += 3;
+    }
+    downscaler.PushScanline();
+  }
+
+  return downscaler.Finish();
+}
+
 // Retrieves the colors used in the GIF image.
 GifColorType* GetImageColors( SavedImage* image, GifFileType* gifInfo )
 {
@@ -173,7 +206,7 @@ GifColorType* GetImageColors( SavedImage* image, GifFileType* gifInfo )
 }
 
 /// Called when we want to handle IMAGE_DESC_RECORD_TYPE
-bool HandleImageDescriptionRecordType( Bitmap& bitmap, GifFileType* gifInfo, unsigned int width, unsigned int height, bool& finished )
+bool HandleImageDescriptionRecordType( const ImageLoader::Input& input, Bitmap& bitmap, GifFileType* gifInfo, unsigned int width, unsigned int height, bool& finished )
 {
   if ( DGifGetImageDesc( gifInfo ) == GIF_ERROR )
   {
@@ -191,13 +224,38 @@ bool HandleImageDescriptionRecordType( Bitmap& bitmap, GifFileType* gifInfo, uns
   SavedImage* image( &gifInfo->SavedImages[ gifInfo->ImageCount - 1 ] );
   const GifImageDesc& desc( image->ImageDesc );
 
+  const unsigned int actualWidth( desc.Width );
+  const unsigned int actualHeight( desc.Height );
+
+  // Get the colormap for the GIF
+  GifColorType* color( GetImageColors( image, gifInfo ) );
+
+  // If it's an animated GIF, we still only read the first image
+
+  Pixel::Format pixelFormat( Pixel::RGB888 );
+
+  // Downscale images which are not interlaced as their lines are decoded, rather than holding the whole image first:
+  if ( !gifInfo->Image.Interlace )
+  {
+    const ImageLoader::ScalingParameters& scaling = input.scalingParameters;
+    Internal::Platform::ScanlineDownscaler downscaler( bitmap, pixelFormat, ImageDimensions( actualWidth, actualHeight ), scaling.dimensions, scaling.scalingMode, scaling.samplingMode );
+    if ( downscaler.IsDownscaling() )
+    {
+      if ( !DownscaleImage( gifInfo, color, actualWidth, actualHeight, downscaler ) )
+      {
+        return false;
+      }
+      input.scalingApplied = true;
+      finished = true;
+      return true;
+    }
+  }
+
   // Create a buffer to store the decoded data.
   PixelBuffer* decodedData( new PixelBuffer[ width * height * sizeof( GifPixelType ) ] );
   AutoDeleteBuffer autoDeleteBuffer( decodedData );
 
   const unsigned int bytesPerRow( width * sizeof( GifPixelType ) );
-  const unsigned int actualWidth( desc.Width );
-  const unsigned int actualHeight( desc.Height );
 
   // Decode the GIF Image
   if ( !DecodeImage( gifInfo, decodedData, actualWidth, actualHeight, bytesPerRow ) )
@@ -205,14 +263,8 @@ bool HandleImageDescriptionRecordType( Bitmap& bitmap, GifFileType* gifInfo, uns
     return false;
   }
 
-  // Get the colormap for the GIF
-  GifColorType* color( GetImageColors( image, gifInfo ) );
-
-  // If it's an animated GIF, we still only read the first image
-
   // Create and populate pixel buffer.
 
-  Pixel::Format pixelFormat( Pixel::RGB888 );
   PixelBuffer *pixels = bitmap.GetPackedPixelsProfile()->ReserveBuffer( pixelFormat, actualWidth, actualHeight );
 
   for (unsigned int row = 0; row < actualHeight; ++row)
@@ -297,7 +349,7 @@ bool LoadBitmapFromGif( const ResourceLoadingClient& client, const ImageLoader::
 
     if( IMAGE_DESC_RECORD_TYPE == recordType )
     {
-      if ( !HandleImageDescriptionRecordType( bitmap, gifInfo, width, height, finished ) )
+      if ( !HandleImageDescriptionRecordType( input, bitmap, gifInfo, width, height, finished ) )
       {
         return false;
       }
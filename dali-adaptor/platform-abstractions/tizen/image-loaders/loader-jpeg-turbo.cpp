@@ -22,6 +22,7 @@
 #include <resource-loader/debug/resource-loader-debug.h>
 #include "platform-capabilities.h"
 #include "image-operations.h"
+#include "portable/mapped-file.h"
 
 // EXTERNAL HEADERS
 #include <libexif/exif-data.h>
@@ -162,6 +163,63 @@ namespace
   const int MAX_TEXTURE_WIDTH  = 4096;
   const int MAX_TEXTURE_HEIGHT = 4096;
 
+  /**
+   * Pull the compressed JPEG image bytes out of a file and into memory.
+   * @param[in]  fp         The file to read, which is left at its start
+   * @param[out] jpegBuffer The buffer to read the whole file into, which is reserved but left empty
+   * @param[out] jpegBufferSize The number of bytes read into the buffer
+   * @return true, if the whole file was read, false otherwise
+   */
+  bool ReadJpegFile( FILE* const fp, Vector<unsigned char>& jpegBuffer, unsigned int& jpegBufferSize )
+  {
+    if( fseek(fp,0,SEEK_END) )
+    {
+      DALI_LOG_ERROR("Error seeking to end of file\n");
+      return false;
+    }
+
+    long positionIndicator = ftell(fp);
+    jpegBufferSize = 0u;
+    if( positionIndicator > -1L )
+    {
+      jpegBufferSize = static_cast<unsigned int>(positionIndicator);
+    }
+
+    if( 0u == jpegBufferSize )
+    {
+      return false;
+    }
+
+    if( fseek(fp, 0, SEEK_SET) )
+    {
+      DALI_LOG_ERROR("Error seeking to start of file\n");
+      return false;
+    }
+
+    try
+    {
+      jpegBuffer.Reserve( jpegBufferSize );
+    }
+    catch(...)
+    {
+      DALI_LOG_ERROR( "Could not allocate temporary memory to hold JPEG file of size %uMB.\n", jpegBufferSize / 1048576U );
+      return false;
+    }
+
+    if( fread( jpegBuffer.Begin(), 1, jpegBufferSize, fp ) != jpegBufferSize )
+    {
+      DALI_LOG_WARNING("Error on image file read.");
+      return false;
+    }
+
+    if( fseek(fp, 0, SEEK_SET) )
+    {
+      DALI_LOG_ERROR("Error seeking to start of file\n");
+    }
+
+    return true;
+  }
+
 } // namespace
 
 bool JpegRotate90 (unsigned char *buffer, int width, int height, int bpp);
@@ -214,54 +272,24 @@ bool LoadJpegHeader( FILE *fp, unsigned int &width, unsigned int &height )
 bool LoadBitmapFromJpeg( const ResourceLoadingClient& client, const ImageLoader::Input& input, Integration::Bitmap& bitmap )
 {
   const int flags= 0;
-  FILE* const fp = input.file;
-
-  if( fseek(fp,0,SEEK_END) )
-  {
-    DALI_LOG_ERROR("Error seeking to end of file\n");
-    return false;
-  }
-
-  long positionIndicator = ftell(fp);
-  unsigned int jpegBufferSize = 0u;
-  if( positionIndicator > -1L )
-  {
-    jpegBufferSize = static_cast<unsigned int>(positionIndicator);
-  }
-
-  if( 0u == jpegBufferSize )
-  {
-    return false;
-  }
-
-  if( fseek(fp, 0, SEEK_SET) )
-  {
-    DALI_LOG_ERROR("Error seeking to start of file\n");
-    return false;
-  }
 
   Vector<unsigned char> jpegBuffer;
-  try
-  {
-    jpegBuffer.Reserve( jpegBufferSize );
-  }
-  catch(...)
-  {
-    DALI_LOG_ERROR( "Could not allocate temporary memory to hold JPEG file of size %uMB.\n", jpegBufferSize / 1048576U );
-    return false;
-  }
-  unsigned char * const jpegBufferPtr = jpegBuffer.Begin();
+  unsigned char * jpegBufferPtr = NULL;
+  unsigned int jpegBufferSize = 0u;
 
-  // Pull the compressed JPEG image bytes out of a file and into memory:
-  if( fread( jpegBufferPtr, 1, jpegBufferSize, fp ) != jpegBufferSize )
+  if( input.mappedFile )
   {
-    DALI_LOG_WARNING("Error on image file read.");
-    return false;
+    // Decode straight out of the file mapped into memory, as TurboJPEG only lacks const on the buffers it reads:
+    jpegBufferPtr = const_cast<unsigned char*>( input.mappedFile->GetData() );
+    jpegBufferSize = static_cast<unsigned int>( input.mappedFile->GetSize() );
   }
-
-  if( fseek(fp, 0, SEEK_SET) )
+  else
   {
-    DALI_LOG_ERROR("Error seeking to start of file\n");
+    if( !ReadJpegFile( input.file, jpegBuffer, jpegBufferSize ) )
+    {
+      return false;
+    }
+    jpegBufferPtr = jpegBuffer.Begin();
   }
 
   // Allow early cancellation between the load and the decompress:
@@ -25,6 +25,7 @@
 #include <dali/integration-api/debug.h>
 #include <dali/integration-api/bitmap.h>
 #include <dali/public-api/images/pixel.h>
+#include "portable/mapped-file.h"
 
 namespace Dali
 {
@@ -115,6 +116,21 @@ struct KtxFileHeader
 // Packed attribute stops the structure from being aligned to compiler defaults
 // so we can be sure of reading the whole thing from file in one call to fread.
 
+/**
+ * Keeps a file mapped into memory while a bitmap uses the pixels in it.
+ */
+class MappedPixels : public Integration::Bitmap::ExternalBuffer
+{
+public:
+  MappedPixels( Internal::Platform::MappedFile& mappedFile )
+  : mMappedFile( &mappedFile )
+  {
+  }
+
+private:
+  Internal::Platform::MappedFilePtr mMappedFile;
+};
+
 /**
  * Template function to read from the file directly into our structure.
  * @param[in]  fp     The file to read from
@@ -357,6 +373,21 @@ bool LoadBitmapFromKtx( const ResourceLoadingClient& client, const ImageLoader::
     return false;
   }
 
+  // Hand the image bytes of a file mapped into memory to the bitmap where they lie,
+  // so they are uploaded to the texture straight out of the mapping:
+  if( input.mappedFile )
+  {
+    const size_t imageOffset = imageSizeOffset + sizeof(imageByteCount);
+    if( imageOffset + imageByteCount > input.mappedFile->GetSize() )
+    {
+      DALI_LOG_ERROR( "KTX image data runs past the end of the file.\n" );
+      return false;
+    }
+    PixelBuffer * const pixels = const_cast<PixelBuffer*>( input.mappedFile->GetData() + imageOffset );
+    bitmap.GetCompressedProfile()->AssignExternalBuffer( pixelFormat, width, height, pixels, (size_t) imageByteCount, new MappedPixels( *input.mappedFile ) );
+    return true;
+  }
+
   // Load up the image bytes:
   PixelBuffer * const pixels = bitmap.GetCompressedProfile()->ReserveBufferOfSize( pixelFormat, width, height, (size_t) imageByteCount );
   if(!pixels)
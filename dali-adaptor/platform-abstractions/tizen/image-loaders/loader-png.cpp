@@ -29,6 +29,7 @@
 #include "dali/public-api/math/math-utils.h"
 #include "dali/public-api/math/vector2.h"
 #include "platform-capabilities.h"
+#include "image-operations.h"
 
 namespace Dali
 {
@@ -115,6 +116,28 @@ bool LoadPngHeader(FILE *fp, unsigned int &width, unsigned int &height, png_stru
   return true;
 }
 
+/**
+ * @brief Decode the rows of a non-interlaced image one at a time, pushing each through a downscaler.
+ *
+ * This has its own setjmp() so a decoding error does not jump over the destructor of the downscaler.
+ */
+bool DownscalePngRows( png_structp png, unsigned int height, Internal::Platform::ScanlineDownscaler& downscaler )
+{
+  if(setjmp(png_jmpbuf(png)))
+  {
+    DALI_LOG_WARNING("error during png_read_row\n");
+    return false;
+  }
+
+  for( unsigned int y = 0; y < height; ++y )
+  {
+    png_read_row( png, downscaler.GetScanline(), NULL );
+    downscaler.PushScanline();
+  }
+
+  return downscaler.Finish();
+}
+
 } // namespace - anonymous
 
 bool LoadPngHeader( const ImageLoader::Input& input, unsigned int& width, unsigned int& height )
@@ -284,6 +307,18 @@ bool LoadBitmapFromPng( const ResourceLoadingClient& client, const ImageLoader::
 
   unsigned int rowBytes = png_get_rowbytes(png, info);
 
+  // Downscale images decoded in row order as the rows are decoded, rather than holding the whole image first:
+  if( png_get_interlace_type(png, info) == PNG_INTERLACE_NONE && rowBytes == width * bpp )
+  {
+    const ImageLoader::ScalingParameters& scaling = input.scalingParameters;
+    Internal::Platform::ScanlineDownscaler downscaler( bitmap, pixelFormat, ImageDimensions( width, height ), scaling.dimensions, scaling.scalingMode, scaling.samplingMode );
+    if( downscaler.IsDownscaling() )
+    {
+      input.scalingApplied = DownscalePngRows( png, height, downscaler );
+      return input.scalingApplied;
+    }
+  }
+
   unsigned int bufferWidth   = GetTextureDimension(width);
   unsigned int bufferHeight  = GetTextureDimension(height);
   unsigned int stride        = bufferWidth*bpp;
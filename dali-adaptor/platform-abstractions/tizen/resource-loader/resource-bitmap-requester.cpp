@@ -117,7 +117,8 @@ void ResourceBitmapRequester::LoadResource( Integration::ResourceRequest& reques
   {
     if( !mThreadImageLocal )
     {
-      mThreadImageLocal = new ResourceThreadImage( mResourceLoader );
+      // Local images are decoded concurrently on a worker per core
+      mThreadImageLocal = new ResourceThreadImage( mResourceLoader, ResourceThreadBase::GetWorkerCountForCores() );
     }
     mThreadImageLocal->AddRequest( request, requestType );
   }
@@ -125,6 +126,7 @@ void ResourceBitmapRequester::LoadResource( Integration::ResourceRequest& reques
   {
     if( !mThreadImageRemote )
     {
+      // A single worker, as libcurl is initialised by the first download
       mThreadImageRemote = new ResourceThreadImage( mResourceLoader );
     }
     mThreadImageRemote->AddRequest( request, requestType );
@@ -36,6 +36,7 @@
 #include "resource-requester-base.h"
 #include "resource-bitmap-requester.h"
 #include "debug/resource-loader-debug.h"
+#include "portable/mapped-file.h"
 
 using namespace Dali::Integration;
 
@@ -324,6 +325,19 @@ bool ResourceLoader::LoadFile( const std::string& filename, Dali::Vector< unsign
 
   DALI_ASSERT_DEBUG( 0 != filename.length());
 
+  // Copy a file which can be mapped into memory in one go, rather than reading it through a stream:
+  Internal::Platform::MappedFilePtr mappedFile( new Internal::Platform::MappedFile( filename.c_str() ) );
+  if( mappedFile->IsMapped() )
+  {
+    unsigned char * const data = const_cast<unsigned char*>( mappedFile->GetData() );
+    buffer.Clear();
+    buffer.Reserve( mappedFile->GetSize() );
+    buffer.Insert( buffer.End(), data, data + mappedFile->GetSize() );
+
+    DALI_LOG_INFO(gLoaderFilter, Debug::Verbose, "ResourceLoader::LoadFile(%s) - mapped %d bytes\n", filename.c_str(), static_cast<int>( mappedFile->GetSize() ));
+    return true;
+  }
+
   bool result;
 
   std::filebuf buf;
@@ -363,6 +377,15 @@ std::string ResourceLoader::LoadFile(const std::string& filename) const
 
   std::string contents;
 
+  Internal::Platform::MappedFilePtr mappedFile( new Internal::Platform::MappedFile( filename.c_str() ) );
+  if( mappedFile->IsMapped() )
+  {
+    contents.assign( reinterpret_cast<const char*>( mappedFile->GetData() ), mappedFile->GetSize() );
+
+    DALI_LOG_INFO(gLoaderFilter, Debug::Verbose, "ResourceLoader::LoadFile(%s) - mapped %d bytes\n", filename.c_str(), static_cast<int>( mappedFile->GetSize() ));
+    return contents;
+  }
+
   std::filebuf buf;
   buf.open(filename.c_str(), std::ios::in);
   if( buf.is_open() )
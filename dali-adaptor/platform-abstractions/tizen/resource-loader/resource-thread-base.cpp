@@ -16,7 +16,9 @@
  */
 
 // EXTERNAL INCLUDES
+#include <algorithm>
 #include <memory>
+#include <unistd.h>
 #include <dali/integration-api/debug.h>
 
 // INTERNAL INCLUDES
@@ -41,46 +43,90 @@ namespace TizenPlatform
 namespace
 {
 const char * const IDLE_PRIORITY_ENVIRONMENT_VARIABLE_NAME = "DALI_RESOURCE_THREAD_IDLE_PRIORITY";
+
+// The most worker threads created for the cores; decoded images are large, so the number of them in flight is bounded
+const unsigned int MAX_WORKERS_FOR_CORES = 8u;
 } // unnamed namespace
 
 /** Thrown by InterruptionPoint() to abort a request early. */
 class CancelRequestException {};
 
-ResourceThreadBase::ResourceThreadBase( ResourceLoader& resourceLoader ) :
+ResourceThreadBase::Worker::Worker( ResourceThreadBase& pool )
+: owner( pool ),
+  thread( 0 ),
+  currentRequestId( NO_REQUEST_IN_FLIGHT ),
+  cancelRequestId( NO_REQUEST_CANCELLED )
+{
+}
+
+ResourceThreadBase::ResourceThreadBase( ResourceLoader& resourceLoader, unsigned int workerCount ) :
   mResourceLoader( resourceLoader ),
-  mThread( 0 ),
-  mCurrentRequestId( NO_REQUEST_IN_FLIGHT ),
-  mCancelRequestId( NO_REQUEST_CANCELLED ),
-  mPaused( false )
+  mWorkers(),
+  mPaused( false ),
+  mTerminating( false )
 {
 #if defined(DEBUG_ENABLED)
   mLogFilter = Debug::Filter::New(Debug::Concise, false, "LOG_RESOURCE_THREAD_BASE");
 #endif
 
-  int error = pthread_create( &mThread, NULL, InternalThreadEntryFunc, this );
-  DALI_ASSERT_ALWAYS( !error && "Error in pthread_create()" );
+  int error = pthread_key_create( &mWorkerKey, NULL );
+  DALI_ASSERT_ALWAYS( !error && "Error in pthread_key_create()" );
+
+  // All the workers are created before any thread starts, so the threads never see the container change
+  workerCount = std::max( workerCount, 1u );
+  mWorkers.Reserve( workerCount );
+  for( unsigned int i = 0; i < workerCount; ++i )
+  {
+    mWorkers.PushBack( new Worker( *this ) );
+  }
+
+  for( WorkerContainer::Iterator iter = mWorkers.Begin(), endIter = mWorkers.End(); iter != endIter; ++iter )
+  {
+    error = pthread_create( &(*iter)->thread, NULL, InternalThreadEntryFunc, *iter );
+    DALI_ASSERT_ALWAYS( !error && "Error in pthread_create()" );
+  }
 }
 
 ResourceThreadBase::~ResourceThreadBase()
 {
   TerminateThread();
 
+  pthread_key_delete( mWorkerKey );
+
 #if defined(DEBUG_ENABLED)
   delete mLogFilter;
 #endif
 }
 
+unsigned int ResourceThreadBase::GetWorkerCountForCores()
+{
+  const long cores = sysconf( _SC_NPROCESSORS_ONLN );
+  if( cores < 1 )
+  {
+    return 1u;
+  }
+  return std::min( static_cast<unsigned int>( cores ), MAX_WORKERS_FOR_CORES );
+}
+
 void ResourceThreadBase::TerminateThread()
 {
-  if (mThread)
+  if( !mWorkers.Empty() )
   {
-    // wake thread
-    mCondition.Notify();
+    {
+      ConditionalWait::ScopedLock lock( mCondition );
+      mTerminating = true;
+    }
 
-    // wait for thread to exit
-    pthread_join( mThread, NULL );
+    // wake threads
+    mCondition.Notify();
 
-    mThread = 0;
+    // wait for threads to exit
+    for( WorkerContainer::Iterator iter = mWorkers.Begin(), endIter = mWorkers.End(); iter != endIter; ++iter )
+    {
+      pthread_join( (*iter)->thread, NULL );
+      delete *iter;
+    }
+    mWorkers.Clear();
   }
 }
 
@@ -93,15 +139,17 @@ void ResourceThreadBase::AddRequest(const ResourceRequest& request, const Reques
     // Lock while adding to the request queue
     ConditionalWait::ScopedLock lock( mCondition );
 
-    wasEmpty = mQueue.empty();
+    wasEmpty = AreQueuesEmpty();
     wasPaused = mPaused;
 
-    mQueue.push_back( std::make_pair(request, type) );
+    const unsigned int lane = std::min( static_cast<unsigned int>( request.GetPriority() ), NUM_PRIORITY_LANES - 1u );
+    mQueues[ lane ].push_back( std::make_pair(request, type) );
   }
 
+  // The workers only wait when all the queues are empty
   if( wasEmpty && !wasPaused )
   {
-    // Wake-up the thread
+    // Wake-up the threads
     mCondition.Notify();
   }
 }
@@ -117,33 +165,51 @@ void ResourceThreadBase::CancelRequest( const Integration::ResourceId resourceId
     // Lock while searching and removing from the request queue:
     ConditionalWait::ScopedLock lock( mCondition );
 
-    for( RequestQueueIter iterator = mQueue.begin();
-         iterator != mQueue.end();
-         ++iterator )
+    for( unsigned int lane = 0; lane < NUM_PRIORITY_LANES && !found; ++lane )
     {
-      if( ((*iterator).first).GetId() == resourceId )
+      RequestQueue& queue = mQueues[ lane ];
+      for( RequestQueueIter iterator = queue.begin();
+           iterator != queue.end();
+           ++iterator )
       {
-        iterator = mQueue.erase( iterator );
-        found = true;
-        break;
+        if( ((*iterator).first).GetId() == resourceId )
+        {
+          iterator = queue.erase( iterator );
+          found = true;
+          break;
+        }
       }
     }
-  }
 
-  // Remember the cancelled id for the worker thread to poll at one of its points
-  // of interruption:
-  if( !found )
-  {
-    Dali::Internal::AtomicWriteToCacheableAlignedAddress( &mCancelRequestId, resourceId );
-    DALI_LOG_INFO( mLogFilter, Debug::Concise, "%s: Cancelling in-flight resource (%u).\n", __FUNCTION__, unsigned(resourceId) );
+    // Remember the cancelled id for the worker thread processing it to poll at
+    // one of its points of interruption:
+    if( !found )
+    {
+      for( WorkerContainer::Iterator iter = mWorkers.Begin(), endIter = mWorkers.End(); iter != endIter; ++iter )
+      {
+        Worker& worker = **iter;
+        if( worker.currentRequestId == resourceId )
+        {
+          Dali::Internal::AtomicWriteToCacheableAlignedAddress( &worker.cancelRequestId, resourceId );
+          DALI_LOG_INFO( mLogFilter, Debug::Concise, "%s: Cancelling in-flight resource (%u).\n", __FUNCTION__, unsigned(resourceId) );
+        }
+      }
+    }
   }
 }
 
 // Called from worker thread.
 void ResourceThreadBase::InterruptionPoint() const
 {
-  const Integration::ResourceId cancelled = Dali::Internal::AtomicReadFromCacheableAlignedAddress( &mCancelRequestId );
-  const Integration::ResourceId current = mCurrentRequestId;
+  const Worker* worker = static_cast<const Worker*>( pthread_getspecific( mWorkerKey ) );
+  if( NULL == worker )
+  {
+    // Not called from a worker thread
+    return;
+  }
+
+  const Integration::ResourceId cancelled = Dali::Internal::AtomicReadFromCacheableAlignedAddress( &worker->cancelRequestId );
+  const Integration::ResourceId current = worker->currentRequestId;
 
   if( current == cancelled )
   {
@@ -152,9 +218,10 @@ void ResourceThreadBase::InterruptionPoint() const
   }
 }
 
-void* ResourceThreadBase::InternalThreadEntryFunc( void* This )
+void* ResourceThreadBase::InternalThreadEntryFunc( void* worker )
 {
-    ( static_cast<ResourceThreadBase*>( This ) )->ThreadLoop();
+    Worker& self = *static_cast<Worker*>( worker );
+    self.owner.ThreadLoop( self );
     return NULL;
 }
 
@@ -174,7 +241,7 @@ void ResourceThreadBase::Resume()
     mPaused = false;
   }
 
-  // If we were paused, wake up the background thread and give it a
+  // If we were paused, wake up the background threads and give them a
   // chance to do some work:
   if( wasPaused )
   {
@@ -182,10 +249,12 @@ void ResourceThreadBase::Resume()
   }
 }
 
-//----------------- Called from separate thread (mThread) -----------------
+//----------------- Called from the worker threads (mWorkers) -----------------
 
-void ResourceThreadBase::ThreadLoop()
+void ResourceThreadBase::ThreadLoop( Worker& worker )
 {
+  pthread_setspecific( mWorkerKey, &worker );
+
   // TODO: Use Environment Options
   const char* threadPriorityIdleRequired = std::getenv( IDLE_PRIORITY_ENVIRONMENT_VARIABLE_NAME );
   if( threadPriorityIdleRequired )
@@ -199,15 +268,16 @@ void ResourceThreadBase::ThreadLoop()
 
   InstallLogging();
 
-  while( !mResourceLoader.IsTerminating() )
+  bool running = true;
+  while( running && !mResourceLoader.IsTerminating() )
   {
     try
     {
-      WaitForRequests();
+      running = WaitForRequests();
 
-      if ( !mResourceLoader.IsTerminating() )
+      if ( running && !mResourceLoader.IsTerminating() )
       {
-        ProcessNextRequest();
+        ProcessNextRequest( worker );
       }
     }
 
@@ -215,7 +285,7 @@ void ResourceThreadBase::ThreadLoop()
     {
       // No problem: a derived class deliberately threw to abort an in-flight request
       // that was cancelled.
-      DALI_LOG_INFO( mLogFilter, Debug::Concise, "%s: Caught cancellation exception for resource (%u).\n", __FUNCTION__, unsigned(mCurrentRequestId) );
+      DALI_LOG_INFO( mLogFilter, Debug::Concise, "%s: Caught cancellation exception for resource (%u).\n", __FUNCTION__, unsigned(worker.currentRequestId) );
       CancelRequestException* disableUnusedVarWarning = &ex;
       ex = *disableUnusedVarWarning;
     }
@@ -224,50 +294,69 @@ void ResourceThreadBase::ThreadLoop()
     catch( std::exception& ex )
     {
       const char * const what = ex.what();
-      DALI_LOG_ERROR( "std::exception caught in resource thread. Aborting request with id %u because of std::exception with reason, \"%s\".\n", unsigned(mCurrentRequestId), what ? what : "null" );
+      DALI_LOG_ERROR( "std::exception caught in resource thread. Aborting request with id %u because of std::exception with reason, \"%s\".\n", unsigned(worker.currentRequestId), what ? what : "null" );
     }
     catch( Dali::DaliException& ex )
     {
       // Probably a failed assert-always:
-      DALI_LOG_ERROR( "DaliException caught in resource thread. Aborting request with id %u. Location: \"%s\". Condition: \"%s\".\n", unsigned(mCurrentRequestId), ex.location, ex.condition );
+      DALI_LOG_ERROR( "DaliException caught in resource thread. Aborting request with id %u. Location: \"%s\". Condition: \"%s\".\n", unsigned(worker.currentRequestId), ex.location, ex.condition );
     }
     catch( ... )
     {
-      DALI_LOG_ERROR( "Unknown exception caught in resource thread. Aborting request with id %u.\n", unsigned(mCurrentRequestId) );
+      DALI_LOG_ERROR( "Unknown exception caught in resource thread. Aborting request with id %u.\n", unsigned(worker.currentRequestId) );
     }
   }
 }
 
-void ResourceThreadBase::WaitForRequests()
+bool ResourceThreadBase::WaitForRequests()
 {
   ConditionalWait::ScopedLock lock( mCondition );
 
-  if( mQueue.empty() || mPaused == true )
+  if( ( AreQueuesEmpty() || mPaused == true ) && !mTerminating )
   {
     // Waiting for a wake up from resource loader control thread
     // This will be to process a new request or terminate
     mCondition.Wait( lock );
   }
+
+  return !mTerminating;
 }
 
-void ResourceThreadBase::ProcessNextRequest()
+bool ResourceThreadBase::AreQueuesEmpty() const
+{
+  for( unsigned int lane = 0; lane < NUM_PRIORITY_LANES; ++lane )
+  {
+    if( !mQueues[ lane ].empty() )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+void ResourceThreadBase::ProcessNextRequest( Worker& worker )
 {
   ResourceRequest* request(NULL);
   RequestType type(RequestLoad);
 
   {
-    // lock the queue and extract the next request
+    // lock the queues and extract the next request of the highest priority
     ConditionalWait::ScopedLock lock( mCondition );
 
-    if (!mQueue.empty())
+    for( unsigned int lane = NUM_PRIORITY_LANES; lane > 0; --lane )
     {
-      const RequestInfo & front = mQueue.front();
-      request = new ResourceRequest( front.first );
-      type = front.second;
-      mCurrentRequestId = front.first.GetId();
-      mQueue.pop_front();
+      RequestQueue& queue = mQueues[ lane - 1 ];
+      if( !queue.empty() && !mPaused )
+      {
+        const RequestInfo & front = queue.front();
+        request = new ResourceRequest( front.first );
+        type = front.second;
+        worker.currentRequestId = front.first.GetId();
+        queue.pop_front();
+        break;
+      }
     }
-  } // unlock the queue
+  } // unlock the queues
 
   // process request outside of lock
   if ( NULL != request )
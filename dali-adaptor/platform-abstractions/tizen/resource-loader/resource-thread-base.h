@@ -20,7 +20,9 @@
 
 // EXTERNAL INCLUDES
 #include <deque>
+#include <pthread.h>
 #include <dali/devel-api/threading/conditional-wait.h>
+#include <dali/public-api/common/dali-vector.h>
 
 // INTERNAL INCLUDES
 #include "resource-loader.h"
@@ -33,7 +35,11 @@ namespace TizenPlatform
 {
 
 /**
- * Resource loader worker thread
+ * Resource loader worker threads.
+ *
+ * Requests are queued in a lane per LoadResourcePriority and taken by a pool of
+ * worker threads, from the highest priority lane first and in the order they
+ * were added within a lane.
  */
 class ResourceThreadBase : public ResourceLoadingClient
 {
@@ -56,9 +62,16 @@ public:
   typedef std::deque<RequestInfo>                               RequestQueue;
   typedef RequestQueue::iterator                                RequestQueueIter;
 
+  /** The number of priority lanes, one for each LoadResourcePriority. */
+  static const unsigned int NUM_PRIORITY_LANES = Integration::LoadPriorityHighest + 1;
+
 public:
-  // Constructor
-  ResourceThreadBase(ResourceLoader& resourceLoader);
+  /**
+   * Constructor.
+   * @param[in] resourceLoader The loader the results are passed to.
+   * @param[in] workerCount The number of worker threads which process requests concurrently.
+   */
+  ResourceThreadBase( ResourceLoader& resourceLoader, unsigned int workerCount = 1u );
 
   // Destructor
   virtual ~ResourceThreadBase();
@@ -68,14 +81,21 @@ protected:
 
 public:
   /**
-   * Add a resource request to the back of the queue
+   * Get the number of worker threads for loads which scale with the cores of the device.
+   * @return The number of online cores, within a range.
+   */
+  static unsigned int GetWorkerCountForCores();
+
+  /**
+   * Add a resource request to the back of the queue of its priority
    * @param[in] request The requested resource/file url and attributes
    * @param[in] type    Load or save flag
    */
   void AddRequest(const Integration::ResourceRequest& request, const RequestType type);
 
   /**
-   * Cancel a resource request. Removes the request from the queue.
+   * Cancel a resource request. Removes the request from the queue, or
+   * interrupts the worker thread which is processing it.
    * @param[in] resourceId ID of the resource to be canceled
    */
   void CancelRequest(Integration::ResourceId  resourceId);
@@ -93,20 +113,44 @@ public:
 
 protected:
   /**
-   * Main control loop for the thread.
+   * The state of a worker thread.
+   */
+  struct Worker
+  {
+    Worker( ResourceThreadBase& owner );
+
+    ResourceThreadBase&              owner;            ///< The thread pool of the worker
+    pthread_t                        thread;           ///< thread instance
+    Integration::ResourceId          currentRequestId; ///< Current request, set by the worker with the queues locked
+    volatile Integration::ResourceId cancelRequestId;  ///< Request to be cancelled on the worker: written by external thread and read by worker.
+  };
+
+  typedef Dali::Vector< Worker* > WorkerContainer;
+
+  /**
+   * Main control loop for a worker thread.
    * The thread is terminated when this function exits
+   * @param[in] worker The worker of the calling thread.
    */
-  void ThreadLoop();
+  void ThreadLoop( Worker& worker );
 
   /**
    * Wait for an incoming resource request or termination
+   * @return False if the worker threads are terminating.
+   */
+  bool WaitForRequests();
+
+  /**
+   * Process the resource request at the head of the highest priority queue
+   * @param[in] worker The worker of the calling thread.
    */
-  void WaitForRequests();
+  void ProcessNextRequest( Worker& worker );
 
   /**
-   * Process the resource request at the head of the queue
+   * Whether there is a request in any of the queues. The queues must be locked.
+   * @return True if all the queues are empty.
    */
-  void ProcessNextRequest();
+  bool AreQueuesEmpty() const;
 
   /**
    * Install a logging function in to core for this thread.
@@ -138,7 +182,7 @@ protected:
   virtual void Decode(const Integration::ResourceRequest& request);
 
   /**
-   * @brief Cancels current resource request if it matches the one latched to be cancelled.
+   * @brief Cancels the current resource request of the calling worker thread if it matches the one latched to be cancelled.
    *
    * @copydoc ResourceLoadingClient::InterruptionPoint
    */
@@ -147,19 +191,19 @@ protected:
 private:
   /**
    * Helper for the thread calling the entry function
-   * @param[in] This A pointer to the current UpdateThread object
+   * @param[in] worker A pointer to the Worker of the thread
    */
-  static void* InternalThreadEntryFunc( void* This );
+  static void* InternalThreadEntryFunc( void* worker );
 
 protected:
   ResourceLoader&                    mResourceLoader;
-  pthread_t                          mThread;    ///< thread instance
+  WorkerContainer                    mWorkers;   ///< The worker threads; owned
   ConditionalWait                    mCondition; ///< condition variable
-  RequestQueue                       mQueue;     ///< Request queue
+  RequestQueue                       mQueues[ NUM_PRIORITY_LANES ]; ///< Request queues, indexed by priority
 private:
-  Integration::ResourceId          mCurrentRequestId; ///< Current request, set by worker thread
-  volatile Integration::ResourceId mCancelRequestId;  ///< Request to be cancelled on thread: written by external thread and read by worker.
-  bool                             mPaused;           ///< Whether to process work in mQueue
+  pthread_key_t                    mWorkerKey;        ///< The Worker of the calling thread
+  bool                             mPaused;           ///< Whether to process work in mQueues
+  bool                             mTerminating;      ///< Whether the workers should exit
 
 private:
 
@@ -45,13 +45,15 @@ namespace
 const size_t MAXIMUM_DOWNLOAD_IMAGE_SIZE  = 50 * 1024 * 1024 ;
 }
 
-ResourceThreadImage::ResourceThreadImage(ResourceLoader& resourceLoader)
-: ResourceThreadBase(resourceLoader)
+ResourceThreadImage::ResourceThreadImage(ResourceLoader& resourceLoader, unsigned int workerCount)
+: ResourceThreadBase(resourceLoader, workerCount)
 {
 }
 
 ResourceThreadImage::~ResourceThreadImage()
 {
+  // Stop the workers before the overrides they call are destroyed
+  TerminateThread();
 }
 
 void ResourceThreadImage::Load(const ResourceRequest& request)
@@ -119,12 +121,14 @@ void ResourceThreadImage::LoadImageFromLocalFile(const Integration::ResourceRequ
   BitmapPtr bitmap = 0;
   bool result = false;
 
-  Dali::Internal::Platform::FileCloser fileCloser( request.GetPath().c_str(), "rb" );
+  // Decoders read the file straight out of memory when it can be mapped, rather than through many small reads:
+  Dali::Internal::Platform::MappedFilePtr mappedFile( new Dali::Internal::Platform::MappedFile( request.GetPath().c_str() ) );
+  Dali::Internal::Platform::FileCloser fileCloser( *mappedFile, request.GetPath().c_str(), "rb" );
   FILE * const fp = fileCloser.GetFile();
 
   if( NULL != fp )
   {
-    result = ImageLoader::ConvertStreamToBitmap( *request.GetType(), request.GetPath(), fp, *this, bitmap );
+    result = ImageLoader::ConvertStreamToBitmap( *request.GetType(), request.GetPath(), fp, *this, bitmap, mappedFile->IsMapped() ? mappedFile.Get() : NULL );
     // Last chance to interrupt a cancelled load before it is reported back to clients
     // which have already stopped tracking it:
     InterruptionPoint(); // Note: This can throw an exception.
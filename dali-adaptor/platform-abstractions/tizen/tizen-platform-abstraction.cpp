@@ -30,6 +30,7 @@
 #include "resource-loader/resource-loader.h"
 #include "image-loaders/image-loader.h"
 #include "portable/file-closer.h"
+#include "portable/band-worker-pool.h"
 
 namespace Dali
 {
@@ -57,6 +58,9 @@ TizenPlatformAbstraction::TizenPlatformAbstraction()
 TizenPlatformAbstraction::~TizenPlatformAbstraction()
 {
   delete mResourceLoader;
+
+  // The loader threads have stopped, so the threads they shared to scale images can be stopped too
+  Dali::Internal::Platform::BandWorkerPool::Shutdown();
 }
 
 void TizenPlatformAbstraction::GetTimeMicroseconds(unsigned int &seconds, unsigned int &microSeconds)
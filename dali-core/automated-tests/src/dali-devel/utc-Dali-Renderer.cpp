@@ -895,3 +895,114 @@ int UtcDaliRendererUniformMapMultipleUniforms02(void)
 
   END_TEST;
 }
+
+int UtcDaliRendererInstancedDrawing(void)
+{
+  TestApplication application;
+
+  tet_infoline("Test that renderers with the same geometry & material are drawn with one instanced draw call");
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  gl.SetInstancedDrawingSupported( true );
+  TraceCallStack& drawTrace = gl.GetDrawTrace();
+  drawTrace.Enable( true );
+
+  Geometry geometry = CreateQuadGeometry();
+  Material material = CreateMaterial( 1.0f );
+  for( unsigned int i = 0; i < 3; ++i )
+  {
+    Renderer renderer = Renderer::New( geometry, material );
+    Actor actor = Actor::New();
+    actor.AddRenderer( renderer );
+    actor.SetSize( 100.0f, 100.0f );
+    actor.SetPosition( 100.0f * i, 0.0f );
+    Stage::GetCurrent().Add( actor );
+  }
+
+  application.SendNotification();
+  application.Render(0);
+
+  drawTrace.Reset();
+  application.SendNotification();
+  application.Render(0);
+  DALI_TEST_EQUALS( drawTrace.CountMethod( "DrawElementsInstanced" ), 1, TEST_LOCATION );
+  DALI_TEST_EQUALS( drawTrace.CountMethod( "DrawElements" ), 0, TEST_LOCATION );
+
+  std::stringstream out;
+  out << GL_TRIANGLES << ", " << 6 << ", " << GL_UNSIGNED_SHORT << ", indices, " << 3;
+  DALI_TEST_CHECK( drawTrace.FindMethodAndParams( "DrawElementsInstanced", out.str() ) );
+
+  // Without support for instancing, each renderer is drawn on its own
+  gl.SetInstancedDrawingSupported( false );
+  drawTrace.Reset();
+  application.SendNotification();
+  application.Render(0);
+  DALI_TEST_EQUALS( drawTrace.CountMethod( "DrawElementsInstanced" ), 0, TEST_LOCATION );
+  DALI_TEST_EQUALS( drawTrace.CountMethod( "DrawElements" ), 3, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliRendererVertexArrayObject(void)
+{
+  TestApplication application;
+
+  tet_infoline("Test that the attribute set-up of a geometry is recorded in a vertex array object & reused");
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  gl.SetVertexArrayObjectSupported( true );
+  TraceCallStack& vertexArrayTrace = gl.GetVertexArrayTrace();
+  vertexArrayTrace.Enable( true );
+  TraceCallStack& drawTrace = gl.GetDrawTrace();
+  drawTrace.Enable( true );
+
+  Geometry geometry = CreateQuadGeometry();
+  Material material = CreateMaterial( 1.0f );
+  Renderer renderer = Renderer::New( geometry, material );
+  Actor actor = Actor::New();
+  actor.AddRenderer( renderer );
+  actor.SetSize( 100.0f, 100.0f );
+  Stage::GetCurrent().Add( actor );
+
+  application.SendNotification();
+  application.Render(0);
+  application.SendNotification();
+  application.Render(0);
+  DALI_TEST_EQUALS( vertexArrayTrace.CountMethod( "GenVertexArrays" ), 1, TEST_LOCATION );
+
+  // Later draws just bind the vertex array object
+  vertexArrayTrace.Reset();
+  drawTrace.Reset();
+  application.SendNotification();
+  application.Render(0);
+  DALI_TEST_EQUALS( drawTrace.CountMethod( "DrawElements" ), 1, TEST_LOCATION );
+  DALI_TEST_EQUALS( vertexArrayTrace.CountMethod( "GenVertexArrays" ), 0, TEST_LOCATION );
+  DALI_TEST_EQUALS( vertexArrayTrace.CountMethod( "BindVertexArray" ), 2, TEST_LOCATION ); // Bound for the draw, then unbound
+  DALI_TEST_EQUALS( vertexArrayTrace.CountMethod( "EnableVertexAttribArray" ), 0, TEST_LOCATION );
+  DALI_TEST_EQUALS( vertexArrayTrace.CountMethod( "VertexAttribPointer" ), 0, TEST_LOCATION );
+  DALI_TEST_EQUALS( vertexArrayTrace.CountMethod( "BindBuffer" ), 0, TEST_LOCATION );
+
+  // Without support for vertex array objects, the attributes are set up for each draw
+  gl.SetVertexArrayObjectSupported( false );
+  vertexArrayTrace.Reset();
+  application.SendNotification();
+  application.Render(0);
+  DALI_TEST_EQUALS( vertexArrayTrace.CountMethod( "BindVertexArray" ), 0, TEST_LOCATION );
+  DALI_TEST_CHECK( vertexArrayTrace.CountMethod( "VertexAttribPointer" ) > 0 );
+
+  // Changing the buffers of the geometry records a new vertex array object
+  gl.SetVertexArrayObjectSupported( true );
+  unsigned int indexData[6] = { 0, 1, 3, 0, 3, 2 };
+  Property::Map indexFormat;
+  indexFormat["indices"] = Property::INTEGER;
+  PropertyBuffer indices = PropertyBuffer::New( indexFormat, sizeof(indexData)/sizeof(indexData[0]) );
+  indices.SetData( indexData );
+  geometry.SetIndexBuffer( indices );
+  vertexArrayTrace.Reset();
+  application.SendNotification();
+  application.Render(0);
+  DALI_TEST_EQUALS( vertexArrayTrace.CountMethod( "DeleteVertexArrays" ), 1, TEST_LOCATION );
+  DALI_TEST_EQUALS( vertexArrayTrace.CountMethod( "GenVertexArrays" ), 1, TEST_LOCATION );
+
+  END_TEST;
+}
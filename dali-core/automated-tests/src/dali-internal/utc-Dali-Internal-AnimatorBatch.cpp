@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali/public-api/dali-core.h>
+#include <dali-test-suite-utils.h>
+
+using namespace Dali;
+
+void utc_dali_internal_animatorbatch_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_animatorbatch_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+const unsigned int ACTOR_COUNT = 40u;
+
+const AlphaFunction::BuiltinFunction ALPHA_FUNCTIONS[] =
+{
+  AlphaFunction::LINEAR,
+  AlphaFunction::EASE_IN,
+  AlphaFunction::EASE_OUT,
+  AlphaFunction::EASE_IN_OUT,
+  AlphaFunction::EASE_OUT_BACK,
+  AlphaFunction::SIN
+};
+const unsigned int ALPHA_FUNCTION_COUNT = sizeof( ALPHA_FUNCTIONS ) / sizeof( ALPHA_FUNCTIONS[0] );
+
+/**
+ * Animate the position, color & opacity of the actors, either with one animation (batched), or one animation per actor.
+ */
+void AnimateActors( bool batched, std::vector< Vector3 >& positions, std::vector< Vector4 >& colors )
+{
+  TestApplication application;
+
+  std::vector< Actor > actors;
+  std::vector< Animation > animations;
+  for( unsigned int i = 0u; i < ACTOR_COUNT; ++i )
+  {
+    Actor actor = Actor::New();
+    actor.SetPosition( Vector3( static_cast<float>( i ), 0.0f, 0.0f ) );
+    Stage::GetCurrent().Add( actor );
+    actors.push_back( actor );
+
+    if( !batched || animations.empty() )
+    {
+      animations.push_back( Animation::New( 2.0f ) );
+    }
+    Animation animation = animations.back();
+
+    const AlphaFunction alpha( ALPHA_FUNCTIONS[ i % ALPHA_FUNCTION_COUNT ] );
+    const TimePeriod period( 0.05f * static_cast<float>( i % 8u ), 1.0f + 0.1f * static_cast<float>( i % 5u ) );
+    animation.AnimateTo( Property( actor, Actor::Property::POSITION ), Vector3( 100.0f, 50.0f, -20.0f ), alpha, period );
+    animation.AnimateBy( Property( actor, Actor::Property::COLOR ), Vector4( -0.5f, 0.25f, -1.0f, -0.75f ), alpha, period );
+    animation.AnimateTo( Property( actor, Actor::Property::SIZE_WIDTH ), 30.0f, alpha, period );
+  }
+
+  for( unsigned int i = 0u; i < animations.size(); ++i )
+  {
+    animations[i].Play();
+  }
+
+  application.SendNotification();
+  for( unsigned int frame = 0u; frame < 25u; ++frame )
+  {
+    application.Render( 100u );
+    for( unsigned int i = 0u; i < ACTOR_COUNT; ++i )
+    {
+      positions.push_back( actors[i].GetCurrentPosition() );
+      colors.push_back( actors[i].GetCurrentColor() );
+    }
+  }
+  application.SendNotification();
+  application.Render( 0u );
+
+  // The final values are baked
+  for( unsigned int i = 0u; i < ACTOR_COUNT; ++i )
+  {
+    positions.push_back( actors[i].GetCurrentPosition() );
+    colors.push_back( actors[i].GetCurrentColor() );
+  }
+}
+
+} // anonymous namespace
+
+int UtcDaliAnimatorBatchMatchesIndividualAnimators(void)
+{
+  std::vector< Vector3 > individualPositions;
+  std::vector< Vector4 > individualColors;
+  AnimateActors( false, individualPositions, individualColors );
+
+  std::vector< Vector3 > batchedPositions;
+  std::vector< Vector4 > batchedColors;
+  AnimateActors( true, batchedPositions, batchedColors );
+
+  DALI_TEST_EQUALS( individualPositions.size(), batchedPositions.size(), TEST_LOCATION );
+  for( unsigned int i = 0u; i < individualPositions.size(); ++i )
+  {
+    DALI_TEST_EQUALS( individualPositions[i], batchedPositions[i], TEST_LOCATION );
+    DALI_TEST_EQUALS( individualColors[i], batchedColors[i], TEST_LOCATION );
+  }
+
+  DALI_TEST_EQUALS( batchedPositions.back(), Vector3( 100.0f, 50.0f, -20.0f ), TEST_LOCATION );
+  DALI_TEST_EQUALS( batchedColors.back(), Vector4( 0.5f, 1.25f, 0.0f, 0.25f ), TEST_LOCATION );
+  END_TEST;
+}
+
+int UtcDaliAnimatorBatchSharedProperty(void)
+{
+  TestApplication application;
+
+  Actor shared = Actor::New();
+  Stage::GetCurrent().Add( shared );
+
+  // The animation is large enough to be batched
+  Animation animation = Animation::New( 1.0f );
+  std::vector< Actor > actors;
+  for( unsigned int i = 0u; i < ACTOR_COUNT; ++i )
+  {
+    Actor actor = Actor::New();
+    Stage::GetCurrent().Add( actor );
+    actors.push_back( actor );
+    animation.AnimateTo( Property( actor, Actor::Property::POSITION ), Vector3( 10.0f, 10.0f, 10.0f ) );
+  }
+
+  // Animators of the same property are applied in the order they were added
+  animation.AnimateBy( Property( shared, Actor::Property::POSITION ), Vector3( 10.0f, 0.0f, 0.0f ) );
+  animation.AnimateTo( Property( shared, Actor::Property::POSITION ), Vector3( 0.0f, 20.0f, 0.0f ) );
+  animation.AnimateBy( Property( shared, Actor::Property::POSITION_Z ), 5.0f );
+  animation.Play();
+
+  application.SendNotification();
+  application.Render( 500u );
+  DALI_TEST_EQUALS( actors[0].GetCurrentPosition(), Vector3( 5.0f, 5.0f, 5.0f ), TEST_LOCATION );
+  DALI_TEST_EQUALS( shared.GetCurrentPosition(), Vector3( 2.5f, 10.0f, 2.5f ), TEST_LOCATION );
+
+  application.Render( 600u );
+  application.SendNotification();
+  application.Render( 0u );
+  DALI_TEST_EQUALS( actors[0].GetCurrentPosition(), Vector3( 10.0f, 10.0f, 10.0f ), TEST_LOCATION );
+  DALI_TEST_EQUALS( shared.GetCurrentPosition(), Vector3( 0.0f, 20.0f, 5.0f ), TEST_LOCATION );
+  END_TEST;
+}
+
+int UtcDaliAnimatorBatchDisconnectBakesCurrentProgress(void)
+{
+  TestApplication application;
+
+  Animation animation = Animation::New( 1.0f );
+  animation.SetDisconnectAction( Animation::Bake );
+  std::vector< Actor > actors;
+  for( unsigned int i = 0u; i < ACTOR_COUNT; ++i )
+  {
+    Actor actor = Actor::New();
+    Stage::GetCurrent().Add( actor );
+    actors.push_back( actor );
+    animation.AnimateTo( Property( actor, Actor::Property::POSITION ), Vector3( 100.0f, 0.0f, 0.0f ), AlphaFunction::LINEAR );
+  }
+  animation.Play();
+
+  application.SendNotification();
+  application.Render( 250u );
+  DALI_TEST_EQUALS( actors[0].GetCurrentPosition(), Vector3( 25.0f, 0.0f, 0.0f ), TEST_LOCATION );
+
+  // The value at the progress of the last update is baked
+  Stage::GetCurrent().Remove( actors[0] );
+  application.SendNotification();
+  application.Render( 250u );
+  DALI_TEST_EQUALS( actors[0].GetCurrentPosition(), Vector3( 25.0f, 0.0f, 0.0f ), TEST_LOCATION );
+  DALI_TEST_EQUALS( actors[1].GetCurrentPosition(), Vector3( 50.0f, 0.0f, 0.0f ), TEST_LOCATION );
+
+  // Destroyed actors are removed from the batches
+  Stage::GetCurrent().Remove( actors[1] );
+  actors.erase( actors.begin(), actors.begin() + 2 );
+  application.SendNotification();
+  application.Render( 250u );
+  DALI_TEST_EQUALS( actors[0].GetCurrentPosition(), Vector3( 75.0f, 0.0f, 0.0f ), TEST_LOCATION );
+  END_TEST;
+}
@@ -0,0 +1,268 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <pthread.h>
+#include <dali/public-api/dali-core.h>
+#include <dali-test-suite-utils.h>
+
+using namespace Dali;
+
+void utc_dali_internal_constraintgraph_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_constraintgraph_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+const unsigned int CHAIN_COUNT = 100u;
+const unsigned int CHAIN_LENGTH = 10u;
+
+/**
+ * Sets the position to the input position, plus an offset; this is safe to call from several threads.
+ */
+struct OffsetConstraint
+{
+  OffsetConstraint( const Vector3& offset ) : mOffset( offset ) { }
+
+  void operator()( Vector3& current, const PropertyInputContainer& inputs )
+  {
+    current = inputs[0]->GetVector3() + mOffset;
+  }
+
+  Vector3 mOffset;
+};
+
+/**
+ * Sets the position to the number of calls; this depends on state outside its inputs.
+ */
+struct CountingConstraint
+{
+  CountingConstraint( int& callCount ) : mCallCount( callCount ) { }
+
+  void operator()( Vector3& current, const PropertyInputContainer& inputs )
+  {
+    ++mCallCount;
+    current = Vector3( static_cast<float>( mCallCount ), 0.0f, 0.0f );
+  }
+
+  int& mCallCount;
+};
+
+/**
+ * Sets the position to the input position, and counts the calls made on a thread other than the test's thread.
+ */
+struct ThreadCheckConstraint
+{
+  ThreadCheckConstraint( pthread_t thread, unsigned int& otherThreadCount )
+  : mThread( thread ),
+    mOtherThreadCount( otherThreadCount )
+  {
+  }
+
+  void operator()( Vector3& current, const PropertyInputContainer& inputs )
+  {
+    current = inputs[0]->GetVector3();
+    if( !pthread_equal( pthread_self(), mThread ) )
+    {
+      ++mOtherThreadCount;
+    }
+  }
+
+  pthread_t mThread;
+  unsigned int& mOtherThreadCount;
+};
+
+/**
+ * Create chains of actors; each actor is constrained to the position of the previous actor, or to
+ * the next actor when reverse is set. The constraints are removed when the actors are destroyed.
+ */
+void CreateChains( std::vector< Actor >& actors, bool reverse )
+{
+  Actor parent = Actor::New();
+  Stage::GetCurrent().Add( parent );
+
+  for( unsigned int chain = 0u; chain < CHAIN_COUNT; ++chain )
+  {
+    const unsigned int first = actors.size();
+    for( unsigned int i = 0u; i < CHAIN_LENGTH; ++i )
+    {
+      Actor actor = Actor::New();
+      actor.SetPosition( Vector3( static_cast<float>( chain ), 0.0f, 0.0f ) );
+      parent.Add( actor );
+      actors.push_back( actor );
+    }
+
+    for( unsigned int i = 1u; i < CHAIN_LENGTH; ++i )
+    {
+      Actor target = actors[ first + ( reverse ? CHAIN_LENGTH - 1u - i : i ) ];
+      Actor source = actors[ first + ( reverse ? CHAIN_LENGTH - i : i - 1u ) ];
+
+      Constraint constraint = Constraint::New< Vector3 >( target, Actor::Property::POSITION, OffsetConstraint( Vector3( 0.0f, 1.0f, 0.0f ) ) );
+      constraint.AddSource( Source( source, Actor::Property::POSITION ) );
+      constraint.SetRemoveAction( ( i % 2u ) ? Constraint::Discard : Constraint::Bake );
+      constraint.SetThreadSafe( true );
+      constraint.Apply();
+    }
+  }
+}
+
+void ConstrainChains( unsigned int threadCount, bool reverse, std::vector< Vector3 >& positions )
+{
+  TestApplication application;
+  application.GetCore().SetUpdateThreadCount( threadCount );
+
+  std::vector< Actor > actors;
+  CreateChains( actors, reverse );
+
+  for( unsigned int frame = 0u; frame < 4u; ++frame )
+  {
+    application.SendNotification();
+    application.Render();
+  }
+
+  // Move the start of each chain
+  for( unsigned int chain = 0u; chain < CHAIN_COUNT; ++chain )
+  {
+    actors[ chain * CHAIN_LENGTH + ( reverse ? CHAIN_LENGTH - 1u : 0u ) ].SetPosition( Vector3( 100.0f, 0.0f, 0.0f ) );
+  }
+
+  for( unsigned int frame = 0u; frame < 4u; ++frame )
+  {
+    application.SendNotification();
+    application.Render();
+  }
+
+  for( unsigned int i = 0u; i < actors.size(); ++i )
+  {
+    positions.push_back( actors[i].GetCurrentPosition() );
+  }
+
+  application.GetCore().SetUpdateThreadCount( 1u );
+}
+
+} // anonymous namespace
+
+int UtcDaliConstraintGraphParallelMatchesSequential(void)
+{
+  std::vector< Vector3 > sequential;
+  ConstrainChains( 1u, false, sequential );
+
+  std::vector< Vector3 > parallel;
+  ConstrainChains( 4u, false, parallel );
+
+  DALI_TEST_EQUALS( sequential.size(), parallel.size(), TEST_LOCATION );
+  for( unsigned int i = 0u; i < sequential.size(); ++i )
+  {
+    DALI_TEST_EQUALS( sequential[i], parallel[i], TEST_LOCATION );
+  }
+
+  // The constraints follow the actor they depend on, within the frame
+  DALI_TEST_EQUALS( parallel[ CHAIN_LENGTH - 1u ], Vector3( 100.0f, CHAIN_LENGTH - 1.0f, 0.0f ), TEST_LOCATION );
+  END_TEST;
+}
+
+int UtcDaliConstraintGraphParallelMatchesSequentialReverse(void)
+{
+  // Each constraint reads a property which is written by a later constraint
+  std::vector< Vector3 > sequential;
+  ConstrainChains( 1u, true, sequential );
+
+  std::vector< Vector3 > parallel;
+  ConstrainChains( 4u, true, parallel );
+
+  DALI_TEST_EQUALS( sequential.size(), parallel.size(), TEST_LOCATION );
+  for( unsigned int i = 0u; i < sequential.size(); ++i )
+  {
+    DALI_TEST_EQUALS( sequential[i], parallel[i], TEST_LOCATION );
+  }
+  END_TEST;
+}
+
+int UtcDaliConstraintGraphNotThreadSafeAppliedOnUpdateThread(void)
+{
+  TestApplication application;
+  application.GetCore().SetUpdateThreadCount( 4u );
+
+  Actor source = Actor::New();
+  source.SetPosition( Vector3( 1.0f, 2.0f, 3.0f ) );
+  Stage::GetCurrent().Add( source );
+
+  // Enough independent constraints to be applied in parallel, if they were thread-safe
+  unsigned int otherThreadCount = 0u;
+  std::vector< Actor > targets;
+  for( unsigned int i = 0u; i < CHAIN_COUNT * CHAIN_LENGTH; ++i )
+  {
+    Actor target = Actor::New();
+    Stage::GetCurrent().Add( target );
+    targets.push_back( target );
+
+    Constraint constraint = Constraint::New< Vector3 >( target, Actor::Property::POSITION, ThreadCheckConstraint( pthread_self(), otherThreadCount ) );
+    constraint.AddSource( Source( source, Actor::Property::POSITION ) );
+    DALI_TEST_CHECK( !constraint.IsThreadSafe() );
+    constraint.Apply();
+  }
+
+  application.SendNotification();
+  application.Render();
+  application.Render();
+
+  DALI_TEST_EQUALS( otherThreadCount, 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( targets.back().GetCurrentPosition(), Vector3( 1.0f, 2.0f, 3.0f ), TEST_LOCATION );
+
+  application.GetCore().SetUpdateThreadCount( 1u );
+  END_TEST;
+}
+
+int UtcDaliConstraintGraphDiscardAppliedEveryFrame(void)
+{
+  TestApplication application;
+
+  Actor target = Actor::New();
+  Stage::GetCurrent().Add( target );
+
+  // A constraint without inputs, whose function does not only depend on its inputs
+  int callCount = 0;
+  Constraint constraint = Constraint::New< Vector3 >( target, Actor::Property::POSITION, CountingConstraint( callCount ) );
+  constraint.SetRemoveAction( Constraint::Discard );
+  constraint.Apply();
+
+  application.SendNotification();
+  application.Render();
+
+  for( unsigned int frame = 0u; frame < 4u; ++frame )
+  {
+    const int previousCount = callCount;
+    application.SendNotification();
+    application.Render();
+    DALI_TEST_EQUALS( callCount, previousCount + 1, TEST_LOCATION );
+    DALI_TEST_EQUALS( target.GetCurrentPosition(), Vector3( static_cast<float>( callCount ), 0.0f, 0.0f ), TEST_LOCATION );
+  }
+
+  // The base value is used once the constraint is removed
+  constraint.Remove();
+  application.SendNotification();
+  application.Render();
+  application.Render();
+  DALI_TEST_EQUALS( target.GetCurrentPosition(), Vector3::ZERO, TEST_LOCATION );
+  END_TEST;
+}
@@ -513,3 +513,156 @@ int UtcFrustumCullDisabledP(void)
 
   END_TEST;
 }
+
+int UtcFrustumRotatedCullP(void)
+{
+  TestApplication application;
+  TestGlAbstraction& glAbstraction = application.GetGlAbstraction();
+  TraceCallStack& drawTrace = glAbstraction.GetDrawTrace();
+  drawTrace.Enable( true );
+
+  // A wide actor left of the stage, rotated so that it is tall & thin
+  Vector2 stageSize = Stage::GetCurrent().GetSize();
+  Actor meshActor = CreateMeshActorToStage( application, Vector3( -100.0f / stageSize.width, 0.5f, 0.5f ) );
+  meshActor.SetSize( Vector3( 400.0f, 10.0f, 0.1f ) );
+  meshActor.SetOrientation( Degree( 90.0f ), Vector3::ZAXIS );
+
+  drawTrace.Reset();
+  application.SendNotification();
+  application.Render( 16 );
+
+  // The unrotated box would overlap the stage; this will be culled by the oriented box
+  DALI_TEST_CHECK( !drawTrace.FindMethod( "DrawElements" ) );
+
+  END_TEST;
+}
+
+int UtcFrustumRotatedCullN(void)
+{
+  TestApplication application;
+  TestGlAbstraction& glAbstraction = application.GetGlAbstraction();
+  TraceCallStack& drawTrace = glAbstraction.GetDrawTrace();
+  drawTrace.Enable( true );
+
+  // A tall actor left of the stage, rotated so that it reaches onto the stage
+  Vector2 stageSize = Stage::GetCurrent().GetSize();
+  Actor meshActor = CreateMeshActorToStage( application, Vector3( -100.0f / stageSize.width, 0.5f, 0.5f ) );
+  meshActor.SetSize( Vector3( 10.0f, 400.0f, 0.1f ) );
+  meshActor.SetOrientation( Degree( 90.0f ), Vector3::ZAXIS );
+
+  drawTrace.Reset();
+  application.SendNotification();
+  application.Render( 16 );
+
+  // This should not be culled
+  DALI_TEST_CHECK( drawTrace.FindMethod( "DrawElements" ) );
+
+  END_TEST;
+}
+
+int UtcFrustumSubtreeCullP(void)
+{
+  TestApplication application;
+  TestGlAbstraction& glAbstraction = application.GetGlAbstraction();
+  TraceCallStack& drawTrace = glAbstraction.GetDrawTrace();
+  drawTrace.Enable( true );
+
+  Actor parent = Actor::New();
+  parent.SetSize( 100.0f, 100.0f );
+  parent.SetParentOrigin( Vector3( -2.0f, 0.5f, 0.5f ) );
+  Stage::GetCurrent().Add( parent );
+
+  Actor first = CreateMeshActorToStage( application );
+  Actor second = CreateMeshActorToStage( application, ParentOrigin::TOP_LEFT );
+  parent.Add( first );
+  parent.Add( second );
+
+  drawTrace.Reset();
+  application.SendNotification();
+  application.Render( 16 );
+
+  // The sub-tree is outside the stage
+  DALI_TEST_CHECK( !drawTrace.FindMethod( "DrawElements" ) );
+
+  // The bounds of the sub-tree follow the parent
+  parent.SetParentOrigin( ParentOrigin::CENTER );
+
+  drawTrace.Reset();
+  application.SendNotification();
+  application.Render( 16 );
+
+  DALI_TEST_EQUALS( drawTrace.CountMethod( "DrawElements" ), 2, TEST_LOCATION );
+
+  // And the children
+  second.SetParentOrigin( Vector3( -5.0f, 0.5f, 0.5f ) );
+
+  drawTrace.Reset();
+  application.SendNotification();
+  application.Render( 16 );
+
+  DALI_TEST_EQUALS( drawTrace.CountMethod( "DrawElements" ), 1, TEST_LOCATION );
+
+  // Removed children are no longer included
+  parent.Remove( first );
+  parent.SetParentOrigin( Vector3( -2.0f, 0.5f, 0.5f ) );
+  Stage::GetCurrent().Add( first );
+
+  drawTrace.Reset();
+  application.SendNotification();
+  application.Render( 16 );
+
+  DALI_TEST_EQUALS( drawTrace.CountMethod( "DrawElements" ), 1, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcFrustumImageActorCullP(void)
+{
+  TestApplication application;
+  TestGlAbstraction& glAbstraction = application.GetGlAbstraction();
+  TraceCallStack& drawTrace = glAbstraction.GetDrawTrace();
+  drawTrace.Enable( true );
+
+  BufferImage image = BufferImage::New( 4, 4 );
+  ImageActor imageActor = ImageActor::New( image );
+  imageActor.SetSize( 100.0f, 100.0f );
+  imageActor.SetParentOrigin( Vector3( -2.0f, 0.5f, 0.5f ) );
+  Stage::GetCurrent().Add( imageActor );
+
+  drawTrace.Reset();
+  application.SendNotification();
+  application.Render( 16 );
+
+  DALI_TEST_CHECK( !drawTrace.FindMethod( "DrawArrays" ) );
+
+  imageActor.SetParentOrigin( ParentOrigin::CENTER );
+
+  drawTrace.Reset();
+  application.SendNotification();
+  application.Render( 16 );
+
+  DALI_TEST_CHECK( drawTrace.FindMethod( "DrawArrays" ) );
+
+  END_TEST;
+}
+
+int UtcFrustumCullModeN(void)
+{
+  TestApplication application;
+  TestGlAbstraction& glAbstraction = application.GetGlAbstraction();
+  TraceCallStack& drawTrace = glAbstraction.GetDrawTrace();
+  drawTrace.Enable( true );
+
+  Stage::GetCurrent().GetRenderTaskList().GetTask( 0u ).SetCullMode( false );
+
+  CreateMeshActorToStage( application, Vector3( 7.0f, 0.5f, 0.5f ) );
+
+  drawTrace.Reset();
+  application.SendNotification();
+  application.Render( 16 );
+
+  // Culling is disabled for the render-task
+  DALI_TEST_CHECK( drawTrace.FindMethod( "DrawElements" ) );
+
+  END_TEST;
+}
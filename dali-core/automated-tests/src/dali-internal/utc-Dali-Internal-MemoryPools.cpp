@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cstring>
+#include <dali/public-api/dali-core.h>
+#include <dali/integration-api/profiling.h>
+#include <dali-test-suite-utils.h>
+
+// Internal headers are allowed here
+
+#include <dali/internal/common/memory-pool-object-allocator.h>
+#include <dali/internal/common/pooled-allocation.h>
+#include <dali/internal/update/nodes/node.h>
+#include <dali/internal/update/nodes/scene-graph-layer.h>
+
+using namespace Dali;
+using Internal::MemoryPoolObjectAllocator;
+using Internal::SceneGraph::Node;
+using Internal::PooledAllocation;
+
+void utc_dali_internal_memorypools_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_memorypools_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+struct TestObject
+{
+  float value[4];
+};
+
+const Integration::Profiling::MemoryPoolOccupancy* FindOccupancy( const Integration::Profiling::MemoryPoolOccupancyContainer& occupancy, const char* name )
+{
+  for( Integration::Profiling::MemoryPoolOccupancyContainer::ConstIterator iter = occupancy.Begin(), endIter = occupancy.End(); iter != endIter; ++iter )
+  {
+    if( 0 == strcmp( iter->name, name ) )
+    {
+      return iter;
+    }
+  }
+  return NULL;
+}
+
+} // anonymous namespace
+
+int UtcDaliMemoryPoolThreadSafeAllocation(void)
+{
+  MemoryPoolObjectAllocator< TestObject > allocator;
+  DALI_TEST_EQUALS( allocator.GetAllocationCount(), 0u, TEST_LOCATION );
+
+  std::vector< void* > memory;
+  for( unsigned int i = 0u; i < 100u; ++i )
+  {
+    memory.push_back( allocator.AllocateRawThreadSafe() );
+    DALI_TEST_CHECK( memory.back() );
+  }
+  DALI_TEST_EQUALS( allocator.GetAllocationCount(), 100u, TEST_LOCATION );
+  DALI_TEST_CHECK( allocator.GetCapacity() >= 100u );
+
+  for( unsigned int i = 0u; i < memory.size(); ++i )
+  {
+    allocator.FreeRawThreadSafe( memory[i] );
+  }
+  DALI_TEST_EQUALS( allocator.GetAllocationCount(), 0u, TEST_LOCATION );
+
+  // Freed memory is reused, rather than growing the pool
+  const unsigned int capacity = allocator.GetCapacity();
+  void* reused = allocator.AllocateRawThreadSafe();
+  DALI_TEST_EQUALS( allocator.GetCapacity(), capacity, TEST_LOCATION );
+  allocator.FreeRawThreadSafe( reused );
+
+  END_TEST;
+}
+
+int UtcDaliMemoryPoolNodeAllocation(void)
+{
+  const unsigned int initialCount = PooledAllocation< Node >::GetMemoryPool().GetAllocationCount();
+
+  Node* node = Node::New();
+  DALI_TEST_EQUALS( PooledAllocation< Node >::GetMemoryPool().GetAllocationCount(), initialCount + 1u, TEST_LOCATION );
+
+  // Layers have their own pool
+  const unsigned int initialLayerCount = PooledAllocation< Internal::SceneGraph::Layer >::GetMemoryPool().GetAllocationCount();
+  Node* layer = Internal::SceneGraph::Layer::New();
+  DALI_TEST_EQUALS( PooledAllocation< Node >::GetMemoryPool().GetAllocationCount(), initialCount + 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( PooledAllocation< Internal::SceneGraph::Layer >::GetMemoryPool().GetAllocationCount(), initialLayerCount + 1u, TEST_LOCATION );
+
+  // Deleting through the base class returns the memory to the correct pool
+  delete layer;
+  DALI_TEST_EQUALS( PooledAllocation< Internal::SceneGraph::Layer >::GetMemoryPool().GetAllocationCount(), initialLayerCount, TEST_LOCATION );
+  delete node;
+  DALI_TEST_EQUALS( PooledAllocation< Node >::GetMemoryPool().GetAllocationCount(), initialCount, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliMemoryPoolOccupancy(void)
+{
+  TestApplication application;
+
+  Integration::Profiling::MemoryPoolOccupancyContainer before;
+  Integration::Profiling::GetMemoryPoolOccupancy( before );
+  const Integration::Profiling::MemoryPoolOccupancy* nodes = FindOccupancy( before, "SceneGraph::Node" );
+  DALI_TEST_CHECK( nodes );
+  DALI_TEST_CHECK( FindOccupancy( before, "SceneGraph::Layer" ) );
+  DALI_TEST_CHECK( FindOccupancy( before, "SceneGraph::ImageAttachment" ) );
+  DALI_TEST_CHECK( nodes->objectSize > 0u );
+  const unsigned int nodeCount = nodes->allocationCount;
+
+  // Actors & image actors create nodes & image attachments on the update-thread
+  ImageActor imageActor = ImageActor::New();
+  Actor actor = Actor::New();
+  Stage::GetCurrent().Add( imageActor );
+  application.SendNotification();
+  application.Render();
+
+  Integration::Profiling::MemoryPoolOccupancyContainer after;
+  Integration::Profiling::GetMemoryPoolOccupancy( after );
+  DALI_TEST_EQUALS( FindOccupancy( after, "SceneGraph::Node" )->allocationCount, nodeCount + 2u, TEST_LOCATION );
+  DALI_TEST_CHECK( FindOccupancy( after, "SceneGraph::ImageAttachment" )->allocationCount >= 1u );
+  DALI_TEST_CHECK( FindOccupancy( after, "SceneGraph::Node" )->allocationCount <= FindOccupancy( after, "SceneGraph::Node" )->capacity );
+
+  END_TEST;
+}
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <time.h>
+#include <dali/public-api/dali-core.h>
+#include <dali-test-suite-utils.h>
+
+// Internal headers are allowed here
+
+#include <dali/internal/update/nodes/node.h>
+#include <dali/internal/update/nodes/node-set.h>
+
+using namespace Dali;
+using Internal::SceneGraph::Node;
+using Internal::SceneGraph::NodeSet;
+
+void utc_dali_internal_nodeset_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_nodeset_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+const unsigned int NODE_COUNT = 1000u;
+
+double GetSeconds()
+{
+  timespec time;
+  clock_gettime( CLOCK_MONOTONIC, &time );
+  return static_cast<double>( time.tv_sec ) + static_cast<double>( time.tv_nsec ) * 1e-9;
+}
+
+void CreateNodes( std::vector< Node* >& nodes, unsigned int count )
+{
+  for( unsigned int i = 0u; i < count; ++i )
+  {
+    nodes.push_back( Node::New() );
+  }
+}
+
+void DeleteNodes( std::vector< Node* >& nodes )
+{
+  for( unsigned int i = 0u; i < nodes.size(); ++i )
+  {
+    delete nodes[i];
+  }
+  nodes.clear();
+}
+
+} // anonymous namespace
+
+int UtcDaliNodeSetInsertErase(void)
+{
+  std::vector< Node* > nodes;
+  CreateNodes( nodes, 4u );
+
+  NodeSet set;
+  for( unsigned int i = 0u; i < nodes.size(); ++i )
+  {
+    set.Insert( *nodes[i] );
+  }
+  DALI_TEST_EQUALS( set.Count(), 4u, TEST_LOCATION );
+
+  // Removing a node moves the last node into its slot
+  DALI_TEST_CHECK( set.Erase( *nodes[1] ) );
+  DALI_TEST_EQUALS( set.Count(), 3u, TEST_LOCATION );
+  DALI_TEST_CHECK( !set.Contains( *nodes[1] ) );
+  DALI_TEST_CHECK( set.Contains( *nodes[0] ) );
+  DALI_TEST_CHECK( set.Contains( *nodes[2] ) );
+  DALI_TEST_CHECK( set.Contains( *nodes[3] ) );
+
+  // Removing a node twice does nothing
+  DALI_TEST_CHECK( !set.Erase( *nodes[1] ) );
+  DALI_TEST_EQUALS( set.Count(), 3u, TEST_LOCATION );
+
+  // The moved node can still be removed
+  DALI_TEST_CHECK( set.Erase( *nodes[3] ) );
+  DALI_TEST_CHECK( set.Erase( *nodes[0] ) );
+  DALI_TEST_CHECK( set.Erase( *nodes[2] ) );
+  DALI_TEST_EQUALS( set.Count(), 0u, TEST_LOCATION );
+
+  DeleteNodes( nodes );
+  END_TEST;
+}
+
+int UtcDaliNodeSetMoveTo(void)
+{
+  std::vector< Node* > nodes;
+  CreateNodes( nodes, 6u );
+
+  NodeSet first;
+  NodeSet second;
+  for( unsigned int i = 0u; i < nodes.size(); ++i )
+  {
+    ( i < 3u ? first : second ).Insert( *nodes[i] );
+  }
+
+  // A node in another set is not found
+  DALI_TEST_CHECK( !first.Contains( *nodes[3] ) );
+  DALI_TEST_CHECK( !first.Erase( *nodes[4] ) );
+
+  first.MoveTo( second );
+  DALI_TEST_EQUALS( first.Count(), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( second.Count(), 6u, TEST_LOCATION );
+
+  for( unsigned int i = 0u; i < nodes.size(); ++i )
+  {
+    DALI_TEST_CHECK( second.Contains( *nodes[i] ) );
+    DALI_TEST_CHECK( !first.Contains( *nodes[i] ) );
+  }
+
+  DeleteNodes( nodes );
+  END_TEST;
+}
+
+int UtcDaliNodeSetBenchmark(void)
+{
+  std::vector< Node* > nodes;
+  CreateNodes( nodes, NODE_COUNT );
+
+  NodeSet connected;
+  NodeSet disconnected;
+  for( unsigned int i = 0u; i < NODE_COUNT; ++i )
+  {
+    disconnected.Insert( *nodes[i] );
+  }
+
+  // Move the nodes between the sets, in a different order to insertion
+  const unsigned int iterations = 200u;
+  const double start = GetSeconds();
+  for( unsigned int iteration = 0u; iteration < iterations; ++iteration )
+  {
+    for( unsigned int i = 0u; i < NODE_COUNT; ++i )
+    {
+      Node& node = *nodes[ ( i * 7u ) % NODE_COUNT ];
+      disconnected.Erase( node );
+      connected.Insert( node );
+    }
+    for( unsigned int i = 0u; i < NODE_COUNT; ++i )
+    {
+      Node& node = *nodes[ ( i * 13u ) % NODE_COUNT ];
+      connected.Erase( node );
+      disconnected.Insert( node );
+    }
+  }
+  const double elapsed = GetSeconds() - start;
+
+  const double operations = 2.0 * iterations * NODE_COUNT;
+  tet_printf( "NodeSet: %.0f connect/disconnect operations per second\n", operations / ( elapsed > 0.0 ? elapsed : 1e-9 ) );
+
+  DALI_TEST_EQUALS( connected.Count(), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( disconnected.Count(), NODE_COUNT, TEST_LOCATION );
+
+  DeleteNodes( nodes );
+  END_TEST;
+}
+
+int UtcDaliNodeSetSceneBenchmark(void)
+{
+  TestApplication application;
+
+  Actor parent = Actor::New();
+  Stage::GetCurrent().Add( parent );
+
+  std::vector< Actor > actors;
+  for( unsigned int i = 0u; i < NODE_COUNT; ++i )
+  {
+    actors.push_back( Actor::New() );
+  }
+
+  application.SendNotification();
+  application.Render();
+
+  // Add & remove the actors each frame, as a scrolling item-view does
+  const unsigned int frames = 20u;
+  const double start = GetSeconds();
+  for( unsigned int frame = 0u; frame < frames; ++frame )
+  {
+    for( unsigned int i = 0u; i < NODE_COUNT; ++i )
+    {
+      parent.Add( actors[i] );
+    }
+    application.SendNotification();
+    application.Render();
+
+    for( unsigned int i = 0u; i < NODE_COUNT; ++i )
+    {
+      parent.Remove( actors[i] );
+    }
+    application.SendNotification();
+    application.Render();
+  }
+  const double elapsed = GetSeconds() - start;
+
+  const double operations = 2.0 * frames * NODE_COUNT;
+  tet_printf( "Scene: %.0f connect/disconnect operations per second (including event processing & rendering)\n", operations / ( elapsed > 0.0 ? elapsed : 1e-9 ) );
+
+  DALI_TEST_EQUALS( parent.GetChildCount(), 0u, TEST_LOCATION );
+
+  // The actors can be connected again
+  parent.Add( actors[0] );
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_CHECK( actors[0].OnStage() );
+  END_TEST;
+}
@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <sstream>
+#include <dali/public-api/dali-core.h>
+#include <dali/integration-api/core.h>
+#include <dali-test-suite-utils.h>
+
+using namespace Dali;
+
+void utc_dali_internal_partial_update_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_partial_update_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+const Rect<int> SURFACE_RECT( 0, 0, TestApplication::DEFAULT_SURFACE_WIDTH, TestApplication::DEFAULT_SURFACE_HEIGHT );
+
+/**
+ * Update & render a frame, with the given age of the back buffer.
+ * @return The damaged rectangle of the frame.
+ */
+Rect<int> RenderFrame( TestApplication& application, unsigned int bufferAge )
+{
+  application.SendNotification();
+  application.UpdateOnly( 16 );
+
+  Integration::RenderStatus status;
+  status.SetBufferAge( bufferAge );
+  application.GetCore().Render( status );
+
+  return status.GetDamagedRect();
+}
+
+/**
+ * Add an image actor of 100x100 at the center of the stage, then render until nothing changes.
+ */
+ImageActor CreateImageActor( TestApplication& application )
+{
+  BufferImage image = BufferImage::New( 4, 4 );
+  ImageActor imageActor = ImageActor::New( image );
+  imageActor.SetParentOrigin( ParentOrigin::CENTER );
+  imageActor.SetSize( 100.0f, 100.0f );
+  Stage::GetCurrent().Add( imageActor );
+
+  for( unsigned int i = 0u; i < 4u; ++i )
+  {
+    RenderFrame( application, 1u );
+  }
+
+  return imageActor;
+}
+
+std::string ScissorTestParam()
+{
+  std::stringstream out;
+  out << GL_SCISSOR_TEST;
+  return out.str();
+}
+
+} // anonymous namespace
+
+int UtcDaliPartialUpdateUnchangedP(void)
+{
+  TestApplication application;
+  CreateImageActor( application );
+
+  // Nothing changed
+  Rect<int> damagedRect = RenderFrame( application, 1u );
+  DALI_TEST_CHECK( damagedRect.IsEmpty() );
+
+  END_TEST;
+}
+
+int UtcDaliPartialUpdateMoveP(void)
+{
+  TestApplication application;
+  TestGlAbstraction& glAbstraction = application.GetGlAbstraction();
+  ImageActor imageActor = CreateImageActor( application );
+
+  imageActor.SetPosition( 100.0f, 0.0f );
+  const Rect<int> damagedRect = RenderFrame( application, 1u );
+
+  // The previous & current bounds, horizontally from 190 to 390 & vertically from 350 to 450, plus a margin
+  tet_printf( "Damaged %d,%d %dx%d\n", damagedRect.x, damagedRect.y, damagedRect.width, damagedRect.height );
+  DALI_TEST_CHECK( damagedRect.x <= 190 && damagedRect.x >= 185 );
+  DALI_TEST_CHECK( damagedRect.y <= 350 && damagedRect.y >= 345 );
+  DALI_TEST_CHECK( damagedRect.x + damagedRect.width >= 390 && damagedRect.x + damagedRect.width <= 395 );
+  DALI_TEST_CHECK( damagedRect.y + damagedRect.height >= 450 && damagedRect.y + damagedRect.height <= 455 );
+
+  // Only the damaged region was drawn
+  const TestGlAbstraction::ScissorParams& scissor = glAbstraction.GetScissorParams();
+  DALI_TEST_EQUALS( scissor.x, damagedRect.x, TEST_LOCATION );
+  DALI_TEST_EQUALS( scissor.y, damagedRect.y, TEST_LOCATION );
+  DALI_TEST_EQUALS( scissor.width, damagedRect.width, TEST_LOCATION );
+  DALI_TEST_EQUALS( scissor.height, damagedRect.height, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliPartialUpdateColorP(void)
+{
+  TestApplication application;
+  ImageActor imageActor = CreateImageActor( application );
+
+  imageActor.SetColor( Color::RED );
+  const Rect<int> damagedRect = RenderFrame( application, 1u );
+
+  DALI_TEST_CHECK( damagedRect.x <= 190 && damagedRect.x >= 185 );
+  DALI_TEST_CHECK( damagedRect.width >= 100 && damagedRect.width <= 110 );
+  DALI_TEST_CHECK( damagedRect.height >= 100 && damagedRect.height <= 110 );
+
+  END_TEST;
+}
+
+int UtcDaliPartialUpdateVisibilityP(void)
+{
+  TestApplication application;
+  ImageActor imageActor = CreateImageActor( application );
+
+  // The actor is removed from the render list, then added again
+  imageActor.SetVisible( false );
+  Rect<int> damagedRect = RenderFrame( application, 1u );
+  DALI_TEST_CHECK( damagedRect.width >= 100 && damagedRect.width <= 110 );
+
+  RenderFrame( application, 1u );
+  RenderFrame( application, 1u );
+
+  imageActor.SetVisible( true );
+  damagedRect = RenderFrame( application, 1u );
+  DALI_TEST_CHECK( damagedRect.width >= 100 && damagedRect.width <= 110 );
+
+  END_TEST;
+}
+
+int UtcDaliPartialUpdateBufferAgeP(void)
+{
+  TestApplication application;
+  TestGlAbstraction& glAbstraction = application.GetGlAbstraction();
+  TraceCallStack& enableTrace = glAbstraction.GetCullFaceTrace();
+  enableTrace.Enable( true );
+  ImageActor imageActor = CreateImageActor( application );
+
+  imageActor.SetPosition( 100.0f, 0.0f );
+  const Rect<int> movedRect = RenderFrame( application, 1u );
+
+  // The properties of the actor are reset in the following frame
+  const Rect<int> resetRect = RenderFrame( application, 1u );
+  DALI_TEST_CHECK( !resetRect.IsEmpty() );
+
+  // The buffer was presented three frames ago, so the damage of the previous two frames is redrawn
+  const Rect<int> damagedRect = RenderFrame( application, 3u );
+  DALI_TEST_CHECK( damagedRect.IsEmpty() );
+  DALI_TEST_EQUALS( glAbstraction.GetScissorParams().width, movedRect.width, TEST_LOCATION );
+
+  // The contents of the buffer are unknown, so the whole surface is redrawn without scissoring
+  imageActor.SetPosition( 0.0f, 0.0f );
+  RenderFrame( application, 1u );
+  RenderFrame( application, 1u );
+  enableTrace.Reset();
+  RenderFrame( application, 0u );
+  DALI_TEST_CHECK( !enableTrace.FindMethodAndParams( "Enable", ScissorTestParam() ) );
+
+  END_TEST;
+}
+
+int UtcDaliPartialUpdateUntrackedChangeN(void)
+{
+  TestApplication application;
+  CreateImageActor( application );
+
+  // A change which is not made by a property damages the whole surface
+  Stage::GetCurrent().SetBackgroundColor( Color::BLUE );
+  const Rect<int> damagedRect = RenderFrame( application, 1u );
+  DALI_TEST_EQUALS( damagedRect, SURFACE_RECT, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliPartialUpdateAddActorN(void)
+{
+  TestApplication application;
+  CreateImageActor( application );
+
+  // Adding an actor sends messages which are not damage-tracked
+  Actor actor = ImageActor::New( BufferImage::New( 4, 4 ) );
+  Stage::GetCurrent().Add( actor );
+  const Rect<int> damagedRect = RenderFrame( application, 1u );
+  DALI_TEST_EQUALS( damagedRect, SURFACE_RECT, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliPartialUpdateOffscreenP(void)
+{
+  TestApplication application;
+  TestGlAbstraction& glAbstraction = application.GetGlAbstraction();
+  ImageActor imageActor = CreateImageActor( application );
+
+  RenderTask task = Stage::GetCurrent().GetRenderTaskList().CreateTask();
+  task.SetSourceActor( imageActor );
+  task.SetTargetFrameBuffer( FrameBufferImage::New() );
+  for( unsigned int i = 0u; i < 4u; ++i )
+  {
+    RenderFrame( application, 1u );
+  }
+
+  // Nothing changed on-screen, but the off-screen target is still drawn
+  TraceCallStack& drawTrace = glAbstraction.GetDrawTrace();
+  drawTrace.Enable( true );
+  drawTrace.Reset();
+  const Rect<int> damagedRect = RenderFrame( application, 1u );
+  DALI_TEST_CHECK( damagedRect.IsEmpty() );
+  DALI_TEST_CHECK( drawTrace.CountMethod( "DrawElements" ) + drawTrace.CountMethod( "DrawArrays" ) > 0 );
+
+  END_TEST;
+}
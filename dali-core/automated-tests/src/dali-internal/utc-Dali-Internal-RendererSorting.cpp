@@ -0,0 +1,310 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <time.h>
+#include <algorithm>
+#include <map>
+#include <dali/public-api/dali-core.h>
+#include <dali-test-suite-utils.h>
+#include <dali/devel-api/common/owner-container.h>
+
+// Internal headers are allowed here
+
+#include <dali/internal/render/common/render-item.h>
+#include <dali/internal/update/manager/renderer-sorting-helper.h>
+
+using namespace Dali;
+using Internal::SceneGraph::RenderItem;
+using Internal::SceneGraph::RendererSortingHelper;
+using Internal::SceneGraph::RendererSortAttributesContainer;
+using Internal::SceneGraph::RendererWithSortAttributes;
+
+typedef OwnerContainer< RenderItem* > RenderItemContainer;
+
+void utc_dali_internal_renderer_sorting_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_renderer_sorting_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+const unsigned int ITEM_COUNT = 5000u;
+
+double GetSeconds()
+{
+  timespec time;
+  clock_gettime( CLOCK_MONOTONIC, &time );
+  return static_cast<double>( time.tv_sec ) + static_cast<double>( time.tv_nsec ) * 1e-9;
+}
+
+/**
+ * Create render items & their sort attributes; the shaders & geometries are fake pointers, which are only compared.
+ */
+void CreateItems( RenderItemContainer& items, RendererSortAttributesContainer& attributes,
+                  unsigned int count, unsigned int shaderCount, unsigned int textureCount, unsigned int geometryCount )
+{
+  items.Clear();
+  attributes.resize( count );
+
+  unsigned int random = 12345u;
+  for( unsigned int i = 0u; i < count; ++i )
+  {
+    random = random * 1103515245u + 12345u;
+    const unsigned int value = random >> 8u;
+
+    RenderItem* item = new RenderItem();
+    item->SetDepthIndex( static_cast< int >( value % 7u ) * 1000 - 3000 );
+    item->SetIsOpaque( 0u == ( value % 3u ) );
+    items.PushBack( item );
+
+    attributes[i].renderItem = item;
+    attributes[i].shader = reinterpret_cast< const Internal::SceneGraph::Shader* >( 0x1000u + 64u * ( ( value / 7u ) % shaderCount ) );
+    attributes[i].textureResourceId = ( value / 11u ) % textureCount;
+    attributes[i].geometry = reinterpret_cast< const Internal::SceneGraph::RenderGeometry* >( 0x80000u + 32u * ( ( value / 13u ) % geometryCount ) );
+    attributes[i].zValue = static_cast< float >( static_cast< int >( value % 41u ) - 20 ) * 0.5f;
+  }
+}
+
+/**
+ * Numbers values in the order they are first seen, up to a maximum.
+ */
+template < typename T >
+class FirstSeen
+{
+public:
+
+  FirstSeen( unsigned int maximum )
+  : mMaximum( maximum )
+  {
+  }
+
+  void Add( T value )
+  {
+    if( mIds.find( value ) == mIds.end() )
+    {
+      const unsigned int id = mIds.size();
+      mIds[ value ] = std::min( id, mMaximum );
+    }
+  }
+
+  unsigned int Get( T value ) const
+  {
+    return mIds.find( value )->second;
+  }
+
+private:
+
+  std::map< T, unsigned int > mIds;
+  unsigned int mMaximum;
+};
+
+/**
+ * The expected order: the primary order of the layer, then the order in which shaders, textures & geometries are first seen.
+ */
+struct ExpectedOrder
+{
+  ExpectedOrder( const RendererSortAttributesContainer& attributes, bool layer3d )
+  : shaders( 255u ),
+    textures( 4095u ),
+    geometries( 2047u ),
+    is3d( layer3d )
+  {
+    for( unsigned int i = 0u; i < attributes.size(); ++i )
+    {
+      shaders.Add( attributes[i].shader );
+      textures.Add( attributes[i].textureResourceId );
+      geometries.Add( attributes[i].geometry );
+    }
+  }
+
+  bool operator()( const RendererWithSortAttributes& lhs, const RendererWithSortAttributes& rhs ) const
+  {
+    if( is3d )
+    {
+      if( lhs.renderItem->IsOpaque() != rhs.renderItem->IsOpaque() )
+      {
+        return lhs.renderItem->IsOpaque();
+      }
+      if( !lhs.renderItem->IsOpaque() && ( lhs.zValue != rhs.zValue ) )
+      {
+        return lhs.zValue > rhs.zValue;
+      }
+    }
+    else if( lhs.renderItem->GetDepthIndex() != rhs.renderItem->GetDepthIndex() )
+    {
+      return lhs.renderItem->GetDepthIndex() < rhs.renderItem->GetDepthIndex();
+    }
+
+    if( shaders.Get( lhs.shader ) != shaders.Get( rhs.shader ) )
+    {
+      return shaders.Get( lhs.shader ) < shaders.Get( rhs.shader );
+    }
+    if( textures.Get( lhs.textureResourceId ) != textures.Get( rhs.textureResourceId ) )
+    {
+      return textures.Get( lhs.textureResourceId ) < textures.Get( rhs.textureResourceId );
+    }
+    return geometries.Get( lhs.geometry ) < geometries.Get( rhs.geometry );
+  }
+
+  FirstSeen< const Internal::SceneGraph::Shader* > shaders;
+  FirstSeen< Integration::ResourceId > textures;
+  FirstSeen< const Internal::SceneGraph::RenderGeometry* > geometries;
+  bool is3d;
+};
+
+/**
+ * The comparison which was used with std::stable_sort before the radix sort.
+ */
+bool CompareItems( const RendererWithSortAttributes& lhs, const RendererWithSortAttributes& rhs )
+{
+  if( lhs.renderItem->GetDepthIndex() == rhs.renderItem->GetDepthIndex() )
+  {
+    if( lhs.shader == rhs.shader )
+    {
+      if( lhs.textureResourceId == rhs.textureResourceId )
+      {
+        return lhs.geometry < rhs.geometry;
+      }
+      return lhs.textureResourceId < rhs.textureResourceId;
+    }
+    return lhs.shader < rhs.shader;
+  }
+  return lhs.renderItem->GetDepthIndex() < rhs.renderItem->GetDepthIndex();
+}
+
+bool CheckSort( unsigned int count, unsigned int shaderCount, unsigned int textureCount, unsigned int geometryCount, bool layer3d )
+{
+  RenderItemContainer items;
+  RendererSortingHelper helper;
+  CreateItems( items, helper.GetSortAttributes(), count, shaderCount, textureCount, geometryCount );
+
+  RendererSortAttributesContainer expected( helper.GetSortAttributes() );
+  std::stable_sort( expected.begin(), expected.end(), ExpectedOrder( expected, layer3d ) );
+
+  helper.Sort( layer3d );
+
+  const RendererSortAttributesContainer& sorted = helper.GetSortAttributes();
+  if( sorted.size() != expected.size() )
+  {
+    return false;
+  }
+  for( unsigned int i = 0u; i < sorted.size(); ++i )
+  {
+    if( sorted[i].renderItem != expected[i].renderItem )
+    {
+      tet_printf( "Item %u differs\n", i );
+      return false;
+    }
+  }
+  return true;
+}
+
+} // anonymous namespace
+
+int UtcDaliRendererSortingHelperSort2D(void)
+{
+  DALI_TEST_CHECK( CheckSort( 0u, 1u, 1u, 1u, false ) );
+  DALI_TEST_CHECK( CheckSort( 1u, 1u, 1u, 1u, false ) );
+  DALI_TEST_CHECK( CheckSort( 500u, 1u, 1u, 1u, false ) );
+  DALI_TEST_CHECK( CheckSort( 500u, 5u, 9u, 4u, false ) );
+  DALI_TEST_CHECK( CheckSort( ITEM_COUNT, 40u, 300u, 100u, false ) );
+  END_TEST;
+}
+
+int UtcDaliRendererSortingHelperSort3D(void)
+{
+  DALI_TEST_CHECK( CheckSort( 1u, 1u, 1u, 1u, true ) );
+  DALI_TEST_CHECK( CheckSort( 500u, 1u, 1u, 1u, true ) );
+  DALI_TEST_CHECK( CheckSort( 500u, 5u, 9u, 4u, true ) );
+  DALI_TEST_CHECK( CheckSort( ITEM_COUNT, 40u, 300u, 100u, true ) );
+  END_TEST;
+}
+
+int UtcDaliRendererSortingHelperSortManyResources(void)
+{
+  // More shaders, textures & geometries than fit in the key; the remainder keep their original order
+  DALI_TEST_CHECK( CheckSort( ITEM_COUNT, 1000u, ITEM_COUNT, 3000u, false ) );
+  DALI_TEST_CHECK( CheckSort( ITEM_COUNT, 1000u, ITEM_COUNT, 3000u, true ) );
+  END_TEST;
+}
+
+int UtcDaliRendererSortingHelperSortRepeatedly(void)
+{
+  // The helper is reused every frame
+  RenderItemContainer items;
+  RendererSortingHelper helper;
+  CreateItems( items, helper.GetSortAttributes(), 200u, 300u, 10u, 10u );
+  helper.Sort( false );
+
+  CreateItems( items, helper.GetSortAttributes(), 100u, 3u, 10u, 10u );
+  RendererSortAttributesContainer expected( helper.GetSortAttributes() );
+  std::stable_sort( expected.begin(), expected.end(), ExpectedOrder( expected, false ) );
+  helper.Sort( false );
+
+  bool matches( true );
+  for( unsigned int i = 0u; i < expected.size(); ++i )
+  {
+    matches = matches && ( helper.GetSortAttributes()[i].renderItem == expected[i].renderItem );
+  }
+  DALI_TEST_CHECK( matches );
+  END_TEST;
+}
+
+int UtcDaliRendererSortingHelperPerformance(void)
+{
+  const unsigned int iterations = 50u;
+
+  RenderItemContainer items;
+  RendererSortAttributesContainer attributes;
+  CreateItems( items, attributes, ITEM_COUNT, 40u, 300u, 100u );
+
+  RendererSortAttributesContainer sorted;
+  double start = GetSeconds();
+  for( unsigned int iteration = 0u; iteration < iterations; ++iteration )
+  {
+    sorted = attributes;
+    std::stable_sort( sorted.begin(), sorted.end(), CompareItems );
+  }
+  const double comparisonElapsed = GetSeconds() - start;
+
+  RendererSortingHelper helper;
+  start = GetSeconds();
+  for( unsigned int iteration = 0u; iteration < iterations; ++iteration )
+  {
+    helper.GetSortAttributes() = attributes;
+    helper.Sort( false );
+  }
+  const double radixElapsed = GetSeconds() - start;
+
+  tet_printf( "Sorting %u items: std::stable_sort %.3f ms, radix sort %.3f ms\n",
+              ITEM_COUNT, 1000.0 * comparisonElapsed / iterations, 1000.0 * radixElapsed / iterations );
+
+  // Both sort by depth index first
+  bool ordered( true );
+  for( unsigned int i = 0u; i < ITEM_COUNT; ++i )
+  {
+    ordered = ordered && ( sorted[i].renderItem->GetDepthIndex() == helper.GetSortAttributes()[i].renderItem->GetDepthIndex() );
+  }
+  DALI_TEST_CHECK( ordered );
+  END_TEST;
+}
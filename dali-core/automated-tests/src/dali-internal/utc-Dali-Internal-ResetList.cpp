@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali/public-api/dali-core.h>
+#include <dali-test-suite-utils.h>
+
+// Internal headers are allowed here
+
+#include <dali/internal/update/common/animatable-property.h>
+#include <dali/internal/update/common/property-owner.h>
+#include <dali/internal/update/common/reset-list.h>
+
+using namespace Dali;
+using Internal::SceneGraph::AnimatableProperty;
+using Internal::SceneGraph::PropertyOwner;
+using Internal::SceneGraph::ResetList;
+
+void utc_dali_internal_resetlist_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_resetlist_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+int UtcDaliResetListRequestReset(void)
+{
+  ResetList resetList;
+
+  PropertyOwner* owner = PropertyOwner::New();
+  AnimatableProperty<float>* property = new AnimatableProperty<float>( 1.0f );
+  owner->InstallCustomProperty( property );
+
+  // The owner is not reset until it has a reset list
+  owner->RequestReset();
+  DALI_TEST_EQUALS( resetList.Count(), 0u, TEST_LOCATION );
+
+  owner->SetResetList( resetList );
+  DALI_TEST_EQUALS( resetList.Count(), 0u, TEST_LOCATION );
+
+  // Requesting several times only adds the owner once
+  property->Set( 0u, 5.0f );
+  owner->RequestReset();
+  owner->RequestReset();
+  DALI_TEST_EQUALS( resetList.Count(), 1u, TEST_LOCATION );
+
+  // A set value is reset in both buffers
+  DALI_TEST_EQUALS( resetList.ResetToBaseValues( 1u ), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( resetList.Count(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( resetList.ResetToBaseValues( 0u ), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( (*property)[0], 1.0f, TEST_LOCATION );
+  DALI_TEST_CHECK( property->IsClean() );
+
+  // The owner is removed, once it has been reset in both buffers
+  DALI_TEST_EQUALS( resetList.Count(), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( resetList.ResetToBaseValues( 1u ), 0u, TEST_LOCATION );
+
+  delete owner;
+  END_TEST;
+}
+
+int UtcDaliResetListRequestAgain(void)
+{
+  ResetList resetList;
+
+  PropertyOwner* owner = PropertyOwner::New();
+  owner->SetResetList( resetList );
+  owner->RequestReset();
+
+  // Writing the properties again keeps the owner in the list
+  for( unsigned int frame = 0u; frame < 5u; ++frame )
+  {
+    DALI_TEST_EQUALS( resetList.ResetToBaseValues( frame % 2u ), 1u, TEST_LOCATION );
+    owner->RequestReset();
+  }
+
+  resetList.ResetToBaseValues( 1u );
+  DALI_TEST_EQUALS( resetList.Count(), 1u, TEST_LOCATION );
+  resetList.ResetToBaseValues( 0u );
+  DALI_TEST_EQUALS( resetList.Count(), 0u, TEST_LOCATION );
+
+  delete owner;
+  END_TEST;
+}
+
+int UtcDaliResetListDestroyOwner(void)
+{
+  ResetList resetList;
+
+  PropertyOwner* owners[3];
+  for( unsigned int i = 0u; i < 3u; ++i )
+  {
+    owners[i] = PropertyOwner::New();
+    owners[i]->SetResetList( resetList );
+    owners[i]->RequestReset();
+  }
+  DALI_TEST_EQUALS( resetList.Count(), 3u, TEST_LOCATION );
+
+  // A destroyed owner is removed from the list; the others are still reset
+  delete owners[0];
+  DALI_TEST_EQUALS( resetList.Count(), 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( resetList.ResetToBaseValues( 0u ), 2u, TEST_LOCATION );
+
+  delete owners[2];
+  DALI_TEST_EQUALS( resetList.Count(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( resetList.ResetToBaseValues( 1u ), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( resetList.Count(), 0u, TEST_LOCATION );
+
+  delete owners[1];
+  END_TEST;
+}
+
+int UtcDaliResetListAnimation(void)
+{
+  TestApplication application;
+
+  Actor actor = Actor::New();
+  Stage::GetCurrent().Add( actor );
+
+  application.SendNotification();
+  application.Render();
+
+  // Only the animated property is reset after the animation finishes; the final value is kept
+  Animation animation = Animation::New( 0.1f );
+  animation.AnimateTo( Property( actor, Actor::Property::POSITION ), Vector3( 10.0f, 20.0f, 0.0f ) );
+  animation.Play();
+
+  application.SendNotification();
+  application.Render( 50 );
+  application.Render( 100 );
+  application.SendNotification();
+  application.Render( 0 );
+  application.Render( 0 );
+
+  DALI_TEST_EQUALS( actor.GetCurrentPosition(), Vector3( 10.0f, 20.0f, 0.0f ), TEST_LOCATION );
+
+  // Setting the property afterwards is reflected in both buffers
+  actor.SetPosition( Vector3( 1.0f, 2.0f, 3.0f ) );
+  application.SendNotification();
+  application.Render( 0 );
+  DALI_TEST_EQUALS( actor.GetCurrentPosition(), Vector3( 1.0f, 2.0f, 3.0f ), TEST_LOCATION );
+  application.Render( 0 );
+  DALI_TEST_EQUALS( actor.GetCurrentPosition(), Vector3( 1.0f, 2.0f, 3.0f ), TEST_LOCATION );
+  application.Render( 0 );
+  DALI_TEST_EQUALS( actor.GetCurrentPosition(), Vector3( 1.0f, 2.0f, 3.0f ), TEST_LOCATION );
+  END_TEST;
+}
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cstring>
+#include <dali/public-api/dali-core.h>
+#include <dali-test-suite-utils.h>
+
+// Internal headers are allowed here
+
+#include <dali/internal/common/hash-map.h>
+#include <dali/internal/common/shader-data.h>
+#include <dali/internal/event/effects/shader-binary-archive.h>
+
+using namespace Dali;
+using Internal::HashMap;
+using Internal::ShaderBinaryArchive;
+using Internal::ShaderData;
+using Internal::ShaderDataPtr;
+
+void utc_dali_internal_shaderbinaryarchive_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_shaderbinaryarchive_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+ShaderDataPtr CreateShaderData( size_t shaderHash, size_t driverIdentity, const char* vertexSource, const char* fragmentSource, unsigned char binaryValue, size_t binarySize )
+{
+  ShaderDataPtr shaderData = new ShaderData( vertexSource, fragmentSource );
+  shaderData->SetHashValue( shaderHash );
+  shaderData->SetDriverIdentity( driverIdentity );
+  shaderData->AllocateBuffer( binarySize );
+  memset( shaderData->GetBufferData(), binaryValue, binarySize );
+  return shaderData;
+}
+
+bool BinaryEquals( ShaderData& shaderData, unsigned char binaryValue, size_t binarySize )
+{
+  if( shaderData.GetBufferSize() != binarySize )
+  {
+    return false;
+  }
+  for( size_t i = 0u; i < binarySize; ++i )
+  {
+    if( shaderData.GetBufferData()[i] != binaryValue )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // anonymous namespace
+
+int UtcDaliHashMapInsertFind(void)
+{
+  HashMap< unsigned int > map;
+  unsigned int value = 0u;
+  DALI_TEST_CHECK( !map.Find( 1u, value ) );
+
+  // Enough keys to grow the table a few times; use keys differing only in their high bits too
+  const unsigned int count = 1000u;
+  for( unsigned int i = 0u; i < count; ++i )
+  {
+    map.Insert( static_cast< size_t >( i ) << 20u, i );
+  }
+  DALI_TEST_EQUALS( map.Count(), static_cast< size_t >( count ), TEST_LOCATION );
+
+  bool allFound = true;
+  for( unsigned int i = 0u; i < count; ++i )
+  {
+    allFound = allFound && map.Find( static_cast< size_t >( i ) << 20u, value ) && ( value == i );
+  }
+  DALI_TEST_CHECK( allFound );
+  DALI_TEST_CHECK( !map.Find( 1u, value ) );
+
+  // Inserting an existing key replaces its value
+  map.Insert( 5u << 20u, 42u );
+  DALI_TEST_EQUALS( map.Count(), static_cast< size_t >( count ), TEST_LOCATION );
+  DALI_TEST_CHECK( map.Find( 5u << 20u, value ) );
+  DALI_TEST_EQUALS( value, 42u, TEST_LOCATION );
+
+  map.Clear();
+  DALI_TEST_EQUALS( map.Count(), static_cast< size_t >( 0u ), TEST_LOCATION );
+  DALI_TEST_CHECK( !map.Find( 5u << 20u, value ) );
+
+  END_TEST;
+}
+
+int UtcDaliShaderBinaryArchiveWriteRead(void)
+{
+  ShaderBinaryArchive archive;
+  archive.Insert( *CreateShaderData( 100u, 7u, "vertex1", "fragment1", 0x11, 16u ) );
+  archive.Insert( *CreateShaderData( 200u, 7u, "vertex2", "fragment2", 0x22, 32u ) );
+  DALI_TEST_EQUALS( archive.Count(), static_cast< size_t >( 2u ), TEST_LOCATION );
+
+  Dali::Vector< unsigned char > buffer;
+  archive.Write( buffer );
+  DALI_TEST_CHECK( buffer.Count() > 16u + 32u );
+
+  ShaderBinaryArchive readArchive;
+  DALI_TEST_CHECK( readArchive.Read( buffer ) );
+  DALI_TEST_EQUALS( readArchive.Count(), static_cast< size_t >( 2u ), TEST_LOCATION );
+
+  ShaderDataPtr shaderData = readArchive.Find( 200u );
+  DALI_TEST_CHECK( shaderData );
+  DALI_TEST_EQUALS( shaderData->GetHashValue(), static_cast< size_t >( 200u ), TEST_LOCATION );
+  DALI_TEST_EQUALS( shaderData->GetDriverIdentity(), static_cast< size_t >( 7u ), TEST_LOCATION );
+  DALI_TEST_EQUALS( std::string( shaderData->GetVertexShader() ), std::string( "vertex2" ), TEST_LOCATION );
+  DALI_TEST_EQUALS( std::string( shaderData->GetFragmentShader() ), std::string( "fragment2" ), TEST_LOCATION );
+  DALI_TEST_CHECK( BinaryEquals( *shaderData, 0x22, 32u ) );
+
+  DALI_TEST_CHECK( !readArchive.Find( 300u ) );
+
+  END_TEST;
+}
+
+int UtcDaliShaderBinaryArchiveReplace(void)
+{
+  ShaderBinaryArchive archive;
+  archive.Insert( *CreateShaderData( 100u, 7u, "vertex", "fragment", 0x11, 16u ) );
+
+  // A binary from another driver replaces the entry
+  archive.Insert( *CreateShaderData( 100u, 8u, "vertex", "fragment", 0x33, 8u ) );
+  DALI_TEST_EQUALS( archive.Count(), static_cast< size_t >( 1u ), TEST_LOCATION );
+
+  Dali::Vector< unsigned char > buffer;
+  archive.Write( buffer );
+  const size_t archiveSize = buffer.Count();
+
+  ShaderBinaryArchive readArchive;
+  DALI_TEST_CHECK( readArchive.Read( buffer ) );
+  ShaderDataPtr shaderData = readArchive.Find( 100u );
+  DALI_TEST_CHECK( shaderData );
+  DALI_TEST_EQUALS( shaderData->GetDriverIdentity(), static_cast< size_t >( 8u ), TEST_LOCATION );
+  DALI_TEST_CHECK( BinaryEquals( *shaderData, 0x33, 8u ) );
+
+  // The superseded binary is not written
+  readArchive.Write( buffer );
+  DALI_TEST_EQUALS( buffer.Count(), archiveSize, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliShaderBinaryArchiveReadInvalid(void)
+{
+  ShaderBinaryArchive archive;
+  archive.Insert( *CreateShaderData( 100u, 7u, "vertex", "fragment", 0x11, 16u ) );
+
+  Dali::Vector< unsigned char > buffer;
+  archive.Write( buffer );
+
+  // An archive of another version is not read
+  Dali::Vector< unsigned char > otherVersion( buffer );
+  otherVersion[4] += 1u;
+  ShaderBinaryArchive readArchive;
+  DALI_TEST_CHECK( !readArchive.Read( otherVersion ) );
+  DALI_TEST_EQUALS( readArchive.Count(), static_cast< size_t >( 0u ), TEST_LOCATION );
+  DALI_TEST_CHECK( !readArchive.Find( 100u ) );
+
+  // Nor is a truncated one
+  Dali::Vector< unsigned char > truncated( buffer );
+  truncated.Resize( buffer.Count() - 4u );
+  DALI_TEST_CHECK( !readArchive.Read( truncated ) );
+  DALI_TEST_EQUALS( readArchive.Count(), static_cast< size_t >( 0u ), TEST_LOCATION );
+
+  Dali::Vector< unsigned char > empty;
+  DALI_TEST_CHECK( !readArchive.Read( empty ) );
+
+  DALI_TEST_CHECK( readArchive.Read( buffer ) );
+  DALI_TEST_EQUALS( readArchive.Count(), static_cast< size_t >( 1u ), TEST_LOCATION );
+
+  END_TEST;
+}
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali/public-api/dali-core.h>
+#include <dali/integration-api/bitmap.h>
+#include <dali-test-suite-utils.h>
+
+using namespace Dali;
+
+void utc_dali_internal_texturememorybudget_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_texturememorybudget_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+const unsigned int FRAMES_UNTIL_EVICTED = 70u; // More than the frames in which a texture is considered recently used
+
+/**
+ * Complete the pending load request with a bitmap & render it
+ * @param[in] discardable Whether the pixels of the bitmap may be discarded once uploaded, as for the loaded images of the application
+ */
+void CompleteLoad( TestApplication& application, ResourcePolicy::Discardable discardable = ResourcePolicy::OWNED_DISCARD )
+{
+  TestPlatformAbstraction& platform = application.GetPlatform();
+  Integration::ResourceRequest* request = platform.GetRequest();
+  DALI_TEST_CHECK( request != NULL );
+  if( request )
+  {
+    Integration::Bitmap* bitmap = Integration::Bitmap::New( Integration::Bitmap::BITMAP_2D_PACKED_PIXELS, discardable );
+    bitmap->GetPackedPixelsProfile()->ReserveBuffer( Pixel::RGBA8888, 16u, 16u, 16u, 16u );
+    Integration::ResourcePointer resource( bitmap );
+    platform.SetResourceLoaded( request->GetId(), request->GetType()->id, resource );
+  }
+
+  application.Render();           // Process LoadComplete
+  application.SendNotification(); // Process event messages
+  application.Render();           // Upload the texture
+  application.SendNotification();
+  platform.DiscardRequest();
+  platform.ClearReadyResources();
+}
+
+void RenderFrames( TestApplication& application, unsigned int frameCount )
+{
+  for( unsigned int i = 0u; i < frameCount; ++i )
+  {
+    application.SendNotification();
+    application.Render( 16 );
+  }
+}
+
+ImageActor CreateLoadedImageActor( TestApplication& application, ResourcePolicy::Discardable discardable = ResourcePolicy::OWNED_DISCARD )
+{
+  Image image = ResourceImage::New( "image.png" );
+  ImageActor actor = ImageActor::New( image );
+  actor.SetSize( 16.0f, 16.0f ); // The test platform abstraction does not know the size of the image, so it would not be drawn
+  Stage::GetCurrent().Add( actor );
+
+  application.SendNotification(); // Flush the load request
+  application.Render();
+  CompleteLoad( application, discardable );
+
+  return actor;
+}
+
+} // anonymous namespace
+
+int UtcDaliTextureMemoryBudgetEvictAndReload(void)
+{
+  TestApplication application; // Discards the pixels of uploaded bitmaps
+  TestPlatformAbstraction& platform = application.GetPlatform();
+  TestGlAbstraction& glAbstraction = application.GetGlAbstraction();
+  TraceCallStack& textureTrace = glAbstraction.GetTextureTrace();
+
+  application.GetCore().SetTextureMemoryBudget( 1u );
+
+  std::vector< GLuint > ids;
+  ids.push_back( 23 );
+  ids.push_back( 24 );
+  glAbstraction.SetNextTextureIds( ids );
+  textureTrace.Enable( true );
+
+  ImageActor actor = CreateLoadedImageActor( application );
+  DALI_TEST_CHECK( textureTrace.FindMethod( "GenTextures" ) );
+
+  // A texture in use is not evicted, even when over the budget
+  RenderFrames( application, FRAMES_UNTIL_EVICTED );
+  DALI_TEST_CHECK( glAbstraction.CheckNoTexturesDeleted() );
+
+  // Once unused, it is evicted
+  Stage::GetCurrent().Remove( actor );
+  RenderFrames( application, FRAMES_UNTIL_EVICTED );
+  DALI_TEST_CHECK( glAbstraction.CheckTextureDeleted( 23 ) );
+
+  // The pixels were discarded, so drawing the image again reloads it
+  platform.ResetTrace();
+  textureTrace.Reset();
+  Stage::GetCurrent().Add( actor );
+  RenderFrames( application, 4u ); // The reload request passes from the render-thread through the update-thread to the event-thread & back
+  DALI_TEST_CHECK( platform.WasCalled( TestPlatformAbstraction::LoadResourceFunc ) );
+
+  CompleteLoad( application );
+  DALI_TEST_CHECK( textureTrace.FindMethod( "GenTextures" ) );
+  const std::vector< GLuint >& textures = glAbstraction.GetBoundTextures( GL_TEXTURE0 );
+  DALI_TEST_CHECK( !textures.empty() && textures.back() == 24u );
+
+  END_TEST;
+}
+
+int UtcDaliTextureMemoryBudgetEvictRetained(void)
+{
+  TestApplication application( TestApplication::DEFAULT_SURFACE_WIDTH, TestApplication::DEFAULT_SURFACE_HEIGHT,
+                               TestApplication::DEFAULT_HORIZONTAL_DPI, TestApplication::DEFAULT_VERTICAL_DPI,
+                               ResourcePolicy::DALI_RETAINS_ALL_DATA );
+  TestPlatformAbstraction& platform = application.GetPlatform();
+  TestGlAbstraction& glAbstraction = application.GetGlAbstraction();
+  TraceCallStack& textureTrace = glAbstraction.GetTextureTrace();
+
+  application.GetCore().SetTextureMemoryBudget( 1u );
+  textureTrace.Enable( true );
+
+  ImageActor actor = CreateLoadedImageActor( application, ResourcePolicy::OWNED_RETAIN );
+
+  Stage::GetCurrent().Remove( actor );
+  RenderFrames( application, FRAMES_UNTIL_EVICTED );
+  DALI_TEST_CHECK( textureTrace.FindMethod( "DeleteTextures" ) );
+
+  // The retained pixels are uploaded again without reloading the image
+  platform.ResetTrace();
+  textureTrace.Reset();
+  Stage::GetCurrent().Add( actor );
+  RenderFrames( application, 3u );
+  DALI_TEST_CHECK( !platform.WasCalled( TestPlatformAbstraction::LoadResourceFunc ) );
+  DALI_TEST_CHECK( textureTrace.FindMethod( "GenTextures" ) );
+
+  END_TEST;
+}
+
+int UtcDaliTextureMemoryBudgetNone(void)
+{
+  TestApplication application;
+  TestGlAbstraction& glAbstraction = application.GetGlAbstraction();
+
+  ImageActor actor = CreateLoadedImageActor( application );
+
+  // Without a budget, unused textures are kept
+  Stage::GetCurrent().Remove( actor );
+  RenderFrames( application, FRAMES_UNTIL_EVICTED );
+  DALI_TEST_CHECK( glAbstraction.CheckNoTexturesDeleted() );
+
+  // Within the budget, too
+  application.GetCore().SetTextureMemoryBudget( 16u * 16u * 4u );
+  RenderFrames( application, FRAMES_UNTIL_EVICTED );
+  DALI_TEST_CHECK( glAbstraction.CheckNoTexturesDeleted() );
+
+  END_TEST;
+}
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali/public-api/dali-core.h>
+#include <dali/integration-api/bitmap.h>
+#include <dali-test-suite-utils.h>
+
+using namespace Dali;
+
+void utc_dali_internal_textureuploadbudget_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_textureuploadbudget_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+const unsigned int IMAGE_WIDTH = 16u;
+const unsigned int IMAGE_HEIGHT = 64u;
+const std::size_t ROW_SIZE = IMAGE_WIDTH * 4u; // RGBA8888
+
+bool gUploaded = false;
+
+void OnUploaded( Image image )
+{
+  gUploaded = true;
+}
+
+/**
+ * Complete the pending load request with a bitmap
+ */
+void SetResourceLoaded( TestApplication& application )
+{
+  TestPlatformAbstraction& platform = application.GetPlatform();
+  Integration::ResourceRequest* request = platform.GetRequest();
+  DALI_TEST_CHECK( request != NULL );
+  if( request )
+  {
+    Integration::Bitmap* bitmap = Integration::Bitmap::New( Integration::Bitmap::BITMAP_2D_PACKED_PIXELS, ResourcePolicy::OWNED_RETAIN );
+    bitmap->GetPackedPixelsProfile()->ReserveBuffer( Pixel::RGBA8888, IMAGE_WIDTH, IMAGE_HEIGHT, IMAGE_WIDTH, IMAGE_HEIGHT );
+    Integration::ResourcePointer resource( bitmap );
+    platform.SetResourceLoaded( request->GetId(), request->GetType()->id, resource );
+  }
+}
+
+void RenderFrame( TestApplication& application )
+{
+  application.SendNotification();
+  application.Render( 16 );
+  application.SendNotification();
+}
+
+} // anonymous namespace
+
+int UtcDaliTextureUploadBudgetSpreadOverFrames(void)
+{
+  TestApplication application;
+  TestPlatformAbstraction& platform = application.GetPlatform();
+  TestGlAbstraction& glAbstraction = application.GetGlAbstraction();
+  TraceCallStack& textureTrace = glAbstraction.GetTextureTrace();
+  TraceCallStack& drawTrace = glAbstraction.GetDrawTrace();
+
+  // A quarter of the image per frame
+  application.GetCore().SetTextureUploadBudget( ROW_SIZE * IMAGE_HEIGHT / 4u );
+
+  gUploaded = false;
+  ResourceImage image = ResourceImage::New( "image.png" );
+  image.UploadedSignal().Connect( &OnUploaded );
+  ImageActor actor = ImageActor::New( image );
+  actor.SetSize( 80.0f, 80.0f );
+  Stage::GetCurrent().Add( actor );
+
+  RenderFrame( application ); // Flush the load request
+
+  textureTrace.Enable( true );
+  drawTrace.Enable( true );
+  SetResourceLoaded( application );
+
+  // The image is not drawn until all of it has been uploaded
+  for( unsigned int frame = 0u; frame < 4u; ++frame )
+  {
+    RenderFrame( application );
+    DALI_TEST_EQUALS( textureTrace.CountMethod( "TexSubImage2D" ), static_cast< int >( frame + 1u ), TEST_LOCATION );
+    DALI_TEST_CHECK( !drawTrace.FindMethod( "DrawArrays" ) && !drawTrace.FindMethod( "DrawElements" ) );
+    DALI_TEST_CHECK( !gUploaded );
+  }
+  DALI_TEST_EQUALS( textureTrace.CountMethod( "GenTextures" ), 1, TEST_LOCATION );
+
+  // The completed upload reaches the update-thread through the double-buffered post-process queue, a frame later
+  RenderFrame( application );
+  RenderFrame( application );
+  DALI_TEST_CHECK( gUploaded );
+
+  RenderFrame( application );
+  DALI_TEST_CHECK( drawTrace.FindMethod( "DrawArrays" ) || drawTrace.FindMethod( "DrawElements" ) );
+  DALI_TEST_EQUALS( textureTrace.CountMethod( "TexSubImage2D" ), 4, TEST_LOCATION );
+
+  platform.DiscardRequest();
+  platform.ClearReadyResources();
+
+  END_TEST;
+}
+
+int UtcDaliTextureUploadBudgetNone(void)
+{
+  TestApplication application;
+  TestPlatformAbstraction& platform = application.GetPlatform();
+  TestGlAbstraction& glAbstraction = application.GetGlAbstraction();
+  TraceCallStack& textureTrace = glAbstraction.GetTextureTrace();
+
+  ResourceImage image = ResourceImage::New( "image.png" );
+  ImageActor actor = ImageActor::New( image );
+  actor.SetSize( 80.0f, 80.0f );
+  Stage::GetCurrent().Add( actor );
+
+  RenderFrame( application ); // Flush the load request
+
+  textureTrace.Enable( true );
+  SetResourceLoaded( application );
+  RenderFrame( application );
+  RenderFrame( application );
+
+  // Without a budget, the image is uploaded as a whole
+  DALI_TEST_CHECK( textureTrace.FindMethod( "TexImage2D" ) );
+  DALI_TEST_CHECK( !textureTrace.FindMethod( "TexSubImage2D" ) );
+
+  platform.DiscardRequest();
+  platform.ClearReadyResources();
+
+  END_TEST;
+}
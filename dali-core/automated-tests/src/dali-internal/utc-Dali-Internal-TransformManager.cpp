@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali/public-api/dali-core.h>
+#include <dali-test-suite-utils.h>
+
+// Internal headers are allowed here
+
+#include <dali/internal/update/manager/transform-manager.h>
+
+using namespace Dali;
+using Internal::SceneGraph::TransformManager;
+using Internal::SceneGraph::TransformId;
+using Internal::SceneGraph::WorldTransform;
+using Internal::SceneGraph::INVALID_TRANSFORM_ID;
+
+void utc_dali_internal_transformmanager_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_transformmanager_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+void SetLocalTransform( TransformManager& manager, TransformId id, const Vector3& position, const Quaternion& orientation, const Vector3& scale )
+{
+  manager.SetLocalTransform( id, ParentOrigin::CENTER, AnchorPoint::CENTER, Vector3( 100.0f, 100.0f, 100.0f ), position, orientation, scale );
+}
+
+} // anonymous namespace
+
+int UtcDaliTransformManagerCreateRemove(void)
+{
+  TransformManager manager;
+  DALI_TEST_EQUALS( manager.GetComponentCount(), 0u, TEST_LOCATION );
+
+  TransformId id1 = manager.CreateTransform();
+  TransformId id2 = manager.CreateTransform();
+  DALI_TEST_CHECK( id1 != id2 );
+  DALI_TEST_EQUALS( manager.GetComponentCount(), 2u, TEST_LOCATION );
+
+  // A new component has the identity transform, and has not been inherited yet
+  const WorldTransform& world = manager.GetWorldTransform( id1 );
+  DALI_TEST_EQUALS( world.matrix[0], Matrix::IDENTITY, 0.001f, TEST_LOCATION );
+  DALI_TEST_CHECK( !world.inherited );
+
+  manager.RemoveTransform( id1 );
+  DALI_TEST_EQUALS( manager.GetComponentCount(), 1u, TEST_LOCATION );
+
+  // The id is reused
+  TransformId id3 = manager.CreateTransform();
+  DALI_TEST_EQUALS( id3, id1, TEST_LOCATION );
+  DALI_TEST_EQUALS( manager.GetComponentCount(), 2u, TEST_LOCATION );
+
+  manager.RemoveTransform( id2 );
+  manager.RemoveTransform( id3 );
+  DALI_TEST_EQUALS( manager.GetComponentCount(), 0u, TEST_LOCATION );
+  END_TEST;
+}
+
+int UtcDaliTransformManagerUpdateInherit(void)
+{
+  TransformManager manager;
+
+  TransformId parent = manager.CreateTransform();
+  TransformId child = manager.CreateTransform();
+  manager.SetParent( child, parent );
+
+  const Quaternion parentOrientation( Radian( Math::PI_2 ), Vector3::ZAXIS );
+  SetLocalTransform( manager, parent, Vector3( 10.0f, 20.0f, 0.0f ), parentOrientation, Vector3( 2.0f, 2.0f, 2.0f ) );
+  SetLocalTransform( manager, child, Vector3( 5.0f, 0.0f, 0.0f ), Quaternion(), Vector3::ONE );
+
+  manager.Update( 0u );
+
+  const WorldTransform& parentWorld = manager.GetWorldTransform( parent );
+  const WorldTransform& childWorld = manager.GetWorldTransform( child );
+
+  DALI_TEST_CHECK( parentWorld.inherited );
+  DALI_TEST_CHECK( childWorld.inherited );
+  DALI_TEST_EQUALS( parentWorld.position[0], Vector3( 10.0f, 20.0f, 0.0f ), 0.001f, TEST_LOCATION );
+
+  // The child offset is scaled & rotated by the parent
+  DALI_TEST_EQUALS( childWorld.position[0], Vector3( 10.0f, 30.0f, 0.0f ), 0.001f, TEST_LOCATION );
+  DALI_TEST_EQUALS( childWorld.scale[0], Vector3( 2.0f, 2.0f, 2.0f ), 0.001f, TEST_LOCATION );
+  DALI_TEST_EQUALS( childWorld.orientation[0], parentOrientation, 0.001f, TEST_LOCATION );
+
+  Matrix expectedMatrix( false );
+  expectedMatrix.SetTransformComponents( Vector3( 2.0f, 2.0f, 2.0f ), parentOrientation, Vector3( 10.0f, 30.0f, 0.0f ) );
+  DALI_TEST_EQUALS( childWorld.matrix[0], expectedMatrix, 0.001f, TEST_LOCATION );
+
+  // Disable scale & orientation inheritance
+  manager.SetInheritance( child, INHERIT_PARENT_POSITION, false, false, false );
+  manager.Update( 1u );
+
+  DALI_TEST_EQUALS( childWorld.scale[1], Vector3::ONE, 0.001f, TEST_LOCATION );
+  DALI_TEST_EQUALS( childWorld.orientation[1], Quaternion(), 0.001f, TEST_LOCATION );
+  DALI_TEST_EQUALS( childWorld.position[1], Vector3( 10.0f, 30.0f, 0.0f ), 0.001f, TEST_LOCATION );
+  END_TEST;
+}
+
+int UtcDaliTransformManagerUpdateParentAfterChild(void)
+{
+  TransformManager manager;
+
+  // Create the child before the parent; the components must be reordered so the parent is calculated first
+  TransformId child = manager.CreateTransform();
+  TransformId grandChild = manager.CreateTransform();
+  TransformId parent = manager.CreateTransform();
+  manager.SetParent( grandChild, child );
+  manager.SetParent( child, parent );
+
+  SetLocalTransform( manager, parent, Vector3( 1.0f, 0.0f, 0.0f ), Quaternion(), Vector3::ONE );
+  SetLocalTransform( manager, child, Vector3( 0.0f, 2.0f, 0.0f ), Quaternion(), Vector3::ONE );
+  SetLocalTransform( manager, grandChild, Vector3( 0.0f, 0.0f, 3.0f ), Quaternion(), Vector3::ONE );
+
+  manager.Update( 0u );
+
+  DALI_TEST_EQUALS( manager.GetWorldTransform( child ).position[0], Vector3( 1.0f, 2.0f, 0.0f ), 0.001f, TEST_LOCATION );
+  DALI_TEST_EQUALS( manager.GetWorldTransform( grandChild ).position[0], Vector3( 1.0f, 2.0f, 3.0f ), 0.001f, TEST_LOCATION );
+
+  // Moving the parent makes the descendants dirty
+  SetLocalTransform( manager, parent, Vector3( 4.0f, 0.0f, 0.0f ), Quaternion(), Vector3::ONE );
+  manager.Update( 1u );
+
+  DALI_TEST_EQUALS( manager.GetWorldTransform( grandChild ).position[1], Vector3( 4.0f, 2.0f, 3.0f ), 0.001f, TEST_LOCATION );
+
+  // Remove the parent from the hierarchy; the child now uses its local transform
+  manager.SetParent( child, INVALID_TRANSFORM_ID );
+  SetLocalTransform( manager, child, Vector3( 0.0f, 2.0f, 0.0f ), Quaternion(), Vector3::ONE );
+  manager.Update( 0u );
+
+  DALI_TEST_EQUALS( manager.GetWorldTransform( child ).position[0], Vector3( 0.0f, 2.0f, 0.0f ), 0.001f, TEST_LOCATION );
+  DALI_TEST_EQUALS( manager.GetWorldTransform( grandChild ).position[0], Vector3( 0.0f, 2.0f, 3.0f ), 0.001f, TEST_LOCATION );
+  END_TEST;
+}
+
+int UtcDaliTransformManagerUpdateDoubleBuffered(void)
+{
+  TransformManager manager;
+
+  TransformId id = manager.CreateTransform();
+  SetLocalTransform( manager, id, Vector3( 1.0f, 2.0f, 3.0f ), Quaternion(), Vector3::ONE );
+
+  const WorldTransform& world = manager.GetWorldTransform( id );
+
+  manager.Update( 0u );
+  DALI_TEST_EQUALS( world.position[0], Vector3( 1.0f, 2.0f, 3.0f ), 0.001f, TEST_LOCATION );
+  DALI_TEST_EQUALS( world.position[1], Vector3::ZERO, 0.001f, TEST_LOCATION );
+  DALI_TEST_CHECK( world.reinherited );
+
+  // The component is clean, but the value calculated in the previous update is copied
+  manager.Update( 1u );
+  DALI_TEST_EQUALS( world.position[1], Vector3( 1.0f, 2.0f, 3.0f ), 0.001f, TEST_LOCATION );
+  DALI_TEST_CHECK( !world.reinherited );
+
+  // Nothing changes
+  manager.Update( 0u );
+  DALI_TEST_EQUALS( world.position[0], Vector3( 1.0f, 2.0f, 3.0f ), 0.001f, TEST_LOCATION );
+  DALI_TEST_CHECK( !world.reinherited );
+  END_TEST;
+}
+
+int UtcDaliTransformManagerRemoveKeepsOthers(void)
+{
+  TransformManager manager;
+
+  TransformId parent = manager.CreateTransform();
+  TransformId first = manager.CreateTransform();
+  TransformId second = manager.CreateTransform();
+  manager.SetParent( first, parent );
+  manager.SetParent( second, parent );
+
+  SetLocalTransform( manager, parent, Vector3( 1.0f, 1.0f, 1.0f ), Quaternion(), Vector3::ONE );
+  SetLocalTransform( manager, first, Vector3( 1.0f, 0.0f, 0.0f ), Quaternion(), Vector3::ONE );
+  SetLocalTransform( manager, second, Vector3( 0.0f, 1.0f, 0.0f ), Quaternion(), Vector3::ONE );
+  manager.Update( 0u );
+
+  // Removing a component moves the last component into its place
+  manager.RemoveTransform( first );
+  SetLocalTransform( manager, parent, Vector3( 2.0f, 2.0f, 2.0f ), Quaternion(), Vector3::ONE );
+  manager.Update( 1u );
+
+  DALI_TEST_EQUALS( manager.GetComponentCount(), 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( manager.GetWorldTransform( second ).position[1], Vector3( 2.0f, 3.0f, 2.0f ), 0.001f, TEST_LOCATION );
+  END_TEST;
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali/public-api/dali-core.h>
+#include <dali-test-suite-utils.h>
+
+// Internal headers are allowed here
+
+#include <dali/internal/common/shader-data.h>
+#include <dali/internal/render/shaders/program.h>
+#include <dali/internal/render/shaders/program-controller.h>
+
+using namespace Dali;
+using Internal::Program;
+using Internal::ProgramController;
+using Internal::ShaderData;
+using Internal::ShaderDataPtr;
+
+void utc_dali_internal_uniformcache_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_uniformcache_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+Program* CreateProgram( ProgramController& programController )
+{
+  ShaderDataPtr shaderData = new ShaderData( "vertex", "fragment" );
+  shaderData->SetHashValue( 1u );
+
+  Program* program = Program::New( programController, shaderData, false );
+  program->Use();
+  return program;
+}
+
+GLint GetLocation( Program& program, const char* name )
+{
+  GLint location = program.GetUniformLocation( program.RegisterUniform( name ) );
+  DALI_TEST_CHECK( location >= 0 && location < Program::MAX_UNIFORM_CACHE_SIZE );
+  return location;
+}
+
+} // anonymous namespace
+
+int UtcDaliUniformCacheMatrix(void)
+{
+  TestApplication application;
+  TestGlAbstraction& glAbstraction = application.GetGlAbstraction();
+  ProgramController programController( glAbstraction );
+  Program* program = CreateProgram( programController );
+
+  const GLint matrixLocation = GetLocation( *program, "uTestMatrix" );
+  const GLint matrix3Location = GetLocation( *program, "uTestMatrix3" );
+
+  Matrix matrix;
+  matrix.SetTransformComponents( Vector3::ONE, Quaternion::IDENTITY, Vector3( 1.0f, 2.0f, 3.0f ) );
+  program->SetUniformMatrix4fv( matrixLocation, 1, matrix.AsFloat() );
+  DALI_TEST_CHECK( glAbstraction.CheckUniformValue< Matrix >( "uTestMatrix", matrix ) );
+  DALI_TEST_EQUALS( programController.GetRedundantUniformCount(), 0u, TEST_LOCATION );
+
+  // Overwrite the value behind the program's back; setting the same matrix again must not reach GL
+  glAbstraction.UniformMatrix4fv( matrixLocation, 1, GL_FALSE, Matrix::IDENTITY.AsFloat() );
+  program->SetUniformMatrix4fv( matrixLocation, 1, matrix.AsFloat() );
+  DALI_TEST_CHECK( glAbstraction.CheckUniformValue< Matrix >( "uTestMatrix", Matrix::IDENTITY ) );
+  DALI_TEST_EQUALS( programController.GetRedundantUniformCount(), 1u, TEST_LOCATION );
+
+  // A different matrix is uploaded
+  program->SetUniformMatrix4fv( matrixLocation, 1, Matrix::IDENTITY.AsFloat() );
+  DALI_TEST_EQUALS( programController.GetRedundantUniformCount(), 1u, TEST_LOCATION );
+  matrix.SetTranslation( Vector3( 4.0f, 5.0f, 6.0f ) );
+  program->SetUniformMatrix4fv( matrixLocation, 1, matrix.AsFloat() );
+  DALI_TEST_CHECK( glAbstraction.CheckUniformValue< Matrix >( "uTestMatrix", matrix ) );
+  DALI_TEST_EQUALS( programController.GetRedundantUniformCount(), 1u, TEST_LOCATION );
+
+  Matrix3 matrix3( 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f );
+  program->SetUniformMatrix3fv( matrix3Location, 1, matrix3.AsFloat() );
+  program->SetUniformMatrix3fv( matrix3Location, 1, matrix3.AsFloat() );
+  DALI_TEST_CHECK( glAbstraction.CheckUniformValue< Matrix3 >( "uTestMatrix3", matrix3 ) );
+  DALI_TEST_EQUALS( programController.GetRedundantUniformCount(), 2u, TEST_LOCATION );
+
+  programController.ClearRedundantUniformCount();
+  DALI_TEST_EQUALS( programController.GetRedundantUniformCount(), 0u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliUniformCacheVector3(void)
+{
+  TestApplication application;
+  TestGlAbstraction& glAbstraction = application.GetGlAbstraction();
+  ProgramController programController( glAbstraction );
+  Program* program = CreateProgram( programController );
+
+  const GLint location = GetLocation( *program, "uTestVector" );
+
+  program->SetUniform3f( location, 1.0f, 2.0f, 3.0f );
+  DALI_TEST_CHECK( glAbstraction.CheckUniformValue< Vector3 >( "uTestVector", Vector3( 1.0f, 2.0f, 3.0f ) ) );
+
+  glAbstraction.Uniform3f( location, 0.0f, 0.0f, 0.0f );
+  program->SetUniform3f( location, 1.0f, 2.0f, 3.0f );
+  DALI_TEST_CHECK( glAbstraction.CheckUniformValue< Vector3 >( "uTestVector", Vector3::ZERO ) );
+  DALI_TEST_EQUALS( programController.GetRedundantUniformCount(), 1u, TEST_LOCATION );
+
+  program->SetUniform3f( location, 1.0f, 2.0f, 4.0f );
+  DALI_TEST_CHECK( glAbstraction.CheckUniformValue< Vector3 >( "uTestVector", Vector3( 1.0f, 2.0f, 4.0f ) ) );
+  DALI_TEST_EQUALS( programController.GetRedundantUniformCount(), 1u, TEST_LOCATION );
+
+  // The cache holds the values GL initializes uniforms to after the context is recreated
+  programController.GlContextDestroyed();
+  program->Use();
+  const GLint newLocation = GetLocation( *program, "uTestVector" );
+  program->SetUniform3f( newLocation, 1.0f, 2.0f, 4.0f );
+  DALI_TEST_EQUALS( programController.GetRedundantUniformCount(), 1u, TEST_LOCATION );
+
+  END_TEST;
+}
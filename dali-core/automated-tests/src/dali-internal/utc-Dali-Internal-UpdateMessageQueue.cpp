@@ -0,0 +1,345 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <pthread.h>
+#include <dali/public-api/dali-core.h>
+#include <dali-test-suite-utils.h>
+#include <test-render-controller.h>
+
+// Internal headers are allowed here
+
+#include <dali/internal/common/message.h>
+#include <dali/internal/update/common/scene-graph-buffers.h>
+#include <dali/internal/update/queue/update-message-queue.h>
+
+using namespace Dali;
+using Internal::MessageBase;
+using Internal::SceneGraph::SceneGraphBuffers;
+
+void utc_dali_internal_update_message_queue_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_update_message_queue_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+const unsigned int FLUSH_COUNT = 2000u;
+const unsigned int MESSAGES_PER_FLUSH = 50u;
+
+/**
+ * Records its value when processed.
+ */
+class RecordMessage : public MessageBase
+{
+public:
+
+  RecordMessage( std::vector< unsigned int >& values, unsigned int value )
+  : mValues( values ),
+    mValue( value )
+  {
+  }
+
+  virtual void Process( Internal::BufferIndex bufferIndex )
+  {
+    mValues.push_back( mValue );
+  }
+
+private:
+
+  std::vector< unsigned int >& mValues;
+  unsigned int mValue;
+};
+
+struct ProducerData
+{
+  Internal::Update::MessageQueue* queue;
+  std::vector< unsigned int >* values;
+  volatile bool finished;
+};
+
+void QueueMessage( Internal::Update::MessageQueue& queue, std::vector< unsigned int >& values, unsigned int value, bool updateScene )
+{
+  unsigned int* slot = queue.ReserveMessageSlot( sizeof( RecordMessage ), updateScene );
+  new ( slot ) RecordMessage( values, value );
+}
+
+void* Produce( void* data )
+{
+  ProducerData& producer = *static_cast< ProducerData* >( data );
+
+  unsigned int value = 0u;
+  for( unsigned int flush = 0u; flush < FLUSH_COUNT; ++flush )
+  {
+    producer.queue->EventProcessingStarted();
+    for( unsigned int i = 0u; i < MESSAGES_PER_FLUSH; ++i )
+    {
+      QueueMessage( *producer.queue, *producer.values, value++, false );
+    }
+    producer.queue->FlushQueue();
+  }
+
+  __sync_synchronize();
+  producer.finished = true;
+  return NULL;
+}
+
+/**
+ * Queues & flushes a message requiring a scene update when processed, as the event-thread may do while the update-thread processes messages.
+ */
+class FlushMessage : public MessageBase
+{
+public:
+
+  FlushMessage( Internal::Update::MessageQueue& queue, std::vector< unsigned int >& values )
+  : mQueue( queue ),
+    mValues( values )
+  {
+  }
+
+  virtual void Process( Internal::BufferIndex bufferIndex )
+  {
+    mQueue.EventProcessingStarted();
+    QueueMessage( mQueue, mValues, 1u, true );
+    mQueue.FlushQueue();
+  }
+
+private:
+
+  Internal::Update::MessageQueue& mQueue;
+  std::vector< unsigned int >& mValues;
+};
+
+void QueueCoalescedMessage( Internal::Update::MessageQueue& queue, std::vector< unsigned int >& values, unsigned int value, const void* property )
+{
+  unsigned int* slot = queue.ReserveCoalescedMessageSlot( sizeof( RecordMessage ), property );
+  new ( slot ) RecordMessage( values, value );
+}
+
+} // anonymous namespace
+
+int UtcDaliUpdateMessageQueueConcurrentFlush(void)
+{
+  TestRenderController renderController;
+  SceneGraphBuffers sceneGraphBuffers;
+  Internal::Update::MessageQueue queue( renderController, sceneGraphBuffers );
+
+  // Only the update-thread processes messages, therefore the values are only written by this thread
+  std::vector< unsigned int > values;
+
+  ProducerData producer;
+  producer.queue = &queue;
+  producer.values = &values;
+  producer.finished = false;
+
+  pthread_t thread;
+  pthread_create( &thread, NULL, Produce, &producer );
+
+  while( !producer.finished )
+  {
+    queue.ProcessMessages( 0u );
+  }
+  pthread_join( thread, NULL );
+  queue.ProcessMessages( 0u );
+
+  // The messages are processed once each, in the order they were queued
+  DALI_TEST_EQUALS( values.size(), static_cast< std::size_t >( FLUSH_COUNT * MESSAGES_PER_FLUSH ), TEST_LOCATION );
+  bool ordered( true );
+  for( unsigned int i = 0u; i < values.size(); ++i )
+  {
+    ordered = ordered && ( values[i] == i );
+  }
+  DALI_TEST_CHECK( ordered );
+
+  queue.ProcessMessages( 0u );
+  DALI_TEST_CHECK( queue.WasEmpty() );
+  END_TEST;
+}
+
+int UtcDaliUpdateMessageQueueSceneUpdate(void)
+{
+  TestRenderController renderController;
+  SceneGraphBuffers sceneGraphBuffers;
+  Internal::Update::MessageQueue queue( renderController, sceneGraphBuffers );
+
+  std::vector< unsigned int > values;
+
+  queue.EventProcessingStarted();
+  QueueMessage( queue, values, 0u, true );
+  DALI_TEST_CHECK( queue.FlushQueue() );
+
+  // The scene is updated before & after the message is processed
+  DALI_TEST_CHECK( queue.IsSceneUpdateRequired() );
+  queue.ProcessMessages( 0u );
+  DALI_TEST_CHECK( !queue.WasEmpty() );
+  DALI_TEST_CHECK( queue.IsSceneUpdateRequired() );
+  queue.ProcessMessages( 1u );
+  DALI_TEST_CHECK( queue.WasEmpty() );
+  DALI_TEST_CHECK( !queue.IsSceneUpdateRequired() );
+
+  // Flushing an empty queue has no messages to process
+  DALI_TEST_CHECK( !queue.FlushQueue() );
+  DALI_TEST_EQUALS( values.size(), 1u, TEST_LOCATION );
+  END_TEST;
+}
+
+int UtcDaliUpdateMessageQueueSceneUpdateFlushedWhileProcessing(void)
+{
+  TestRenderController renderController;
+  SceneGraphBuffers sceneGraphBuffers;
+  Internal::Update::MessageQueue queue( renderController, sceneGraphBuffers );
+
+  std::vector< unsigned int > values;
+
+  queue.EventProcessingStarted();
+  unsigned int* slot = queue.ReserveMessageSlot( sizeof( FlushMessage ), false );
+  new ( slot ) FlushMessage( queue, values );
+  DALI_TEST_CHECK( queue.FlushQueue() );
+
+  // The message flushed during processing is left for the next update
+  DALI_TEST_CHECK( !queue.IsSceneUpdateRequired() );
+  queue.ProcessMessages( 0u );
+  DALI_TEST_EQUALS( values.size(), 0u, TEST_LOCATION );
+
+  // The scene is updated when it is processed, and in the following update
+  DALI_TEST_CHECK( queue.IsSceneUpdateRequired() );
+  queue.ProcessMessages( 1u );
+  DALI_TEST_EQUALS( values.size(), 1u, TEST_LOCATION );
+  DALI_TEST_CHECK( queue.IsSceneUpdateRequired() );
+  queue.ProcessMessages( 0u );
+  DALI_TEST_CHECK( !queue.IsSceneUpdateRequired() );
+  END_TEST;
+}
+
+int UtcDaliUpdateMessageQueueCoalesce(void)
+{
+  TestRenderController renderController;
+  SceneGraphBuffers sceneGraphBuffers;
+  Internal::Update::MessageQueue queue( renderController, sceneGraphBuffers );
+
+  std::vector< unsigned int > values;
+  int first( 0 );
+  int second( 0 );
+
+  // Only the last message for each property is processed, in the position of the first
+  queue.EventProcessingStarted();
+  QueueCoalescedMessage( queue, values, 1u, &first );
+  QueueMessage( queue, values, 2u, false );
+  QueueCoalescedMessage( queue, values, 3u, &second );
+  QueueCoalescedMessage( queue, values, 4u, &first );
+  QueueCoalescedMessage( queue, values, 5u, &second );
+  queue.FlushQueue();
+  queue.ProcessMessages( 0u );
+
+  DALI_TEST_EQUALS( values.size(), 3u, TEST_LOCATION );
+  DALI_TEST_EQUALS( values[0], 4u, TEST_LOCATION );
+  DALI_TEST_EQUALS( values[1], 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( values[2], 5u, TEST_LOCATION );
+
+  // An invalidated message is not replaced
+  values.clear();
+  queue.EventProcessingStarted();
+  QueueCoalescedMessage( queue, values, 6u, &first );
+  queue.InvalidateCoalescedMessage( &first );
+  QueueMessage( queue, values, 7u, false );
+  QueueCoalescedMessage( queue, values, 8u, &first );
+  QueueCoalescedMessage( queue, values, 9u, &first );
+  queue.FlushQueue();
+
+  // Messages are not replaced after the queue has been flushed
+  queue.EventProcessingStarted();
+  QueueCoalescedMessage( queue, values, 10u, &first );
+  queue.FlushQueue();
+  queue.ProcessMessages( 0u );
+
+  DALI_TEST_EQUALS( values.size(), 4u, TEST_LOCATION );
+  DALI_TEST_EQUALS( values[0], 6u, TEST_LOCATION );
+  DALI_TEST_EQUALS( values[1], 7u, TEST_LOCATION );
+  DALI_TEST_EQUALS( values[2], 9u, TEST_LOCATION );
+  DALI_TEST_EQUALS( values[3], 10u, TEST_LOCATION );
+
+  // The earlier slots remain valid when the buffer grows
+  values.clear();
+  std::vector< int > properties( 5000u );
+  queue.EventProcessingStarted();
+  for( unsigned int i = 0u; i < properties.size(); ++i )
+  {
+    QueueCoalescedMessage( queue, values, i, &properties[i] );
+  }
+  for( unsigned int i = 0u; i < properties.size(); ++i )
+  {
+    QueueCoalescedMessage( queue, values, i + 1u, &properties[i] );
+  }
+  queue.FlushQueue();
+  queue.ProcessMessages( 0u );
+
+  DALI_TEST_EQUALS( values.size(), properties.size(), TEST_LOCATION );
+  bool replaced( true );
+  for( unsigned int i = 0u; i < values.size(); ++i )
+  {
+    replaced = replaced && ( values[i] == i + 1u );
+  }
+  DALI_TEST_CHECK( replaced );
+  END_TEST;
+}
+
+int UtcDaliUpdateMessageQueueCoalescePropertyMessages(void)
+{
+  TestApplication application;
+
+  Actor actor = Actor::New();
+  Stage::GetCurrent().Add( actor );
+
+  // The last position is used
+  actor.SetPosition( Vector3( 1.0f, 2.0f, 3.0f ) );
+  actor.SetPosition( Vector3( 4.0f, 5.0f, 6.0f ) );
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( actor.GetCurrentPosition(), Vector3( 4.0f, 5.0f, 6.0f ), TEST_LOCATION );
+
+  // Component & relative changes are applied in order
+  actor.SetPosition( Vector3( 1.0f, 2.0f, 3.0f ) );
+  actor.SetX( 10.0f );
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( actor.GetCurrentPosition(), Vector3( 10.0f, 2.0f, 3.0f ), TEST_LOCATION );
+
+  actor.SetPosition( Vector3( 1.0f, 2.0f, 3.0f ) );
+  actor.TranslateBy( Vector3( 1.0f, 1.0f, 1.0f ) );
+  actor.SetPosition( Vector3( 5.0f, 5.0f, 5.0f ) );
+  actor.TranslateBy( Vector3( 1.0f, 1.0f, 1.0f ) );
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( actor.GetCurrentPosition(), Vector3( 6.0f, 6.0f, 6.0f ), TEST_LOCATION );
+
+  // Custom properties are coalesced too
+  Property::Index index = actor.RegisterProperty( "custom", 0.0f );
+  actor.SetProperty( index, 1.0f );
+  actor.SetProperty( index, 2.0f );
+  actor.SetColor( Color::RED );
+  actor.SetProperty( index, 3.0f );
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( actor.GetProperty< float >( index ), 3.0f, TEST_LOCATION );
+  DALI_TEST_EQUALS( actor.GetCurrentColor(), Color::RED, TEST_LOCATION );
+  END_TEST;
+}
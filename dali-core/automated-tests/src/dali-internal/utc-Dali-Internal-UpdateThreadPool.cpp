@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali/public-api/dali-core.h>
+#include <dali-test-suite-utils.h>
+
+// Internal headers are allowed here
+
+#include <dali/internal/update/common/update-thread-pool.h>
+
+using namespace Dali;
+using Internal::SceneGraph::UpdateThreadPool;
+
+void utc_dali_internal_updatethreadpool_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_updatethreadpool_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+class TestTask : public UpdateThreadPool::Task
+{
+public:
+
+  TestTask()
+  : mExecuteCount( 0 ),
+    mSum( 0u )
+  {
+  }
+
+  virtual ~TestTask()
+  {
+  }
+
+  virtual void Execute()
+  {
+    ++mExecuteCount;
+    for( unsigned int i = 0u; i < 10000u; ++i )
+    {
+      mSum += i;
+    }
+  }
+
+  int mExecuteCount;
+  unsigned int mSum;
+};
+
+/**
+ * Create a tree of actors, with layers and large sub-trees which are updated as separate tasks.
+ */
+Actor CreateTree( std::vector< Actor >& actors )
+{
+  Layer root = Layer::New();
+  root.SetParentOrigin( ParentOrigin::CENTER );
+  root.SetAnchorPoint( AnchorPoint::CENTER );
+  root.SetPosition( 10.0f, 20.0f );
+
+  for( unsigned int i = 0u; i < 4u; ++i )
+  {
+    Actor branch = ( i % 2u ) ? Actor( Layer::New() ) : Actor::New();
+    branch.SetParentOrigin( ParentOrigin::CENTER );
+    branch.SetAnchorPoint( AnchorPoint::CENTER );
+    branch.SetPosition( 100.0f * i, 0.0f );
+    root.Add( branch );
+
+    for( unsigned int j = 0u; j < 10u; ++j )
+    {
+      ImageActor leaf = ImageActor::New( BufferImage::New( 4u, 4u ) );
+      leaf.SetParentOrigin( ParentOrigin::CENTER );
+      leaf.SetAnchorPoint( AnchorPoint::CENTER );
+      leaf.SetSize( 10.0f, 10.0f );
+      leaf.SetPosition( 0.0f, 10.0f * j );
+      branch.Add( leaf );
+      actors.push_back( leaf );
+    }
+  }
+
+  return root;
+}
+
+} // anonymous namespace
+
+int UtcDaliUpdateThreadPoolThreadCount(void)
+{
+  UpdateThreadPool pool;
+  DALI_TEST_EQUALS( pool.GetThreadCount(), 1u, TEST_LOCATION );
+
+  pool.SetThreadCount( 4u );
+  DALI_TEST_EQUALS( pool.GetThreadCount(), 4u, TEST_LOCATION );
+
+  pool.SetThreadCount( 2u );
+  DALI_TEST_EQUALS( pool.GetThreadCount(), 2u, TEST_LOCATION );
+
+  // The calling thread is always used
+  pool.SetThreadCount( 0u );
+  DALI_TEST_EQUALS( pool.GetThreadCount(), 1u, TEST_LOCATION );
+  END_TEST;
+}
+
+int UtcDaliUpdateThreadPoolExecute(void)
+{
+  for( unsigned int threadCount = 1u; threadCount <= 4u; ++threadCount )
+  {
+    UpdateThreadPool pool;
+    pool.SetThreadCount( threadCount );
+
+    std::vector< TestTask > tasks( 64u );
+    UpdateThreadPool::TaskContainer container;
+    for( unsigned int i = 0u; i < tasks.size(); ++i )
+    {
+      container.push_back( &tasks[i] );
+    }
+
+    // Execute several batches with the same threads
+    for( unsigned int batch = 0u; batch < 3u; ++batch )
+    {
+      pool.Execute( container );
+    }
+
+    for( unsigned int i = 0u; i < tasks.size(); ++i )
+    {
+      DALI_TEST_EQUALS( tasks[i].mExecuteCount, 3, TEST_LOCATION );
+    }
+  }
+
+  // An empty batch does nothing
+  UpdateThreadPool pool;
+  pool.SetThreadCount( 2u );
+  pool.Execute( UpdateThreadPool::TaskContainer() );
+  END_TEST;
+}
+
+int UtcDaliUpdateThreadPoolParallelSceneUpdate(void)
+{
+  TestApplication application;
+
+  std::vector< Actor > actors;
+  Actor sequentialTree = CreateTree( actors );
+  Stage::GetCurrent().Add( sequentialTree );
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  gl.EnableDrawCallTrace( true );
+
+  application.SendNotification();
+  application.Render();
+
+  std::vector< Vector3 > sequentialPositions;
+  for( unsigned int i = 0u; i < actors.size(); ++i )
+  {
+    sequentialPositions.push_back( actors[i].GetCurrentWorldPosition() );
+  }
+
+  gl.GetDrawTrace().Reset();
+  application.Render();
+  const int sequentialDrawCount = gl.GetDrawTrace().CountMethod( "DrawElements" ) + gl.GetDrawTrace().CountMethod( "DrawArrays" );
+  DALI_TEST_CHECK( sequentialDrawCount > 0 );
+
+  // Update a copy of the scene with several threads; the result should match the sequential update
+  application.GetCore().SetUpdateThreadCount( 4u );
+
+  std::vector< Actor > parallelActors;
+  Actor parallelTree = CreateTree( parallelActors );
+  Stage::GetCurrent().Add( parallelTree );
+
+  application.SendNotification();
+  application.Render();
+
+  for( unsigned int i = 0u; i < parallelActors.size(); ++i )
+  {
+    DALI_TEST_EQUALS( parallelActors[i].GetCurrentWorldPosition(), sequentialPositions[i], 0.001f, TEST_LOCATION );
+  }
+
+  // Both trees are rendered
+  gl.GetDrawTrace().Reset();
+  application.Render();
+  DALI_TEST_EQUALS( gl.GetDrawTrace().CountMethod( "DrawElements" ) + gl.GetDrawTrace().CountMethod( "DrawArrays" ), sequentialDrawCount * 2, TEST_LOCATION );
+
+  // Moving the tree updates the world positions of every actor
+  parallelTree.SetPosition( 0.0f, 0.0f );
+  application.SendNotification();
+  application.Render();
+
+  for( unsigned int i = 0u; i < parallelActors.size(); ++i )
+  {
+    DALI_TEST_EQUALS( parallelActors[i].GetCurrentWorldPosition(), sequentialPositions[i] - Vector3( 10.0f, 20.0f, 0.0f ), 0.001f, TEST_LOCATION );
+  }
+  END_TEST;
+}
@@ -431,7 +431,7 @@ void Function( Vector3& /* current */, const PropertyInputContainer& inputs )
 
 int UtcDaliConstraintCloneCheckSourcesAndSetters(void)
 {
-  // Ensure all sources, the tag and remove-action are cloned appropriately
+  // Ensure all sources, the tag, remove-action and thread-safety are cloned appropriately
 
   TestApplication application;
 
@@ -452,6 +452,7 @@ int UtcDaliConstraintCloneCheckSourcesAndSetters(void)
   constraint.AddSource( LocalSource( Actor::Property::COLOR ) );
   constraint.AddSource( LocalSource( Actor::Property::VISIBLE ) );
   constraint.SetRemoveAction( Constraint::Discard );
+  constraint.SetThreadSafe( true );
   constraint.SetTag( 123 );
 
   // Clone the constraint & apply the clone
@@ -463,6 +464,7 @@ int UtcDaliConstraintCloneCheckSourcesAndSetters(void)
 
   DALI_TEST_EQUALS( constraint.GetRemoveAction(), constraintClone.GetRemoveAction(), TEST_LOCATION );
   DALI_TEST_EQUALS( constraint.GetTag(),          constraintClone.GetTag(),          TEST_LOCATION );
+  DALI_TEST_EQUALS( constraint.IsThreadSafe(),     constraintClone.IsThreadSafe(),     TEST_LOCATION );
 
   END_TEST;
 }
@@ -596,6 +598,45 @@ int UtcDaliConstraintGetTargetPropertyN(void)
 }
 ///////////////////////////////////////////////////////////////////////////////
 
+///////////////////////////////////////////////////////////////////////////////
+// Constraint::SetThreadSafe
+// Constraint::IsThreadSafe
+///////////////////////////////////////////////////////////////////////////////
+int UtcDaliConstraintThreadSafeP(void)
+{
+  TestApplication application;
+
+  Actor actor = Actor::New();
+  Constraint constraint = Constraint::New< Vector3 >( actor, Actor::Property::POSITION, &BasicFunction< Vector3 > );
+  DALI_TEST_CHECK( !constraint.IsThreadSafe() );
+
+  constraint.SetThreadSafe( true );
+  DALI_TEST_CHECK( constraint.IsThreadSafe() );
+
+  END_TEST;
+}
+
+int UtcDaliConstraintSetThreadSafeN(void)
+{
+  // Attempt to set from uninitialised constraint
+
+  TestApplication application;
+
+  Constraint constraint;
+  try
+  {
+    constraint.SetThreadSafe( true );
+    DALI_TEST_CHECK( false ); // Should not reach here!
+  }
+  catch( ... )
+  {
+    DALI_TEST_CHECK( true );
+  }
+
+  END_TEST;
+}
+///////////////////////////////////////////////////////////////////////////////
+
 ///////////////////////////////////////////////////////////////////////////////
 // Constraint::SetTag
 // Constraint::GetTag
@@ -498,6 +498,204 @@ int UtcDaliLayerSetDepthTestDisabled(void)
   END_TEST;
 }
 
+int UtcDaliLayerSetBatchingEnabled(void)
+{
+  TestApplication application;
+  tet_infoline("Testing Dali::Layer::SetBatchingEnabled() ");
+
+  Layer actor = Layer::New();
+  DALI_TEST_CHECK( !actor.IsBatchingEnabled() );
+
+  actor.SetBatchingEnabled( true );
+  DALI_TEST_CHECK( actor.IsBatchingEnabled() );
+
+  actor.SetBatchingEnabled( false );
+  DALI_TEST_CHECK( !actor.IsBatchingEnabled() );
+  END_TEST;
+}
+
+int UtcDaliLayerBatchingDrawCalls(void)
+{
+  TestApplication application;
+  tet_infoline("Testing that compatible image actors are drawn with a single draw call when batching is enabled");
+
+  TraceCallStack& drawTrace = application.GetGlAbstraction().GetDrawTrace();
+  drawTrace.Enable( true );
+
+  Layer layer = Layer::New();
+  layer.SetParentOrigin( ParentOrigin::CENTER );
+  layer.SetSize( 100.0f, 100.0f );
+  Stage::GetCurrent().Add( layer );
+
+  BufferImage image = BufferImage::New( 4, 4 );
+  ImageActor actors[3];
+  for( unsigned int i = 0; i < 3; ++i )
+  {
+    actors[i] = ImageActor::New( image );
+    actors[i].SetSize( 10.0f, 10.0f );
+    actors[i].SetPosition( 20.0f * i, 0.0f );
+    layer.Add( actors[i] );
+  }
+
+  application.SendNotification();
+  application.Render();
+
+  // Without batching, each actor is drawn separately
+  drawTrace.Reset();
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( drawTrace.CountMethod( "DrawArrays" ), 3, TEST_LOCATION );
+
+  // The three quads are drawn as triangles by one draw call
+  layer.SetBatchingEnabled( true );
+  drawTrace.Reset();
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( drawTrace.CountMethod( "DrawArrays" ), 1, TEST_LOCATION );
+
+  std::stringstream out;
+  out << GL_TRIANGLES << ", " << 0 << ", " << 18;
+  DALI_TEST_CHECK( drawTrace.FindMethodAndParams( "DrawArrays", out.str() ) );
+
+  // An actor with a different color is not batched with the others
+  actors[2].SetColor( Color::RED );
+  drawTrace.Reset();
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( drawTrace.CountMethod( "DrawArrays" ), 2, TEST_LOCATION );
+  END_TEST;
+}
+
+int UtcDaliLayerBatchingCustomShader(void)
+{
+  TestApplication application;
+  tet_infoline("Testing that image actors with a custom shader are only batched if it does not modify the geometry");
+
+  TraceCallStack& drawTrace = application.GetGlAbstraction().GetDrawTrace();
+  drawTrace.Enable( true );
+
+  Layer layer = Layer::New();
+  layer.SetParentOrigin( ParentOrigin::CENTER );
+  layer.SetSize( 100.0f, 100.0f );
+  layer.SetBatchingEnabled( true );
+  Stage::GetCurrent().Add( layer );
+
+  // The vertex shader may read the model matrix or the local positions
+  ShaderEffect shader = ShaderEffect::New( "", "" );
+  BufferImage image = BufferImage::New( 4, 4 );
+  ImageActor actors[3];
+  for( unsigned int i = 0; i < 3; ++i )
+  {
+    actors[i] = ImageActor::New( image );
+    actors[i].SetSize( 10.0f, 10.0f );
+    actors[i].SetPosition( 20.0f * i, 0.0f );
+    actors[i].SetShaderEffect( shader );
+    layer.Add( actors[i] );
+  }
+
+  application.SendNotification();
+  application.Render();
+
+  drawTrace.Reset();
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( drawTrace.CountMethod( "DrawArrays" ), 3, TEST_LOCATION );
+
+  // The hint allows the actors to be batched
+  ShaderEffect hintedShader = ShaderEffect::New( "", "", ShaderEffect::HINT_DOESNT_MODIFY_GEOMETRY );
+  for( unsigned int i = 0; i < 3; ++i )
+  {
+    actors[i].SetShaderEffect( hintedShader );
+  }
+  drawTrace.Reset();
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( drawTrace.CountMethod( "DrawArrays" ), 1, TEST_LOCATION );
+  END_TEST;
+}
+
+int UtcDaliLayerSetRenderCacheEnabled(void)
+{
+  TestApplication application;
+  tet_infoline("Testing Dali::Layer::SetRenderCacheEnabled() ");
+
+  Layer actor = Layer::New();
+  DALI_TEST_CHECK( !actor.IsRenderCacheEnabled() );
+
+  actor.SetRenderCacheEnabled( true );
+  DALI_TEST_CHECK( actor.IsRenderCacheEnabled() );
+
+  actor.SetRenderCacheEnabled( false );
+  DALI_TEST_CHECK( !actor.IsRenderCacheEnabled() );
+  END_TEST;
+}
+
+int UtcDaliLayerRenderCacheDrawCalls(void)
+{
+  TestApplication application;
+  tet_infoline("Testing that a cached layer is only redrawn when its actors change");
+
+  TraceCallStack& drawTrace = application.GetGlAbstraction().GetDrawTrace();
+  TraceCallStack& textureTrace = application.GetGlAbstraction().GetTextureTrace();
+  drawTrace.Enable( true );
+  textureTrace.Enable( true );
+
+  BufferImage image = BufferImage::New( 4, 4 );
+
+  // An actor which changes, outside the cached layer
+  ImageActor other = ImageActor::New( image );
+  other.SetSize( 10.0f, 10.0f );
+  Stage::GetCurrent().Add( other );
+
+  Layer layer = Layer::New();
+  layer.SetParentOrigin( ParentOrigin::CENTER );
+  layer.SetSize( 100.0f, 100.0f );
+  layer.SetRenderCacheEnabled( true );
+  Stage::GetCurrent().Add( layer );
+
+  ImageActor actors[3];
+  for( unsigned int i = 0; i < 3; ++i )
+  {
+    actors[i] = ImageActor::New( image );
+    actors[i].SetSize( 10.0f, 10.0f );
+    actors[i].SetPosition( 20.0f * i, 0.0f );
+    layer.Add( actors[i] );
+  }
+
+  // The cache is created when the layer is first drawn
+  textureTrace.Reset();
+  for( unsigned int i = 0; i < 4; ++i )
+  {
+    application.SendNotification();
+    application.Render();
+  }
+  DALI_TEST_EQUALS( textureTrace.CountMethod( "GenTextures" ), 2, TEST_LOCATION );
+
+  // Only the cache & the other actor are drawn while the layer does not change
+  other.SetPosition( 5.0f, 0.0f );
+  drawTrace.Reset();
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( drawTrace.CountMethod( "DrawArrays" ), 2, TEST_LOCATION );
+
+  // The cache is redrawn when an actor of the layer changes
+  actors[1].SetColor( Color::RED );
+  drawTrace.Reset();
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( drawTrace.CountMethod( "DrawArrays" ), 5, TEST_LOCATION );
+
+  // The cache is released once disabled
+  layer.SetRenderCacheEnabled( false );
+  drawTrace.Reset();
+  textureTrace.Reset();
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( drawTrace.CountMethod( "DrawArrays" ), 4, TEST_LOCATION );
+  DALI_TEST_CHECK( textureTrace.FindMethod( "DeleteTextures" ) );
+  END_TEST;
+}
+
 int UtcDaliLayerCreateDestroy(void)
 {
   tet_infoline("Testing Dali::Layer::CreateDestroy() ");
@@ -63,6 +63,14 @@ class Shader;
 
 /**
  * @brief Shaders allows custom vertex and color transformations in the GPU
+ *
+ * A vertex shader may declare the attributes "mat4 aInstanceModelView" and optionally "vec4 aInstanceColor",
+ * and use them instead of the uModelView & uColor uniforms. Consecutive renderers with the same geometry,
+ * material & shader are then drawn with a single instanced draw call where the GL implementation supports it;
+ * uModelView is set to the view matrix in this case.
+ * <pre>
+ * gl_Position = uProjection * aInstanceModelView * vec4( aPosition * uSize.xy, 0.0, 1.0 );
+ * </pre>
  */
 class DALI_IMPORT_API Shader : public Handle
 {
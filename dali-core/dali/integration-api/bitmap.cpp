@@ -275,6 +275,7 @@ Bitmap::Bitmap( ResourcePolicy::Discardable discardable, Dali::Integration::Pixe
   mHasAlphaChannel(true),
   mAlphaChannelUsed(true),
   mData(pixBuf),
+  mExternalBuffer(NULL),
   mDiscardable(discardable)
 {
 }
@@ -301,7 +302,15 @@ void Bitmap::DeletePixelBuffer()
   {
     return;
   }
-  free ( mData );
+  if( mExternalBuffer )
+  {
+    delete mExternalBuffer;
+    mExternalBuffer = NULL;
+  }
+  else
+  {
+    free ( mData );
+  }
   mData = NULL;
 }
 
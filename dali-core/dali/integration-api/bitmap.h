@@ -266,6 +266,17 @@ public:
    * Features that only apply to opaque/compressed formats. */
   /**@{*/
 
+  /**
+   * Owner of a pixel buffer the bitmap did not allocate, such as a file
+   * mapped into memory. The bitmap deletes it, rather than freeing the
+   * buffer, when the pixel buffer is deleted.
+   */
+  class ExternalBuffer
+  {
+  public:
+    virtual ~ExternalBuffer() {}
+  };
+
   class CompressedProfile
   {
   public:
@@ -285,6 +296,25 @@ public:
                                        const unsigned width,
                                        const unsigned height,
                                        const size_t numBytes ) = 0;
+
+    /**
+     * Use a buffer the Bitmap did not allocate as its pixel buffer, without copying it.
+     * Any previously allocated pixel buffer is deleted.
+     * The contents must stay unchanged until the pixel buffer is deleted, when
+     * the owner passed in is deleted in turn.
+     * @param[in] pixelFormat   pixel format
+     * @param[in] width         Image width in pixels
+     * @param[in] height        Image height in pixels
+     * @param[in] buffer        The compressed pixel data
+     * @param[in] numBytes      Buffer size in bytes
+     * @param[in] owner         Keeps the buffer valid, the Bitmap takes ownership of it
+     */
+    virtual void AssignExternalBuffer( Pixel::Format pixelFormat,
+                                       const unsigned width,
+                                       const unsigned height,
+                                       PixelBuffer* buffer,
+                                       const size_t numBytes,
+                                       ExternalBuffer* owner ) = 0;
   };
 
   virtual const CompressedProfile* GetCompressedProfile() const { return 0; }
@@ -325,6 +355,7 @@ protected:
   bool          mHasAlphaChannel;   ///< Whether the image has an alpha channel
   bool          mAlphaChannelUsed;  ///< Whether the alpha channel is used in case the image owns one.
   PixelBuffer*  mData;            ///< Raw pixel data
+  ExternalBuffer* mExternalBuffer; ///< Owner of mData if the bitmap did not allocate it, or NULL
 
 private:
 
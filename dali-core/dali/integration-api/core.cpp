@@ -78,6 +78,21 @@ void Core::SetDpi(unsigned int dpiHorizontal, unsigned int dpiVertical)
   mImpl->SetDpi(dpiHorizontal, dpiVertical);
 }
 
+void Core::SetUpdateThreadCount( unsigned int threadCount )
+{
+  mImpl->SetUpdateThreadCount( threadCount );
+}
+
+void Core::SetTextureMemoryBudget( std::size_t budget )
+{
+  mImpl->SetTextureMemoryBudget( budget );
+}
+
+void Core::SetTextureUploadBudget( std::size_t budget )
+{
+  mImpl->SetTextureUploadBudget( budget );
+}
+
 void Core::Suspend()
 {
   mImpl->Suspend();
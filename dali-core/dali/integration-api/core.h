@@ -21,6 +21,7 @@
 // EXTERNAL INCLUDES
 #include <dali/public-api/common/dali-common.h>
 #include <dali/public-api/common/view-mode.h>
+#include <dali/public-api/math/rect.h>
 #include <dali/integration-api/context-notifier.h>
 #include <dali/integration-api/resource-policies.h>
 
@@ -119,7 +120,9 @@ public:
    * Constructor
    */
   RenderStatus()
-  : needsUpdate(false),
+  : damagedRect(),
+    bufferAge(0u),
+    needsUpdate(false),
     hasRendered(false)
   {
   }
@@ -148,8 +151,36 @@ public:
    */
   bool HasRendered() { return hasRendered; }
 
+  /**
+   * Set the age of the back buffer of the surface, before the frame is rendered.
+   * This is the number of frames since the buffer was last presented, as given by EGL_EXT_buffer_age.
+   * If the age is known, only the regions which changed since the buffer was presented are redrawn.
+   * @param[in] age The age of the buffer, or zero if its contents are undefined; the whole surface is then redrawn.
+   */
+  void SetBufferAge(unsigned int age) { bufferAge = age; }
+
+  /**
+   * Query the age of the back buffer of the surface.
+   * @return The age of the buffer, or zero if its contents are undefined.
+   */
+  unsigned int GetBufferAge() const { return bufferAge; }
+
+  /**
+   * Set the region of the surface which changed since the previous frame.
+   */
+  void SetDamagedRect(const Rect<int>& rect) { damagedRect = rect; }
+
+  /**
+   * Query the region of the surface which changed since the previous frame, e.g. to swap the buffers with damage.
+   * The rectangle is in window coordinates, with the origin at the bottom-left of the surface, as used by glScissor().
+   * @return The damaged region; this is empty if nothing changed.
+   */
+  const Rect<int>& GetDamagedRect() const { return damagedRect; }
+
 private:
 
+  Rect<int> damagedRect;
+  unsigned int bufferAge;
   bool needsUpdate;
   bool hasRendered;
 };
@@ -280,6 +311,33 @@ public:
    */
   void SetDpi(unsigned int dpiHorizontal, unsigned int dpiVertical);
 
+  /**
+   * Set the number of threads used to update the scene-graph.
+   * With more than one thread, independent sub-trees of the scene-graph are updated in parallel,
+   * and large numbers of independent constraints, marked with Dali::Constraint::SetThreadSafe(), are applied in parallel.
+   * Multi-threading note: this method should be called from the main thread
+   * @param[in] threadCount The number of threads, including the update-thread; the default is one.
+   */
+  void SetUpdateThreadCount( unsigned int threadCount );
+
+  /**
+   * Set the GPU memory budget of the textures of bitmap images.
+   * When the budget is exceeded, the least recently used textures which were not drawn in recent frames are
+   * deleted; they are uploaded again, reloading the image if its pixels were discarded, when next drawn.
+   * Multi-threading note: this method should be called from the main thread
+   * @param[in] budget The budget in bytes; the default is zero, for no budget.
+   */
+  void SetTextureMemoryBudget( std::size_t budget );
+
+  /**
+   * Set the number of bytes of newly loaded images uploaded to GL per frame.
+   * With a budget, large images are uploaded a band of rows at a time over several frames, keeping the frame
+   * time stable while many images arrive; an image is drawn, and its uploaded signal emitted, once fully uploaded.
+   * Multi-threading note: this method should be called from the main thread
+   * @param[in] budget The budget in bytes; the default is zero, to upload each image as a whole when first drawn.
+   */
+  void SetTextureUploadBudget( std::size_t budget );
+
   // Core Lifecycle
 
   /**
@@ -115,6 +115,20 @@ public:
    */
   virtual void PostRender() = 0;
 
+  /**
+   * Query whether the context supports instanced drawing, i.e. DrawArraysInstanced(),
+   * DrawElementsInstanced() & VertexAttribDivisor().
+   * @return True if instanced drawing is supported.
+   */
+  virtual bool IsInstancedDrawingSupported() = 0;
+
+  /**
+   * Query whether the context supports vertex array objects, i.e. GenVertexArrays(),
+   * BindVertexArray() & DeleteVertexArrays().
+   * @return True if vertex array objects are supported.
+   */
+  virtual bool IsVertexArrayObjectSupported() = 0;
+
   /**
    * The number of texture units an implementation supports is implementation dependent, but must be at least 8.
    */
@@ -152,6 +152,29 @@ const int SHADER_MEMORY_SIZE(
   sizeof( Internal::Shader ) +
   sizeof( Internal::SceneGraph::Shader ) );
 
+namespace
+{
+
+template< typename T >
+void AddMemoryPoolOccupancy( const char* name, const Internal::MemoryPoolObjectAllocator< T >& pool, MemoryPoolOccupancyContainer& occupancy )
+{
+  MemoryPoolOccupancy entry;
+  entry.name = name;
+  entry.objectSize = sizeof( T );
+  entry.allocationCount = pool.GetAllocationCount();
+  entry.capacity = pool.GetCapacity();
+  occupancy.PushBack( entry );
+}
+
+} // unnamed namespace
+
+void GetMemoryPoolOccupancy( MemoryPoolOccupancyContainer& occupancy )
+{
+  AddMemoryPoolOccupancy( "SceneGraph::Node", Internal::PooledAllocation< Internal::SceneGraph::Node >::GetMemoryPool(), occupancy );
+  AddMemoryPoolOccupancy( "SceneGraph::Layer", Internal::PooledAllocation< Internal::SceneGraph::Layer >::GetMemoryPool(), occupancy );
+  AddMemoryPoolOccupancy( "SceneGraph::ImageAttachment", Internal::PooledAllocation< Internal::SceneGraph::ImageAttachment >::GetMemoryPool(), occupancy );
+}
+
 } // namespace Profiling
 
 } // namespace Integration
@@ -22,6 +22,7 @@
 
 // INTERNAL INCLUDES
 #include <dali/public-api/common/dali-common.h>
+#include <dali/public-api/common/dali-vector.h>
 
 namespace Dali
 {
@@ -62,6 +63,26 @@ DALI_IMPORT_API extern const int PROPERTY_BUFFER_MEMORY_SIZE;     ///< Total siz
 DALI_IMPORT_API extern const int MATERIAL_MEMORY_SIZE;     ///< Total size of material and associated internal objects
 DALI_IMPORT_API extern const int SAMPLER_MEMORY_SIZE;     ///< Total size of material and associated internal objects
 DALI_IMPORT_API extern const int SHADER_MEMORY_SIZE;     ///< Total size of material and associated internal objects
+
+/**
+ * The occupancy of a memory pool, from which internal objects are allocated.
+ */
+struct MemoryPoolOccupancy
+{
+  const char* name;             ///< The name of the object type allocated from the pool
+  unsigned int objectSize;      ///< The size of each object
+  unsigned int allocationCount; ///< The number of objects currently allocated
+  unsigned int capacity;        ///< The number of objects which fit in the pool, before it must grow
+};
+
+typedef Dali::Vector< MemoryPoolOccupancy > MemoryPoolOccupancyContainer;
+
+/**
+ * Retrieve the occupancy of the memory pools for scene-graph objects.
+ * @param[out] occupancy The occupancy of each pool is appended to this container.
+ */
+DALI_IMPORT_API void GetMemoryPoolOccupancy( MemoryPoolOccupancyContainer& occupancy );
+
 } // namespace Profiling
 
 } // namespace Integration
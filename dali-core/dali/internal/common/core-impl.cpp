@@ -166,6 +166,7 @@ Core::Core( RenderController& renderController, PlatformAbstraction& platform,
   mShaderFactory = new ShaderFactory();
   mUpdateManager->SetShaderSaver( *mShaderFactory );
   mShaderFactory->LoadDefaultShaders();
+  mShaderFactory->WarmUpPrograms();
 
   GetImplementation(Dali::TypeRegistry::Get()).CallInitFunctions();
 }
@@ -248,6 +249,21 @@ void Core::SetDpi( unsigned int dpiHorizontal, unsigned int dpiVertical )
   mStage->SetDpi( Vector2( dpiHorizontal , dpiVertical) );
 }
 
+void Core::SetUpdateThreadCount( unsigned int threadCount )
+{
+  SetUpdateThreadCountMessage( *mUpdateManager, threadCount );
+}
+
+void Core::SetTextureMemoryBudget( std::size_t budget )
+{
+  SetTextureMemoryBudgetMessage( *mUpdateManager, budget );
+}
+
+void Core::SetTextureUploadBudget( std::size_t budget )
+{
+  SetTextureUploadBudgetMessage( *mUpdateManager, budget );
+}
+
 void Core::Update( float elapsedSeconds, unsigned int lastVSyncTimeMilliseconds, unsigned int nextVSyncTimeMilliseconds, Integration::UpdateStatus& status )
 {
   // set the time delta so adaptor can easily print FPS with a release build with 0 as
@@ -329,6 +345,9 @@ void Core::ProcessEvents()
 
   mNotificationManager->ProcessMessages();
 
+  // Write any shader binaries received from the render-thread
+  mShaderFactory->SaveArchive();
+
   // Avoid allocating MessageBuffers, triggering size-negotiation or sending any other spam whilst paused
   if( mIsActive )
   {
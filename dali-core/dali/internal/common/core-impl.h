@@ -119,6 +119,21 @@ public:
    */
   void SetDpi(unsigned int dpiHorizontal, unsigned int dpiVertical);
 
+  /**
+   * @copydoc Dali::Integration::Core::SetUpdateThreadCount(unsigned int)
+   */
+  void SetUpdateThreadCount( unsigned int threadCount );
+
+  /**
+   * @copydoc Dali::Integration::Core::SetTextureMemoryBudget(std::size_t)
+   */
+  void SetTextureMemoryBudget( std::size_t budget );
+
+  /**
+   * @copydoc Dali::Integration::Core::SetTextureUploadBudget(std::size_t)
+   */
+  void SetTextureUploadBudget( std::size_t budget );
+
   /**
    * @copydoc Dali::Integration::Core::SetMinimumFrameTimeInterval(unsigned int)
    */
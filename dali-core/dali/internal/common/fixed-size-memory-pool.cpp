@@ -20,6 +20,7 @@
 
 // INTERNAL HEADERS
 #include <dali/public-api/common/dali-common.h>
+#include <dali/devel-api/threading/mutex.h>
 
 namespace Dali
 {
@@ -80,7 +81,10 @@ struct FixedSizeMemoryPool::Impl
      mCurrentBlock( &mMemoryBlocks ),
      mCurrentBlockCapacity( initialCapacity ),
      mCurrentBlockSize( 0 ),
-     mDeletedObjects( NULL )
+     mDeletedObjects( NULL ),
+     mAllocationCount( 0 ),
+     mCapacity( initialCapacity ),
+     mMutex()
   {
     // We need enough room to store the deleted list in the data
     DALI_ASSERT_DEBUG( mFixedSize >= sizeof( void* ) );
@@ -114,6 +118,7 @@ struct FixedSizeMemoryPool::Impl
     }
 
     mCurrentBlockCapacity = size;
+    mCapacity += size;
 
     // Allocate
     Block* block = new Block( mCurrentBlockCapacity * mFixedSize );
@@ -133,6 +138,11 @@ struct FixedSizeMemoryPool::Impl
   SizeType mCurrentBlockSize;         ///< The number of allocations allocated to the current block
 
   void* mDeletedObjects;              ///< Pointer to the head of the list of deleted objects. The addresses are stored in the allocated memory blocks.
+
+  SizeType mAllocationCount;          ///< The number of allocations which have not been freed
+  SizeType mCapacity;                 ///< The total capacity of the allocated memory blocks
+
+  Mutex mMutex;                       ///< Used by the thread-safe methods
 };
 
 FixedSizeMemoryPool::FixedSizeMemoryPool( SizeType fixedSize, SizeType initialCapacity, SizeType maximumBlockCapacity )
@@ -147,6 +157,8 @@ FixedSizeMemoryPool::~FixedSizeMemoryPool()
 
 void* FixedSizeMemoryPool::Allocate()
 {
+  mImpl->mAllocationCount++;
+
   // First, recycle deleted objects
   if( mImpl->mDeletedObjects )
   {
@@ -174,6 +186,33 @@ void FixedSizeMemoryPool::Free( void* memory )
   // Add memory to head of deleted objects list. Store next address in the same memory space as the old object.
   *( reinterpret_cast< void** >( memory ) ) = mImpl->mDeletedObjects;
   mImpl->mDeletedObjects = memory;
+
+  mImpl->mAllocationCount--;
+}
+
+void* FixedSizeMemoryPool::AllocateThreadSafe()
+{
+  Mutex::ScopedLock lock( mImpl->mMutex );
+  return Allocate();
+}
+
+void FixedSizeMemoryPool::FreeThreadSafe( void* memory )
+{
+  Mutex::ScopedLock lock( mImpl->mMutex );
+  Free( memory );
+}
+
+FixedSizeMemoryPool::SizeType FixedSizeMemoryPool::GetAllocationCount() const
+{
+  // Locked as the counts are read while the thread-safe methods change them on another thread
+  Mutex::ScopedLock lock( mImpl->mMutex );
+  return mImpl->mAllocationCount;
+}
+
+FixedSizeMemoryPool::SizeType FixedSizeMemoryPool::GetCapacity() const
+{
+  Mutex::ScopedLock lock( mImpl->mMutex );
+  return mImpl->mCapacity;
 }
 
 } // namespace Internal
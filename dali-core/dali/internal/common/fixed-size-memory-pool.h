@@ -87,6 +87,36 @@ public:
    */
   void Free( void* memory );
 
+  /**
+   * @brief Thread-safe version of Allocate(), for pools which are used by more than one thread
+   *
+   * @return Return the newly allocated memory
+   */
+  void* AllocateThreadSafe();
+
+  /**
+   * @brief Thread-safe version of Free()
+   *
+   * @param memory The memory to be deleted. Must have been allocated by this memory pool
+   */
+  void FreeThreadSafe( void* memory );
+
+  /**
+   * @brief Retrieve the number of allocations which have not been freed.
+   * This is thread-safe, so it may be called while another thread allocates from the pool.
+   *
+   * @return The allocation count
+   */
+  SizeType GetAllocationCount() const;
+
+  /**
+   * @brief Retrieve the number of allocations which fit in the memory blocks allocated so far.
+   * This is thread-safe, like GetAllocationCount().
+   *
+   * @return The capacity of the memory pool
+   */
+  SizeType GetCapacity() const;
+
 private:
 
   // Undefined
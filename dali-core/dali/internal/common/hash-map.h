@@ -0,0 +1,181 @@
+#ifndef __DALI_INTERNAL_HASH_MAP_H__
+#define __DALI_INTERNAL_HASH_MAP_H__
+
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali/public-api/common/dali-vector.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+/**
+ * @brief An open-addressing hash table which maps hash values to values.
+ *
+ * The keys are expected to already be hash values (e.g. of shader sources), so they are only mixed
+ * before being used to select a slot. Lookups & insertions are O(1) on average.
+ * The value type must be copyable with memcpy, as it is stored in a Dali::Vector.
+ */
+template< typename T >
+class HashMap
+{
+public:
+
+  /**
+   * @brief Constructor
+   */
+  HashMap()
+  : mSlots(),
+    mCount( 0u )
+  {
+  }
+
+  /**
+   * @brief Find the value of a key.
+   * @param[in] key The key to look for.
+   * @param[out] value Set to the value of the key, if found.
+   * @return True if the key was found.
+   */
+  bool Find( size_t key, T& value ) const
+  {
+    if( mCount > 0u )
+    {
+      const size_t mask = mSlots.Count() - 1u;
+      for( size_t index = Mix( key ) & mask; mSlots[ index ].used; index = ( index + 1u ) & mask )
+      {
+        if( mSlots[ index ].key == key )
+        {
+          value = mSlots[ index ].value;
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
+  /**
+   * @brief Insert a key, or replace its value if it is already in the map.
+   * @param[in] key The key.
+   * @param[in] value The value of the key.
+   */
+  void Insert( size_t key, const T& value )
+  {
+    // Keep the load factor under one half so the probe sequences stay short
+    if( ( mCount + 1u ) * 2u > mSlots.Count() )
+    {
+      Rehash( mSlots.Count() > 0u ? mSlots.Count() * 2u : MINIMUM_CAPACITY );
+    }
+
+    const size_t mask = mSlots.Count() - 1u;
+    size_t index = Mix( key ) & mask;
+    for( ; mSlots[ index ].used; index = ( index + 1u ) & mask )
+    {
+      if( mSlots[ index ].key == key )
+      {
+        mSlots[ index ].value = value;
+        return;
+      }
+    }
+
+    mSlots[ index ].key = key;
+    mSlots[ index ].value = value;
+    mSlots[ index ].used = true;
+    ++mCount;
+  }
+
+  /**
+   * @brief Remove all the keys.
+   */
+  void Clear()
+  {
+    mSlots.Clear();
+    mCount = 0u;
+  }
+
+  /**
+   * @return The number of keys in the map.
+   */
+  size_t Count() const
+  {
+    return mCount;
+  }
+
+private:
+
+  struct Slot
+  {
+    size_t key;
+    T value;
+    bool used;
+  };
+
+  /**
+   * Spread the bits of the key, so that keys differing only in their high bits use different slots.
+   */
+  static size_t Mix( size_t key )
+  {
+    return key ^ ( key >> 16u ) ^ ( key >> 7u );
+  }
+
+  /**
+   * Reallocate the slots & insert the keys again.
+   * @param[in] capacity The new number of slots, a power of two.
+   */
+  void Rehash( size_t capacity )
+  {
+    Dali::Vector< Slot > slots;
+    slots.Swap( mSlots );
+
+    Slot empty;
+    empty.key = 0u;
+    empty.value = T();
+    empty.used = false;
+    mSlots.Resize( capacity, empty );
+    mCount = 0u;
+
+    for( typename Dali::Vector< Slot >::ConstIterator iter = slots.Begin(), endIter = slots.End(); iter != endIter; ++iter )
+    {
+      if( iter->used )
+      {
+        Insert( iter->key, iter->value );
+      }
+    }
+  }
+
+  // Undefined
+  HashMap( const HashMap& );
+
+  // Undefined
+  HashMap& operator=( const HashMap& rhs );
+
+private:
+
+  static const size_t MINIMUM_CAPACITY = 32u;
+
+  Dali::Vector< Slot > mSlots; ///< The slots; the count is zero or a power of two
+  size_t mCount;               ///< The number of used slots
+};
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // __DALI_INTERNAL_HASH_MAP_H__
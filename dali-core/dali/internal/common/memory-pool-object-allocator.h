@@ -91,6 +91,58 @@ public:
     mPool->Free( object );
   }
 
+  /**
+   * @brief Thread-safe version of AllocateRaw(), for pools which are used by more than one thread
+   *
+   * @return Return the allocated memory block
+   */
+  void* AllocateRawThreadSafe()
+  {
+    return mPool->AllocateThreadSafe();
+  }
+
+  /**
+   * @brief Thread-safe version of Free()
+   *
+   * @param object Pointer to the object to delete
+   */
+  void FreeThreadSafe( T* object )
+  {
+    object->~T();
+
+    mPool->FreeThreadSafe( object );
+  }
+
+  /**
+   * @brief Return a block of memory to the memory pool, after the object stored in it has been destroyed
+   *
+   * @param memory The memory block, which was returned by AllocateRawThreadSafe()
+   */
+  void FreeRawThreadSafe( void* memory )
+  {
+    mPool->FreeThreadSafe( memory );
+  }
+
+  /**
+   * @brief Retrieve the number of objects which have been allocated, and not freed
+   *
+   * @return The object count
+   */
+  unsigned int GetAllocationCount() const
+  {
+    return mPool->GetAllocationCount();
+  }
+
+  /**
+   * @brief Retrieve the number of objects which fit in the memory allocated by the pool so far
+   *
+   * @return The capacity of the pool
+   */
+  unsigned int GetCapacity() const
+  {
+    return mPool->GetCapacity();
+  }
+
   /**
    * @brief Reset the memory pool, unloading all block memory previously allocated
    */
@@ -101,6 +101,18 @@ unsigned int* MessageBuffer::ReserveMessageSlot( std::size_t size )
   return reinterpret_cast<unsigned int*>(slot);
 }
 
+std::size_t MessageBuffer::GetSlotOffset( const unsigned int* slot ) const
+{
+  return reinterpret_cast< const WordType* >( slot ) - mData;
+}
+
+unsigned int* MessageBuffer::GetSlot( std::size_t offset ) const
+{
+  DALI_ASSERT_DEBUG( offset < mSize );
+
+  return reinterpret_cast< unsigned int* >( mData + offset );
+}
+
 std::size_t MessageBuffer::GetCapacity() const
 {
   return mCapacity * WORD_SIZE;
@@ -55,6 +55,20 @@ public:
    */
   unsigned int* ReserveMessageSlot( std::size_t size );
 
+  /**
+   * Retrieve the offset of a reserved slot; unlike the slot address, this remains valid when the buffer grows.
+   * @param[in] slot A slot returned by ReserveMessageSlot(), since the last Reset().
+   * @return The offset of the slot.
+   */
+  std::size_t GetSlotOffset( const unsigned int* slot ) const;
+
+  /**
+   * Retrieve a reserved slot from its offset.
+   * @param[in] offset An offset returned by GetSlotOffset(), since the last Reset().
+   * @return A pointer to the address allocated for the message.
+   */
+  unsigned int* GetSlot( std::size_t offset ) const;
+
   /**
    * Query the capacity of the message buffer.
    * @return The capacity with respect to the size of type "char".
@@ -58,6 +58,16 @@ public:
    */
   virtual void Process( BufferIndex bufferIndex ) = 0;
 
+  /**
+   * Query whether the change made by the message is found by the damage tracking of the update-thread.
+   * Any other message causes the whole surface to be redrawn.
+   * @return True if the message only writes the properties of a property owner, which is then reset.
+   */
+  virtual bool IsDamageTracked() const
+  {
+    return false;
+  }
+
 private:
 };
 
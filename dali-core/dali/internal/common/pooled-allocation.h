@@ -0,0 +1,105 @@
+#ifndef __DALI_INTERNAL_POOLED_ALLOCATION_H__
+#define __DALI_INTERNAL_POOLED_ALLOCATION_H__
+
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <new>
+#include <cstddef>
+
+// INTERNAL INCLUDES
+#include <dali/internal/common/memory-pool-object-allocator.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+/**
+ * @brief Allocates the memory of objects of type T from a memory pool, rather than the heap.
+ *
+ * It implements the class-specific operator new and operator delete of scene-graph objects,
+ * which are created on the event-thread and destroyed on the update-thread, therefore the pool is thread-safe.
+ * A class derived from T, which does not have a pool of its own, is allocated from the heap.
+ */
+template< typename T >
+class PooledAllocation
+{
+public:
+
+  /**
+   * @brief Allocate the memory of an object.
+   *
+   * @param[in] size The size of the object, which is passed to operator new.
+   * @return The allocated memory.
+   */
+  static void* Allocate( std::size_t size )
+  {
+    if( size == sizeof( T ) )
+    {
+      return GetPool().AllocateRawThreadSafe();
+    }
+    return ::operator new( size );
+  }
+
+  /**
+   * @brief Free the memory of an object which has been destroyed.
+   *
+   * @param[in] memory The memory to free, which was returned by Allocate().
+   * @param[in] size The size of the destroyed object, which is passed to operator delete.
+   */
+  static void Free( void* memory, std::size_t size )
+  {
+    if( size == sizeof( T ) )
+    {
+      GetPool().FreeRawThreadSafe( memory );
+    }
+    else
+    {
+      ::operator delete( memory );
+    }
+  }
+
+  /**
+   * @brief Retrieve the memory pool e.g. to report its occupancy.
+   *
+   * @return The memory pool.
+   */
+  static const MemoryPoolObjectAllocator< T >& GetMemoryPool()
+  {
+    return GetPool();
+  }
+
+private:
+
+  /**
+   * @return The memory pool, which is created by the first allocation.
+   */
+  static MemoryPoolObjectAllocator< T >& GetPool()
+  {
+    static MemoryPoolObjectAllocator< T > pool;
+    return pool;
+  }
+};
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif /* __DALI_INTERNAL_POOLED_ALLOCATION_H__ */
@@ -49,6 +49,7 @@ public:
    */
   ShaderData(const std::string& vertexSource, const std::string& fragmentSource)
   : mShaderHash( -1 ),
+    mDriverIdentity( 0 ),
     mVertexShader(vertexSource),
     mFragmentShader(fragmentSource)
   { }
@@ -85,6 +86,24 @@ public: // API
     return mShaderHash;
   }
 
+  /**
+   * Set the identity of the GL driver which created the compiled binary
+   * @param [in] driverIdentity  hash identifying the driver
+   */
+  void SetDriverIdentity( size_t driverIdentity )
+  {
+    mDriverIdentity = driverIdentity;
+  }
+
+  /**
+   * Get the identity of the GL driver which created the compiled binary
+   * @return hash identifying the driver, or zero if not known
+   */
+  size_t GetDriverIdentity() const
+  {
+    return mDriverIdentity;
+  }
+
   /**
    * @return the vertex shader
    */
@@ -155,6 +174,7 @@ private: // Not implemented
 private: // Data
 
   size_t                      mShaderHash;     ///< hash key created with vertex and fragment shader code
+  size_t                      mDriverIdentity; ///< hash identifying the driver which created the binary
   std::string                 mVertexShader;   ///< source code for vertex program
   std::string                 mFragmentShader; ///< source code for fragment program
   Dali::Vector<unsigned char> mBuffer;         ///< buffer containing compiled binary bytecode
@@ -122,6 +122,8 @@ Layer::Layer( Actor::DerivedType type )
   mBehavior(Dali::Layer::LAYER_2D),
   mIsClipping(false),
   mDepthTestDisabled(false),
+  mBatchingEnabled(false),
+  mRenderCacheEnabled(false),
   mTouchConsumed(false),
   mHoverConsumed(false)
 {
@@ -278,6 +280,38 @@ bool Layer::IsDepthTestDisabled() const
   return mDepthTestDisabled || (mBehavior == Dali::Layer::LAYER_2D);
 }
 
+void Layer::SetBatchingEnabled( bool enable )
+{
+  if( enable != mBatchingEnabled )
+  {
+    mBatchingEnabled = enable;
+
+    // layerNode is being used in a separate thread; queue a message to set the value
+    SetBatchingEnabledMessage( GetEventThreadServices(), GetSceneLayerOnStage(), mBatchingEnabled );
+  }
+}
+
+bool Layer::IsBatchingEnabled() const
+{
+  return mBatchingEnabled;
+}
+
+void Layer::SetRenderCacheEnabled( bool enable )
+{
+  if( enable != mRenderCacheEnabled )
+  {
+    mRenderCacheEnabled = enable;
+
+    // layerNode is being used in a separate thread; queue a message to set the value
+    SetRenderCacheEnabledMessage( GetEventThreadServices(), GetSceneLayerOnStage(), mRenderCacheEnabled );
+  }
+}
+
+bool Layer::IsRenderCacheEnabled() const
+{
+  return mRenderCacheEnabled;
+}
+
 void Layer::SetSortFunction(Dali::Layer::SortFunctionType function)
 {
   if( function != mSortFunction )
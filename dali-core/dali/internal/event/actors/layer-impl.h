@@ -174,6 +174,26 @@ public:
    */
   bool IsDepthTestDisabled() const;
 
+  /**
+   * @copydoc Dali::Layer::SetBatchingEnabled()
+   */
+  void SetBatchingEnabled( bool enable );
+
+  /**
+   * @copydoc Dali::Layer::IsBatchingEnabled()
+   */
+  bool IsBatchingEnabled() const;
+
+  /**
+   * @copydoc Dali::Layer::SetRenderCacheEnabled()
+   */
+  void SetRenderCacheEnabled( bool enable );
+
+  /**
+   * @copydoc Dali::Layer::IsRenderCacheEnabled()
+   */
+  bool IsRenderCacheEnabled() const;
+
   /**
    * @copydoc Dali::Layer::SetSortFunction()
    */
@@ -305,6 +325,8 @@ private:
 
   bool mIsClipping:1;                           ///< True when clipping is enabled
   bool mDepthTestDisabled:1;                    ///< Whether depth test is disabled.
+  bool mBatchingEnabled:1;                      ///< Whether the draw calls are batched.
+  bool mRenderCacheEnabled:1;                   ///< Whether the layer is drawn through a texture.
   bool mTouchConsumed:1;                        ///< Whether we should consume touch (including gesture).
   bool mHoverConsumed:1;                        ///< Whether we should consume hover.
 
@@ -46,7 +46,8 @@ ConstraintBase::ConstraintBase( Object& object, Property::Index targetPropertyIn
   mRemoveAction( Dali::Constraint::DEFAULT_REMOVE_ACTION ),
   mTag( 0 ),
   mApplied( false ),
-  mSourceDestroyed( false )
+  mSourceDestroyed( false ),
+  mThreadSafe( false )
 {
   ObserveObject( object );
 }
@@ -146,6 +147,16 @@ ConstraintBase::RemoveAction ConstraintBase::GetRemoveAction() const
   return mRemoveAction;
 }
 
+void ConstraintBase::SetThreadSafe( bool threadSafe )
+{
+  mThreadSafe = threadSafe;
+}
+
+bool ConstraintBase::IsThreadSafe() const
+{
+  return mThreadSafe;
+}
+
 void ConstraintBase::SetTag(const unsigned int tag)
 {
   mTag = tag;
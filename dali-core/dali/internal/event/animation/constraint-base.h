@@ -124,6 +124,16 @@ public:
    */
   RemoveAction GetRemoveAction() const;
 
+  /**
+   * @copydoc Dali::Constraint::SetThreadSafe()
+   */
+  void SetThreadSafe( bool threadSafe );
+
+  /**
+   * @copydoc Dali::Constraint::IsThreadSafe()
+   */
+  bool IsThreadSafe() const;
+
   /**
    * @copydoc Dali::Constraint::SetTag()
    */
@@ -209,6 +219,7 @@ protected:
   unsigned int mTag;
   bool mApplied:1; ///< Whether the constraint has been applied
   bool mSourceDestroyed:1; ///< Is set to true if any of our input source objects are destroyed
+  bool mThreadSafe:1; ///< Whether the constraint function may be called on a worker thread
 };
 
 } // namespace Internal
@@ -100,6 +100,7 @@ public:
                                             funcPtr );
 
     clone->SetRemoveAction(mRemoveAction);
+    clone->SetThreadSafe( mThreadSafe );
     clone->SetTag( mTag );
 
     return clone;
@@ -175,6 +176,7 @@ private:
                                                                                      func );
       DALI_ASSERT_DEBUG( NULL != sceneGraphConstraint );
       sceneGraphConstraint->SetRemoveAction( mRemoveAction );
+      sceneGraphConstraint->SetThreadSafe( mThreadSafe );
 
       // object is being used in a separate thread; queue a message to apply the constraint
       ApplyConstraintMessage( GetEventThreadServices(), *targetObject, *sceneGraphConstraint );
@@ -319,6 +321,7 @@ public:
                                      funcPtr );
 
     clone->SetRemoveAction(mRemoveAction);
+    clone->SetThreadSafe( mThreadSafe );
     clone->SetTag( mTag );
 
     return clone;
@@ -470,6 +473,7 @@ private:
 
       DALI_ASSERT_DEBUG( NULL != sceneGraphConstraint );
       sceneGraphConstraint->SetRemoveAction( mRemoveAction );
+      sceneGraphConstraint->SetThreadSafe( mThreadSafe );
 
         // object is being used in a separate thread; queue a message to apply the constraint
       ApplyConstraintMessage( GetEventThreadServices(), *targetObject, *sceneGraphConstraint );
@@ -83,6 +83,23 @@ public:
    */
   virtual unsigned int* ReserveMessageSlot( std::size_t size, bool updateScene = true ) = 0;
 
+  /**
+   * Reserve space for a message which replaces any earlier message for the same property, queued since the last flush.
+   * The earlier message is destroyed and its slot is returned, when it has the same size and was not invalidated;
+   * only messages which overwrite the whole property value should be coalesced.
+   * @post Calling this method may invalidate any previously returned slots.
+   * @param[in] size The message size with respect to the size of type "char".
+   * @param[in] property The property changed by the message.
+   * @return A pointer to the first char allocated for the message.
+   */
+  virtual unsigned int* ReserveCoalescedMessageSlot( std::size_t size, const void* property ) = 0;
+
+  /**
+   * Prevent an earlier message for a property from being replaced; called when another kind of message changes the property.
+   * @param[in] property The property.
+   */
+  virtual void InvalidateCoalescedMessage( const void* property ) = 0;
+
   /**
    * @return the current event-buffer index.
    */
@@ -960,6 +960,9 @@ Property::Value Object::GetPropertyValue( const PropertyMetadata* entry ) const
 
 void Object::SetSceneGraphProperty( Property::Index index, const PropertyMetadata& entry, const Property::Value& value )
 {
+  // The scene object is informed, so that the property is reset in the following frames
+  const SceneGraph::PropertyOwner* sceneObject = GetPropertyOwner();
+
   switch ( entry.GetType() )
   {
     case Property::BOOLEAN:
@@ -968,7 +971,7 @@ void Object::SetSceneGraphProperty( Property::Index index, const PropertyMetadat
       DALI_ASSERT_DEBUG( NULL != property );
 
       // property is being used in a separate thread; queue a message to set the property
-      BakeMessage<bool>( GetEventThreadServices(), *property, value.Get<bool>() );
+      SceneGraph::AnimatablePropertyMessage<bool>::Send( GetEventThreadServices(), sceneObject, property, &AnimatableProperty<bool>::Bake, value.Get<bool>() );
       break;
     }
 
@@ -978,7 +981,7 @@ void Object::SetSceneGraphProperty( Property::Index index, const PropertyMetadat
       DALI_ASSERT_DEBUG( NULL != property );
 
       // property is being used in a separate thread; queue a message to set the property
-      BakeMessage<int>( GetEventThreadServices(), *property, value.Get<int>() );
+      SceneGraph::AnimatablePropertyMessage<int>::Send( GetEventThreadServices(), sceneObject, property, &AnimatableProperty<int>::Bake, value.Get<int>() );
       break;
     }
 
@@ -988,7 +991,7 @@ void Object::SetSceneGraphProperty( Property::Index index, const PropertyMetadat
       DALI_ASSERT_DEBUG( NULL != property );
 
       // property is being used in a separate thread; queue a message to set the property
-      BakeMessage<float>( GetEventThreadServices(), *property, value.Get<float>() );
+      SceneGraph::AnimatablePropertyMessage<float>::Send( GetEventThreadServices(), sceneObject, property, &AnimatableProperty<float>::Bake, value.Get<float>() );
       break;
     }
 
@@ -1000,15 +1003,15 @@ void Object::SetSceneGraphProperty( Property::Index index, const PropertyMetadat
       // property is being used in a separate thread; queue a message to set the property
       if(entry.componentIndex == 0)
       {
-        SetXComponentMessage<Vector2>( GetEventThreadServices(), *property, value.Get<float>() );
+        SceneGraph::AnimatablePropertyComponentMessage<Vector2>::Send( GetEventThreadServices(), sceneObject, property, &AnimatableProperty<Vector2>::BakeX, value.Get<float>() );
       }
       else if(entry.componentIndex == 1)
       {
-        SetYComponentMessage<Vector2>( GetEventThreadServices(), *property, value.Get<float>() );
+        SceneGraph::AnimatablePropertyComponentMessage<Vector2>::Send( GetEventThreadServices(), sceneObject, property, &AnimatableProperty<Vector2>::BakeY, value.Get<float>() );
       }
       else
       {
-        BakeMessage<Vector2>( GetEventThreadServices(), *property, value.Get<Vector2>() );
+        SceneGraph::AnimatablePropertyMessage<Vector2>::Send( GetEventThreadServices(), sceneObject, property, &AnimatableProperty<Vector2>::Bake, value.Get<Vector2>() );
       }
       break;
     }
@@ -1021,19 +1024,19 @@ void Object::SetSceneGraphProperty( Property::Index index, const PropertyMetadat
       // property is being used in a separate thread; queue a message to set the property
       if(entry.componentIndex == 0)
       {
-        SetXComponentMessage<Vector3>( GetEventThreadServices(), *property, value.Get<float>() );
+        SceneGraph::AnimatablePropertyComponentMessage<Vector3>::Send( GetEventThreadServices(), sceneObject, property, &AnimatableProperty<Vector3>::BakeX, value.Get<float>() );
       }
       else if(entry.componentIndex == 1)
       {
-        SetYComponentMessage<Vector3>( GetEventThreadServices(), *property, value.Get<float>() );
+        SceneGraph::AnimatablePropertyComponentMessage<Vector3>::Send( GetEventThreadServices(), sceneObject, property, &AnimatableProperty<Vector3>::BakeY, value.Get<float>() );
       }
       else if(entry.componentIndex == 2)
       {
-        SetZComponentMessage<Vector3>( GetEventThreadServices(), *property, value.Get<float>() );
+        SceneGraph::AnimatablePropertyComponentMessage<Vector3>::Send( GetEventThreadServices(), sceneObject, property, &AnimatableProperty<Vector3>::BakeZ, value.Get<float>() );
       }
       else
       {
-        BakeMessage<Vector3>( GetEventThreadServices(), *property, value.Get<Vector3>() );
+        SceneGraph::AnimatablePropertyMessage<Vector3>::Send( GetEventThreadServices(), sceneObject, property, &AnimatableProperty<Vector3>::Bake, value.Get<Vector3>() );
       }
 
       break;
@@ -1047,23 +1050,23 @@ void Object::SetSceneGraphProperty( Property::Index index, const PropertyMetadat
       // property is being used in a separate thread; queue a message to set the property
       if(entry.componentIndex == 0)
       {
-        SetXComponentMessage<Vector4>( GetEventThreadServices(), *property, value.Get<float>() );
+        SceneGraph::AnimatablePropertyComponentMessage<Vector4>::Send( GetEventThreadServices(), sceneObject, property, &AnimatableProperty<Vector4>::BakeX, value.Get<float>() );
       }
       else if(entry.componentIndex == 1)
       {
-        SetYComponentMessage<Vector4>( GetEventThreadServices(), *property, value.Get<float>() );
+        SceneGraph::AnimatablePropertyComponentMessage<Vector4>::Send( GetEventThreadServices(), sceneObject, property, &AnimatableProperty<Vector4>::BakeY, value.Get<float>() );
       }
       else if(entry.componentIndex == 2)
       {
-        SetZComponentMessage<Vector4>( GetEventThreadServices(), *property, value.Get<float>() );
+        SceneGraph::AnimatablePropertyComponentMessage<Vector4>::Send( GetEventThreadServices(), sceneObject, property, &AnimatableProperty<Vector4>::BakeZ, value.Get<float>() );
       }
       else if(entry.componentIndex == 3)
       {
-        SetWComponentMessage<Vector4>( GetEventThreadServices(), *property, value.Get<float>() );
+        SceneGraph::AnimatablePropertyComponentMessage<Vector4>::Send( GetEventThreadServices(), sceneObject, property, &AnimatableProperty<Vector4>::BakeW, value.Get<float>() );
       }
       else
       {
-        BakeMessage<Vector4>( GetEventThreadServices(), *property, value.Get<Vector4>() );
+        SceneGraph::AnimatablePropertyMessage<Vector4>::Send( GetEventThreadServices(), sceneObject, property, &AnimatableProperty<Vector4>::Bake, value.Get<Vector4>() );
       }
       break;
     }
@@ -1074,7 +1077,7 @@ void Object::SetSceneGraphProperty( Property::Index index, const PropertyMetadat
       DALI_ASSERT_DEBUG( NULL != property );
 
       // property is being used in a separate thread; queue a message to set the property
-      BakeMessage<Quaternion>( GetEventThreadServices(), *property, value.Get<Quaternion>() );
+      SceneGraph::AnimatablePropertyMessage<Quaternion>::Send( GetEventThreadServices(), sceneObject, property, &AnimatableProperty<Quaternion>::Bake, value.Get<Quaternion>() );
       break;
     }
 
@@ -1084,7 +1087,7 @@ void Object::SetSceneGraphProperty( Property::Index index, const PropertyMetadat
       DALI_ASSERT_DEBUG( NULL != property );
 
       // property is being used in a separate thread; queue a message to set the property
-      BakeMessage<Matrix>( GetEventThreadServices(), *property, value.Get<Matrix>() );
+      SceneGraph::AnimatablePropertyMessage<Matrix>::Send( GetEventThreadServices(), sceneObject, property, &AnimatableProperty<Matrix>::Bake, value.Get<Matrix>() );
       break;
     }
 
@@ -1094,7 +1097,7 @@ void Object::SetSceneGraphProperty( Property::Index index, const PropertyMetadat
       DALI_ASSERT_DEBUG( NULL != property );
 
       // property is being used in a separate thread; queue a message to set the property
-      BakeMessage<Matrix3>( GetEventThreadServices(), *property, value.Get<Matrix3>() );
+      SceneGraph::AnimatablePropertyMessage<Matrix3>::Send( GetEventThreadServices(), sceneObject, property, &AnimatableProperty<Matrix3>::Bake, value.Get<Matrix3>() );
       break;
     }
 
@@ -618,6 +618,16 @@ unsigned int* Stage::ReserveMessageSlot( std::size_t size, bool updateScene )
   return mUpdateManager.ReserveMessageSlot( size, updateScene );
 }
 
+unsigned int* Stage::ReserveCoalescedMessageSlot( std::size_t size, const void* property )
+{
+  return mUpdateManager.ReserveCoalescedMessageSlot( size, property );
+}
+
+void Stage::InvalidateCoalescedMessage( const void* property )
+{
+  mUpdateManager.InvalidateCoalescedMessage( property );
+}
+
 BufferIndex Stage::GetEventBufferIndex() const
 {
   return mUpdateManager.GetEventBufferIndex();
@@ -396,6 +396,16 @@ public: // Implementation of EventThreadServices
    */
   virtual unsigned int* ReserveMessageSlot( std::size_t size, bool updateScene );
 
+  /**
+   * @copydoc EventThreadServices::ReserveCoalescedMessageSlot
+   */
+  virtual unsigned int* ReserveCoalescedMessageSlot( std::size_t size, const void* property );
+
+  /**
+   * @copydoc EventThreadServices::InvalidateCoalescedMessage
+   */
+  virtual void InvalidateCoalescedMessage( const void* property );
+
   /**
    * @copydoc EventThreadServices::GetEventBufferIndex
    */
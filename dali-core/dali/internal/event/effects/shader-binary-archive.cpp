@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/event/effects/shader-binary-archive.h>
+
+// EXTERNAL INCLUDES
+#include <cstring>
+
+// INTERNAL INCLUDES
+#include <dali/public-api/dali-core-version.h>
+#include <dali/integration-api/debug.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace
+{
+
+const uint32_t ARCHIVE_MAGIC = 0x42534C44;  ///< "DLSB" when read as little-endian bytes
+const uint32_t ARCHIVE_FORMAT_VERSION = 1u; ///< Increment when the layout of the archive changes
+
+/**
+ * The header at the start of the archive; followed by the entries, then their data.
+ */
+struct Header
+{
+  uint32_t magic;
+  uint32_t formatVersion;
+  uint32_t coreMajorVersion;
+  uint32_t coreMinorVersion;
+  uint32_t coreMicroVersion;
+  uint32_t entryCount;
+};
+
+/**
+ * Check that a range of bytes lies within the archive
+ */
+inline bool InRange( uint32_t offset, uint32_t size, size_t archiveSize )
+{
+  return ( offset <= archiveSize ) && ( size <= archiveSize - offset );
+}
+
+} // unnamed namespace
+
+ShaderBinaryArchive::ShaderBinaryArchive()
+: mEntries(),
+  mData(),
+  mEntryIndices()
+{
+}
+
+ShaderBinaryArchive::~ShaderBinaryArchive()
+{
+}
+
+bool ShaderBinaryArchive::Read( Dali::Vector< unsigned char >& buffer )
+{
+  Clear();
+  mData.Swap( buffer );
+
+  const size_t archiveSize = mData.Count();
+  if( archiveSize < sizeof( Header ) )
+  {
+    Clear();
+    return false;
+  }
+
+  Header header;
+  memcpy( &header, mData.Begin(), sizeof( Header ) );
+
+  if( header.magic != ARCHIVE_MAGIC ||
+      header.formatVersion != ARCHIVE_FORMAT_VERSION ||
+      header.coreMajorVersion != CORE_MAJOR_VERSION ||
+      header.coreMinorVersion != CORE_MINOR_VERSION ||
+      header.coreMicroVersion != CORE_MICRO_VERSION )
+  {
+    DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, "Shader binary archive is of a different version, ignoring it\n" );
+    Clear();
+    return false;
+  }
+
+  if( header.entryCount > ( archiveSize - sizeof( Header ) ) / sizeof( Entry ) )
+  {
+    DALI_LOG_ERROR( "Shader binary archive is truncated\n" );
+    Clear();
+    return false;
+  }
+
+  mEntries.Resize( header.entryCount );
+  if( header.entryCount > 0u )
+  {
+    memcpy( mEntries.Begin(), mData.Begin() + sizeof( Header ), header.entryCount * sizeof( Entry ) );
+  }
+
+  for( unsigned int index = 0u; index < header.entryCount; ++index )
+  {
+    const Entry& entry = mEntries[ index ];
+    if( !InRange( entry.vertexOffset, entry.vertexSize, archiveSize ) ||
+        !InRange( entry.fragmentOffset, entry.fragmentSize, archiveSize ) ||
+        !InRange( entry.binaryOffset, entry.binarySize, archiveSize ) )
+    {
+      DALI_LOG_ERROR( "Shader binary archive is corrupt\n" );
+      Clear();
+      return false;
+    }
+
+    mEntryIndices.Insert( static_cast< size_t >( entry.shaderHash ), index );
+  }
+
+  return true;
+}
+
+void ShaderBinaryArchive::Write( Dali::Vector< unsigned char >& buffer ) const
+{
+  const size_t entryCount = mEntries.Count();
+
+  // Work out the size, so the buffer is allocated once
+  size_t archiveSize = sizeof( Header ) + entryCount * sizeof( Entry );
+  for( Dali::Vector< Entry >::ConstIterator iter = mEntries.Begin(), endIter = mEntries.End(); iter != endIter; ++iter )
+  {
+    archiveSize += iter->vertexSize + iter->fragmentSize + iter->binarySize;
+  }
+  buffer.Resize( archiveSize );
+
+  Header header;
+  header.magic = ARCHIVE_MAGIC;
+  header.formatVersion = ARCHIVE_FORMAT_VERSION;
+  header.coreMajorVersion = CORE_MAJOR_VERSION;
+  header.coreMinorVersion = CORE_MINOR_VERSION;
+  header.coreMicroVersion = CORE_MICRO_VERSION;
+  header.entryCount = entryCount;
+  memcpy( buffer.Begin(), &header, sizeof( Header ) );
+
+  // Copy the data of each entry after the entries, dropping any superseded data
+  unsigned char* entryPointer = buffer.Begin() + sizeof( Header );
+  uint32_t offset = sizeof( Header ) + entryCount * sizeof( Entry );
+  for( Dali::Vector< Entry >::ConstIterator iter = mEntries.Begin(), endIter = mEntries.End(); iter != endIter; ++iter, entryPointer += sizeof( Entry ) )
+  {
+    Entry entry = *iter;
+
+    memcpy( buffer.Begin() + offset, mData.Begin() + iter->vertexOffset, iter->vertexSize );
+    entry.vertexOffset = offset;
+    offset += iter->vertexSize;
+
+    memcpy( buffer.Begin() + offset, mData.Begin() + iter->fragmentOffset, iter->fragmentSize );
+    entry.fragmentOffset = offset;
+    offset += iter->fragmentSize;
+
+    memcpy( buffer.Begin() + offset, mData.Begin() + iter->binaryOffset, iter->binarySize );
+    entry.binaryOffset = offset;
+    offset += iter->binarySize;
+
+    memcpy( entryPointer, &entry, sizeof( Entry ) );
+  }
+}
+
+ShaderDataPtr ShaderBinaryArchive::Find( size_t shaderHash ) const
+{
+  ShaderDataPtr shaderData;
+
+  unsigned int index = 0u;
+  if( mEntryIndices.Find( shaderHash, index ) )
+  {
+    const Entry& entry = mEntries[ index ];
+    const char* data = reinterpret_cast< const char* >( mData.Begin() );
+
+    shaderData = new ShaderData( std::string( data + entry.vertexOffset, entry.vertexSize ),
+                                 std::string( data + entry.fragmentOffset, entry.fragmentSize ) );
+    shaderData->SetHashValue( shaderHash );
+    shaderData->SetDriverIdentity( static_cast< size_t >( entry.driverIdentity ) );
+    shaderData->AllocateBuffer( entry.binarySize );
+    if( entry.binarySize > 0u )
+    {
+      memcpy( shaderData->GetBufferData(), mData.Begin() + entry.binaryOffset, entry.binarySize );
+    }
+  }
+
+  return shaderData;
+}
+
+void ShaderBinaryArchive::Insert( ShaderData& shaderData )
+{
+  DALI_ASSERT_DEBUG( shaderData.GetBufferSize() > 0 );
+
+  const char* vertexShader = shaderData.GetVertexShader();
+  const char* fragmentShader = shaderData.GetFragmentShader();
+
+  Entry entry;
+  entry.shaderHash = shaderData.GetHashValue();
+  entry.driverIdentity = shaderData.GetDriverIdentity();
+  entry.vertexSize = strlen( vertexShader );
+  entry.vertexOffset = Append( vertexShader, entry.vertexSize );
+  entry.fragmentSize = strlen( fragmentShader );
+  entry.fragmentOffset = Append( fragmentShader, entry.fragmentSize );
+  entry.binarySize = shaderData.GetBufferSize();
+  entry.binaryOffset = Append( shaderData.GetBufferData(), entry.binarySize );
+
+  unsigned int index = 0u;
+  if( mEntryIndices.Find( shaderData.GetHashValue(), index ) )
+  {
+    mEntries[ index ] = entry;
+  }
+  else
+  {
+    mEntryIndices.Insert( shaderData.GetHashValue(), mEntries.Count() );
+    mEntries.PushBack( entry );
+  }
+}
+
+uint32_t ShaderBinaryArchive::Append( const void* data, size_t size )
+{
+  const uint32_t offset = mData.Count();
+  mData.Resize( offset + size );
+  if( size > 0u )
+  {
+    memcpy( mData.Begin() + offset, data, size );
+  }
+  return offset;
+}
+
+void ShaderBinaryArchive::Clear()
+{
+  mEntries.Clear();
+  mData.Clear();
+  mEntryIndices.Clear();
+}
+
+} // namespace Internal
+
+} // namespace Dali
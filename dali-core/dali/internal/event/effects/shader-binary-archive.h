@@ -0,0 +1,138 @@
+#ifndef __DALI_INTERNAL_SHADER_BINARY_ARCHIVE_H__
+#define __DALI_INTERNAL_SHADER_BINARY_ARCHIVE_H__
+
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <stdint.h>
+
+// INTERNAL INCLUDES
+#include <dali/public-api/common/dali-vector.h>
+#include <dali/internal/common/hash-map.h>
+#include <dali/internal/common/shader-data.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+/**
+ * ShaderBinaryArchive holds the compiled binaries of many shader programs, so that they can be
+ * read & written as a single file instead of a file per program.
+ *
+ * Each entry is keyed by the hash over the shader sources, and records the identity of the GL driver
+ * which created the binary. The sources are stored as well, so that a program can be created from an
+ * entry alone and recompiled if the binary is rejected.
+ * The archive is versioned with its format and the DALi Core version; other archives are not read.
+ */
+class ShaderBinaryArchive
+{
+public:
+
+  /**
+   * Constructor; the archive is empty.
+   */
+  ShaderBinaryArchive();
+
+  /**
+   * Destructor, non-virtual as not a base class
+   */
+  ~ShaderBinaryArchive();
+
+  /**
+   * Read an archive, replacing the current entries.
+   * The entries refer to the data of the buffer, so it is taken rather than copied.
+   * @param[in,out] buffer The archive file contents; left empty.
+   * @return true if the buffer was a valid archive of this version; otherwise the archive is left empty.
+   */
+  bool Read( Dali::Vector< unsigned char >& buffer );
+
+  /**
+   * Write the entries as an archive file.
+   * @param[out] buffer Set to the archive file contents.
+   */
+  void Write( Dali::Vector< unsigned char >& buffer ) const;
+
+  /**
+   * Create the shader data of an entry.
+   * @param[in] shaderHash The hash over the shader sources.
+   * @return The shader data, with a copy of the binary, or NULL if there is no entry for the hash.
+   */
+  ShaderDataPtr Find( size_t shaderHash ) const;
+
+  /**
+   * Add the binary of a program, replacing any entry with the same hash.
+   * @param[in] shaderData The shader data, which must contain a binary.
+   */
+  void Insert( ShaderData& shaderData );
+
+  /**
+   * @return The number of entries
+   */
+  size_t Count() const
+  {
+    return mEntries.Count();
+  }
+
+private:
+
+  /**
+   * An entry, as stored in the file; the offsets are from the start of mData.
+   */
+  struct Entry
+  {
+    uint64_t shaderHash;
+    uint64_t driverIdentity;
+    uint32_t vertexOffset;
+    uint32_t vertexSize;
+    uint32_t fragmentOffset;
+    uint32_t fragmentSize;
+    uint32_t binaryOffset;
+    uint32_t binarySize;
+  };
+
+  /**
+   * Append bytes to mData.
+   * @return The offset of the bytes in mData.
+   */
+  uint32_t Append( const void* data, size_t size );
+
+  /**
+   * Remove all the entries.
+   */
+  void Clear();
+
+  // Undefined
+  ShaderBinaryArchive( const ShaderBinaryArchive& );
+
+  // Undefined
+  ShaderBinaryArchive& operator=( const ShaderBinaryArchive& rhs );
+
+private:
+
+  Dali::Vector< Entry > mEntries;         ///< The entries
+  Dali::Vector< unsigned char > mData;    ///< The sources & binaries of the entries; superseded data is dropped on Write()
+  HashMap< unsigned int > mEntryIndices;  ///< Finds the index of an entry by its shader hash
+};
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // __DALI_INTERNAL_SHADER_BINARY_ARCHIVE_H__
@@ -20,6 +20,7 @@
 
 // EXTERNAL INCLUDES
 #include <sstream>
+#include <cstdlib>
 
 // INTERNAL INCLUDES
 #include <dali/public-api/dali-core-version.h>
@@ -30,6 +31,7 @@
 #include <dali/internal/event/common/thread-local-storage.h>
 #include <dali/internal/event/effects/shader-effect-impl.h>
 #include <dali/internal/event/effects/shader-declarations.h>
+#include <dali/internal/update/manager/update-manager.h>
 
 // compile time generated shader strings
 #include "dali-shaders.h"
@@ -38,6 +40,8 @@ namespace
 {
 const char* VERSION_SEPARATOR = "-";
 const char* SHADER_SUFFIX = ".dali-bin";
+const char* SHADER_ARCHIVE_FILENAME = "dali-shaders.dali-bin";  ///< Versioned by its header, so an archive of an older DALi is overwritten
+const char* SHADER_MANIFEST_FILENAME = "dali-shader-manifest.txt";
 }
 
 namespace Dali
@@ -63,9 +67,22 @@ void shaderBinaryFilename( size_t shaderHash, std::string& filename )
   filename = binaryShaderFilenameBuilder.str();
 }
 
+/**
+ * @brief Get the current time in microseconds from the platform abstraction.
+ */
+unsigned int GetTimeMicroseconds( Integration::PlatformAbstraction& platformAbstraction )
+{
+  unsigned int seconds( 0u );
+  unsigned int microSeconds( 0u );
+  platformAbstraction.GetTimeMicroseconds( seconds, microSeconds );
+  return seconds * 1000000u + microSeconds;
+}
+
 }
 
 ShaderFactory::ShaderFactory()
+: mArchiveLoaded( false ),
+  mArchiveModified( false )
 {
 }
 
@@ -85,26 +102,38 @@ ShaderDataPtr ShaderFactory::Load( const std::string& vertexSource, const std::s
 {
   // Work out the filename for the binary that the glsl source will be compiled and linked to:
   shaderHash = CalculateHash( vertexSource.c_str(), fragmentSource.c_str() );
-  std::string binaryShaderFilename;
-  shaderBinaryFilename( shaderHash, binaryShaderFilename );
 
   ShaderDataPtr shaderData;
 
   /// Check a cache of previously loaded shaders:
-  for( int i = 0, cacheSize = mShaderBinaryCache.Size(); i < cacheSize; ++i )
+  Internal::ShaderData* cachedShaderData = NULL;
+  if( mShaderBinaryTable.Find( shaderHash, cachedShaderData ) )
+  {
+    shaderData = cachedShaderData;
+
+    DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, "Mem cache hit for hash: %u\n", shaderHash );
+  }
+
+  // Then check the archive of the binaries compiled in previous runs:
+  if( shaderData.Get() == NULL )
   {
-    if( mShaderBinaryCache[i]->GetHashValue() == shaderHash )
+    LoadArchive();
+
+    shaderData = mArchive.Find( shaderHash );
+    if( shaderData )
     {
-      shaderData = mShaderBinaryCache[i];
+      MemoryCacheInsert( *shaderData );
 
-      DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, "Mem cache hit on path: \"%s\"\n", binaryShaderFilename.c_str() );
-      break;
+      DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, "Archive hit for hash: %u\n", shaderHash );
     }
   }
 
-  // If memory cache failed check the file system for a binary or return a source-only ShaderData:
+  // If the archive failed check the file system for a binary installed on its own or return a source-only ShaderData:
   if( shaderData.Get() == NULL )
   {
+    std::string binaryShaderFilename;
+    shaderBinaryFilename( shaderHash, binaryShaderFilename );
+
     // Allocate the structure that returns the loaded shader:
     shaderData = new ShaderData( vertexSource, fragmentSource );
     shaderData->SetHashValue( shaderHash );
@@ -131,19 +160,33 @@ ShaderDataPtr ShaderFactory::Load( const std::string& vertexSource, const std::s
 
 void ShaderFactory::SaveBinary( Internal::ShaderDataPtr shaderData )
 {
-  // Save the binary to the file system:
-  std::string binaryShaderFilename;
-  shaderBinaryFilename( shaderData->GetHashValue(), binaryShaderFilename );
-
-  ThreadLocalStorage& tls = ThreadLocalStorage::Get();
-  Integration::PlatformAbstraction& platformAbstraction = tls.GetPlatformAbstraction();
-  const bool saved = platformAbstraction.SaveShaderBinaryFile( binaryShaderFilename, &shaderData->GetBuffer()[0], shaderData->GetBufferSize() );
-
   // Save the binary into to memory cache:
   MemoryCacheInsert( *shaderData );
 
-  DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, saved ? "Saved to file: %s\n" : "Save to file failed: %s\n", binaryShaderFilename.c_str() );
-  if( saved ) {} // Avoid unused variable warning in release builds
+  // Add the binary to the archive; it is written to the file system by SaveArchive()
+  LoadArchive();
+  mArchive.Insert( *shaderData );
+  mArchiveModified = true;
+
+  DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, "Added to archive: %u\n", shaderData->GetHashValue() );
+}
+
+void ShaderFactory::SaveArchive()
+{
+  if( mArchiveModified )
+  {
+    mArchiveModified = false;
+
+    Dali::Vector< unsigned char > buffer;
+    mArchive.Write( buffer );
+
+    ThreadLocalStorage& tls = ThreadLocalStorage::Get();
+    Integration::PlatformAbstraction& platformAbstraction = tls.GetPlatformAbstraction();
+    const bool saved = platformAbstraction.SaveShaderBinaryFile( SHADER_ARCHIVE_FILENAME, buffer.Begin(), buffer.Count() );
+
+    DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, saved ? "Saved %u binaries to file: %s\n" : "Save of %u binaries to file failed: %s\n", mArchive.Count(), SHADER_ARCHIVE_FILENAME );
+    if( saved ) {} // Avoid unused variable warning in release builds
+  }
 }
 
 void ShaderFactory::LoadDefaultShaders()
@@ -153,20 +196,108 @@ void ShaderFactory::LoadDefaultShaders()
   mDefaultShader->SendProgramMessage( ImageVertex, ImageFragment, false );
 }
 
+void ShaderFactory::WarmUpPrograms()
+{
+  ThreadLocalStorage& tls = ThreadLocalStorage::Get();
+  Integration::PlatformAbstraction& platformAbstraction = tls.GetPlatformAbstraction();
+  const unsigned int startTime = GetTimeMicroseconds( platformAbstraction );
+
+  LoadArchive();
+  const unsigned int archiveTime = GetTimeMicroseconds( platformAbstraction );
+
+  Dali::Vector< unsigned char > manifest;
+  if( platformAbstraction.LoadShaderBinaryFile( SHADER_MANIFEST_FILENAME, manifest ) )
+  {
+    manifest.PushBack( '\0' );
+
+    SceneGraph::UpdateManager& updateManager = tls.GetUpdateManager();
+    unsigned int requested( 0u );
+    unsigned int listed( 0u );
+
+    const char* text = reinterpret_cast< const char* >( manifest.Begin() );
+    char* end = NULL;
+    for( size_t shaderHash = strtoul( text, &end, 10 ); end != text; text = end, shaderHash = strtoul( text, &end, 10 ) )
+    {
+      ++listed;
+
+      ShaderDataPtr shaderData;
+      Internal::ShaderData* cachedShaderData = NULL;
+      if( mShaderBinaryTable.Find( shaderHash, cachedShaderData ) )
+      {
+        shaderData = cachedShaderData;
+      }
+      else
+      {
+        shaderData = mArchive.Find( shaderHash );
+        if( shaderData )
+        {
+          MemoryCacheInsert( *shaderData );
+        }
+      }
+
+      if( shaderData )
+      {
+        WarmUpProgramMessage( updateManager, shaderData );
+        ++requested;
+      }
+      else
+      {
+        DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, "Warm-up program not in archive: %u\n", shaderHash );
+      }
+    }
+
+    const unsigned int endTime = GetTimeMicroseconds( platformAbstraction );
+    DALI_LOG_RENDER_INFO( "Shader warm-up: %u of %u listed programs requested; archive read in %u us, total %u us\n",
+                          requested, listed, archiveTime - startTime, endTime - startTime );
+  }
+  else
+  {
+    DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, "Shader warm-up: no manifest; archive of %u binaries read in %u us\n",
+                   mArchive.Count(), archiveTime - startTime );
+  }
+}
+
 void ShaderFactory::MemoryCacheInsert( ShaderData& shaderData )
 {
   DALI_ASSERT_DEBUG( shaderData.GetBufferSize() > 0 );
 
-  // Save the binary into to memory cache:
+  // Save the binary into to memory cache; it may already be there if the render-thread replaced its binary
+  Internal::ShaderData* cachedShaderData = NULL;
+  if( mShaderBinaryTable.Find( shaderData.GetHashValue(), cachedShaderData ) && ( cachedShaderData == &shaderData ) )
+  {
+    return;
+  }
+
   if( shaderData.GetBufferSize() > 0 )
   {
     mShaderBinaryCache.Reserve( mShaderBinaryCache.Size() + 1 ); // Make sure the push won't throw after we inc the ref count.
     shaderData.Reference();
     mShaderBinaryCache.PushBack( &shaderData );
+    mShaderBinaryTable.Insert( shaderData.GetHashValue(), &shaderData );
     DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, "CACHED BINARY FOR HASH: %u\n", shaderData.GetHashValue() );
   }
 }
 
+void ShaderFactory::LoadArchive()
+{
+  if( !mArchiveLoaded )
+  {
+    mArchiveLoaded = true;
+
+    ThreadLocalStorage& tls = ThreadLocalStorage::Get();
+    Integration::PlatformAbstraction& platformAbstraction = tls.GetPlatformAbstraction();
+
+    Dali::Vector< unsigned char > buffer;
+    const bool loaded = platformAbstraction.LoadShaderBinaryFile( SHADER_ARCHIVE_FILENAME, buffer ) && mArchive.Read( buffer );
+
+    DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, loaded ?
+        "Read %u binaries from archive: \"%s\"\n" :
+        "No binaries read from archive: %u, \"%s\"\n",
+        mArchive.Count(), SHADER_ARCHIVE_FILENAME );
+    if( loaded ) {} // Avoid unused variable warning in release builds
+  }
+}
+
 } // namespace Internal
 
 } // namespace Dali
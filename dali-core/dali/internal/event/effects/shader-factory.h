@@ -23,6 +23,7 @@
 #include <dali/internal/event/effects/shader-declarations.h>
 #include <dali/internal/common/message.h>
 #include <dali/internal/common/shader-saver.h>
+#include <dali/internal/event/effects/shader-binary-archive.h>
 
 namespace Dali
 {
@@ -37,6 +38,9 @@ typedef IntrusivePtr<ShaderData> ShaderDataPtr;
  * ShaderFactory is an object which manages shader binary resource load requests,
  * It triggers the load requests during core initialization and sends a message to the
  * render manager with information about all the requested shader binaries.
+ *
+ * The binaries are kept in a single ShaderBinaryArchive file, which is read once when the first
+ * shader is loaded and written after new binaries have been received.
  */
 class ShaderFactory : public ShaderSaver
 {
@@ -56,7 +60,7 @@ public:
    * @brief Looks for precompiled binary version of shader program in memory and file caches.
    *
    * Tries to load a binary version of a shader program identified by a hash over the two source
-   * files, checking an in-memory cache first.
+   * files, checking an in-memory cache first, then the archive, and then a file of the binary alone.
    * If the cache hits or the load succeeds, the buffer member of the returned ShaderData will
    * contain a precompiled shader binary program which can be uploaded directly to GLES.
    *
@@ -70,23 +74,44 @@ public:
   Internal::ShaderDataPtr Load( const std::string& vertexSource, const std::string& fragmentSource, size_t& shaderHash );
 
   /**
-   * @brief Saves shader to memory cache and filesystem.
+   * @brief Saves shader to memory cache and archive.
    * This is called when a shader binary is ready to be saved to the memory cache file system.
    * Shaders that pass through here become available to subsequent invocations of Load.
+   * The archive is written to the file system by SaveArchive().
    * @param[in] shader The data to be saved.
    * @sa Load
    */
   virtual void SaveBinary( Internal::ShaderDataPtr shader );
 
+  /**
+   * @brief Writes the archive to the file system, if binaries have been saved since it was last written.
+   * Called after the messages from the update-thread have been processed, so the binaries compiled
+   * during a frame are written together.
+   */
+  void SaveArchive();
+
   /**
    * Called during Core initialization to load the default shader.
    */
   void LoadDefaultShaders();
 
+  /**
+   * Called during Core initialization to link the programs listed in the warm-up manifest before the first frame.
+   * The manifest is a file named by SHADER_MANIFEST_FILENAME in the shader binary locations, listing the
+   * hashes of the programs as decimal numbers separated by white-space. Programs which are not in the archive
+   * are skipped. The time taken to read the archive and request the programs is logged.
+   */
+  void WarmUpPrograms();
+
 private:
 
   void MemoryCacheInsert( Internal::ShaderData& shaderData );
 
+  /**
+   * Read the archive from the file system, the first time this is called.
+   */
+  void LoadArchive();
+
   // Undefined
   ShaderFactory( const ShaderFactory& );
 
@@ -96,6 +121,10 @@ private:
 private:
   ShaderEffectPtr                           mDefaultShader;
   Dali::Vector< Internal::ShaderData* > mShaderBinaryCache; ///< Cache of pre-compiled shaders.
+  HashMap< Internal::ShaderData* >          mShaderBinaryTable; ///< Finds the shaders in mShaderBinaryCache by their hash
+  ShaderBinaryArchive                       mArchive;           ///< The binaries read from, and to be written to, the archive file
+  bool                                      mArchiveLoaded:1;   ///< Whether the archive file has been read
+  bool                                      mArchiveModified:1; ///< Whether binaries have been saved since the archive file was written
 
 }; // class ShaderFactory
 
@@ -70,6 +70,23 @@ Dali::Integration::PixelBuffer* BitmapCompressed::ReserveBufferOfSize( Pixel::Fo
   return mData;
 }
 
+void BitmapCompressed::AssignExternalBuffer( Pixel::Format pixelFormat,
+                                             const unsigned int width,
+                                             const unsigned int height,
+                                             Dali::Integration::PixelBuffer* buffer,
+                                             const size_t bufferSize,
+                                             ExternalBuffer* owner )
+{
+  DALI_ASSERT_DEBUG( buffer && owner && "An external buffer needs an owner to release it." );
+  // delete existing buffer
+  DeletePixelBuffer();
+
+  Initialize(pixelFormat, width, height, bufferSize);
+
+  mData = buffer;
+  mExternalBuffer = owner;
+}
+
 } //namespace Integration
 
 } //namespace Dali
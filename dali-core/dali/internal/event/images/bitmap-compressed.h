@@ -79,6 +79,16 @@ public:
                                      const unsigned height,
                                      const std::size_t numBytes );
 
+  /**
+   * @copydoc Dali::Integration::Bitmap::CompressedProfile::AssignExternalBuffer
+   */
+  virtual void AssignExternalBuffer( Pixel::Format pixelFormat,
+                                     const unsigned width,
+                                     const unsigned height,
+                                     Dali::Integration::PixelBuffer* buffer,
+                                     const std::size_t numBytes,
+                                     ExternalBuffer* owner );
+
   /**
    * Get the pixel buffer size in bytes
    * @return The buffer size in bytes.
@@ -387,6 +387,17 @@ void ResourceClient::NotifyUploaded( ResourceId id )
   }
 }
 
+void ResourceClient::NotifyReloadRequired( ResourceId id )
+{
+  DALI_LOG_INFO(Debug::Filter::gResource, Debug::General, "ResourceClient: NotifyReloadRequired(id:%u)\n", id);
+
+  TicketContainerIter ticketIter = mImpl->mTickets.find(id);
+  if( ticketIter != mImpl->mTickets.end() && ticketIter->second->GetLoadingState() != ResourceLoading )
+  {
+    ReloadResource( id, false );
+  }
+}
+
 void ResourceClient::NotifyLoading( ResourceId id )
 {
   DALI_LOG_INFO(Debug::Filter::gResource, Debug::General, "ResourceClient: NotifyLoading(id:%u)\n", id);
@@ -226,6 +226,12 @@ public: // Message methods
    */
   void NotifyUploaded( ResourceId id );
 
+  /**
+   * Load a resource again, as its texture was evicted from GPU memory after its pixels were discarded.
+   * @param[in] id The resource id of the evicted resource
+   */
+  void NotifyReloadRequired( ResourceId id );
+
   /**
    * Notify associated ticket observers that the resource is loading.
    * @param[in] id The resource id of the loading resource
@@ -273,6 +279,11 @@ inline MessageBase* UploadedMessage( ResourceClient& client, ResourceId id )
   return new MessageValue1< ResourceClient, ResourceId >( &client, &ResourceClient::NotifyUploaded, id );
 }
 
+inline MessageBase* ReloadRequiredMessage( ResourceClient& client, ResourceId id )
+{
+  return new MessageValue1< ResourceClient, ResourceId >( &client, &ResourceClient::NotifyReloadRequired, id );
+}
+
 inline MessageBase* LoadingMessage( ResourceClient& client, ResourceId id )
 {
   return new MessageValue1< ResourceClient, ResourceId  >( &client, &ResourceClient::NotifyLoading, id );
@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/render/common/layer-cache.h>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/common/hash.h>
+#include <dali/integration-api/debug.h>
+#include <dali/internal/common/image-sampler.h>
+#include <dali/internal/common/shader-data.h>
+#include <dali/internal/render/gl-resources/context.h>
+#include <dali/internal/render/gl-resources/frame-buffer-texture.h>
+#include <dali/internal/render/gl-resources/texture-units.h>
+#include <dali/internal/render/shaders/program.h>
+#include "dali-shaders.h"
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Render
+{
+
+namespace
+{
+
+// The corners of the viewport in normalized device coordinates, drawn as a triangle strip
+const float VIEWPORT_VERTICES[] = { -1.0f, -1.0f,   1.0f, -1.0f,   -1.0f, 1.0f,   1.0f, 1.0f };
+const GLsizei VIEWPORT_VERTEX_COUNT = 4;
+
+} // unnamed namespace
+
+LayerCache::Cache::Cache( const SceneGraph::Layer* cachedLayer )
+: layer( cachedLayer ),
+  texture( NULL ),
+  viewMatrix(),
+  projectionMatrix(),
+  viewport(),
+  isValid( false ),
+  isUsed( false )
+{
+}
+
+LayerCache::LayerCache( Context& context, ProgramCache& programCache )
+: mContext( context ),
+  mProgramCache( programCache ),
+  mProgram( NULL ),
+  mVertexBuffer(),
+  mCaches(),
+  mCurrentCache( NULL ),
+  mRenderRegion(),
+  mIsRenderRegionSet( false ),
+  mIsRedrawing( false )
+{
+}
+
+LayerCache::~LayerCache()
+{
+  for( CacheContainer::Iterator iter = mCaches.Begin(), endIter = mCaches.End(); iter != endIter; ++iter )
+  {
+    ReleaseTexture( **iter );
+  }
+}
+
+bool LayerCache::BeginRedraw( const SceneGraph::Layer* layer, bool dirty, const Matrix& viewMatrix, const Matrix& projectionMatrix )
+{
+  DALI_ASSERT_DEBUG( !mIsRedrawing && "LayerCache::BeginRedraw. EndRedraw() was not called" );
+
+  const Rect<int> viewport = mContext.GetViewport();
+  mCurrentCache = &GetCache( layer );
+  Cache& cache = *mCurrentCache;
+  cache.isUsed = true;
+
+  const unsigned int width = static_cast< unsigned int >( viewport.x + viewport.width );
+  const unsigned int height = static_cast< unsigned int >( viewport.y + viewport.height );
+  if( NULL == cache.texture ||
+      cache.texture->GetWidth() != width ||
+      cache.texture->GetHeight() != height )
+  {
+    ReleaseTexture( cache );
+    cache.texture = new FrameBufferTexture( width, height, Pixel::RGBA8888, RenderBuffer::COLOR_DEPTH, mContext );
+  }
+
+  if( cache.isValid &&
+      !dirty &&
+      cache.viewport == viewport &&
+      cache.viewMatrix == viewMatrix &&
+      cache.projectionMatrix == projectionMatrix )
+  {
+    return false;
+  }
+
+  cache.isValid = false;
+  cache.viewport = viewport;
+  cache.viewMatrix = viewMatrix;
+  cache.projectionMatrix = projectionMatrix;
+
+  // Binds the framebuffer of the cache, creating it if required
+  if( !cache.texture->Prepare() )
+  {
+    // Draw the lists directly instead
+    return true;
+  }
+
+  // The whole cache is redrawn, even if only a region of the surface is
+  const Rect<int>* renderRegion = mContext.GetRenderRegion();
+  mIsRenderRegionSet = ( NULL != renderRegion );
+  if( mIsRenderRegionSet )
+  {
+    mRenderRegion = *renderRegion;
+  }
+  mContext.SetRenderRegion( NULL );
+
+  mContext.ClearColor( 0.0f, 0.0f, 0.0f, 0.0f );
+  mContext.ColorMask( true );
+  mContext.DepthMask( true );
+  mContext.Clear( GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT, Context::FORCE_CLEAR );
+
+  mIsRedrawing = true;
+  return true;
+}
+
+void LayerCache::EndRedraw()
+{
+  if( !mIsRedrawing )
+  {
+    return;
+  }
+  mIsRedrawing = false;
+
+  GLenum attachments[] = { GL_DEPTH_ATTACHMENT };
+  mContext.InvalidateFramebuffer( GL_FRAMEBUFFER, 1, attachments );
+
+  mContext.BindFramebuffer( GL_FRAMEBUFFER, 0 );
+  mContext.SetRenderRegion( mIsRenderRegionSet ? &mRenderRegion : NULL );
+
+  mCurrentCache->isValid = true;
+}
+
+void LayerCache::Draw()
+{
+  if( NULL == mCurrentCache || !mCurrentCache->isValid )
+  {
+    return;
+  }
+  Cache& cache = *mCurrentCache;
+
+  if( NULL == mProgram )
+  {
+    Internal::ShaderDataPtr shaderData = new ShaderData( LayerCacheVertex, LayerCacheFragment );
+    shaderData->SetHashValue( CalculateHash( LayerCacheVertex, LayerCacheFragment ) );
+    mProgram = Program::New( mProgramCache, shaderData, false );
+  }
+  mProgram->Use();
+
+  if( !mVertexBuffer )
+  {
+    mVertexBuffer = new GpuBuffer( mContext );
+  }
+  if( !mVertexBuffer->BufferIsValid() )
+  {
+    mVertexBuffer->UpdateDataBuffer( sizeof( VIEWPORT_VERTICES ), VIEWPORT_VERTICES, GpuBuffer::STATIC_DRAW );
+  }
+
+  // The premultiplied colors are blended as the items would have been
+  mContext.SetBlend( true );
+  mContext.BlendEquationSeparate( GL_FUNC_ADD, GL_FUNC_ADD );
+  mContext.BlendFuncSeparate( GL_ONE, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA );
+  mContext.EnableDepthBuffer( false );
+  mContext.EnableStencilBuffer( false );
+  mContext.ColorMask( true );
+  mContext.CullFace( CullNone );
+  mContext.SetScissorTest( false );
+
+  cache.texture->Bind( GL_TEXTURE_2D, TEXTURE_UNIT_IMAGE );
+  cache.texture->ApplySampler( TEXTURE_UNIT_IMAGE, ImageSampler::PackBitfield( FilterMode::NEAREST, FilterMode::NEAREST ) );
+
+  const GLint samplerLoc = mProgram->GetUniformLocation( Program::UNIFORM_SAMPLER );
+  if( -1 != samplerLoc )
+  {
+    mProgram->SetUniform1i( samplerLoc, TEXTURE_UNIT_IMAGE );
+  }
+
+  // The viewport within the texture
+  const GLint rectLoc = mProgram->GetUniformLocation( Program::UNIFORM_SAMPLER_RECT );
+  if( -1 != rectLoc )
+  {
+    const float width = static_cast< float >( cache.texture->GetWidth() );
+    const float height = static_cast< float >( cache.texture->GetHeight() );
+    mProgram->SetUniform4f( rectLoc, cache.viewport.x / width, cache.viewport.y / height, 1.0f, 1.0f );
+  }
+
+  mVertexBuffer->Bind( GpuBuffer::ARRAY_BUFFER );
+  const GLint positionLoc = mProgram->GetAttribLocation( Program::ATTRIB_POSITION );
+  if( -1 != positionLoc )
+  {
+    mContext.EnableVertexAttributeArray( positionLoc );
+    mContext.VertexAttribPointer( positionLoc, 2, GL_FLOAT, GL_FALSE, 0, 0 );
+    mContext.DrawArrays( GL_TRIANGLE_STRIP, 0, VIEWPORT_VERTEX_COUNT );
+    mContext.DisableVertexAttributeArray( positionLoc );
+  }
+}
+
+void LayerCache::ReleaseUnusedCaches()
+{
+  mCurrentCache = NULL;
+
+  for( CacheContainer::Iterator iter = mCaches.Begin(); iter != mCaches.End(); )
+  {
+    Cache& cache = **iter;
+    if( cache.isUsed )
+    {
+      cache.isUsed = false;
+      ++iter;
+    }
+    else
+    {
+      ReleaseTexture( cache );
+      iter = mCaches.Erase( iter );
+    }
+  }
+}
+
+void LayerCache::GlContextDestroyed()
+{
+  // The textures are lost with the context; the caches are created again when next drawn
+  for( CacheContainer::Iterator iter = mCaches.Begin(), endIter = mCaches.End(); iter != endIter; ++iter )
+  {
+    Cache& cache = **iter;
+    if( NULL != cache.texture )
+    {
+      cache.texture->GlContextDestroyed();
+      delete cache.texture;
+      cache.texture = NULL;
+    }
+  }
+  mCaches.Clear();
+  mCurrentCache = NULL;
+  mIsRedrawing = false;
+
+  if( mVertexBuffer )
+  {
+    mVertexBuffer->GlContextDestroyed();
+  }
+}
+
+LayerCache::Cache& LayerCache::GetCache( const SceneGraph::Layer* layer )
+{
+  for( CacheContainer::Iterator iter = mCaches.Begin(), endIter = mCaches.End(); iter != endIter; ++iter )
+  {
+    if( (*iter)->layer == layer )
+    {
+      return **iter;
+    }
+  }
+
+  Cache* cache = new Cache( layer );
+  mCaches.PushBack( cache );
+  return *cache;
+}
+
+void LayerCache::ReleaseTexture( Cache& cache )
+{
+  if( NULL != cache.texture )
+  {
+    Texture* texture = cache.texture; // GlCleanup() is public through the Texture interface
+    texture->GlCleanup();
+    delete cache.texture;
+    cache.texture = NULL;
+  }
+  cache.isValid = false;
+}
+
+} // namespace Render
+
+} // namespace Internal
+
+} // namespace Dali
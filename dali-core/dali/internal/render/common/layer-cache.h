@@ -0,0 +1,162 @@
+#ifndef __DALI_INTERNAL_RENDER_LAYER_CACHE_H__
+#define __DALI_INTERNAL_RENDER_LAYER_CACHE_H__
+
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali/public-api/math/matrix.h>
+#include <dali/public-api/math/rect.h>
+#include <dali/devel-api/common/owner-container.h>
+#include <dali/internal/common/owner-pointer.h>
+#include <dali/internal/render/gl-resources/gpu-buffer.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+class Context;
+class FrameBufferTexture;
+class Program;
+class ProgramCache;
+
+namespace SceneGraph
+{
+class Layer;
+}
+
+namespace Render
+{
+
+/**
+ * Keeps the layers with the render cache enabled drawn in off-screen textures.
+ * The render lists of such a layer are only drawn into its texture when their items changed, or when
+ * the camera or viewport changed; the texture is then drawn in place of the lists.
+ *
+ * The texture has the size of the framebuffer up to the far corner of the viewport, so the lists are drawn
+ * into it with the viewport & projection of the instruction. It holds premultiplied colors, as drawn
+ * with the default blending from a transparent black texture, and is blended onto the framebuffer so.
+ */
+class LayerCache
+{
+public:
+
+  /**
+   * Constructor.
+   * @param[in] context The GL context.
+   * @param[in] programCache The cache of the program which draws the textures.
+   */
+  LayerCache( Context& context, ProgramCache& programCache );
+
+  /**
+   * Non-virtual destructor.
+   */
+  ~LayerCache();
+
+  /**
+   * Prepare to draw the render lists of a cached layer, with the viewport of the current instruction.
+   * If the cache of the layer must be redrawn, its framebuffer is bound and cleared; the lists must then be
+   * drawn, followed by EndRedraw().
+   * @param[in] layer The cached layer.
+   * @param[in] dirty True if the items of the layer may have changed since the cache was drawn.
+   * @param[in] viewMatrix The view matrix of the instruction.
+   * @param[in] projectionMatrix The projection matrix of the instruction.
+   * @return True if the render lists must be drawn; either into the cache, or directly if it could not be created.
+   */
+  bool BeginRedraw( const SceneGraph::Layer* layer, bool dirty, const Matrix& viewMatrix, const Matrix& projectionMatrix );
+
+  /**
+   * Finish drawing the render lists into the cache, and bind the default framebuffer again.
+   */
+  void EndRedraw();
+
+  /**
+   * Draw the cache of the layer prepared with BeginRedraw() into the viewport, if it is valid.
+   */
+  void Draw();
+
+  /**
+   * Release the caches of the layers which were not drawn since the previous call.
+   * This should be called after each frame in which the instructions were drawn.
+   */
+  void ReleaseUnusedCaches();
+
+  /**
+   * Forget the GL resources after the context was destroyed.
+   */
+  void GlContextDestroyed();
+
+private:
+
+  /**
+   * The cache of a layer.
+   */
+  struct Cache
+  {
+    Cache( const SceneGraph::Layer* cachedLayer );
+
+    const SceneGraph::Layer* layer;  ///< The cached layer
+    FrameBufferTexture* texture;     ///< The texture the layer is drawn into, or NULL; owned
+    Matrix viewMatrix;               ///< The view matrix the texture was drawn with
+    Matrix projectionMatrix;         ///< The projection matrix the texture was drawn with
+    Rect<int> viewport;              ///< The viewport the texture was drawn with
+    bool isValid:1;                  ///< False until the texture has been drawn
+    bool isUsed:1;                   ///< Whether the layer was drawn since ReleaseUnusedCaches() was last called
+  };
+
+  typedef OwnerContainer< Cache* > CacheContainer;
+
+  /**
+   * Find the cache of a layer, or add one.
+   * @param[in] layer The cached layer.
+   * @return The cache.
+   */
+  Cache& GetCache( const SceneGraph::Layer* layer );
+
+  /**
+   * Delete the texture of a cache, and its GL resources.
+   * @param[in] cache The cache.
+   */
+  void ReleaseTexture( Cache& cache );
+
+  // Undefined
+  LayerCache( const LayerCache& );
+
+  // Undefined
+  LayerCache& operator=( const LayerCache& );
+
+private:
+
+  Context& mContext;
+  ProgramCache& mProgramCache;
+  Program* mProgram;                      ///< Draws the textures; owned by the program cache
+  OwnerPointer< GpuBuffer > mVertexBuffer; ///< The corners of the viewport
+  CacheContainer mCaches;
+  Cache* mCurrentCache;                   ///< The cache prepared by BeginRedraw()
+  Rect<int> mRenderRegion;                ///< The render region set before BeginRedraw()
+  bool mIsRenderRegionSet:1;              ///< Whether a render region was set before BeginRedraw()
+  bool mIsRedrawing:1;                    ///< Whether the lists are being drawn into the current cache
+};
+
+} // namespace Render
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // __DALI_INTERNAL_RENDER_LAYER_CACHE_H__
@@ -44,7 +44,10 @@ public:
     QUATERNION_TO_MATRIX,
     FLOAT_POINT_MULTIPLY,
     RESET_PROPERTIES,
+    PROPERTY_OWNERS_RESET,
     PROCESS_MESSAGES,
+    MESSAGE_QUEUE_CONTENTION,
+    MESSAGES_COALESCED,
     ANIMATE_NODES,
     ANIMATORS_APPLIED,
     APPLY_CONSTRAINTS,
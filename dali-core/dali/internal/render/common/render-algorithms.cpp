@@ -19,6 +19,7 @@
 #include <dali/internal/render/common/render-algorithms.h>
 
 // INTERNAL INCLUDES
+#include <dali/internal/render/common/layer-cache.h>
 #include <dali/internal/render/common/render-debug.h>
 #include <dali/internal/render/common/render-list.h>
 #include <dali/internal/render/common/render-instruction.h>
@@ -132,7 +133,7 @@ inline void ProcessRenderList(
   {
     bool depthBufferEnabled = ( ( renderList.GetFlags() & RenderList::DEPTH_BUFFER_ENABLED ) != 0u );
     size_t count = renderList.Count();
-    for ( size_t index = 0; index < count; ++index )
+    for ( size_t index = 0; index < count; )
     {
       const RenderItem& item = renderList.GetItem( index );
       DALI_PRINT_RENDER_ITEM( item );
@@ -140,7 +141,18 @@ inline void ProcessRenderList(
       //Enable depth writes if depth buffer is enabled and item is opaque
       context.DepthMask( depthBufferEnabled && ( item.IsOpaque() || item.GetRenderer().RequiresDepthTest() ) );
 
-      item.GetRenderer().Render( context, textureCache, bufferIndex, item.GetNode(), defaultShader, item.GetModelViewMatrix(), viewMatrix, projectionMatrix, cullMode, !item.IsOpaque() );
+      // Consecutive items may be drawn in a batch by the renderer of the first
+      const size_t end = item.GetRenderer().FindBatchEnd( renderList, index, defaultShader, bufferIndex );
+      if( end - index > 1 )
+      {
+        item.GetRenderer().RenderBatch( context, textureCache, bufferIndex, renderList, index, end, defaultShader, viewMatrix, projectionMatrix, !item.IsOpaque() );
+        context.IncrementBatchedCount( end - index - 1 );
+      }
+      else
+      {
+        item.GetRenderer().Render( context, textureCache, bufferIndex, item.GetNode(), defaultShader, item.GetModelViewMatrix(), viewMatrix, projectionMatrix, cullMode, !item.IsOpaque() );
+      }
+      index = end;
     }
   }
   else
@@ -161,6 +173,7 @@ void ProcessRenderInstruction( const RenderInstruction& instruction,
                                Context& context,
                                SceneGraph::TextureCache& textureCache,
                                SceneGraph::Shader& defaultShader,
+                               LayerCache& layerCache,
                                BufferIndex bufferIndex )
 {
   DALI_PRINT_RENDER_INSTRUCTION( instruction, bufferIndex );
@@ -171,6 +184,9 @@ void ProcessRenderInstruction( const RenderInstruction& instruction,
   DALI_ASSERT_DEBUG( NULL != viewMatrix );
   DALI_ASSERT_DEBUG( NULL != projectionMatrix );
 
+  // The renderers were culled during the update
+  context.IncrementCulledCount( instruction.mCulledCount );
+
   if( NULL != viewMatrix &&
       NULL != projectionMatrix )
   {
@@ -182,8 +198,40 @@ void ProcessRenderInstruction( const RenderInstruction& instruction,
     {
       const RenderList* renderList = instruction.GetRenderList( index );
 
-      if(  renderList &&
-          !renderList->IsEmpty() )
+      if( renderList && renderList->GetCachedLayer() )
+      {
+        // The consecutive lists of a cached layer are drawn through its render cache
+        const SceneGraph::Layer* cachedLayer = renderList->GetCachedLayer();
+        RenderListContainer::SizeType end = index;
+        bool dirty = false;
+        for( ; end < count; ++end )
+        {
+          const RenderList* cachedList = instruction.GetRenderList( end );
+          if( !cachedList || cachedList->GetCachedLayer() != cachedLayer )
+          {
+            break;
+          }
+          dirty = dirty || ( cachedList->GetFlags() & RenderList::RENDER_CACHE_DIRTY );
+        }
+
+        if( layerCache.BeginRedraw( cachedLayer, dirty, *viewMatrix, *projectionMatrix ) )
+        {
+          for( ; index < end; ++index )
+          {
+            renderList = instruction.GetRenderList( index );
+            if( !renderList->IsEmpty() )
+            {
+              ProcessRenderList( *renderList, context, textureCache, defaultShader, bufferIndex, *viewMatrix, *projectionMatrix, instruction.mCullMode );
+            }
+          }
+          layerCache.EndRedraw();
+        }
+        layerCache.Draw();
+
+        index = end - 1;
+      }
+      else if(  renderList &&
+               !renderList->IsEmpty() )
       {
         ProcessRenderList( *renderList, context, textureCache, defaultShader, bufferIndex, *viewMatrix, *projectionMatrix, instruction.mCullMode );
       }
@@ -36,6 +36,7 @@ class TextureCache;
 
 namespace Render
 {
+class LayerCache;
 
 /**
  * Process a render-instruction.
@@ -43,12 +44,14 @@ namespace Render
  * @param[in] context The GL context.
  * @param[in] textureCache The texture cache used to get textures.
  * @param[in] defaultShader The default shader.
+ * @param[in] layerCache The render caches of the layers which have them enabled.
  * @param[in] buffer The current render buffer index (previous update buffer)
  */
 void ProcessRenderInstruction( const SceneGraph::RenderInstruction& instruction,
                                Context& context,
                                SceneGraph::TextureCache& textureCache,
                                SceneGraph::Shader& defaultShader,
+                               LayerCache& layerCache,
                                BufferIndex bufferIndex );
 
 } // namespace Render
@@ -149,6 +149,22 @@ void PrintCullCount( unsigned int frameCount, unsigned int culledCount )
   }
 }
 
+void PrintBatchedCount( unsigned int frameCount, unsigned int batchedCount )
+{
+  if( frameCount % 120 == 30 ) // Print every 2 seconds reg
+  {
+    Debug::LogMessage( Debug::DebugInfo, "Renderer # Draw calls saved by batching: %u\n", batchedCount );
+  }
+}
+
+void PrintRedundantUniformCount( unsigned int frameCount, unsigned int redundantCount )
+{
+  if( frameCount % 120 == 30 ) // Print every 2 seconds reg
+  {
+    Debug::LogMessage( Debug::DebugInfo, "Renderer # Redundant uniform calls skipped: %u\n", redundantCount );
+  }
+}
+
 
 
 } // Render
@@ -50,9 +50,13 @@
 #ifdef DALI_PRINT_RENDERERS
 #define DALI_PRINT_RENDERER_COUNT(x, y)  Render::PrintRendererCount(x, y)
 #define DALI_PRINT_CULL_COUNT(x, y)      Render::PrintCullCount(x, y)
+#define DALI_PRINT_BATCHED_COUNT(x, y)   Render::PrintBatchedCount(x, y)
+#define DALI_PRINT_REDUNDANT_UNIFORM_COUNT(x, y) Render::PrintRedundantUniformCount(x, y)
 #else // DALI_PRINT_RENDERERS
 #define DALI_PRINT_RENDERER_COUNT(x, y)
 #define DALI_PRINT_CULL_COUNT(x, y)
+#define DALI_PRINT_BATCHED_COUNT(x, y)
+#define DALI_PRINT_REDUNDANT_UNIFORM_COUNT(x, y)
 #endif // DALI_PRINT_RENDERERS
 
 
@@ -118,6 +122,20 @@ void PrintCullCount( unsigned int frameCount, unsigned int culledCount );
  */
 void PrintRendererCount( unsigned int frameCount, unsigned int rendererCount );
 
+/**
+ * Print the number of draw calls saved by batching
+ * @param[in] frameCount The frame counter
+ * @param[in] batchedCount The number of renderers drawn by the draw call of another renderer
+ */
+void PrintBatchedCount( unsigned int frameCount, unsigned int batchedCount );
+
+/**
+ * Print the number of uniform calls skipped as their values were already set
+ * @param[in] frameCount The frame counter
+ * @param[in] redundantCount The number of redundant uniform calls
+ */
+void PrintRedundantUniformCount( unsigned int frameCount, unsigned int redundantCount );
+
 } // Render
 
 } // Internal
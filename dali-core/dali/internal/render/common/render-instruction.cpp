@@ -39,6 +39,9 @@ RenderInstruction::RenderInstruction()
   mIsClearColorSet( false ),
   mCullMode(false),
   mOffscreenTextureId( 0 ),
+  mCulledCount( 0u ),
+  mDamagedRegion(),
+  mIsFullyDamaged( true ),
   mCameraAttachment( 0 ),
   mNextFreeRenderList( 0 )
 {
@@ -105,6 +108,11 @@ const RenderList* RenderInstruction::GetRenderList( RenderListContainer::SizeTyp
   return mRenderLists[ index ];
 }
 
+RenderList* RenderInstruction::GetRenderList( RenderListContainer::SizeType index )
+{
+  return const_cast< RenderList* >( static_cast< const RenderInstruction& >( *this ).GetRenderList( index ) );
+}
+
 void RenderInstruction::Reset( CameraAttachment* cameraAttachment,
                                unsigned int      offscreenTextureId,
                                const Viewport*   viewport,
@@ -117,6 +125,8 @@ void RenderInstruction::Reset( CameraAttachment* cameraAttachment,
   mIsClearColorSet = NULL != clearColor;
   mCullMode = false;
   mOffscreenTextureId = offscreenTextureId;
+  mCulledCount = 0u;
+  mIsFullyDamaged = true;
   mRenderTracker = NULL;
   mNextFreeRenderList = 0;
 
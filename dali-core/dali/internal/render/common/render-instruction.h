@@ -20,6 +20,7 @@
 
 // INTERNAL INCLUDES
 #include <dali/public-api/math/matrix.h>
+#include <dali/public-api/math/vector4.h>
 #include <dali/public-api/math/viewport.h>
 #include <dali/internal/update/node-attachments/scene-graph-camera-attachment.h>
 #include <dali/internal/render/common/render-list.h>
@@ -83,6 +84,11 @@ public:
    */
   const RenderList* GetRenderList( RenderListContainer::SizeType index ) const;
 
+  /**
+   * @copydoc GetRenderList( RenderListContainer::SizeType ) const
+   */
+  RenderList* GetRenderList( RenderListContainer::SizeType index );
+
   /**
    * Reset render-instruction
    * render-lists are cleared but not released, while matrices and other settings reset in
@@ -138,6 +144,10 @@ public: // Data, TODO hide these
   bool     mCullMode:1;                 ///< True if renderers should be frustum culled
 
   unsigned int mOffscreenTextureId;     ///< Optional offscreen target
+  unsigned int mCulledCount;            ///< The number of renderables which were culled, rather than added to the lists
+
+  Vector4  mDamagedRegion;              ///< The bounds of the changes since the previous frame, in normalized device coordinates (min x, min y, max x, max y)
+  bool     mIsFullyDamaged:1;           ///< True if the whole surface must be redrawn; mDamagedRegion is then unused
 
 private: // Data
 
@@ -72,6 +72,8 @@ public:
     STENCIL_BUFFER_ENABLED = 1 << 3, ///< If stencil buffer should be used for writing / test operation
     STENCIL_WRITE          = 1 << 4, ///< If the stencil buffer is writable
     STENCIL_CLEAR          = 1 << 5, ///< If the stencil buffer should first be cleared
+    BATCHING_ENABLED       = 1 << 6, ///< If consecutive compatible items may be drawn with a single draw call
+    RENDER_CACHE_DIRTY     = 1 << 7, ///< If the items may have changed since they were drawn into the render cache of their layer
 
   };
 
@@ -83,6 +85,8 @@ public:
     mRenderFlags( 0u ),
     mClippingBox( NULL ),
     mSourceLayer( NULL ),
+    mCachedLayer( NULL ),
+    mCulledCount( 0u ),
     mHasColorRenderItems( false )
   {
   }
@@ -130,6 +134,7 @@ public:
     // we dont want to delete and re-create the render items every frame
     mNextFree = 0;
     mRenderFlags = 0u;
+    mCachedLayer = NULL;
 
     delete mClippingBox;
     mClippingBox = NULL;
@@ -289,6 +294,40 @@ public:
     mSourceLayer = layer;
   }
 
+  /**
+   * @return the layer whose render cache the items are drawn into, or NULL if they are drawn directly
+   */
+  const Layer* GetCachedLayer() const
+  {
+    return mCachedLayer;
+  }
+
+  /**
+   * @param layer whose render cache the items are drawn into, or NULL to draw them directly
+   */
+  void SetCachedLayer( const Layer* layer )
+  {
+    mCachedLayer = layer;
+  }
+
+  /**
+   * Set the number of renderables which were culled when the items were added.
+   * This is kept with the items when they are reused in the next frame.
+   * @param[in] culledCount The culled count.
+   */
+  void SetCulledCount( unsigned int culledCount )
+  {
+    mCulledCount = culledCount;
+  }
+
+  /**
+   * @return the number of renderables which were culled when the items were added
+   */
+  unsigned int GetCulledCount() const
+  {
+    return mCulledCount;
+  }
+
   /**
    * Set if the RenderList contains color RenderItems
    * @param[in] hasColorRenderItems True if it contains color RenderItems, false otherwise
@@ -322,6 +361,8 @@ private:
 
   ClippingBox* mClippingBox;               ///< The clipping box, in window coordinates, when clipping is enabled
   Layer*       mSourceLayer;              ///< The originating layer where the renderers are from
+  const Layer* mCachedLayer;              ///< The layer whose render cache the items are drawn into, or NULL
+  unsigned int mCulledCount;              ///< The number of renderables culled when the items were added
   bool         mHasColorRenderItems : 1;  ///< True if list contains color render items
 };
 
@@ -18,14 +18,19 @@
 // CLASS HEADER
 #include <dali/internal/render/common/render-manager.h>
 
+// EXTERNAL INCLUDES
+#include <cmath>
+
 // INTERNAL INCLUDES
 #include <dali/public-api/actors/sampling.h>
 #include <dali/public-api/common/dali-common.h>
 #include <dali/public-api/common/stage.h>
+#include <dali/public-api/math/math-utils.h>
 #include <dali/public-api/render-tasks/render-task.h>
 #include <dali/integration-api/debug.h>
 #include <dali/integration-api/core.h>
 #include <dali/internal/common/owner-pointer.h>
+#include <dali/internal/render/common/layer-cache.h>
 #include <dali/internal/render/common/render-algorithms.h>
 #include <dali/internal/render/common/render-debug.h>
 #include <dali/internal/render/common/render-tracker.h>
@@ -86,6 +91,92 @@ typedef OwnerContainer< RenderTracker* >       RenderTrackerContainer;
 typedef RenderTrackerContainer::Iterator       RenderTrackerIter;
 typedef RenderTrackerContainer::ConstIterator  RenderTrackerConstIter;
 
+namespace
+{
+
+const unsigned int MAXIMUM_BUFFER_AGE = 3u; ///< The damage of this number of frames is kept, e.g. for triple buffering
+const int DAMAGE_MARGIN = 1;                ///< Pixels added around damaged regions, for filtering & rounding
+
+/**
+ * Retrieve the viewport of an on-screen instruction.
+ * @param[in] instruction The instruction.
+ * @param[in] surfaceRect The rectangle of the default surface.
+ * @return The viewport, with the lower-left corner at (0,0) as used by glViewport.
+ */
+Rect<int> GetOnscreenViewport( const RenderInstruction& instruction, const Rect<int>& surfaceRect )
+{
+  // Check whether a viewport is specified, otherwise the full surface size is used
+  if ( instruction.mIsViewportSet )
+  {
+    // For glViewport the lower-left corner is (0,0)
+    const int y = ( surfaceRect.height - instruction.mViewport.height ) - instruction.mViewport.y;
+    return Rect<int>( instruction.mViewport.x,  y, instruction.mViewport.width, instruction.mViewport.height );
+  }
+
+  return surfaceRect;
+}
+
+/**
+ * Extend a rectangle to include another.
+ */
+void Merge( Rect<int>& rect, const Rect<int>& other )
+{
+  if( other.IsEmpty() )
+  {
+    return;
+  }
+  if( rect.IsEmpty() )
+  {
+    rect = other;
+    return;
+  }
+
+  const int right = std::max( rect.x + rect.width, other.x + other.width );
+  const int top = std::max( rect.y + rect.height, other.y + other.height );
+  rect.x = std::min( rect.x, other.x );
+  rect.y = std::min( rect.y, other.y );
+  rect.width = right - rect.x;
+  rect.height = top - rect.y;
+}
+
+/**
+ * Clip a rectangle to another.
+ */
+void Clip( Rect<int>& rect, const Rect<int>& bounds )
+{
+  const int right = std::min( rect.x + rect.width, bounds.x + bounds.width );
+  const int top = std::min( rect.y + rect.height, bounds.y + bounds.height );
+  rect.x = std::max( rect.x, bounds.x );
+  rect.y = std::max( rect.y, bounds.y );
+  rect.width = std::max( right - rect.x, 0 );
+  rect.height = std::max( top - rect.y, 0 );
+}
+
+/**
+ * Convert a region in normalized device coordinates to window coordinates.
+ * @param[in] region The region (min x, min y, max x, max y).
+ * @param[in] viewport The viewport.
+ * @return The rectangle, including a margin.
+ */
+Rect<int> ToWindowRect( const Vector4& region, const Rect<int>& viewport )
+{
+  if( region.x > region.z || region.y > region.w )
+  {
+    return Rect<int>();
+  }
+
+  const float halfWidth = 0.5f * static_cast< float >( viewport.width );
+  const float halfHeight = 0.5f * static_cast< float >( viewport.height );
+  const int left = viewport.x + static_cast< int >( floorf( ( Clamp( region.x, -1.0f, 1.0f ) + 1.0f ) * halfWidth ) ) - DAMAGE_MARGIN;
+  const int bottom = viewport.y + static_cast< int >( floorf( ( Clamp( region.y, -1.0f, 1.0f ) + 1.0f ) * halfHeight ) ) - DAMAGE_MARGIN;
+  const int right = viewport.x + static_cast< int >( ceilf( ( Clamp( region.z, -1.0f, 1.0f ) + 1.0f ) * halfWidth ) ) + DAMAGE_MARGIN;
+  const int top = viewport.y + static_cast< int >( ceilf( ( Clamp( region.w, -1.0f, 1.0f ) + 1.0f ) * halfHeight ) ) + DAMAGE_MARGIN;
+
+  return Rect<int>( left, bottom, right - left, top - bottom );
+}
+
+} // unnamed namespace
+
 /**
  * Structure to contain internal data
  */
@@ -103,12 +194,15 @@ struct RenderManager::Impl
     frameCount( 0 ),
     renderBufferIndex( SceneGraphBuffers::INITIAL_UPDATE_BUFFER_INDEX ),
     defaultSurfaceRect(),
+    damageHistoryCount( 0u ),
+    pendingDamagedRect(),
     rendererContainer(),
     samplerContainer(),
     renderersAdded( false ),
     firstRenderCompleted( false ),
     defaultShader( NULL ),
-    programController( glAbstraction )
+    programController( glAbstraction ),
+    layerCache( context, programController )
   {
   }
 
@@ -135,6 +229,83 @@ struct RenderManager::Impl
     }
   }
 
+  /**
+   * Find the region of the default surface which changed since the previous frame, from the on-screen instructions.
+   * @return The damaged rectangle in window coordinates.
+   */
+  Rect<int> GetDamagedRect()
+  {
+    Rect<int> damagedRect( pendingDamagedRect );
+
+    const size_t count = instructions.Count( renderBufferIndex );
+    for ( size_t i = 0; i < count; ++i )
+    {
+      const RenderInstruction& instruction = instructions.At( renderBufferIndex, i );
+      if( 0u == instruction.mOffscreenTextureId )
+      {
+        if( instruction.mIsFullyDamaged )
+        {
+          return defaultSurfaceRect;
+        }
+        Merge( damagedRect, ToWindowRect( instruction.mDamagedRegion, GetOnscreenViewport( instruction, defaultSurfaceRect ) ) );
+      }
+    }
+
+    Clip( damagedRect, defaultSurfaceRect );
+    return damagedRect;
+  }
+
+  /**
+   * Find the region of the back buffer to redraw; this includes the damage since the buffer was last presented.
+   * @param[in] damagedRect The region which changed since the previous frame.
+   * @param[in] bufferAge The age of the back buffer, or zero if its contents are undefined.
+   * @return The rectangle to redraw.
+   */
+  Rect<int> GetRedrawRect( const Rect<int>& damagedRect, unsigned int bufferAge ) const
+  {
+    if( 0u == bufferAge || bufferAge > damageHistoryCount )
+    {
+      return defaultSurfaceRect;
+    }
+
+    Rect<int> redrawRect( damagedRect );
+    for( unsigned int i = 0u; i + 1u < bufferAge; ++i )
+    {
+      Merge( redrawRect, damageHistory[i] );
+    }
+    return redrawRect;
+  }
+
+  /**
+   * Keep the damage of a frame, after it is rendered.
+   * @param[in] damagedRect The region which changed since the previous frame.
+   * @param[in] presented Whether the frame will be presented; otherwise its damage is added to the next frame.
+   */
+  void AddDamageHistory( const Rect<int>& damagedRect, bool presented )
+  {
+    if( !presented )
+    {
+      pendingDamagedRect = damagedRect;
+      return;
+    }
+    pendingDamagedRect = Rect<int>();
+
+    for( unsigned int i = MAXIMUM_BUFFER_AGE - 1u; i > 0u; --i )
+    {
+      damageHistory[i] = damageHistory[i - 1u];
+    }
+    damageHistory[0] = damagedRect;
+    damageHistoryCount = std::min( damageHistoryCount + 1u, MAXIMUM_BUFFER_AGE );
+  }
+
+  /**
+   * Forget the damage of the previous frames, e.g. when the surface is resized; the next frames are fully redrawn.
+   */
+  void ResetDamageHistory()
+  {
+    damageHistoryCount = 0u;
+  }
+
   void UpdateTrackers()
   {
     for(RenderTrackerIter iter = mRenderTrackers.Begin(), end = mRenderTrackers.End(); iter != end; ++iter)
@@ -162,6 +333,10 @@ struct RenderManager::Impl
 
   Rect<int>                     defaultSurfaceRect;       ///< Rectangle for the default surface we are rendering to
 
+  Rect<int>                     damageHistory[ MAXIMUM_BUFFER_AGE ]; ///< The damaged rectangles of the last frames presented, latest first
+  unsigned int                  damageHistoryCount;       ///< The number of frames in damageHistory
+  Rect<int>                     pendingDamagedRect;       ///< The damage of a frame which was not presented
+
   RendererOwnerContainer        rendererContainer;        ///< List of owned renderers
   SamplerOwnerContainer         samplerContainer;         ///< List of owned samplers
   PropertyBufferOwnerContainer  propertyBufferContainer;  ///< List of owned property buffers
@@ -174,6 +349,7 @@ struct RenderManager::Impl
   bool                          firstRenderCompleted;     ///< False until the first render is done
   Shader*                       defaultShader;            ///< Default shader to use
   ProgramController             programController;        ///< Owner of the GL programs
+  Render::LayerCache            layerCache;               ///< The render caches of the layers
 };
 
 RenderManager* RenderManager::New( Integration::GlAbstraction& glAbstraction, ResourcePostProcessList& resourcePostProcessQ )
@@ -207,6 +383,7 @@ void RenderManager::ContextCreated()
 {
   mImpl->context.GlContextCreated();
   mImpl->programController.GlContextCreated();
+  mImpl->ResetDamageHistory();
 
   // renderers, textures and gpu buffers cannot reinitialize themselves
   // so they rely on someone reloading the data for them
@@ -219,6 +396,7 @@ void RenderManager::ContextDestroyed()
 
   mImpl->context.GlContextDestroyed();
   mImpl->programController.GlContextDestroyed();
+  mImpl->layerCache.GlContextDestroyed();
 
   // inform texture cache
   mImpl->textureCache.GlContextDestroyed(); // Clears gl texture ids
@@ -231,6 +409,12 @@ void RenderManager::ContextDestroyed()
     GlResourceOwner* renderer = *iter;
     renderer->GlContextDestroyed(); // Clear up vertex buffers
   }
+
+  // inform geometries
+  for( RenderGeometryOwnerIter iter = mImpl->renderGeometryContainer.Begin(); iter != mImpl->renderGeometryContainer.End(); ++iter )
+  {
+    (*iter)->GlContextDestroyed(); // Forget vertex array objects
+  }
 }
 
 void RenderManager::DispatchPostProcessRequest(ResourcePostProcessRequest& request)
@@ -243,6 +427,13 @@ void RenderManager::SetShaderSaver( ShaderSaver& upstream )
   mImpl->programController.SetShaderSaver( upstream );
 }
 
+void RenderManager::WarmUpProgram( Internal::ShaderDataPtr shaderData )
+{
+  // The program cache owns the program; using it loads the binary or compiles the sources
+  Program* program = Program::New( mImpl->programController, shaderData, false );
+  program->Use();
+}
+
 RenderInstructionContainer& RenderManager::GetRenderInstructionContainer()
 {
   return mImpl->instructions;
@@ -256,6 +447,17 @@ void RenderManager::SetBackgroundColor( const Vector4& color )
 void RenderManager::SetDefaultSurfaceRect(const Rect<int>& rect)
 {
   mImpl->defaultSurfaceRect = rect;
+  mImpl->ResetDamageHistory();
+}
+
+void RenderManager::SetTextureMemoryBudget( std::size_t budget )
+{
+  mImpl->textureCache.SetMemoryBudget( budget );
+}
+
+void RenderManager::SetTextureUploadBudget( std::size_t budget )
+{
+  mImpl->textureCache.SetUploadBudget( budget );
 }
 
 void RenderManager::AddRenderer( Render::Renderer* renderer )
@@ -451,12 +653,15 @@ bool RenderManager::Render( Integration::RenderStatus& status )
   DALI_ASSERT_DEBUG( mImpl->context.IsGlContextCreated() );
 
   status.SetHasRendered( false );
+  status.SetDamagedRect( Rect<int>() );
 
   // Increment the frame count at the beginning of each frame
   ++(mImpl->frameCount);
   mImpl->context.SetFrameCount(mImpl->frameCount);
   mImpl->context.ClearRendererCount();
   mImpl->context.ClearCulledCount();
+  mImpl->context.ClearBatchedCount();
+  mImpl->programController.ClearRedundantUniformCount();
 
   PERF_MONITOR_START(PerformanceMonitor::DRAW_NODES);
 
@@ -465,9 +670,18 @@ bool RenderManager::Render( Integration::RenderStatus& status )
   // Process messages queued during previous update
   mImpl->renderQueue.ProcessMessages( mImpl->renderBufferIndex );
 
+  // Continue uploading the textures which are spread over several frames
+  mImpl->textureCache.UploadPendingTextures();
+
   // No need to make any gl calls if we've done 1st glClear & don't have any renderers to render during startup.
   if( !mImpl->firstRenderCompleted || mImpl->renderersAdded )
   {
+    // Only the damage since the back buffer was last presented is redrawn, if its age is known
+    const Rect<int> damagedRect = mImpl->GetDamagedRect();
+    const Rect<int> redrawRect = mImpl->GetRedrawRect( damagedRect, status.GetBufferAge() );
+    const bool partialRedraw = mImpl->firstRenderCompleted && ( redrawRect != mImpl->defaultSurfaceRect );
+    status.SetDamagedRect( damagedRect );
+
     // switch rendering to adaptor provided (default) buffer
     mImpl->context.BindFramebuffer( GL_FRAMEBUFFER, 0 );
 
@@ -487,7 +701,8 @@ bool RenderManager::Render( Integration::RenderStatus& status )
     // It is important to clear all 3 buffers, for performance on deferred renderers like Mali
     // e.g. previously when the depth & stencil buffers were NOT cleared, it caused the DDK to exceed a "vertex count limit",
     // and then stall. That problem is only noticeable when rendering a large number of vertices per frame.
-    mImpl->context.SetScissorTest( false );
+    // For a partial redraw, the buffers are cleared & drawn within the redrawn region only.
+    mImpl->context.SetRenderRegion( partialRedraw ? &redrawRect : NULL );
     mImpl->context.ColorMask( true );
     mImpl->context.DepthMask( true );
     mImpl->context.StencilMask( 0xFF ); // 8 bit stencil mask, all 1's
@@ -505,7 +720,17 @@ bool RenderManager::Render( Integration::RenderStatus& status )
       {
         RenderInstruction& instruction = mImpl->instructions.At( mImpl->renderBufferIndex, i );
 
-        DoRender( instruction, *mImpl->defaultShader );
+        if( 0u != instruction.mOffscreenTextureId )
+        {
+          // The damage of the default surface does not apply to off-screen targets, which are always drawn in full
+          mImpl->context.SetRenderRegion( NULL );
+          DoRender( instruction, *mImpl->defaultShader );
+        }
+        else if( !partialRedraw || !redrawRect.IsEmpty() ) // Nothing needs to be drawn on-screen if nothing changed
+        {
+          mImpl->context.SetRenderRegion( partialRedraw ? &redrawRect : NULL );
+          DoRender( instruction, *mImpl->defaultShader );
+        }
 
         const RenderListContainer::SizeType countRenderList = instruction.RenderListCount();
         if ( countRenderList > 0 )
@@ -513,6 +738,12 @@ bool RenderManager::Render( Integration::RenderStatus& status )
           status.SetHasRendered( true );
         }
       }
+
+      if( !partialRedraw || !redrawRect.IsEmpty() )
+      {
+        // The caches of the layers which are no longer drawn are released
+        mImpl->layerCache.ReleaseUnusedCaches();
+      }
       GLenum attachments[] = { GL_DEPTH, GL_STENCIL };
       mImpl->context.InvalidateFramebuffer(GL_FRAMEBUFFER, 2, attachments);
 
@@ -520,13 +751,22 @@ bool RenderManager::Render( Integration::RenderStatus& status )
 
       mImpl->firstRenderCompleted = true;
     }
+
+    mImpl->context.SetRenderRegion( NULL );
+    mImpl->AddDamageHistory( damagedRect, status.HasRendered() );
   }
 
+  // Now the textures used by this frame are known, keep the rest within the memory budget
+  mImpl->textureCache.EvictUnusedTextures();
+
   PERF_MONITOR_END(PerformanceMonitor::DRAW_NODES);
 
   // check if anything has been posted to the update thread
   bool updateRequired = !mImpl->resourcePostProcessQueue[ mImpl->renderBufferIndex ].empty();
 
+  // keep rendering until the textures being uploaded over several frames are complete
+  updateRequired = updateRequired || mImpl->textureCache.HasPendingUploads();
+
   //Notify RenderGeometries that rendering has finished
   for ( RenderGeometryOwnerIter iter = mImpl->renderGeometryContainer.Begin(); iter != mImpl->renderGeometryContainer.End(); ++iter )
   {
@@ -544,6 +784,8 @@ bool RenderManager::Render( Integration::RenderStatus& status )
 
   DALI_PRINT_RENDERER_COUNT(mImpl->frameCount, mImpl->context.GetRendererCount());
   DALI_PRINT_CULL_COUNT(mImpl->frameCount, mImpl->context.GetCulledCount());
+  DALI_PRINT_BATCHED_COUNT(mImpl->frameCount, mImpl->context.GetBatchedCount());
+  DALI_PRINT_REDUNDANT_UNIFORM_COUNT(mImpl->frameCount, mImpl->programController.GetRedundantUniformCount());
 
   return updateRequired;
 }
@@ -595,17 +837,7 @@ void RenderManager::DoRender( RenderInstruction& instruction, Shader& defaultSha
     // switch rendering to adaptor provided (default) buffer
     mImpl->context.BindFramebuffer( GL_FRAMEBUFFER, 0 );
 
-    // Check whether a viewport is specified, otherwise the full surface size is used
-    if ( instruction.mIsViewportSet )
-    {
-      // For glViewport the lower-left corner is (0,0)
-      const int y = ( mImpl->defaultSurfaceRect.height - instruction.mViewport.height ) - instruction.mViewport.y;
-      viewportRect.Set( instruction.mViewport.x,  y, instruction.mViewport.width, instruction.mViewport.height );
-    }
-    else
-    {
-      viewportRect = mImpl->defaultSurfaceRect;
-    }
+    viewportRect = GetOnscreenViewport( instruction, mImpl->defaultSurfaceRect );
   }
 
   mImpl->context.Viewport(viewportRect.x, viewportRect.y, viewportRect.width, viewportRect.height);
@@ -629,6 +861,7 @@ void RenderManager::DoRender( RenderInstruction& instruction, Shader& defaultSha
                                     mImpl->context,
                                     mImpl->textureCache,
                                     defaultShader,
+                                    mImpl->layerCache,
                                     mImpl->renderBufferIndex );
 
   if(instruction.mOffscreenTextureId != 0)
@@ -117,6 +117,12 @@ public:
    */
   void SetShaderSaver( ShaderSaver& upstream );
 
+  /**
+   * Create & link a program ahead of its first use, e.g. from a shader binary listed for warm-up.
+   * @param[in] shaderData Source code, hash over source, and optional compiled binary for the shader program
+   */
+  void WarmUpProgram( Internal::ShaderDataPtr shaderData );
+
   /**
    * Retrieve the render instructions; these should be set during each "update" traversal.
    * @return The render instruction container.
@@ -143,6 +149,18 @@ public:
    */
   void SetDefaultSurfaceRect( const Rect<int>& rect );
 
+  /**
+   * Set the GPU memory budget of the bitmap textures.
+   * @param[in] budget The budget in bytes, or zero for no budget.
+   */
+  void SetTextureMemoryBudget( std::size_t budget );
+
+  /**
+   * Set the number of bytes of new bitmaps uploaded per frame.
+   * @param[in] budget The budget in bytes, or zero to upload each bitmap as a whole.
+   */
+  void SetTextureUploadBudget( std::size_t budget );
+
   /**
    * Add a Renderer to the render manager.
    * @param[in] renderer The renderer to add.
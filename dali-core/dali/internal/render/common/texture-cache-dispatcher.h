@@ -168,6 +168,14 @@ public:
    */
   virtual void DispatchDiscardTexture( ResourceId id ) = 0;
 
+  /**
+   * Dispatch a message to mark a texture as reloadable; its resource can be loaded again, so
+   * the texture may be evicted even when its pixels have been discarded.
+   * May be called from Update thread
+   * @param[in] id Resource Id of the texture
+   */
+  virtual void DispatchSetTextureReloadable( ResourceId id ) = 0;
+
 protected:
 
   RenderQueue&             mRenderQueue;
@@ -32,6 +32,15 @@ struct Vertex2D
   float mV;
 };
 
+struct Vertex3D
+{
+  float mX;
+  float mY;
+  float mZ;
+  float mU;
+  float mV;
+};
+
 } // namespace Internal
 
 } // namespace Dali
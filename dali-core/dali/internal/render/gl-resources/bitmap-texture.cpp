@@ -18,6 +18,9 @@
 // CLASS HEADER
 #include <dali/internal/render/gl-resources/bitmap-texture.h>
 
+// EXTERNAL INCLUDES
+#include <algorithm>
+
 // INTERNAL INCLUDES
 #include <dali/integration-api/debug.h>
 #include <dali/internal/render/common/vertex.h>
@@ -44,7 +47,8 @@ BitmapTexture::BitmapTexture(
   mBitmap(bitmap),
   mClearPixels(false),
   mDiscardPolicy(policy),
-  mPixelFormat(bitmap->GetPixelFormat())
+  mPixelFormat(bitmap->GetPixelFormat()),
+  mUploadedRows(0u)
 {
   DALI_LOG_TRACE_METHOD(Debug::Filter::gImage);
   DALI_LOG_SET_OBJECT_STRING(this, DALI_LOG_GET_OBJECT_STRING(bitmap));
@@ -63,7 +67,8 @@ BitmapTexture::BitmapTexture(
   mBitmap(NULL),
   mClearPixels(clearPixels),
   mDiscardPolicy(policy),
-  mPixelFormat( pixelFormat )
+  mPixelFormat( pixelFormat ),
+  mUploadedRows(0u)
 {
   DALI_LOG_TRACE_METHOD(Debug::Filter::gImage);
 }
@@ -368,6 +373,74 @@ unsigned int BitmapTexture::GetHeight() const
   return height;
 }
 
+size_t BitmapTexture::GetMemorySize() const
+{
+  size_t size = 0u;
+  if( mId != 0 )
+  {
+    size = static_cast< size_t >( mWidth ) * mHeight * Pixel::GetBytesPerPixel( mPixelFormat );
+  }
+  return size;
+}
+
+size_t BitmapTexture::UploadRows( size_t budget )
+{
+  const unsigned char* pixels = mBitmap ? mBitmap->GetBuffer() : NULL;
+  if( NULL == pixels )
+  {
+    // Nothing left to upload, e.g. the bitmap was updated & uploaded as a whole
+    mUploadedRows = mHeight;
+    return 0u;
+  }
+
+  GLenum pixelFormat = GL_RGBA;
+  GLenum pixelDataType = GL_UNSIGNED_BYTE;
+  Integration::ConvertToGlFormat( mPixelFormat, pixelDataType, pixelFormat );
+
+  mContext.ActiveTexture( TEXTURE_UNIT_UPLOAD );
+  if( mId == 0 )
+  {
+    // Allocate the texture, then fill it a band at a time; also restarts the upload after a context loss
+    mContext.GenTextures( 1, &mId );
+    mContext.Bind2dTexture( mId );
+    mContext.PixelStorei( GL_UNPACK_ALIGNMENT, 1 ); // We always use tightly packed data
+    mContext.TexImage2D( GL_TEXTURE_2D, 0, pixelFormat, mWidth, mHeight, 0, pixelFormat, pixelDataType, NULL );
+    mContext.TexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE );
+    mContext.TexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE );
+    mUploadedRows = 0u;
+  }
+  else
+  {
+    mContext.Bind2dTexture( mId );
+    mContext.PixelStorei( GL_UNPACK_ALIGNMENT, 1 );
+  }
+
+  const size_t rowSize = static_cast< size_t >( mWidth ) * Pixel::GetBytesPerPixel( mPixelFormat );
+  unsigned int rowCount = mHeight - mUploadedRows;
+  if( rowSize > 0u && budget / rowSize < rowCount )
+  {
+    rowCount = std::max( static_cast< unsigned int >( budget / rowSize ), 1u );
+  }
+
+  mContext.TexSubImage2D( GL_TEXTURE_2D, 0, 0, mUploadedRows, mWidth, rowCount, pixelFormat, pixelDataType, pixels + mUploadedRows * rowSize );
+  mUploadedRows += rowCount;
+
+  INCREASE_BY( PerformanceMonitor::TEXTURE_DATA_UPLOADED, rowCount * rowSize );
+
+  if( mUploadedRows >= mHeight )
+  {
+    // If the resource policy is to discard on upload then release buffer
+    DiscardBitmapBuffer();
+  }
+
+  return rowCount * rowSize;
+}
+
+bool BitmapTexture::IsUploadComplete() const
+{
+  return mUploadedRows >= mHeight;
+}
+
 void BitmapTexture::DiscardBitmapBuffer()
 {
   DALI_LOG_INFO(Debug::Filter::gImage, Debug::General, "BitmapTexture::DiscardBitmapBuffer() DiscardPolicy: %s\n", mDiscardPolicy == ResourcePolicy::OWNED_DISCARD?"DISCARD":"RETAIN");
@@ -79,6 +79,26 @@ public:
    */
   Integration::Bitmap* GetBitmap() { return mBitmap.Get(); }
 
+  /**
+   * Retrieve the GPU memory used by the texture
+   * @return The size of the GL texture in bytes, or zero if it has not been created
+   */
+  size_t GetMemorySize() const;
+
+  /**
+   * Upload the next band of rows of the bitmap, creating the GL texture before the first band.
+   * Used to spread the upload of a large bitmap over several frames.
+   * @param[in] budget The number of bytes to upload; at least one row is uploaded.
+   * @return The number of bytes uploaded.
+   */
+  size_t UploadRows( size_t budget );
+
+  /**
+   * Query whether all the rows of the bitmap have been uploaded by UploadRows()
+   * @return true if the upload is complete, or there are no pixels to upload.
+   */
+  bool IsUploadComplete() const;
+
 public:
 
   /**
@@ -168,6 +188,7 @@ private:
   bool                        mClearPixels:1;   ///< true if initial texture should be cleared on creation
   ResourcePolicy::Discardable mDiscardPolicy:2; ///< The bitmap discard policy
   Pixel::Format               mPixelFormat:5;   ///< Pack pixel format into bitfield
+  unsigned int                mUploadedRows;    ///< The number of rows uploaded by UploadRows()
 
   // Changes scope, should be at end of class
   DALI_LOG_OBJECT_STRING_DECLARATION;
@@ -81,6 +81,7 @@ Context::Context(Integration::GlAbstraction& glAbstraction)
   mBoundArrayBufferId(0),
   mBoundElementArrayBufferId(0),
   mBoundTransformFeedbackBufferId(0),
+  mBoundVertexArrayId(0),
   mActiveTextureUnit( TEXTURE_UNIT_LAST ),
   mBlendColor(Color::TRANSPARENT),
   mBlendFuncSeparateSrcRGB(GL_ONE),
@@ -93,9 +94,13 @@ Context::Context(Integration::GlAbstraction& glAbstraction)
   mClearColor(Color::WHITE),    // initial color, never used until it's been set by the user
   mCullFaceMode(CullNone),
   mViewPort( 0, 0, 0, 0 ),
+  mRenderRegion( 0, 0, 0, 0 ),
+  mIsRenderRegionSet( false ),
+  mScissorBoxIsRegion( false ),
   mFrameCount( 0 ),
   mCulledCount( 0 ),
-  mRendererCount( 0 )
+  mRendererCount( 0 ),
+  mBatchedCount( 0 )
 {
 }
 
@@ -144,6 +149,12 @@ const Rect< int >& Context::GetViewport()
 
 void Context::FlushVertexAttributeLocations()
 {
+  if( mBoundVertexArrayId != 0 )
+  {
+    // The vertex array object holds its own attribute enables; the cache is for the default object
+    return;
+  }
+
   for( unsigned int i = 0; i < MAX_ATTRIBUTE_CACHE_SIZE; ++i )
   {
     // see if our cached state is different to the actual state
@@ -171,7 +182,7 @@ void Context::FlushVertexAttributeLocations()
 void Context::SetVertexAttributeLocation(unsigned int location, bool state)
 {
 
-  if( location >= MAX_ATTRIBUTE_CACHE_SIZE )
+  if( location >= MAX_ATTRIBUTE_CACHE_SIZE || mBoundVertexArrayId != 0 )
   {
     // not cached, make the gl call through context
     if ( state )
@@ -245,11 +256,21 @@ void Context::ResetGlState()
   mGlAbstraction.Disable(GL_SAMPLE_COVERAGE);
 
   mScissorTestEnabled = false;
+  mIsRenderRegionSet = false;
+  mScissorBoxIsRegion = false;
   mGlAbstraction.Disable(GL_SCISSOR_TEST);
 
   mStencilBufferEnabled = false;
   mGlAbstraction.Disable(GL_STENCIL_TEST);
 
+  // The element array buffer binding below is for the default vertex array object
+  mBoundVertexArrayId = 0;
+  if( mGlAbstraction.IsVertexArrayObjectSupported() )
+  {
+    LOG_GL("BindVertexArray 0\n");
+    mGlAbstraction.BindVertexArray( mBoundVertexArrayId );
+  }
+
   mBoundArrayBufferId = 0;
   LOG_GL("BindBuffer GL_ARRAY_BUFFER 0\n");
   mGlAbstraction.BindBuffer(GL_ARRAY_BUFFER, mBoundArrayBufferId);
@@ -184,8 +184,14 @@ public:
    */
   void BindElementArrayBuffer(GLuint buffer)
   {
+    if( mBoundVertexArrayId != 0 )
+    {
+      // The binding is part of the vertex array object's state; not cached
+      LOG_GL("BindBuffer GL_ELEMENT_ARRAY_BUFFER %d\n", buffer);
+      CHECK_GL( mGlAbstraction, mGlAbstraction.BindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer) );
+    }
     // Avoid unecessary calls to BindBuffer
-    if (mBoundElementArrayBufferId!= buffer)
+    else if (mBoundElementArrayBufferId!= buffer)
     {
       mBoundElementArrayBufferId = buffer;
 
@@ -253,6 +259,23 @@ public:
     CHECK_GL( mGlAbstraction, mGlAbstraction.BindTransformFeedback(target, id) );
   }
 
+  /**
+   * Wrapper for OpenGL ES 3.0 glBindVertexArray()
+   * While a vertex array object other than zero is bound, the vertex attribute enables & the element
+   * array buffer binding are set on that object directly; the cached state is for the default object.
+   */
+  void BindVertexArray(GLuint array)
+  {
+    // Avoid unecessary calls to BindVertexArray
+    if( mBoundVertexArrayId != array )
+    {
+      mBoundVertexArrayId = array;
+
+      LOG_GL("BindVertexArray %d\n", array);
+      CHECK_GL( mGlAbstraction, mGlAbstraction.BindVertexArray(array) );
+    }
+  }
+
   /**
    * Helper to bind texture for rendering. If given texture is
    * already bound in the given textureunit, this method does nothing.
@@ -659,6 +682,28 @@ public:
     CHECK_GL( mGlAbstraction, mGlAbstraction.DeleteTransformFeedbacks(n, ids) );
   }
 
+  /**
+   * Wrapper for OpenGL ES 3.0 glDeleteVertexArrays()
+   */
+  void DeleteVertexArrays(GLsizei n, const GLuint* arrays)
+  {
+    // Vertex array objects are released with the context
+    if( this->IsGlContextCreated() )
+    {
+      LOG_GL("DeleteVertexArrays %d %p\n", n, arrays);
+      CHECK_GL( mGlAbstraction, mGlAbstraction.DeleteVertexArrays(n, arrays) );
+    }
+
+    // Deleting the bound object reverts the binding to zero
+    for( GLsizei i = 0; i < n; ++i )
+    {
+      if( arrays[i] == mBoundVertexArrayId )
+      {
+        mBoundVertexArrayId = 0;
+      }
+    }
+  }
+
   /**
    * Wrapper for OpenGL ES 2.0 glDepthFunc()
    */
@@ -786,6 +831,15 @@ public:
     CHECK_GL( mGlAbstraction, mGlAbstraction.GenTransformFeedbacks(n, ids) );
   }
 
+  /**
+   * Wrapper for OpenGL ES 3.0 glGenVertexArrays()
+   */
+  void GenVertexArrays(GLsizei n, GLuint* arrays)
+  {
+    LOG_GL("GenVertexArrays %d %p\n", n, arrays);
+    CHECK_GL( mGlAbstraction, mGlAbstraction.GenVertexArrays(n, arrays) );
+  }
+
   /**
    * @return the current buffer bound for a given target
    */
@@ -827,6 +881,15 @@ public:
     SetVertexAttributeLocation( location, false);
   }
 
+  /**
+   * Wrapper for OpenGL ES 2.0 glVertexAttrib4fv()
+   */
+  void VertexAttrib4fv( GLuint index, const GLfloat* values )
+  {
+    LOG_GL("VertexAttrib4fv(%d, %p)\n", index, values );
+    CHECK_GL( mGlAbstraction, mGlAbstraction.VertexAttrib4fv( index, values ) );
+  }
+
   /**
    * Wrapper for OpenGL ES 3.0 glVertexAttribDivisor()
    */
@@ -1013,6 +1076,18 @@ public:
    */
   void SetScissorTest(bool enable)
   {
+    if( mIsRenderRegionSet )
+    {
+      // The scissor test remains enabled, to restrict rendering to the region
+      if( !enable && !mScissorBoxIsRegion )
+      {
+        LOG_GL("Scissor %d %d %d %d\n", mRenderRegion.x, mRenderRegion.y, mRenderRegion.width, mRenderRegion.height);
+        CHECK_GL( mGlAbstraction, mGlAbstraction.Scissor( mRenderRegion.x, mRenderRegion.y, mRenderRegion.width, mRenderRegion.height ) );
+        mScissorBoxIsRegion = true;
+      }
+      enable = true;
+    }
+
     // Avoid unecessary calls to glEnable/glDisable
     if (enable != mScissorTestEnabled)
     {
@@ -1031,6 +1106,33 @@ public:
     }
   }
 
+  /**
+   * Restrict rendering to a region of the framebuffer, e.g. the part of the surface which is redrawn.
+   * While a region is set, the scissor test remains enabled, and scissor boxes are clipped to the region.
+   * The scissor test is then disabled, apart from the region.
+   * @param[in] region The region in window coordinates, or NULL to render to the whole framebuffer.
+   */
+  void SetRenderRegion( const Rect<int>* region )
+  {
+    mIsRenderRegionSet = ( NULL != region );
+    if( mIsRenderRegionSet )
+    {
+      mRenderRegion = *region;
+    }
+    mScissorBoxIsRegion = false;
+
+    SetScissorTest( false );
+  }
+
+  /**
+   * Retrieve the region rendering is restricted to.
+   * @return The region in window coordinates, or NULL if the whole framebuffer is rendered to.
+   */
+  const Rect<int>* GetRenderRegion() const
+  {
+    return mIsRenderRegionSet ? &mRenderRegion : NULL;
+  }
+
   /**
    * This method replaces glEnable(GL_STENCIL_TEST) and glDisable(GL_STENCIL_TEST).
    * Note GL_STENCIL_TEST means enable the stencil buffer for writing and or testing.
@@ -1460,6 +1562,18 @@ public:
    */
   void Scissor(GLint x, GLint y, GLsizei width, GLsizei height)
   {
+    if( mIsRenderRegionSet )
+    {
+      // Clip the box to the render region
+      const GLint right = std::min( x + width, mRenderRegion.x + mRenderRegion.width );
+      const GLint top = std::min( y + height, mRenderRegion.y + mRenderRegion.height );
+      x = std::max( x, mRenderRegion.x );
+      y = std::max( y, mRenderRegion.y );
+      width = std::max( right - x, 0 );
+      height = std::max( top - y, 0 );
+      mScissorBoxIsRegion = false;
+    }
+
     LOG_GL("Scissor %d %d %d %d\n", x, y, width, height);
     CHECK_GL( mGlAbstraction, mGlAbstraction.Scissor(x, y, width, height) );
   }
@@ -1636,6 +1750,24 @@ public:
     return mMaxTextureSize;
   }
 
+  /**
+   * Query whether instanced drawing is supported by the GL implementation.
+   * @return True if DrawArraysInstanced(), DrawElementsInstanced() & VertexAttribDivisor() can be used.
+   */
+  bool IsInstancedDrawingSupported()
+  {
+    return mGlAbstraction.IsInstancedDrawingSupported();
+  }
+
+  /**
+   * Query whether vertex array objects are supported by the GL implementation.
+   * @return True if GenVertexArrays(), BindVertexArray() & DeleteVertexArrays() can be used.
+   */
+  bool IsVertexArrayObjectSupported()
+  {
+    return mGlAbstraction.IsVertexArrayObjectSupported();
+  }
+
   /**
    * Get the current viewport.
    * @return Viewport rectangle.
@@ -1666,6 +1798,15 @@ public:
     mCulledCount++;
   }
 
+  /**
+   * Increase the count of culled renderers
+   * @param[in] count The number of renderers culled
+   */
+  inline void IncrementCulledCount( unsigned int count )
+  {
+    mCulledCount += count;
+  }
+
   /**
    * Clear the count of culled renderers
    */
@@ -1706,6 +1847,31 @@ public:
     return mRendererCount;
   }
 
+  /**
+   * Increase the count of draw calls saved by batching
+   * @param[in] count The number of renderers drawn by the draw call of another renderer
+   */
+  inline void IncrementBatchedCount( unsigned int count )
+  {
+    mBatchedCount += count;
+  }
+
+  /**
+   * Clear the count of draw calls saved by batching
+   */
+  inline void ClearBatchedCount()
+  {
+    mBatchedCount = 0;
+  }
+
+  /**
+   * Get the count of draw calls saved by batching in this frame
+   */
+  inline unsigned int GetBatchedCount()
+  {
+    return mBatchedCount;
+  }
+
 private: // Implementation
 
   /**
@@ -1773,6 +1939,9 @@ private: // Data
   GLuint mBoundElementArrayBufferId; ///< The ID passed to glBindBuffer(GL_ELEMENT_ARRAY_BUFFER)
   GLuint mBoundTransformFeedbackBufferId; ///< The ID passed to glBindBuffer(GL_TRANSFORM_FEEDBACK_BUFFER)
 
+  // glBindVertexArray() state
+  GLuint mBoundVertexArrayId;        ///< The ID passed to glBindVertexArray()
+
   // glBindTexture() state
   TextureUnit mActiveTextureUnit;
   GLuint mBound2dTextureId[ MAX_TEXTURE_UNITS ];  ///< The ID passed to glBindTexture(GL_TEXTURE_2D)
@@ -1799,6 +1968,11 @@ private: // Data
   // cached viewport size
   Rect< int > mViewPort;
 
+  // render region, within which the scissor test is always enabled
+  Rect< int > mRenderRegion;
+  bool mIsRenderRegionSet;   ///< Whether rendering is restricted to mRenderRegion
+  bool mScissorBoxIsRegion;  ///< Whether the scissor box was last set to mRenderRegion
+
   // Vertex Attribute Buffer enable caching
   bool mVertexAttributeCachedState[ MAX_ATTRIBUTE_CACHE_SIZE ];    ///< Value cache for Enable Vertex Attribute
   bool mVertexAttributeCurrentState[ MAX_ATTRIBUTE_CACHE_SIZE ];   ///< Current state on the driver for Enable Vertex Attribute
@@ -1806,6 +1980,7 @@ private: // Data
   unsigned int mFrameCount;       ///< Number of render frames
   unsigned int mCulledCount;      ///< Number of culled renderers per frame
   unsigned int mRendererCount;    ///< Number of image renderers per frame
+  unsigned int mBatchedCount;     ///< Number of draw calls saved by batching per frame
   FrameBufferStateCache mFrameBufferStateCache;   ///< frame buffer state cache
 };
 
@@ -17,6 +17,9 @@
 
 #include <dali/internal/render/gl-resources/texture-cache.h>
 
+#include <algorithm>
+#include <limits>
+
 #include <dali/integration-api/bitmap.h>
 
 #include <dali/internal/update/resources/resource-manager-declarations.h>
@@ -59,6 +62,15 @@ namespace SceneGraph
 namespace
 {
 
+/**
+ * Textures bound within this many frames are not evicted, even when over the memory budget;
+ * about a second at 60 frames per second.
+ */
+const unsigned int RECENTLY_USED_FRAME_COUNT = 60u;
+
+typedef std::pair< unsigned int, ResourceId > EvictionCandidate; ///< The number of frames since a texture was used, and its Id
+typedef std::vector< EvictionCandidate >      EvictionCandidates;
+
 /**
  * @brief Forward to all textures in container the news that the GL Context is down.
  */
@@ -80,7 +92,12 @@ TextureCache::TextureCache( RenderQueue& renderQueue,
 : TextureCacheDispatcher(renderQueue),
   mPostProcessResourceDispatcher(postProcessResourceDispatcher),
   mContext(context),
-  mDiscardBitmapsPolicy(ResourcePolicy::OWNED_DISCARD)
+  mDiscardBitmapsPolicy(ResourcePolicy::OWNED_DISCARD),
+  mTextureUsage(),
+  mMemoryStatistics(),
+  mMemoryBudget( 0u ),
+  mPendingUploads(),
+  mUploadBudget( 0u )
 {
 }
 
@@ -98,6 +115,7 @@ void TextureCache::CreateTexture( ResourceId        id,
 
   Texture* texture = TextureFactory::NewBitmapTexture(width, height, pixelFormat, clearPixels, mContext, GetDiscardBitmapsPolicy() );
   mTextures.insert(TexturePair(id, texture));
+  AddTextureUsage( id, texture );
 }
 
 void TextureCache::AddBitmap(ResourceId id, Integration::BitmapPtr bitmap)
@@ -106,6 +124,24 @@ void TextureCache::AddBitmap(ResourceId id, Integration::BitmapPtr bitmap)
 
   Texture* texture = TextureFactory::NewBitmapTexture(bitmap.Get(), mContext, GetDiscardBitmapsPolicy());
   mTextures.insert(TexturePair(id, texture));
+  AddTextureUsage( id, texture );
+
+  if( mUploadBudget > 0u && texture )
+  {
+    if( dynamic_cast< BitmapTexture* >( texture ) )
+    {
+      // Spread the upload over the next frames rather than uploading it all when first drawn
+      mPendingUploads.push_back( id );
+    }
+    else
+    {
+      // e.g. compressed textures, which cannot be uploaded a band at a time
+      texture->CreateGlTexture();
+
+      ResourcePostProcessRequest ppRequest( id, ResourcePostProcessRequest::UPLOADED );
+      mPostProcessResourceDispatcher.DispatchPostProcessRequest(ppRequest);
+    }
+  }
 }
 
 void TextureCache::AddNativeImage(ResourceId id, NativeImageInterfacePtr nativeImage)
@@ -148,6 +184,7 @@ void TextureCache::CreateGlTexture( ResourceId id )
     if( texturePtr )
     {
       texturePtr->CreateGlTexture();
+      UpdateMemorySize( id );
     }
   }
 }
@@ -164,6 +201,7 @@ void TextureCache::UpdateTexture( ResourceId id, Integration::BitmapPtr bitmap )
     if( texturePtr )
     {
       texturePtr->Update( bitmap.Get() );
+      UpdateMemorySize( id );
 
       ResourcePostProcessRequest ppRequest( id, ResourcePostProcessRequest::UPLOADED );
       mPostProcessResourceDispatcher.DispatchPostProcessRequest(ppRequest);
@@ -183,6 +221,13 @@ void TextureCache::UpdateTexture( ResourceId id, Integration::BitmapPtr bitmap,
     {
       texturePtr->Update( bitmap.Get(), xOffset, yOffset );
 
+      TextureUsageIter usageIter = mTextureUsage.find( id );
+      if( usageIter != mTextureUsage.end() )
+      {
+        usageIter->second.modified = true;
+        UpdateMemorySize( usageIter->second );
+      }
+
       ResourcePostProcessRequest ppRequest( id, ResourcePostProcessRequest::UPLOADED );
       mPostProcessResourceDispatcher.DispatchPostProcessRequest(ppRequest);
     }
@@ -239,6 +284,15 @@ void TextureCache::DiscardTexture( ResourceId id )
       }
       mTextures.erase(iter);
       deleted = true;
+
+      mPendingUploads.erase( std::remove( mPendingUploads.begin(), mPendingUploads.end(), id ), mPendingUploads.end() );
+
+      TextureUsageIter usageIter = mTextureUsage.find( id );
+      if( usageIter != mTextureUsage.end() )
+      {
+        mMemoryStatistics.residentBytes -= usageIter->second.size;
+        mTextureUsage.erase( usageIter );
+      }
     }
   }
 
@@ -290,6 +344,31 @@ void TextureCache::BindTexture( Texture *texture, ResourceId id, GLenum target,
     ResourcePostProcessRequest ppRequest( id, ResourcePostProcessRequest::UPLOADED );
     mPostProcessResourceDispatcher.DispatchPostProcessRequest(ppRequest);
   }
+
+  TextureUsageIter usageIter = mTextureUsage.find( id );
+  if( usageIter != mTextureUsage.end() )
+  {
+    TextureUsage& usage = usageIter->second;
+    usage.lastUsedFrame = mContext.GetFrameCount();
+
+    if( created )
+    {
+      UpdateMemorySize( usage );
+      if( usage.evicted )
+      {
+        usage.evicted = false;
+        usage.reloadRequested = false;
+        ++mMemoryStatistics.reloadCount;
+      }
+    }
+    else if( usage.evicted && !usage.reloadRequested && texture->GetTextureId() == 0 )
+    {
+      // The pixels were discarded, so the texture can only be created again once the resource has been reloaded
+      usage.reloadRequested = true;
+      ResourcePostProcessRequest ppRequest( id, ResourcePostProcessRequest::RELOAD );
+      mPostProcessResourceDispatcher.DispatchPostProcessRequest(ppRequest);
+    }
+  }
 }
 
 Texture* TextureCache::GetTexture(ResourceId id)
@@ -412,6 +491,16 @@ void TextureCache::GlContextDestroyed()
 {
   SceneGraph::GlContextDestroyed( mTextures );
   SceneGraph::GlContextDestroyed( mFramebufferTextures );
+
+  // The textures are restored by reloading all the images, rather than on their next use
+  for( TextureUsageIter iter = mTextureUsage.begin(); iter != mTextureUsage.end(); ++iter )
+  {
+    TextureUsage& usage = iter->second;
+    usage.size = 0u;
+    usage.evicted = false;
+    usage.reloadRequested = false;
+  }
+  mMemoryStatistics.residentBytes = 0u;
 }
 
 void TextureCache::SetDiscardBitmapsPolicy( ResourcePolicy::Discardable policy )
@@ -426,6 +515,159 @@ ResourcePolicy::Discardable TextureCache::GetDiscardBitmapsPolicy()
   return mDiscardBitmapsPolicy;
 }
 
+void TextureCache::SetTextureReloadable( ResourceId id )
+{
+  TextureUsageIter usageIter = mTextureUsage.find( id );
+  if( usageIter != mTextureUsage.end() )
+  {
+    usageIter->second.reloadable = true;
+  }
+}
+
+void TextureCache::SetMemoryBudget( std::size_t budget )
+{
+  DALI_LOG_INFO( gTextureCacheFilter, Debug::General, "TextureCache::SetMemoryBudget(%u)\n", static_cast< unsigned int >( budget ) );
+  mMemoryBudget = budget;
+}
+
+void TextureCache::EvictUnusedTextures()
+{
+  if( mMemoryBudget == 0u || mMemoryStatistics.residentBytes <= mMemoryBudget )
+  {
+    return;
+  }
+
+  const unsigned int frameCount = mContext.GetFrameCount();
+
+  // Find the resident textures which were not used recently, and can be created again from their bitmap or resource
+  EvictionCandidates candidates;
+  for( TextureUsageIter iter = mTextureUsage.begin(); iter != mTextureUsage.end(); ++iter )
+  {
+    TextureUsage& usage = iter->second;
+    const unsigned int age = frameCount - usage.lastUsedFrame; // Correct even if the frame count has wrapped
+    if( usage.size > 0u && !usage.modified && age >= RECENTLY_USED_FRAME_COUNT &&
+        std::find( mPendingUploads.begin(), mPendingUploads.end(), iter->first ) == mPendingUploads.end() )
+    {
+      Integration::Bitmap* bitmap = usage.texture->GetBitmap();
+      if( bitmap && ( usage.reloadable || bitmap->GetBuffer() ) )
+      {
+        candidates.push_back( EvictionCandidate( age, iter->first ) );
+      }
+    }
+  }
+
+  // Evict the least recently used first
+  std::sort( candidates.begin(), candidates.end() );
+
+  for( EvictionCandidates::reverse_iterator iter = candidates.rbegin();
+       iter != candidates.rend() && mMemoryStatistics.residentBytes > mMemoryBudget;
+       ++iter )
+  {
+    EvictTexture( iter->second, mTextureUsage[ iter->second ] );
+  }
+
+  DALI_LOG_INFO( gTextureCacheFilter, Debug::General, "TextureCache::EvictUnusedTextures() resident:%u budget:%u evictions:%u reloads:%u\n",
+                 static_cast< unsigned int >( mMemoryStatistics.residentBytes ), static_cast< unsigned int >( mMemoryBudget ),
+                 mMemoryStatistics.evictionCount, mMemoryStatistics.reloadCount );
+}
+
+const TextureCache::MemoryStatistics& TextureCache::GetMemoryStatistics() const
+{
+  return mMemoryStatistics;
+}
+
+void TextureCache::SetUploadBudget( std::size_t budget )
+{
+  DALI_LOG_INFO( gTextureCacheFilter, Debug::General, "TextureCache::SetUploadBudget(%u)\n", static_cast< unsigned int >( budget ) );
+  mUploadBudget = budget;
+}
+
+void TextureCache::UploadPendingTextures()
+{
+  std::size_t remaining = mUploadBudget;
+
+  PendingUploads::iterator iter = mPendingUploads.begin();
+  for( ; iter != mPendingUploads.end(); ++iter )
+  {
+    if( mUploadBudget > 0u && remaining == 0u )
+    {
+      break;
+    }
+
+    const ResourceId id = *iter;
+    BitmapTexture* texture = GetBitmapTexture( id );
+    if( texture )
+    {
+      // Without a budget, e.g. after it was removed, the rest of each texture is uploaded at once
+      const std::size_t uploaded = texture->UploadRows( mUploadBudget > 0u ? remaining : std::numeric_limits< std::size_t >::max() );
+      remaining -= std::min( uploaded, remaining );
+      UpdateMemorySize( id );
+
+      if( !texture->IsUploadComplete() )
+      {
+        break;
+      }
+    }
+
+    DALI_LOG_INFO( Debug::Filter::gGLResource, Debug::General, "TextureCache::UploadPendingTextures() id:%u complete\n", id );
+
+    ResourcePostProcessRequest ppRequest( id, ResourcePostProcessRequest::UPLOADED );
+    mPostProcessResourceDispatcher.DispatchPostProcessRequest(ppRequest);
+  }
+
+  mPendingUploads.erase( mPendingUploads.begin(), iter );
+}
+
+bool TextureCache::HasPendingUploads() const
+{
+  return !mPendingUploads.empty();
+}
+
+void TextureCache::AddTextureUsage( ResourceId id, Texture* texture )
+{
+  BitmapTexture* bitmapTexture = dynamic_cast< BitmapTexture* >( texture );
+  if( bitmapTexture )
+  {
+    TextureUsage usage;
+    usage.texture = bitmapTexture;
+    usage.size = 0u;
+    usage.lastUsedFrame = mContext.GetFrameCount();
+    usage.reloadable = false;
+    usage.modified = false;
+    usage.evicted = false;
+    usage.reloadRequested = false;
+    mTextureUsage[ id ] = usage;
+  }
+}
+
+void TextureCache::UpdateMemorySize( TextureUsage& usage )
+{
+  const std::size_t size = usage.texture->GetMemorySize();
+  mMemoryStatistics.residentBytes = mMemoryStatistics.residentBytes - usage.size + size;
+  usage.size = size;
+}
+
+void TextureCache::UpdateMemorySize( ResourceId id )
+{
+  TextureUsageIter usageIter = mTextureUsage.find( id );
+  if( usageIter != mTextureUsage.end() )
+  {
+    UpdateMemorySize( usageIter->second );
+  }
+}
+
+void TextureCache::EvictTexture( ResourceId id, TextureUsage& usage )
+{
+  DALI_LOG_INFO( Debug::Filter::gGLResource, Debug::General, "TextureCache::EvictTexture(id:%u size:%u)\n", id, static_cast< unsigned int >( usage.size ) );
+
+  usage.texture->GlCleanup();
+  mMemoryStatistics.residentBytes -= usage.size;
+  usage.size = 0u;
+  usage.evicted = true;
+  usage.reloadRequested = false;
+  ++mMemoryStatistics.evictionCount;
+}
+
 
 /********************************************************************************
  **********************  Implements TextureCacheDispatcher  *********************
@@ -600,6 +842,21 @@ void TextureCache::DispatchDiscardTexture( ResourceId id )
   }
 }
 
+void TextureCache::DispatchSetTextureReloadable( ResourceId id )
+{
+  // NULL, means being shutdown, so ignore msgs
+  if( mSceneGraphBuffers != NULL )
+  {
+    typedef MessageValue1< TextureCache, ResourceId > DerivedType;
+
+    // Reserve some memory inside the render queue
+    unsigned int* slot = mRenderQueue.ReserveMessageSlot( mSceneGraphBuffers->GetUpdateBufferIndex(), sizeof( DerivedType ) );
+
+    // Construct message in the render queue memory; note that delete should not be called on the return value
+    new (slot) DerivedType( this, &TextureCache::SetTextureReloadable, id );
+  }
+}
+
 } // SceneGraph
 
 } // Internal
@@ -72,6 +72,24 @@ typedef TextureContainer::const_iterator        TextureConstIter;
 class TextureCache : public TextureCacheDispatcher
 {
 public:
+
+  /**
+   * Statistics of the GPU memory used by bitmap textures
+   */
+  struct MemoryStatistics
+  {
+    MemoryStatistics()
+    : residentBytes( 0u ),
+      evictionCount( 0u ),
+      reloadCount( 0u )
+    {
+    }
+
+    std::size_t  residentBytes; ///< The size of the GL textures of the bitmap textures
+    unsigned int evictionCount; ///< The number of textures evicted to stay within the memory budget
+    unsigned int reloadCount;   ///< The number of evicted textures which were created again when next used
+  };
+
  /**
    * Constructor
    * @param[in] renderQueue Queue to use for dispatching messages to this object
@@ -245,6 +263,53 @@ public:
    */
   ResourcePolicy::Discardable GetDiscardBitmapsPolicy();
 
+  /**
+   * Mark a texture as reloadable; its resource can be loaded again if the texture is evicted
+   * after its pixels have been discarded.
+   * @param[in] id Resource Id of the texture
+   */
+  void SetTextureReloadable( ResourceId id );
+
+  /**
+   * Set the GPU memory budget of the bitmap textures.
+   * When the budget is exceeded, the least recently used textures are evicted; they are created
+   * again, from their bitmap or by loading the resource again, the next time they are used.
+   * @param[in] budget The budget in bytes, or zero for no budget.
+   */
+  void SetMemoryBudget( std::size_t budget );
+
+  /**
+   * Evict the least recently used textures, which have not been used in recent frames, until
+   * the resident textures are within the memory budget. Called once per frame, after rendering.
+   */
+  void EvictUnusedTextures();
+
+  /**
+   * Get the statistics of the GPU memory used by bitmap textures.
+   * @return The statistics.
+   */
+  const MemoryStatistics& GetMemoryStatistics() const;
+
+  /**
+   * Set the number of bytes of new bitmaps uploaded per frame.
+   * With a budget, new bitmap textures are uploaded a band of rows at a time over several frames,
+   * rather than all at once when first drawn; they are reported as uploaded once complete.
+   * @param[in] budget The budget in bytes, or zero to upload each texture as a whole.
+   */
+  void SetUploadBudget( std::size_t budget );
+
+  /**
+   * Continue uploading the new bitmap textures, within the upload budget.
+   * Called once per frame, before rendering.
+   */
+  void UploadPendingTextures();
+
+  /**
+   * Query whether there are textures still being uploaded over several frames.
+   * @return true if UploadPendingTextures() has more to upload.
+   */
+  bool HasPendingUploads() const;
+
 protected: // Implements TextureCacheDispatcher
 
   /**
@@ -306,6 +371,58 @@ protected: // Implements TextureCacheDispatcher
    */
   virtual void DispatchDiscardTexture( ResourceId id );
 
+  /**
+   * @copydoc TextureCacheDispatcher::DispatchSetTextureReloadable()
+   */
+  virtual void DispatchSetTextureReloadable( ResourceId id );
+
+private:
+
+  /**
+   * The use of a bitmap texture, for the memory budget
+   */
+  struct TextureUsage
+  {
+    BitmapTexture* texture;          ///< The texture, owned by mTextures
+    std::size_t    size;             ///< The size of the GL texture, or zero if it has not been created
+    unsigned int   lastUsedFrame;    ///< The frame in which the texture was last bound
+    bool           reloadable:1;     ///< True if the resource can be loaded again
+    bool           modified:1;       ///< True if other bitmaps were uploaded into the texture, so it cannot be restored
+    bool           evicted:1;        ///< True if the GL texture was evicted and has not been created again
+    bool           reloadRequested:1;///< True if the resource was requested again since the eviction
+  };
+
+  typedef std::map< ResourceId, TextureUsage > TextureUsageContainer;
+  typedef TextureUsageContainer::iterator      TextureUsageIter;
+
+  typedef std::vector< ResourceId >            PendingUploads;
+
+  /**
+   * Start tracking the use of a texture, if it is a bitmap texture
+   * @param[in] id Resource Id of the texture
+   * @param[in] texture The texture, which may be NULL
+   */
+  void AddTextureUsage( ResourceId id, Texture* texture );
+
+  /**
+   * Update the size of a texture after its GL texture may have been created, resized or deleted
+   * @param[in] usage The use of the texture
+   */
+  void UpdateMemorySize( TextureUsage& usage );
+
+  /**
+   * @copydoc UpdateMemorySize( TextureUsage& )
+   * @param[in] id Resource Id of the texture
+   */
+  void UpdateMemorySize( ResourceId id );
+
+  /**
+   * Delete the GL texture of a texture, which is created again when next used
+   * @param[in] id Resource Id of the texture
+   * @param[in] usage The use of the texture
+   */
+  void EvictTexture( ResourceId id, TextureUsage& usage );
+
 private:
 
   PostProcessResourceDispatcher& mPostProcessResourceDispatcher;
@@ -321,6 +438,13 @@ private:
 
   TextureResourceObservers mObservers;
   ResourcePolicy::Discardable mDiscardBitmapsPolicy;
+
+  TextureUsageContainer mTextureUsage;     ///< The use of the bitmap textures
+  MemoryStatistics      mMemoryStatistics; ///< The GPU memory used by the bitmap textures
+  std::size_t           mMemoryBudget;     ///< The GPU memory budget of the bitmap textures, or zero for no budget
+
+  PendingUploads        mPendingUploads;   ///< The new bitmap textures being uploaded, in order of arrival
+  std::size_t           mUploadBudget;     ///< The bytes of new bitmaps uploaded per frame, or zero to upload them whole
 };
 
 
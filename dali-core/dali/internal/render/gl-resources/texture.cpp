@@ -199,6 +199,8 @@ void Texture::GlCleanup()
   {
     mContext.DeleteTextures(1,&mId);
     mId = 0;
+    // the sampler state was lost with the gl texture
+    mSamplerBitfield = 0;
   }
 }
 
@@ -28,17 +28,44 @@ namespace Internal
 namespace SceneGraph
 {
 
+namespace
+{
+
+bool AttributeLocationsEqual( const Vector<GLint>& lhs, const Vector<GLint>& rhs )
+{
+  if( lhs.Count() != rhs.Count() )
+  {
+    return false;
+  }
+
+  for( unsigned int i = 0; i < lhs.Count(); ++i )
+  {
+    if( lhs[i] != rhs[i] )
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+} // unnamed namespace
+
 RenderGeometry::RenderGeometry( GeometryType type, bool requiresDepthTest )
 : mIndexBuffer(0),
   mGeometryType( type ),
+  mVertexArrays(),
+  mContext( NULL ),
   mRequiresDepthTest(requiresDepthTest ),
   mHasBeenUpdated(false),
-  mAttributesChanged(true)
+  mAttributesChanged(true),
+  mVertexArraysOutdated(false)
 {
 }
 
 RenderGeometry::~RenderGeometry()
 {
+  DeleteVertexArrays();
 }
 
 void RenderGeometry::GlContextCreated( Context& context )
@@ -47,6 +74,8 @@ void RenderGeometry::GlContextCreated( Context& context )
 
 void RenderGeometry::GlContextDestroyed()
 {
+  // The GL names were released with the context
+  mVertexArrays.Clear();
 }
 
 void RenderGeometry::AddPropertyBuffer( Render::PropertyBuffer* propertyBuffer, bool isIndexBuffer )
@@ -60,6 +89,7 @@ void RenderGeometry::AddPropertyBuffer( Render::PropertyBuffer* propertyBuffer,
     mVertexBuffers.PushBack( propertyBuffer );
     mAttributesChanged = true;
   }
+  mVertexArraysOutdated = true;
 }
 
 void RenderGeometry::RemovePropertyBuffer( const Render::PropertyBuffer* propertyBuffer )
@@ -67,6 +97,7 @@ void RenderGeometry::RemovePropertyBuffer( const Render::PropertyBuffer* propert
   if( propertyBuffer == mIndexBuffer )
   {
     mIndexBuffer = 0;
+    mVertexArraysOutdated = true;
   }
   else
   {
@@ -78,6 +109,7 @@ void RenderGeometry::RemovePropertyBuffer( const Render::PropertyBuffer* propert
         //This will delete the gpu buffer associated to the RenderPropertyBuffer if there is one
         mVertexBuffers.Remove( mVertexBuffers.Begin()+i);
         mAttributesChanged = true;
+        mVertexArraysOutdated = true;
         break;
       }
     }
@@ -116,7 +148,8 @@ void RenderGeometry::OnRenderFinished()
 void RenderGeometry::UploadAndDraw(
     Context& context,
     BufferIndex bufferIndex,
-    Vector<GLint>& attributeLocation )
+    Vector<GLint>& attributeLocation,
+    unsigned int instanceCount )
 {
   if( !mHasBeenUpdated )
   {
@@ -140,17 +173,21 @@ void RenderGeometry::UploadAndDraw(
     mHasBeenUpdated = true;
   }
 
-  //Bind buffers to attribute locations
-  unsigned int base = 0;
-  for( unsigned int i = 0; i < mVertexBuffers.Count(); ++i )
+  if( mVertexArraysOutdated )
   {
-    mVertexBuffers[i]->BindBuffer( GpuBuffer::ARRAY_BUFFER );
-    base += mVertexBuffers[i]->EnableVertexAttributes( context, attributeLocation, base );
+    DeleteVertexArrays();
+    mVertexArraysOutdated = false;
   }
 
-  if( mIndexBuffer )
+  // The per-instance attributes are set up outside of the geometry, so instanced draws cannot use a vertex array object
+  const bool useVertexArray = ( instanceCount <= 1u ) && context.IsVertexArrayObjectSupported();
+  if( useVertexArray )
   {
-    mIndexBuffer->BindBuffer( GpuBuffer::ELEMENT_ARRAY_BUFFER );
+    BindVertexArray( context, attributeLocation );
+  }
+  else
+  {
+    BindBuffers( context, attributeLocation );
   }
 
   //Bind index buffer
@@ -160,65 +197,34 @@ void RenderGeometry::UploadAndDraw(
     numIndices = mIndexBuffer->GetDataSize() / mIndexBuffer->GetElementSize();
   }
 
-  //Draw call
+  GLenum mode( GL_TRIANGLES );
   switch(mGeometryType)
   {
     case Dali::Geometry::TRIANGLES:
     {
-      if( numIndices )
-      {
-        context.DrawElements(GL_TRIANGLES, numIndices, GL_UNSIGNED_SHORT, 0);
-      }
-      else
-      {
-        unsigned int numVertices = mVertexBuffers[0]->GetElementCount();
-        context.DrawArrays( GL_TRIANGLES, 0, numVertices );
-      }
+      mode = GL_TRIANGLES;
       break;
     }
     case Dali::Geometry::LINES:
     {
-      if( numIndices )
-      {
-        context.DrawElements(GL_LINES, numIndices, GL_UNSIGNED_SHORT, 0);
-      }
-      else
-      {
-        unsigned int numVertices = mVertexBuffers[0]->GetElementCount();
-        context.DrawArrays( GL_LINES, 0, numVertices );
-      }
+      mode = GL_LINES;
       break;
     }
     case Dali::Geometry::POINTS:
     {
-      unsigned int numVertices = mVertexBuffers[0]->GetElementCount();
-      context.DrawArrays(GL_POINTS, 0, numVertices );
+      // Points are always drawn without indices
+      mode = GL_POINTS;
+      numIndices = 0u;
       break;
     }
     case Dali::Geometry::TRIANGLE_STRIP:
     {
-      if( numIndices )
-      {
-        context.DrawElements(GL_TRIANGLE_STRIP, numIndices, GL_UNSIGNED_SHORT, 0);
-      }
-      else
-      {
-        unsigned int numVertices = mVertexBuffers[0]->GetElementCount();
-        context.DrawArrays(GL_TRIANGLE_STRIP, 0, numVertices );
-      }
+      mode = GL_TRIANGLE_STRIP;
       break;
     }
     case Dali::Geometry::TRIANGLE_FAN:
     {
-      if( numIndices )
-      {
-        context.DrawElements(GL_TRIANGLE_FAN, numIndices, GL_UNSIGNED_SHORT, 0);
-      }
-      else
-      {
-        unsigned int numVertices = mVertexBuffers[0]->GetElementCount();
-        context.DrawArrays(GL_TRIANGLE_FAN, 0, numVertices );
-      }
+      mode = GL_TRIANGLE_FAN;
       break;
     }
     default:
@@ -228,14 +234,99 @@ void RenderGeometry::UploadAndDraw(
     }
   }
 
-  //Disable atrributes
-  for( unsigned int i = 0; i < attributeLocation.Count(); ++i )
+  //Draw call
+  if( numIndices )
+  {
+    if( instanceCount > 1u )
+    {
+      context.DrawElementsInstanced( mode, numIndices, GL_UNSIGNED_SHORT, 0, instanceCount );
+    }
+    else
+    {
+      context.DrawElements( mode, numIndices, GL_UNSIGNED_SHORT, 0 );
+    }
+  }
+  else
+  {
+    unsigned int numVertices = mVertexBuffers[0]->GetElementCount();
+    if( instanceCount > 1u )
+    {
+      context.DrawArraysInstanced( mode, 0, numVertices, instanceCount );
+    }
+    else
+    {
+      context.DrawArrays( mode, 0, numVertices );
+    }
+  }
+
+  if( useVertexArray )
+  {
+    // Restore the default vertex array object, whose state the context caches
+    context.BindVertexArray( 0 );
+  }
+  else
+  {
+    //Disable atrributes
+    for( unsigned int i = 0; i < attributeLocation.Count(); ++i )
+    {
+      if( attributeLocation[i] != -1 )
+      {
+        context.DisableVertexAttributeArray( attributeLocation[i] );
+      }
+    }
+  }
+}
+
+void RenderGeometry::BindBuffers( Context& context, Vector<GLint>& attributeLocation )
+{
+  //Bind buffers to attribute locations
+  unsigned int base = 0;
+  for( unsigned int i = 0; i < mVertexBuffers.Count(); ++i )
+  {
+    mVertexBuffers[i]->BindBuffer( GpuBuffer::ARRAY_BUFFER );
+    base += mVertexBuffers[i]->EnableVertexAttributes( context, attributeLocation, base );
+  }
+
+  if( mIndexBuffer )
+  {
+    mIndexBuffer->BindBuffer( GpuBuffer::ELEMENT_ARRAY_BUFFER );
+  }
+}
+
+void RenderGeometry::BindVertexArray( Context& context, Vector<GLint>& attributeLocation )
+{
+  // Programs which use the same attribute locations share a vertex array object
+  for( VertexArrayIter iter = mVertexArrays.Begin(); iter != mVertexArrays.End(); ++iter )
+  {
+    if( AttributeLocationsEqual( (*iter)->attributeLocation, attributeLocation ) )
+    {
+      context.BindVertexArray( (*iter)->id );
+      return;
+    }
+  }
+
+  VertexArray* vertexArray = new VertexArray;
+  vertexArray->attributeLocation = attributeLocation;
+  vertexArray->id = 0;
+  context.GenVertexArrays( 1, &vertexArray->id );
+  mVertexArrays.PushBack( vertexArray );
+  mContext = &context;
+
+  // Record the attribute set-up in the new object
+  context.BindVertexArray( vertexArray->id );
+  BindBuffers( context, attributeLocation );
+}
+
+void RenderGeometry::DeleteVertexArrays()
+{
+  if( mContext )
   {
-    if( attributeLocation[i] != -1 )
+    for( VertexArrayIter iter = mVertexArrays.Begin(); iter != mVertexArrays.End(); ++iter )
     {
-      context.DisableVertexAttributeArray( attributeLocation[i] );
+      mContext->DeleteVertexArrays( 1, &(*iter)->id );
     }
   }
+  mVertexArrays.Clear();
 }
 
 } // namespace SceneGraph
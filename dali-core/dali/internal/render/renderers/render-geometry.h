@@ -70,6 +70,7 @@ public:
 
   /**
    * Called on Gl Context destroyed.
+   * Forgets the vertex array objects, which were released with the context.
    */
   void GlContextDestroyed();
 
@@ -137,14 +138,51 @@ public:
 
   /**
    * Upload the geometry if it has changed, set up the attributes and perform
-   * the Draw call corresponding to the geometry type
+   * the Draw call corresponding to the geometry type.
+   * If vertex array objects are supported, the attribute set-up is recorded in a vertex array object the
+   * first time the geometry is drawn with a set of attribute locations; later draws just bind that object.
    * @param[in] context The GL context
    * @param[in] bufferIndex The current buffer index
    * @param[in] attributeLocation The location for the attributes in the shader
+   * @param[in] instanceCount The number of instances to draw; instanced draw calls are used if more than one
    */
   void UploadAndDraw(Context& context,
                      BufferIndex bufferIndex,
-                     Vector<GLint>& attributeLocation );
+                     Vector<GLint>& attributeLocation,
+                     unsigned int instanceCount = 1u );
+
+private:
+
+  /**
+   * A vertex array object, recorded for the attribute locations of a program
+   */
+  struct VertexArray
+  {
+    Vector<GLint> attributeLocation; ///< The attribute locations the object was recorded with
+    GLuint id;                       ///< The GL name of the object
+  };
+
+  typedef OwnerContainer< VertexArray* > VertexArrayContainer;
+  typedef VertexArrayContainer::Iterator VertexArrayIter;
+
+  /**
+   * Bind the vertex & index buffers and point the attributes at them
+   * @param[in] context The GL context
+   * @param[in] attributeLocation The location for the attributes in the shader
+   */
+  void BindBuffers( Context& context, Vector<GLint>& attributeLocation );
+
+  /**
+   * Bind the vertex array object recorded for the attribute locations, recording it first if there is none
+   * @param[in] context The GL context
+   * @param[in] attributeLocation The location for the attributes in the shader
+   */
+  void BindVertexArray( Context& context, Vector<GLint>& attributeLocation );
+
+  /**
+   * Delete the vertex array objects, e.g. when the buffers of the geometry change
+   */
+  void DeleteVertexArrays();
 
 private:
 
@@ -154,10 +192,15 @@ private:
 
   GeometryType  mGeometryType;
 
+  // Vertex array objects, one per set of attribute locations
+  VertexArrayContainer mVertexArrays;
+  Context* mContext; ///< The context the vertex array objects were created with
+
   // Booleans
   bool mRequiresDepthTest : 1;
   bool mHasBeenUpdated : 1;
   bool mAttributesChanged : 1;
+  bool mVertexArraysOutdated : 1; ///< True if the buffers changed since the vertex array objects were recorded
 
 };
 
@@ -23,6 +23,7 @@
 #include <dali/integration-api/debug.h>
 #include <dali/internal/common/internal-constants.h>
 #include <dali/internal/render/common/performance-monitor.h>
+#include <dali/internal/render/common/render-list.h>
 #include <dali/internal/render/common/vertex.h>
 #include <dali/internal/render/gl-resources/gpu-buffer.h>
 #include <dali/internal/render/gl-resources/texture.h>
@@ -39,6 +40,8 @@ namespace
 Debug::Filter* gImageRenderFilter=Debug::Filter::New(Debug::NoLogging, false, "LOG_IMAGE_RENDERER");
 #endif
 
+const unsigned int VERTICES_PER_BATCHED_QUAD = 6u; ///< Batched quads are drawn as separate triangles
+
 /**
  * VertexToTextureCoord
  * Represents a mapping between a 1 dimensional vertex coordinate
@@ -199,6 +202,10 @@ void ImageRenderer::GlContextDestroyed()
   {
     mIndexBuffer->GlContextDestroyed();
   }
+  if( mBatchVertexBuffer )
+  {
+    mBatchVertexBuffer->GlContextDestroyed();
+  }
   // force recreation of the geometry in next render
   mIsMeshGenerated = false;
 }
@@ -209,6 +216,8 @@ void ImageRenderer::GlCleanup()
 
   mVertexBuffer.Reset();
   mIndexBuffer.Reset();
+  mBatchVertexBuffer.Reset();
+  mBatchVertices.Release();
 }
 
 bool ImageRenderer::RequiresDepthTest() const
@@ -261,45 +270,15 @@ void ImageRenderer::DoRender( Context& context, SceneGraph::TextureCache& textur
 
   DALI_ASSERT_DEBUG( mVertexBuffer );
 
-  mTextureCache->BindTexture( mTexture, mTextureId,  GL_TEXTURE_2D, TEXTURE_UNIT_IMAGE );
-
-  if( mTexture->GetTextureId() == 0 )
+  if( !BindTexture( program ) )
   {
     return; // early out if we haven't got a GL texture yet (e.g. due to context loss)
   }
 
-  mTexture->ApplySampler( TEXTURE_UNIT_IMAGE, mSamplerBitfield );
-
-  // Set sampler uniform
-  GLint samplerLoc = program.GetUniformLocation( Program::UNIFORM_SAMPLER );
-  if( -1 != samplerLoc )
-  {
-    // set the uniform
-    program.SetUniform1i( samplerLoc, TEXTURE_UNIT_IMAGE );
-  }
-
   // make sure the vertex is bound, this has to be done before
   // we call VertexAttribPointer otherwise you get weird output on the display
   mVertexBuffer->Bind(GpuBuffer::ARRAY_BUFFER);
 
-  samplerLoc = program.GetUniformLocation( Program::UNIFORM_SAMPLER_RECT );
-  if( -1 != samplerLoc )
-  {
-    UvRect uv;
-
-    if ( mUsePixelArea )
-    {
-      mTexture->GetTextureCoordinates( uv, &mPixelArea );
-    }
-    else
-    {
-      mTexture->GetTextureCoordinates( uv, NULL );
-    }
-
-    // set the uniform
-    program.SetUniform4f( samplerLoc, uv.u0, uv.v0, uv.u2, uv.v2 );
-  }
-
   // Check whether the program supports the expected attributes/uniforms
   const GLint positionLoc = program.GetAttribLocation( Program::ATTRIB_POSITION );
   const GLint texCoordLoc = program.GetAttribLocation( Program::ATTRIB_TEXCOORD );
@@ -352,6 +331,191 @@ void ImageRenderer::DoRender( Context& context, SceneGraph::TextureCache& textur
   }
 }
 
+bool ImageRenderer::BindTexture( Program& program )
+{
+  mTextureCache->BindTexture( mTexture, mTextureId,  GL_TEXTURE_2D, TEXTURE_UNIT_IMAGE );
+
+  if( mTexture->GetTextureId() == 0 )
+  {
+    return false;
+  }
+
+  mTexture->ApplySampler( TEXTURE_UNIT_IMAGE, mSamplerBitfield );
+
+  // Set sampler uniform
+  GLint samplerLoc = program.GetUniformLocation( Program::UNIFORM_SAMPLER );
+  if( -1 != samplerLoc )
+  {
+    // set the uniform
+    program.SetUniform1i( samplerLoc, TEXTURE_UNIT_IMAGE );
+  }
+
+  samplerLoc = program.GetUniformLocation( Program::UNIFORM_SAMPLER_RECT );
+  if( -1 != samplerLoc )
+  {
+    UvRect uv;
+
+    if ( mUsePixelArea )
+    {
+      mTexture->GetTextureCoordinates( uv, &mPixelArea );
+    }
+    else
+    {
+      mTexture->GetTextureCoordinates( uv, NULL );
+    }
+
+    // set the uniform
+    program.SetUniform4f( samplerLoc, uv.u0, uv.v0, uv.u2, uv.v2 );
+  }
+
+  return true;
+}
+
+void ImageRenderer::DoRenderBatch( Context& context, SceneGraph::TextureCache& textureCache, BufferIndex bufferIndex, Program& program, const SceneGraph::RenderList& renderList, size_t begin, size_t end )
+{
+  DALI_ASSERT_DEBUG( NULL != mTexture && "ImageRenderer::DoRenderBatch. mTexture == NULL." );
+
+  if( !BindTexture( program ) )
+  {
+    return; // early out if we haven't got a GL texture yet (e.g. due to context loss)
+  }
+
+  // Transform the quads of the batch on the CPU
+  mBatchVertices.Clear();
+  mBatchVertices.Reserve( ( end - begin ) * VERTICES_PER_BATCHED_QUAD );
+  for( size_t index = begin; index < end; ++index )
+  {
+    const SceneGraph::RenderItem& item = renderList.GetItem( index );
+    const SceneGraph::NodeDataProvider& node = item.GetNode();
+    const ImageRenderer* renderer = item.GetRenderer().GetImageRenderer();
+    DALI_ASSERT_DEBUG( NULL != renderer && "ImageRenderer::DoRenderBatch. Not an image renderer." );
+
+    renderer->AddQuadToBatch( *mTexture, node.GetModelMatrix( bufferIndex ), mBatchVertices );
+  }
+
+  if( !mBatchVertexBuffer )
+  {
+    mBatchVertexBuffer = new GpuBuffer( context );
+  }
+  mBatchVertexBuffer->UpdateDataBuffer( mBatchVertices.Count() * sizeof(Vertex3D), mBatchVertices.Begin(), GpuBuffer::STREAM_DRAW );
+  mBatchVertexBuffer->Bind(GpuBuffer::ARRAY_BUFFER);
+
+  // Check whether the program supports the expected attributes/uniforms
+  const GLint positionLoc = program.GetAttribLocation( Program::ATTRIB_POSITION );
+  const GLint texCoordLoc = program.GetAttribLocation( Program::ATTRIB_TEXCOORD );
+
+  if ( positionLoc != -1 )
+  {
+    context.EnableVertexAttributeArray( positionLoc );
+    context.VertexAttribPointer( positionLoc, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex3D), 0 );
+  }
+
+  if ( texCoordLoc != -1 )
+  {
+    context.EnableVertexAttributeArray( texCoordLoc );
+    context.VertexAttribPointer( texCoordLoc, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex3D), (const void*) (sizeof(float)*3) );
+  }
+
+  context.DrawArrays( GL_TRIANGLES, 0, mBatchVertices.Count() );
+
+  if ( positionLoc != -1 )
+  {
+    context.DisableVertexAttributeArray( positionLoc );
+  }
+
+  if ( texCoordLoc != -1 )
+  {
+    context.DisableVertexAttributeArray( texCoordLoc );
+  }
+}
+
+size_t ImageRenderer::FindBatchEnd( const SceneGraph::RenderList& renderList, size_t begin, const SceneGraph::Shader& defaultShader, BufferIndex bufferIndex ) const
+{
+  // Only the vertices of quads are generated on the CPU.
+  // A custom shader must not modify the geometry, since the vertices of a batch are in world coordinates & the model matrix is the identity.
+  const SceneGraph::Shader* shader = mShader ? mShader : &defaultShader;
+  if( ( 0u == ( renderList.GetFlags() & SceneGraph::RenderList::BATCHING_ENABLED ) ) ||
+      ( mMeshType != QUAD ) ||
+      ( shader != &defaultShader && !shader->GeometryHintEnabled( Dali::ShaderEffect::HINT_DOESNT_MODIFY_GEOMETRY ) ) )
+  {
+    return begin + 1;
+  }
+
+  const SceneGraph::RenderItem& first = renderList.GetItem( begin );
+  const SceneGraph::NodeDataProvider& node = first.GetNode();
+  const Vector4& color = node.GetRenderColor( bufferIndex );
+
+  const size_t count = renderList.Count();
+  size_t end = begin + 1;
+  for( ; end < count; ++end )
+  {
+    const SceneGraph::RenderItem& item = renderList.GetItem( end );
+    const SceneGraph::NodeDataProvider& itemNode = item.GetNode();
+    const ImageRenderer* renderer = item.GetRenderer().GetImageRenderer();
+
+    // The items are drawn with the same blending, depth writes & color
+    if( ( NULL == renderer ) ||
+        ( item.IsOpaque() != first.IsOpaque() ) ||
+        ( itemNode.GetRenderColor( bufferIndex ) != color ) ||
+        !CanBatchWith( *renderer, defaultShader ) )
+    {
+      break;
+    }
+  }
+
+  return end;
+}
+
+bool ImageRenderer::CanBatchWith( const ImageRenderer& other, const SceneGraph::Shader& defaultShader ) const
+{
+  const SceneGraph::Shader* shader = mShader ? mShader : &defaultShader;
+  const SceneGraph::Shader* otherShader = other.mShader ? other.mShader : &defaultShader;
+
+  const Vector4* blendColor = mBlendingOptions.GetBlendColor();
+  const Vector4* otherBlendColor = other.mBlendingOptions.GetBlendColor();
+
+  return ( other.mMeshType == QUAD ) &&
+         ( mTextureId == other.mTextureId ) &&
+         ( shader == otherShader ) &&
+         ( mSamplerBitfield == other.mSamplerBitfield ) &&
+         ( GetCullFaceMode() == other.GetCullFaceMode() ) &&
+         ( mUsePixelArea == other.mUsePixelArea ) &&
+         ( !mUsePixelArea || ( mPixelArea == other.mPixelArea ) ) &&
+         ( mBlendingOptions.GetBitmask() == other.mBlendingOptions.GetBitmask() ) &&
+         ( ( blendColor == otherBlendColor ) || ( blendColor && otherBlendColor && ( *blendColor == *otherBlendColor ) ) );
+}
+
+void ImageRenderer::AddQuadToBatch( Internal::Texture& texture, const Matrix& modelMatrix, Dali::Vector< Vertex3D >& vertices ) const
+{
+  const float x0 = -0.5f * mGeometrySize.x;
+  const float y0 = -0.5f * mGeometrySize.y;
+  const float x1 =  0.5f * mGeometrySize.x;
+  const float y1 =  0.5f * mGeometrySize.y;
+
+  // The corners as in SetQuadMeshData()
+  const Vector4 corners[] = { modelMatrix * Vector4( x0, y0, 0.0f, 1.0f ),
+                              modelMatrix * Vector4( x0, y1, 0.0f, 1.0f ),
+                              modelMatrix * Vector4( x1, y0, 0.0f, 1.0f ),
+                              modelMatrix * Vector4( x1, y1, 0.0f, 1.0f ) };
+
+  Vertex3D quad[]={
+                    { corners[0].x, corners[0].y, corners[0].z, 0.0, 0.0 },
+                    { corners[1].x, corners[1].y, corners[1].z, 0.0, 1.0 },
+                    { corners[2].x, corners[2].y, corners[2].z, 1.0, 0.0 },
+                    { corners[3].x, corners[3].y, corners[3].z, 1.0, 1.0 }
+                  };
+
+  texture.MapUV( sizeof(quad)/sizeof(Vertex3D), &quad[0].mU, sizeof(Vertex3D)/sizeof(float), mUsePixelArea ? &mPixelArea : NULL );
+
+  // Triangles 0,1,2 and 1,3,2 as drawn by the strip
+  vertices.PushBack( quad[0] );
+  vertices.PushBack( quad[1] );
+  vertices.PushBack( quad[2] );
+  vertices.PushBack( quad[1] );
+  vertices.PushBack( quad[3] );
+  vertices.PushBack( quad[2] );
+}
+
 void ImageRenderer::DoSetBlending(Context& context, BufferIndex bufferIndex, bool blend )
 {
   // Enables/disables blending mode.
@@ -418,7 +582,7 @@ void ImageRenderer::UpdateIndexBuffer( Context& context, GLsizeiptr size, const
   }
 }
 
-void ImageRenderer::GenerateMeshData( Texture* texture )
+void ImageRenderer::GenerateMeshData( Internal::Texture* texture )
 {
   const PixelArea* pixelArea = NULL;
   if( mUsePixelArea )
@@ -458,7 +622,7 @@ void ImageRenderer::GenerateMeshData( Texture* texture )
   mIsMeshGenerated = true;
 }
 
-void ImageRenderer::SetQuadMeshData( Texture* texture, const Vector2& size, const PixelArea* pixelArea )
+void ImageRenderer::SetQuadMeshData( Internal::Texture* texture, const Vector2& size, const PixelArea* pixelArea )
 {
   const float x0 = -0.5f * size.x;
   const float y0 = -0.5f * size.y;
@@ -506,7 +670,7 @@ void ImageRenderer::SetQuadMeshData( Texture* texture, const Vector2& size, cons
   UpdateIndexBuffer( *mContext, 0, NULL );
 }
 
-void ImageRenderer::SetNinePatchMeshData( Texture* texture, const Vector2& size, const Vector4& border, bool borderInPixels, const PixelArea* pixelArea, bool noCenter )
+void ImageRenderer::SetNinePatchMeshData( Internal::Texture* texture, const Vector2& size, const Vector4& border, bool borderInPixels, const PixelArea* pixelArea, bool noCenter )
 {
   DALI_ASSERT_ALWAYS( mTexture->GetWidth()  > 0.0f && "Invalid Texture width" );
   DALI_ASSERT_ALWAYS( mTexture->GetHeight() > 0.0f && "Invalid Texture height" );
@@ -731,7 +895,7 @@ void ImageRenderer::SetNinePatchMeshData( Texture* texture, const Vector2& size,
 
 }
 
-void ImageRenderer::SetGridMeshData( Texture* texture, const Vector2& size, const Vector4* border, bool borderInPixels, const PixelArea* pixelArea )
+void ImageRenderer::SetGridMeshData( Internal::Texture* texture, const Vector2& size, const Vector4* border, bool borderInPixels, const PixelArea* pixelArea )
 {
   /*
    * Quad Grid:
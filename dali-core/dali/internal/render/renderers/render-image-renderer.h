@@ -20,8 +20,10 @@
 
 // INTERNAL INCLUDES
 #include <dali/public-api/actors/image-actor.h>
+#include <dali/public-api/common/dali-vector.h>
 #include <dali/internal/common/owner-pointer.h>
 #include <dali/internal/update/resources/resource-manager-declarations.h>
+#include <dali/internal/render/common/vertex.h>
 #include <dali/internal/render/gl-resources/context.h>
 #include <dali/internal/render/gl-resources/texture-observer.h>
 #include <dali/internal/render/renderers/render-renderer.h>
@@ -141,6 +143,26 @@ public:
    */
   virtual void DoRender( Context& context, SceneGraph::TextureCache& textureCache, const SceneGraph::NodeDataProvider& node, BufferIndex bufferIndex, Program& program, const Matrix& modelViewMatrix, const Matrix& viewMatrix );
 
+  /**
+   * @copydoc Dali::Internal::SceneGraph::Renderer::DoRenderBatch()
+   */
+  virtual void DoRenderBatch( Context& context, SceneGraph::TextureCache& textureCache, BufferIndex bufferIndex, Program& program, const SceneGraph::RenderList& renderList, size_t begin, size_t end );
+
+  /**
+   * Quads are batched if the render list enables batching, and their nodes have the same color.
+   * The vertices are transformed into world coordinates on the CPU.
+   * @copydoc Dali::Internal::SceneGraph::Renderer::FindBatchEnd()
+   */
+  virtual size_t FindBatchEnd( const SceneGraph::RenderList& renderList, size_t begin, const SceneGraph::Shader& defaultShader, BufferIndex bufferIndex ) const;
+
+  /**
+   * @copydoc Dali::Internal::SceneGraph::Renderer::GetImageRenderer()
+   */
+  virtual const ImageRenderer* GetImageRenderer() const
+  {
+    return this;
+  }
+
   /**
    * @copydoc Dali::Internal::SceneGraph::Renderer::DoSetBlending()
    */
@@ -164,6 +186,29 @@ private:
    */
   void UpdateIndexBuffer( Context& context, GLsizeiptr size, const GLvoid *data );
 
+  /**
+   * Helper to bind the texture, and set the sampler uniforms.
+   * @param[in] program The program in use
+   * @return False if the texture has no GL texture yet.
+   */
+  bool BindTexture( Program& program );
+
+  /**
+   * Helper to query whether another renderer can be drawn in the same batch.
+   * @param[in] other The other renderer
+   * @param[in] defaultShader The shader of renderers which have no custom shader
+   * @return True if the renderers have the same texture, pixel area, shader, sampler, face-culling mode and blending options.
+   */
+  bool CanBatchWith( const ImageRenderer& other, const SceneGraph::Shader& defaultShader ) const;
+
+  /**
+   * Helper to add the two triangles of the quad to a batch, in world coordinates.
+   * @param[in] texture The texture of the batch, from which to get UV data
+   * @param[in] modelMatrix The model matrix of the node
+   * @param[in,out] vertices The vertices of the batch
+   */
+  void AddQuadToBatch( Texture& texture, const Matrix& modelMatrix, Dali::Vector< Vertex3D >& vertices ) const;
+
   /**
    * Helper to generate mesh data when required
    * @param[in] texture Texture from which to get UV data
@@ -229,6 +274,8 @@ private:
 
   OwnerPointer< GpuBuffer > mVertexBuffer;
   OwnerPointer< GpuBuffer > mIndexBuffer;
+  OwnerPointer< GpuBuffer > mBatchVertexBuffer; ///< The vertices of the batches drawn by this renderer
+  Dali::Vector< Vertex3D > mBatchVertices;      ///< A buffer to transform the vertices of a batch on the CPU, before they are uploaded
 
   Vector4   mBorder;
   PixelArea mPixelArea;
@@ -15,23 +15,48 @@
  */
 
 #include "render-new-renderer.h"
+#include <cstring>
 #include <dali/devel-api/common/hash.h>
 #include <dali/internal/common/image-sampler.h>
 #include <dali/internal/event/common/property-input-impl.h>
 #include <dali/internal/update/common/uniform-map.h>
+#include <dali/internal/render/common/render-list.h>
+#include <dali/internal/render/data-providers/node-data-provider.h>
 #include <dali/internal/render/data-providers/render-data-provider.h>
 #include <dali/internal/render/data-providers/uniform-name-cache.h>
 #include <dali/internal/render/gl-resources/context.h>
+#include <dali/internal/render/gl-resources/gpu-buffer.h>
 #include <dali/internal/render/gl-resources/texture.h>
 #include <dali/internal/render/gl-resources/texture-cache.h>
 #include <dali/internal/render/renderers/render-sampler.h>
 #include <dali/internal/render/shaders/program.h>
+#include <dali/internal/render/shaders/scene-graph-shader.h>
 
 
 namespace Dali
 {
 namespace Internal
 {
+namespace
+{
+
+const unsigned int MATRIX_COLUMNS = 4u;                        ///< A mat4 attribute uses 4 consecutive locations
+const unsigned int FLOATS_PER_MATRIX = 16u;
+const unsigned int FLOATS_PER_INSTANCE = 20u;                  ///< The model-view matrix & color of an instance
+const size_t INSTANCE_COLOR_OFFSET = FLOATS_PER_MATRIX * sizeof( float );
+const GLsizei INSTANCE_STRIDE = FLOATS_PER_INSTANCE * sizeof( float );
+
+/**
+ * Compare the contents of two collected uniform maps
+ */
+inline bool UniformMapsEqual( const SceneGraph::CollectedUniformMap& lhs, const SceneGraph::CollectedUniformMap& rhs )
+{
+  return ( lhs.Count() == rhs.Count() ) &&
+         ( 0u == lhs.Count() || 0 == memcmp( lhs.Begin(), rhs.Begin(), lhs.Count() * sizeof( SceneGraph::CollectedUniformMap::ItemType ) ) );
+}
+
+} // unnamed namespace
+
 namespace Render
 {
 
@@ -47,7 +72,10 @@ NewRenderer::NewRenderer( SceneGraph::RenderDataProvider* dataProvider,
 : Renderer(),
   mRenderDataProvider( dataProvider ),
   mRenderGeometry( renderGeometry ),
-  mUpdateAttributesLocation( true )
+  mAttributesProgram( NULL ),
+  mUpdateAttributesLocation( true ),
+  mInstanceBuffer(),
+  mInstanceData()
 {
 }
 
@@ -126,25 +154,197 @@ void NewRenderer::DoRender( Context& context, SceneGraph::TextureCache& textureC
 
   SetUniforms( bufferIndex, node, program );
 
-  if( mUpdateAttributesLocation || mRenderGeometry->AttributesChanged() )
+  if( mUpdateAttributesLocation || ( mAttributesProgram != &program ) || mRenderGeometry->AttributesChanged() )
   {
     mRenderGeometry->GetAttributeLocationFromProgram( mAttributesLocation, program, bufferIndex );
+    mAttributesProgram = &program;
     mUpdateAttributesLocation = false;
   }
 
+  // The shader may be written for instanced drawing; set the constant values of the per-instance attributes
+  const GLint modelViewLoc = program.GetAttribLocation( Program::ATTRIB_INSTANCE_MODELVIEW );
+  if( -1 != modelViewLoc )
+  {
+    const float* modelView = modelViewMatrix.AsFloat();
+    for( unsigned int i = 0; i < MATRIX_COLUMNS; ++i )
+    {
+      context.VertexAttrib4fv( modelViewLoc + i, modelView + i * MATRIX_COLUMNS );
+    }
+  }
+
+  const GLint colorLoc = program.GetAttribLocation( Program::ATTRIB_INSTANCE_COLOR );
+  if( -1 != colorLoc )
+  {
+    context.VertexAttrib4fv( colorLoc, node.GetRenderColor( bufferIndex ).AsFloat() );
+  }
+
   mRenderGeometry->UploadAndDraw( context, bufferIndex, mAttributesLocation );
 }
 
+size_t NewRenderer::FindBatchEnd( const SceneGraph::RenderList& renderList, size_t begin, const SceneGraph::Shader& defaultShader, BufferIndex bufferIndex ) const
+{
+  if( !mRenderGeometry || !mContext || !mContext->IsInstancedDrawingSupported() )
+  {
+    return begin + 1;
+  }
+
+  // The shader must take the model-view matrix of each instance from an attribute
+  Program* program = mRenderDataProvider->GetShader().GetProgram();
+  if( !program || ( -1 == program->GetAttribLocation( Program::ATTRIB_INSTANCE_MODELVIEW ) ) )
+  {
+    return begin + 1;
+  }
+  const bool hasInstanceColor = ( -1 != program->GetAttribLocation( Program::ATTRIB_INSTANCE_COLOR ) );
+
+  const SceneGraph::RenderItem& first = renderList.GetItem( begin );
+  const SceneGraph::NodeDataProvider& node = first.GetNode();
+  const SceneGraph::CollectedUniformMap& nodeUniformMap = node.GetUniformMap( bufferIndex );
+  const Vector3& size = node.GetRenderSize( bufferIndex );
+  const Vector4& color = node.GetRenderColor( bufferIndex );
+
+  const size_t count = renderList.Count();
+  size_t end = begin + 1;
+  for( ; end < count; ++end )
+  {
+    const SceneGraph::RenderItem& item = renderList.GetItem( end );
+    const SceneGraph::NodeDataProvider& itemNode = item.GetNode();
+    const NewRenderer* renderer = item.GetRenderer().GetNewRenderer();
+
+    // The instances are drawn with the same blending, depth writes & uniforms
+    if( ( NULL == renderer ) ||
+        ( item.IsOpaque() != first.IsOpaque() ) ||
+        !CanInstanceWith( *renderer, bufferIndex ) ||
+        !UniformMapsEqual( itemNode.GetUniformMap( bufferIndex ), nodeUniformMap ) ||
+        ( itemNode.GetRenderSize( bufferIndex ) != size ) ||
+        ( !hasInstanceColor && itemNode.GetRenderColor( bufferIndex ) != color ) )
+    {
+      break;
+    }
+  }
+
+  return end;
+}
+
+bool NewRenderer::CanInstanceWith( const NewRenderer& renderer, BufferIndex bufferIndex ) const
+{
+  return ( renderer.mRenderGeometry == mRenderGeometry ) &&
+         ( &renderer.mRenderDataProvider->GetShader() == &mRenderDataProvider->GetShader() ) &&
+         ( &renderer.mRenderDataProvider->GetMaterial() == &mRenderDataProvider->GetMaterial() ) &&
+         UniformMapsEqual( renderer.mRenderDataProvider->GetUniformMap().GetUniformMap( bufferIndex ),
+                           mRenderDataProvider->GetUniformMap().GetUniformMap( bufferIndex ) );
+}
+
+void NewRenderer::DoRenderBatch( Context& context, SceneGraph::TextureCache& textureCache, BufferIndex bufferIndex, Program& program, const SceneGraph::RenderList& renderList, size_t begin, size_t end )
+{
+  const SceneGraph::NodeDataProvider& node = renderList.GetItem( begin ).GetNode();
+
+  BindTextures( textureCache, program );
+
+  SetUniforms( bufferIndex, node, program );
+
+  if( mUpdateAttributesLocation || ( mAttributesProgram != &program ) || mRenderGeometry->AttributesChanged() )
+  {
+    mRenderGeometry->GetAttributeLocationFromProgram( mAttributesLocation, program, bufferIndex );
+    mAttributesProgram = &program;
+    mUpdateAttributesLocation = false;
+  }
+
+  // Collect the model-view matrix & color of each instance
+  const size_t instanceCount = end - begin;
+  mInstanceData.Resize( instanceCount * FLOATS_PER_INSTANCE );
+  float* instance = mInstanceData.Begin();
+  for( size_t index = begin; index < end; ++index, instance += FLOATS_PER_INSTANCE )
+  {
+    const SceneGraph::RenderItem& item = renderList.GetItem( index );
+    const SceneGraph::NodeDataProvider& itemNode = item.GetNode();
+    memcpy( instance, item.GetModelViewMatrix().AsFloat(), FLOATS_PER_MATRIX * sizeof( float ) );
+    memcpy( instance + FLOATS_PER_MATRIX, itemNode.GetRenderColor( bufferIndex ).AsFloat(), 4u * sizeof( float ) );
+
+    // The other renderers are not drawn this frame; keep their uniform maps up to date
+    NewRenderer* renderer = item.GetRenderer().GetNewRenderer();
+    if( renderer != this )
+    {
+      renderer->UpdateUniformIndexMap( bufferIndex, itemNode, program );
+    }
+  }
+
+  if( !mInstanceBuffer )
+  {
+    mInstanceBuffer = new GpuBuffer( context );
+  }
+  mInstanceBuffer->UpdateDataBuffer( mInstanceData.Count() * sizeof( float ), mInstanceData.Begin(), GpuBuffer::STREAM_DRAW );
+  mInstanceBuffer->Bind( GpuBuffer::ARRAY_BUFFER );
+
+  const GLint modelViewLoc = program.GetAttribLocation( Program::ATTRIB_INSTANCE_MODELVIEW );
+  for( unsigned int i = 0; i < MATRIX_COLUMNS; ++i )
+  {
+    context.EnableVertexAttributeArray( modelViewLoc + i );
+    context.VertexAttribPointer( modelViewLoc + i, 4, GL_FLOAT, GL_FALSE, INSTANCE_STRIDE, (const void*) ( i * MATRIX_COLUMNS * sizeof( float ) ) );
+    context.VertexAttribDivisor( modelViewLoc + i, 1 );
+  }
+
+  const GLint colorLoc = program.GetAttribLocation( Program::ATTRIB_INSTANCE_COLOR );
+  if( -1 != colorLoc )
+  {
+    context.EnableVertexAttributeArray( colorLoc );
+    context.VertexAttribPointer( colorLoc, 4, GL_FLOAT, GL_FALSE, INSTANCE_STRIDE, (const void*) INSTANCE_COLOR_OFFSET );
+    context.VertexAttribDivisor( colorLoc, 1 );
+  }
+
+  mRenderGeometry->UploadAndDraw( context, bufferIndex, mAttributesLocation, instanceCount );
+
+  // The divisors are not part of the cached vertex attribute state, so reset them
+  for( unsigned int i = 0; i < MATRIX_COLUMNS; ++i )
+  {
+    context.VertexAttribDivisor( modelViewLoc + i, 0 );
+    context.DisableVertexAttributeArray( modelViewLoc + i );
+  }
+
+  if( -1 != colorLoc )
+  {
+    context.VertexAttribDivisor( colorLoc, 0 );
+    context.DisableVertexAttributeArray( colorLoc );
+  }
+}
+
 void NewRenderer::GlContextDestroyed()
 {
   mRenderGeometry->GlContextDestroyed();
+
+  if( mInstanceBuffer )
+  {
+    mInstanceBuffer->GlContextDestroyed();
+  }
 }
 
 void NewRenderer::GlCleanup()
 {
+  mInstanceBuffer.Reset();
+  mInstanceData.Release();
 }
 
 void NewRenderer::SetUniforms( BufferIndex bufferIndex, const SceneGraph::NodeDataProvider& node, Program& program )
+{
+  UpdateUniformIndexMap( bufferIndex, node, program );
+
+  // Set uniforms in local map
+  for( UniformIndexMappings::Iterator iter = mUniformIndexMap.Begin(),
+         end = mUniformIndexMap.End() ;
+       iter != end ;
+       ++iter )
+  {
+    SetUniformFromProperty( bufferIndex, program, *iter );
+  }
+
+  GLint sizeLoc = program.GetUniformLocation( Program::UNIFORM_SIZE );
+  if( -1 != sizeLoc )
+  {
+    Vector3 size = node.GetRenderSize( bufferIndex );
+    program.SetSizeUniform3f( sizeLoc, size.x, size.y, size.z );
+  }
+}
+
+void NewRenderer::UpdateUniformIndexMap( BufferIndex bufferIndex, const SceneGraph::NodeDataProvider& node, Program& program )
 {
   // Check if the map has changed
   DALI_ASSERT_DEBUG( mRenderDataProvider && "No Uniform map data provider available" );
@@ -192,22 +392,6 @@ void NewRenderer::SetUniforms( BufferIndex bufferIndex, const SceneGraph::NodeDa
 
     mUniformIndexMap.Resize( mapIndex );
   }
-
-  // Set uniforms in local map
-  for( UniformIndexMappings::Iterator iter = mUniformIndexMap.Begin(),
-         end = mUniformIndexMap.End() ;
-       iter != end ;
-       ++iter )
-  {
-    SetUniformFromProperty( bufferIndex, program, *iter );
-  }
-
-  GLint sizeLoc = program.GetUniformLocation( Program::UNIFORM_SIZE );
-  if( -1 != sizeLoc )
-  {
-    Vector3 size = node.GetRenderSize( bufferIndex );
-    program.SetSizeUniform3f( sizeLoc, size.x, size.y, size.z );
-  }
 }
 
 void NewRenderer::SetUniformFromProperty( BufferIndex bufferIndex, Program& program, UniformIndexMap& map )
@@ -32,6 +32,7 @@ namespace Dali
 namespace Internal
 {
 class Context;
+class GpuBuffer;
 class PropertyInputImpl;
 
 namespace Render
@@ -40,6 +41,10 @@ namespace Render
 /**
  * The new geometry renderer.
  *
+ * Consecutive render items of renderers with the same geometry, shader & material may be drawn with a single
+ * instanced draw call, if the context supports it and the shader declares the per-instance attributes:
+ * mat4 aInstanceModelView, and optionally vec4 aInstanceColor. Otherwise each item is drawn on its own,
+ * with the values of these attributes set to the model-view matrix & color of the item.
  */
 class NewRenderer : public Renderer
 {
@@ -114,6 +119,11 @@ public: // Implementation of Renderer
    */
   virtual bool RequiresDepthTest() const;
 
+  /**
+   * @copydoc Render::Renderer::FindBatchEnd()
+   */
+  virtual size_t FindBatchEnd( const SceneGraph::RenderList& renderList, size_t begin, const SceneGraph::Shader& defaultShader, BufferIndex bufferIndex ) const;
+
   /**
    * @copydoc SceneGraph::Renderer::CheckResources()
    */
@@ -160,6 +170,19 @@ public: // Implementation of GlResourceOwner
 private:
   struct UniformIndexMap;
 
+  /**
+   * @copydoc Render::Renderer::DoRenderBatch()
+   */
+  virtual void DoRenderBatch( Context& context, SceneGraph::TextureCache& textureCache, BufferIndex bufferIndex, Program& program, const SceneGraph::RenderList& renderList, size_t begin, size_t end );
+
+  /**
+   * Query whether an item of another renderer can be drawn as an instance of an item of this renderer.
+   * @param[in] renderer The other renderer
+   * @param[in] bufferIndex The index of the previous update buffer.
+   * @return True if the renderers have the same geometry, shader, material & uniform map.
+   */
+  bool CanInstanceWith( const NewRenderer& renderer, BufferIndex bufferIndex ) const;
+
   /**
    * Set the uniforms from properties according to the uniform map
    * @param[in] node The node using the renderer
@@ -167,6 +190,13 @@ private:
    */
   void SetUniforms( BufferIndex bufferIndex, const SceneGraph::NodeDataProvider& node, Program& program );
 
+  /**
+   * Update the uniform index map if the uniform map of the renderer or node has changed
+   * @param[in] node The node using the renderer
+   * @param[in] program The shader program on which to set the uniforms.
+   */
+  void UpdateUniformIndexMap( BufferIndex bufferIndex, const SceneGraph::NodeDataProvider& node, Program& program );
+
   /**
    * Set the program uniform in the map from the mapped property
    */
@@ -197,8 +227,12 @@ private:
   UniformIndexMappings mUniformIndexMap;
 
   Vector<GLint> mAttributesLocation;
+  const Program* mAttributesProgram; ///< The program mAttributesLocation was queried from
   bool mUpdateAttributesLocation;
 
+  OwnerPointer< GpuBuffer > mInstanceBuffer; ///< The per-instance attributes of an instanced draw
+  Vector< float > mInstanceData;             ///< Scratch space to collect the per-instance attributes, kept to avoid an allocation per batch
+
 };
 
 
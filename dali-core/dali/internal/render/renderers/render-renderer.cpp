@@ -27,6 +27,7 @@
 #include <dali/public-api/actors/blending.h>
 #include <dali/internal/common/image-sampler.h>
 #include <dali/internal/render/renderers/render-new-renderer.h>
+#include <dali/internal/render/common/render-list.h>
 
 namespace Dali
 {
@@ -144,6 +145,69 @@ void Renderer::Render( Context& context,
                        const Matrix& projectionMatrix,
                        bool cull,
                        bool blend )
+{
+  Program* program = UseProgram( context, bufferIndex, defaultShader, blend );
+  if( !program )
+  {
+    return;
+  }
+
+  // Ignore missing uniforms - custom shaders and flat color shaders don't have SAMPLER
+  // set projection and view matrix if program has not yet received them yet this frame
+  const Matrix& modelMatrix = node.GetModelMatrix( bufferIndex );
+  SetMatrices( *program, modelMatrix, viewMatrix, projectionMatrix, modelViewMatrix );
+
+  // set color uniform
+  GLint loc = program->GetUniformLocation( Program::UNIFORM_COLOR );
+  if( Program::UNIFORM_UNKNOWN != loc )
+  {
+    const Vector4& color = node.GetRenderColor( bufferIndex );
+    program->SetUniform4f( loc, color.r, color.g, color.b, color.a );
+  }
+
+  //@todo MESH_REWORK Remove after removing ImageRenderer
+  DoSetUniforms(context, bufferIndex, mShader, program );
+
+  // subclass rendering and actual draw call
+  DoRender( context, textureCache, node, bufferIndex, *program, modelViewMatrix, viewMatrix );
+}
+
+void Renderer::RenderBatch( Context& context,
+                            SceneGraph::TextureCache& textureCache,
+                            BufferIndex bufferIndex,
+                            const SceneGraph::RenderList& renderList,
+                            size_t begin,
+                            size_t end,
+                            SceneGraph::Shader& defaultShader,
+                            const Matrix& viewMatrix,
+                            const Matrix& projectionMatrix,
+                            bool blend )
+{
+  Program* program = UseProgram( context, bufferIndex, defaultShader, blend );
+  if( !program )
+  {
+    return;
+  }
+
+  // The vertices are in world coordinates
+  SetMatrices( *program, Matrix::IDENTITY, viewMatrix, projectionMatrix, viewMatrix );
+
+  // set color uniform; all the nodes of the batch have the same color
+  GLint loc = program->GetUniformLocation( Program::UNIFORM_COLOR );
+  if( Program::UNIFORM_UNKNOWN != loc )
+  {
+    const SceneGraph::NodeDataProvider& node = renderList.GetItem( begin ).GetNode();
+    const Vector4& color = node.GetRenderColor( bufferIndex );
+    program->SetUniform4f( loc, color.r, color.g, color.b, color.a );
+  }
+
+  DoSetUniforms(context, bufferIndex, mShader, program );
+
+  // subclass rendering and actual draw call
+  DoRenderBatch( context, textureCache, bufferIndex, *program, renderList, begin, end );
+}
+
+Program* Renderer::UseProgram( Context& context, BufferIndex bufferIndex, SceneGraph::Shader& defaultShader, bool blend )
 {
   NewRenderer* renderer = GetNewRenderer(); // avoid a dynamic cast per item per frame
 
@@ -163,7 +227,7 @@ void Renderer::Render( Context& context,
   {
     // CheckResources() is overriden in derived classes.
     // Prevents modify the GL state if resources are not ready and nothing is to be rendered.
-    return;
+    return NULL;
   }
 
   // Get the program to use:
@@ -176,7 +240,7 @@ void Renderer::Render( Context& context,
     if( !program )
     {
       DALI_LOG_ERROR( "Failed to get program for shader at address %p.", (void*) &*mShader );
-      return;
+      return NULL;
     }
   }
 
@@ -187,24 +251,7 @@ void Renderer::Render( Context& context,
 
   DoSetBlending( context, bufferIndex, blend );
 
-  // Ignore missing uniforms - custom shaders and flat color shaders don't have SAMPLER
-  // set projection and view matrix if program has not yet received them yet this frame
-  const Matrix& modelMatrix = node.GetModelMatrix( bufferIndex );
-  SetMatrices( *program, modelMatrix, viewMatrix, projectionMatrix, modelViewMatrix );
-
-  // set color uniform
-  GLint loc = program->GetUniformLocation( Program::UNIFORM_COLOR );
-  if( Program::UNIFORM_UNKNOWN != loc )
-  {
-    const Vector4& color = node.GetRenderColor( bufferIndex );
-    program->SetUniform4f( loc, color.r, color.g, color.b, color.a );
-  }
-
-  //@todo MESH_REWORK Remove after removing ImageRenderer
-  DoSetUniforms(context, bufferIndex, mShader, program );
-
-  // subclass rendering and actual draw call
-  DoRender( context, textureCache, node, bufferIndex, *program, modelViewMatrix, viewMatrix );
+  return program;
 }
 
 void Renderer::SetSortAttributes( BufferIndex bufferIndex, SceneGraph::RendererWithSortAttributes& sortAttributes ) const
@@ -44,6 +44,7 @@ class SceneController;
 class Shader;
 class TextureCache;
 class NodeDataProvider;
+struct RenderList;
 }
 
 
@@ -51,6 +52,7 @@ namespace Render
 {
 class UniformNameCache;
 class NewRenderer;
+class ImageRenderer;
 
 /**
  * Renderers are used to render meshes
@@ -122,6 +124,62 @@ public:
                bool cull,
                bool blend);
 
+  /**
+   * Called to render a batch of consecutive render items with a single draw call, during RenderManager::Render().
+   * This must be the renderer of the first item.
+   * @see FindBatchEnd()
+   * @param[in] context The context used for rendering
+   * @param[in] textureCache The texture cache used to get textures
+   * @param[in] bufferIndex The index of the previous update buffer.
+   * @param[in] renderList The render list which contains the items
+   * @param[in] begin The index of the first item
+   * @param[in] end The index after the last item
+   * @param[in] defaultShader in case there is no custom shader
+   * @param[in] viewMatrix The view matrix.
+   * @param[in] projectionMatrix The projection matrix.
+   * @param[in] blend Whether blending is enabled
+   */
+  void RenderBatch( Context& context,
+                    SceneGraph::TextureCache& textureCache,
+                    BufferIndex bufferIndex,
+                    const SceneGraph::RenderList& renderList,
+                    size_t begin,
+                    size_t end,
+                    SceneGraph::Shader& defaultShader,
+                    const Matrix& viewMatrix,
+                    const Matrix& projectionMatrix,
+                    bool blend );
+
+  /**
+   * Find the consecutive render items which can be drawn in a batch with an item of this renderer,
+   * i.e. with the same program, textures and GL state.
+   * @param[in] renderList The render list which contains the items
+   * @param[in] begin The index of the item of this renderer
+   * @param[in] defaultShader The shader of renderers which have no custom shader
+   * @param[in] bufferIndex The index of the previous update buffer.
+   * @return The index after the last item of the batch; begin + 1 if the item is drawn on its own.
+   */
+  virtual size_t FindBatchEnd( const SceneGraph::RenderList& renderList, size_t begin, const SceneGraph::Shader& defaultShader, BufferIndex bufferIndex ) const
+  {
+    return begin + 1;
+  }
+
+  /**
+   * @return NewRenderer or NULL if this is an old renderer
+   */
+  virtual NewRenderer* GetNewRenderer()
+  {
+    return NULL;
+  }
+
+  /**
+   * @return ImageRenderer or NULL if this is not an image renderer
+   */
+  virtual const ImageRenderer* GetImageRenderer() const
+  {
+    return NULL;
+  }
+
   /**
    * Write the renderer's sort attributes to the passed in reference
    *
@@ -146,12 +204,14 @@ private:
   Renderer& operator=( const Renderer& rhs );
 
   /**
-   * @return NewRenderer or NULL if this is an old renderer
+   * Take the program of the shader into use, and set up the GL state which does not depend on the node.
+   * @param[in] context The context used for rendering
+   * @param[in] bufferIndex The index of the previous update buffer.
+   * @param[in] defaultShader in case there is no custom shader
+   * @param[in] blend Whether blending is enabled
+   * @return The program, or NULL if nothing can be rendered.
    */
-  virtual NewRenderer* GetNewRenderer()
-  {
-    return NULL;
-  }
+  Program* UseProgram( Context& context, BufferIndex bufferIndex, SceneGraph::Shader& defaultShader, bool blend );
 
   /**
    * Checks if renderer's resources are ready to be used.
@@ -189,6 +249,30 @@ private:
    */
   virtual void DoRender( Context& context, SceneGraph::TextureCache& textureCache, const SceneGraph::NodeDataProvider& node, BufferIndex bufferIndex, Program& program, const Matrix& modelViewMatrix, const Matrix& viewMatrix ) = 0;
 
+  /**
+   * Called from RenderBatch; implemented in derived classes which can be batched.
+   * @param[in] context The context used for rendering
+   * @param[in] textureCache The texture cache used to get textures
+   * @param[in] bufferIndex The index of the previous update buffer.
+   * @param[in] program to use.
+   * @param[in] renderList The render list which contains the items
+   * @param[in] begin The index of the first item
+   * @param[in] end The index after the last item
+   */
+  virtual void DoRenderBatch( Context& context, SceneGraph::TextureCache& textureCache, BufferIndex bufferIndex, Program& program, const SceneGraph::RenderList& renderList, size_t begin, size_t end )
+  {
+  }
+
+protected:
+
+  /**
+   * @return The face-culling mode.
+   */
+  CullFaceMode GetCullFaceMode() const
+  {
+    return mCullFaceMode;
+  }
+
 protected:
 
   Context* mContext;
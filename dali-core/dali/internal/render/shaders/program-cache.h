@@ -91,11 +91,23 @@ public: // API
    */
   virtual GLenum ProgramBinaryFormat() = 0;
 
+  /**
+   * Get a hash identifying the GL driver, e.g. from its vendor, renderer & version strings.
+   * Program binaries created by one driver should not be given to another.
+   * @return the driver identity
+   */
+  virtual size_t GetDriverIdentity() = 0;
+
   /**
    * @param programData to store/save
    */
   virtual void StoreBinary( Internal::ShaderDataPtr programData ) = 0;
 
+  /**
+   * Called by a program when a uniform is not uploaded, as it already has the value being set
+   */
+  virtual void IncrementRedundantUniformCount() = 0;
+
 private: // not implemented as non-copyable
 
   ProgramCache( const ProgramCache& rhs );
@@ -19,6 +19,7 @@
 #include <dali/internal/render/shaders/program-controller.h>
 
 // INTERNAL INCLUDES
+#include <dali/devel-api/common/hash.h>
 #include <dali/integration-api/gl-defines.h>
 #include <dali/internal/common/shader-saver.h>
 #include <dali/internal/update/resources/resource-manager-declarations.h>
@@ -36,8 +37,10 @@ ProgramController::ProgramController( Integration::GlAbstraction& glAbstraction
 : mShaderSaver( 0 ),
   mGlAbstraction( glAbstraction ),
   mCurrentProgram( NULL ),
+  mDriverIdentity( 0 ),
   mProgramBinaryFormat( 0 ),
-  mNumberOfProgramBinaryFormats( 0 )
+  mNumberOfProgramBinaryFormats( 0 ),
+  mRedundantUniformCount( 0u )
 {
   // we have 17 default programs so make room for those and a few custom ones as well
   mProgramCache.Reserve( 32 );
@@ -77,12 +80,28 @@ void ProgramController::GlContextCreated()
     LOG_GL("GetIntegerv(GL_PROGRAM_BINARY_FORMATS_OES) = %d\n", programBinaryFormats[0] );
     mProgramBinaryFormat = programBinaryFormats[0];
   }
+
+  // identify the driver, so binaries stored by a different driver (version) are not used
+  std::string driver;
+  const GLenum driverStrings[] = { GL_VENDOR, GL_RENDERER, GL_VERSION };
+  for( unsigned int i = 0; i < sizeof( driverStrings ) / sizeof( driverStrings[0] ); ++i )
+  {
+    const GLubyte* value = CHECK_GL( mGlAbstraction, mGlAbstraction.GetString( driverStrings[i] ) );
+    if( value )
+    {
+      driver += reinterpret_cast< const char* >( value );
+    }
+    driver += '\n';
+  }
+  mDriverIdentity = CalculateHash( driver );
+  LOG_GL( "GetString(GL_VENDOR, GL_RENDERER, GL_VERSION) = %s\n", driver.c_str() );
 }
 
 void ProgramController::GlContextDestroyed()
 {
   mNumberOfProgramBinaryFormats = 0;
   mProgramBinaryFormat = 0;
+  mDriverIdentity = 0;
 
   SetCurrentProgram( NULL );
   // Inform programs they are no longer valid
@@ -101,16 +120,7 @@ Integration::GlAbstraction& ProgramController::GetGlAbstraction()
 Program* ProgramController::GetProgram( size_t shaderHash )
 {
   Program* program = NULL;
-  const ProgramIterator end = mProgramCache.End();
-  for ( ProgramIterator iter = mProgramCache.Begin(); iter != end; ++iter )
-  {
-    size_t hash = (*iter)->GetHash();
-    if( shaderHash == hash )
-    {
-      program = (*iter)->GetProgram();
-      break;
-    }
-  }
+  mProgramTable.Find( shaderHash, program );
   return program;
 }
 
@@ -119,6 +129,7 @@ void ProgramController::AddProgram( size_t shaderHash, Program* program )
   // we expect unique hash values so its event thread sides job to guarantee that
   // AddProgram is only called after program checks that GetProgram returns NULL
   mProgramCache.PushBack( new ProgramPair( program, shaderHash ) );
+  mProgramTable.Insert( shaderHash, program );
 }
 
 Program* ProgramController::GetCurrentProgram()
@@ -141,6 +152,11 @@ unsigned int ProgramController::ProgramBinaryFormat()
   return mProgramBinaryFormat;
 }
 
+size_t ProgramController::GetDriverIdentity()
+{
+  return mDriverIdentity;
+}
+
 void ProgramController::StoreBinary( Internal::ShaderDataPtr programData )
 {
   DALI_ASSERT_DEBUG( programData->GetBufferSize() > 0 );
@@ -152,6 +168,11 @@ void ProgramController::StoreBinary( Internal::ShaderDataPtr programData )
   }
 }
 
+void ProgramController::IncrementRedundantUniformCount()
+{
+  ++mRedundantUniformCount;
+}
+
 void ProgramController::SetShaderSaver( ShaderSaver& shaderSaver )
 {
   mShaderSaver = &shaderSaver;
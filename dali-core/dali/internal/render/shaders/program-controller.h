@@ -20,6 +20,7 @@
 
 // INTERNAL INCLUDES
 #include <dali/devel-api/common/owner-container.h>
+#include <dali/internal/common/hash-map.h>
 #include <dali/internal/render/shaders/program.h>
 #include <dali/internal/render/shaders/program-cache.h>
 
@@ -123,6 +124,22 @@ public: // API
    */
   void SetShaderSaver( ShaderSaver& shaderSaver );
 
+  /**
+   * Resets the count of redundant uniform calls. Called at the beginning of every frame
+   */
+  void ClearRedundantUniformCount()
+  {
+    mRedundantUniformCount = 0u;
+  }
+
+  /**
+   * @return the number of uniform calls skipped since the count was cleared, as their values were already set
+   */
+  unsigned int GetRedundantUniformCount() const
+  {
+    return mRedundantUniformCount;
+  }
+
 private: // From ProgramCache
 
   /**
@@ -160,11 +177,21 @@ private: // From ProgramCache
    */
   virtual GLenum ProgramBinaryFormat();
 
+  /**
+   * @copydoc ProgramCache::GetDriverIdentity
+   */
+  virtual size_t GetDriverIdentity();
+
   /**
    * @copydoc ProgramCache::StoreBinary
    */
   virtual void StoreBinary( Internal::ShaderDataPtr programData );
 
+  /**
+   * @copydoc ProgramCache::IncrementRedundantUniformCount
+   */
+  virtual void IncrementRedundantUniformCount();
+
 private: // not implemented as non-copyable
 
   ProgramController( const ProgramController& rhs );
@@ -179,10 +206,15 @@ private: // Data
   typedef OwnerContainer< ProgramPair* > ProgramContainer;
   typedef ProgramContainer::Iterator ProgramIterator;
   ProgramContainer mProgramCache;
+  HashMap< Program* > mProgramTable; ///< Finds the programs in mProgramCache by their hash
+
+  size_t mDriverIdentity;
 
   GLint mProgramBinaryFormat;
   GLint mNumberOfProgramBinaryFormats;
 
+  unsigned int mRedundantUniformCount; ///< The number of uniform calls skipped this frame
+
 };
 
 } // namespace Internal
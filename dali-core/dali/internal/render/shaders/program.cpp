@@ -19,6 +19,7 @@
 #include <dali/internal/render/shaders/program.h>
 
 // EXTERNAL INCLUDES
+#include <cstring>
 #include <iomanip>
 
 // INTERNAL INCLUDES
@@ -80,6 +81,8 @@ const char* gStdAttribs[ Program::ATTRIB_TYPE_LAST ] =
 {
   "aPosition",    // ATTRIB_POSITION
   "aTexCoord",    // ATTRIB_TEXCOORD
+  "aInstanceModelView", // ATTRIB_INSTANCE_MODELVIEW
+  "aInstanceColor",     // ATTRIB_INSTANCE_COLOR
 };
 
 const char* gStdUniforms[ Program::UNIFORM_TYPE_LAST ] =
@@ -162,7 +165,7 @@ unsigned int Program::RegisterCustomAttribute( const std::string& name )
     }
   }
   // if we get here, index is one past end so push back the new name
-  mAttributeLocations.push_back( std::make_pair( name, ATTRIB_UNKNOWN ) );
+  mAttributeLocations.push_back( std::make_pair( name, ATTRIB_NOT_QUERIED ) );
   return index;
 }
 
@@ -174,7 +177,7 @@ GLint Program::GetCustomAttributeLocation( unsigned int attributeIndex )
   // check if we have already queried the location of the attribute
   GLint location = mAttributeLocations[ attributeIndex ].second;
 
-  if( location == ATTRIB_UNKNOWN )
+  if( location == ATTRIB_NOT_QUERIED )
   {
     location = CHECK_GL( mGlAbstraction, mGlAbstraction.GetAttribLocation( mProgramId, mAttributeLocations[ attributeIndex ].first.c_str() ) );
 
@@ -277,6 +280,10 @@ void Program::SetUniform1i( GLint location, GLint value0 )
       // update cache
       mUniformCacheInt[ location ] = value0;
     }
+    else
+    {
+      mCache.IncrementRedundantUniformCount();
+    }
   }
 }
 
@@ -328,6 +335,10 @@ void Program::SetUniform1f( GLint location, GLfloat value0 )
       // update cache
       mUniformCacheFloat[ location ] = value0;
     }
+    else
+    {
+      mCache.IncrementRedundantUniformCount();
+    }
   }
 }
 
@@ -364,6 +375,10 @@ void Program::SetUniform2f( GLint location, GLfloat value0, GLfloat value1 )
       mUniformCacheFloat2[ location ][ 0 ] = value0;
       mUniformCacheFloat2[ location ][ 1 ] = value1;
     }
+    else
+    {
+      mCache.IncrementRedundantUniformCount();
+    }
   }
 }
 
@@ -378,6 +393,10 @@ void Program::SetSizeUniform3f( GLint location, GLfloat value0, GLfloat value1,
     mSizeUniformCache.z = value2;
     SetUniform3f( location, value0, value1, value2 );
   }
+  else
+  {
+    mCache.IncrementRedundantUniformCount();
+  }
 }
 
 void Program::SetUniform3f( GLint location, GLfloat value0, GLfloat value1, GLfloat value2 )
@@ -392,9 +411,34 @@ void Program::SetUniform3f( GLint location, GLfloat value0, GLfloat value1, GLfl
     return;
   }
 
-  // Not caching these as based on current analysis this is not called that often by our shaders
-  LOG_GL( "Uniform3f(%d,%f,%f,%f)\n", location, value0, value1, value2 );
-  CHECK_GL( mGlAbstraction, mGlAbstraction.Uniform3f( location, value0, value1, value2 ) );
+  // check if uniform location fits the cache
+  if( location >= MAX_UNIFORM_CACHE_SIZE )
+  {
+    // not cached, make the gl call
+    LOG_GL( "Uniform3f(%d,%f,%f,%f)\n", location, value0, value1, value2 );
+    CHECK_GL( mGlAbstraction, mGlAbstraction.Uniform3f( location, value0, value1, value2 ) );
+  }
+  else
+  {
+    // check if the same value has already been set, reset if any component is different
+    if( ( fabsf(value0 - mUniformCacheFloat3[ location ][ 0 ]) >= Math::MACHINE_EPSILON_1 )||
+        ( fabsf(value1 - mUniformCacheFloat3[ location ][ 1 ]) >= Math::MACHINE_EPSILON_1 )||
+        ( fabsf(value2 - mUniformCacheFloat3[ location ][ 2 ]) >= Math::MACHINE_EPSILON_1 ) )
+    {
+      // make the gl call
+      LOG_GL( "Uniform3f(%d,%f,%f,%f)\n", location, value0, value1, value2 );
+      CHECK_GL( mGlAbstraction, mGlAbstraction.Uniform3f( location, value0, value1, value2 ) );
+
+      // update cache
+      mUniformCacheFloat3[ location ][ 0 ] = value0;
+      mUniformCacheFloat3[ location ][ 1 ] = value1;
+      mUniformCacheFloat3[ location ][ 2 ] = value2;
+    }
+    else
+    {
+      mCache.IncrementRedundantUniformCount();
+    }
+  }
 }
 
 void Program::SetUniform4f( GLint location, GLfloat value0, GLfloat value1, GLfloat value2, GLfloat value3 )
@@ -434,6 +478,10 @@ void Program::SetUniform4f( GLint location, GLfloat value0, GLfloat value1, GLfl
       mUniformCacheFloat4[ location ][ 2 ] = value2;
       mUniformCacheFloat4[ location ][ 3 ] = value3;
     }
+    else
+    {
+      mCache.IncrementRedundantUniformCount();
+    }
   }
 }
 
@@ -449,8 +497,18 @@ void Program::SetUniformMatrix4fv( GLint location, GLsizei count, const GLfloat*
     return;
   }
 
-  // Not caching these calls. Based on current analysis this is called very often
-  // but with different values (we're using this for MVP matrices)
+  // Only single matrices are cached; the matrices of static actors & cameras do not change between frames.
+  // Matrices are compared bitwise as comparing each element with a tolerance costs more than the upload it saves
+  if( count == 1 && location < MAX_UNIFORM_CACHE_SIZE )
+  {
+    if( 0 == memcmp( value, mUniformCacheMatrix4[ location ], sizeof( mUniformCacheMatrix4[ location ] ) ) )
+    {
+      mCache.IncrementRedundantUniformCount();
+      return;
+    }
+    memcpy( mUniformCacheMatrix4[ location ], value, sizeof( mUniformCacheMatrix4[ location ] ) );
+  }
+
   // NOTE! we never want driver or GPU to transpose
   LOG_GL( "UniformMatrix4fv(%d,%d,GL_FALSE,%x)\n", location, count, value );
   CHECK_GL( mGlAbstraction, mGlAbstraction.UniformMatrix4fv( location, count, GL_FALSE, value ) );
@@ -468,9 +526,17 @@ void Program::SetUniformMatrix3fv( GLint location, GLsizei count, const GLfloat*
     return;
   }
 
+  // Only single matrices are cached, compared bitwise like the 4x4 matrices
+  if( count == 1 && location < MAX_UNIFORM_CACHE_SIZE )
+  {
+    if( 0 == memcmp( value, mUniformCacheMatrix3[ location ], sizeof( mUniformCacheMatrix3[ location ] ) ) )
+    {
+      mCache.IncrementRedundantUniformCount();
+      return;
+    }
+    memcpy( mUniformCacheMatrix3[ location ], value, sizeof( mUniformCacheMatrix3[ location ] ) );
+  }
 
-  // Not caching these calls. Based on current analysis this is called very often
-  // but with different values (we're using this for MVP matrices)
   // NOTE! we never want driver or GPU to transpose
   LOG_GL( "UniformMatrix3fv(%d,%d,GL_FALSE,%x)\n", location, count, value );
   CHECK_GL( mGlAbstraction, mGlAbstraction.UniformMatrix3fv( location, count, GL_FALSE, value ) );
@@ -543,8 +609,9 @@ void Program::Load()
 
   const bool binariesSupported = mCache.IsBinarySupported();
 
-  // if shader binaries are supported and ShaderData contains compiled bytecode?
-  if( binariesSupported && mProgramData->HasBinary() )
+  // if shader binaries are supported and ShaderData contains compiled bytecode from this driver?
+  if( binariesSupported && mProgramData->HasBinary() &&
+      ( mProgramData->GetDriverIdentity() == 0 || mProgramData->GetDriverIdentity() == mCache.GetDriverIdentity() ) )
   {
     DALI_LOG_INFO(Debug::Filter::gShader, Debug::General, "Program::Load() - Using Compiled Shader, Size = %d\n", mProgramData->GetBufferSize());
 
@@ -604,6 +671,7 @@ void Program::Load()
             mProgramData->AllocateBuffer(binaryLength);
             // Copy the bytecode to ShaderData
             CHECK_GL( mGlAbstraction, mGlAbstraction.GetProgramBinary(mProgramId, binaryLength, NULL, &binaryFormat, mProgramData->GetBufferData()) );
+            mProgramData->SetDriverIdentity( mCache.GetDriverIdentity() );
             mCache.StoreBinary( mProgramData );
             DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, "Saved binary.\n" );
           }
@@ -732,7 +800,7 @@ void Program::ResetAttribsUniformCache()
   // reset attribute locations
   for( unsigned i = 0; i < mAttributeLocations.size() ; ++i )
   {
-    mAttributeLocations[ i ].second = ATTRIB_UNKNOWN;
+    mAttributeLocations[ i ].second = ATTRIB_NOT_QUERIED;
   }
 
   // reset all gl uniform locations
@@ -757,11 +825,18 @@ void Program::ResetAttribsUniformCache()
     mUniformCacheFloat[ i ] = 0.0f;
     mUniformCacheFloat2[ i ][ 0 ] = 0.0f;
     mUniformCacheFloat2[ i ][ 1 ] = 0.0f;
+    mUniformCacheFloat3[ i ][ 0 ] = 0.0f;
+    mUniformCacheFloat3[ i ][ 1 ] = 0.0f;
+    mUniformCacheFloat3[ i ][ 2 ] = 0.0f;
     mUniformCacheFloat4[ i ][ 0 ] = 0.0f;
     mUniformCacheFloat4[ i ][ 1 ] = 0.0f;
     mUniformCacheFloat4[ i ][ 2 ] = 0.0f;
     mUniformCacheFloat4[ i ][ 3 ] = 0.0f;
   }
+
+  // GL initializes uniforms to 0
+  memset( mUniformCacheMatrix3, 0, sizeof( mUniformCacheMatrix3 ) );
+  memset( mUniformCacheMatrix4, 0, sizeof( mUniformCacheMatrix4 ) );
 }
 
 } // namespace Internal
@@ -72,9 +72,12 @@ public:
    */
   enum AttribType
   {
+    ATTRIB_NOT_QUERIED = -2,
     ATTRIB_UNKNOWN = -1,
     ATTRIB_POSITION,
     ATTRIB_TEXCOORD,
+    ATTRIB_INSTANCE_MODELVIEW,
+    ATTRIB_INSTANCE_COLOR,
     ATTRIB_TYPE_LAST
   };
 
@@ -227,6 +230,7 @@ public:
   /**
    * Sets the uniform value as matrix. NOTE! we never want GPU to transpose
    * so make sure your matrix is in correct order for GL.
+   * A single matrix is only uploaded if it differs from the one already set.
    * @param [in] location Location of uniform
    * @param [in] count Count of matrices
    * @param [in] value values as float pointers
@@ -236,6 +240,7 @@ public:
   /**
    * Sets the uniform value as matrix. NOTE! we never want GPU to transpose
    * so make sure your matrix is in correct order for GL.
+   * A single matrix is only uploaded if it differs from the one already set.
    * @param [in] location Location of uniform
    * @param [in] count Count of matrices
    * @param [in] value values as float pointers
@@ -369,11 +374,14 @@ private:  // Data
   Dali::Vector< GLint > mSamplerUniformLocations; ///< sampler uniform location cache
 
   // uniform value caching
-  GLint mUniformCacheInt[ MAX_UNIFORM_CACHE_SIZE ];         ///< Value cache for uniforms of single int
-  GLfloat mUniformCacheFloat[ MAX_UNIFORM_CACHE_SIZE ];     ///< Value cache for uniforms of single float
-  GLfloat mUniformCacheFloat2[ MAX_UNIFORM_CACHE_SIZE ][2]; ///< Value cache for uniforms of two floats
-  GLfloat mUniformCacheFloat4[ MAX_UNIFORM_CACHE_SIZE ][4]; ///< Value cache for uniforms of four floats
-  Vector3 mSizeUniformCache;                                ///< Cache value for size uniform
+  GLint mUniformCacheInt[ MAX_UNIFORM_CACHE_SIZE ];           ///< Value cache for uniforms of single int
+  GLfloat mUniformCacheFloat[ MAX_UNIFORM_CACHE_SIZE ];       ///< Value cache for uniforms of single float
+  GLfloat mUniformCacheFloat2[ MAX_UNIFORM_CACHE_SIZE ][2];   ///< Value cache for uniforms of two floats
+  GLfloat mUniformCacheFloat3[ MAX_UNIFORM_CACHE_SIZE ][3];   ///< Value cache for uniforms of three floats
+  GLfloat mUniformCacheFloat4[ MAX_UNIFORM_CACHE_SIZE ][4];   ///< Value cache for uniforms of four floats
+  GLfloat mUniformCacheMatrix3[ MAX_UNIFORM_CACHE_SIZE ][9];  ///< Value cache for uniforms of a single 3x3 matrix
+  GLfloat mUniformCacheMatrix4[ MAX_UNIFORM_CACHE_SIZE ][16]; ///< Value cache for uniforms of a single 4x4 matrix
+  Vector3 mSizeUniformCache;                                  ///< Cache value for size uniform
   bool mModifiesGeometry;  ///< True if the program changes geometry
 
 };
@@ -71,6 +71,24 @@ public:
     mProperty = NULL;
   }
 
+  /**
+   * Retrieve the property being accessed.
+   * @return The property, or NULL if the accessor has been reset.
+   */
+  const SceneGraph::PropertyBase* GetProperty() const
+  {
+    return mProperty;
+  }
+
+  /**
+   * Retrieve the property being accessed, for writing.
+   * @return The property, or NULL if the accessor has been reset.
+   */
+  SceneGraph::AnimatableProperty<PropertyType>* GetAnimatableProperty() const
+  {
+    return mProperty;
+  }
+
   /**
    * @copydoc Dali::Internal::SceneGraph::PropertyBase::IsClean()
    */
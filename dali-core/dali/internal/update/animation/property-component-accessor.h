@@ -71,6 +71,15 @@ public:
     mProperty = NULL;
   }
 
+  /**
+   * Retrieve the property being accessed.
+   * @return The property, or NULL if the accessor has been reset.
+   */
+  const SceneGraph::PropertyBase* GetProperty() const
+  {
+    return mProperty;
+  }
+
   /**
    * @copydoc Dali::Internal::SceneGraph::PropertyBase::IsClean()
    */
@@ -163,6 +172,15 @@ public:
     mProperty = NULL;
   }
 
+  /**
+   * Retrieve the property being accessed.
+   * @return The property, or NULL if the accessor has been reset.
+   */
+  const SceneGraph::PropertyBase* GetProperty() const
+  {
+    return mProperty;
+  }
+
   /**
    * @copydoc Dali::Internal::SceneGraph::PropertyBase::IsClean()
    */
@@ -255,6 +273,15 @@ public:
     mProperty = NULL;
   }
 
+  /**
+   * Retrieve the property being accessed.
+   * @return The property, or NULL if the accessor has been reset.
+   */
+  const SceneGraph::PropertyBase* GetProperty() const
+  {
+    return mProperty;
+  }
+
   /**
    * @copydoc Dali::Internal::SceneGraph::PropertyBase::IsClean()
    */
@@ -347,6 +374,15 @@ public:
     mProperty = NULL;
   }
 
+  /**
+   * Retrieve the property being accessed.
+   * @return The property, or NULL if the accessor has been reset.
+   */
+  const SceneGraph::PropertyBase* GetProperty() const
+  {
+    return mProperty;
+  }
+
   /**
    * @copydoc Dali::Internal::SceneGraph::PropertyBase::IsClean()
    */
@@ -19,6 +19,7 @@
 #include <dali/internal/update/animation/scene-graph-animation.h>
 
 // EXTERNAL INCLUDES
+#include <algorithm> // std::sort
 #include <cmath> // fmod
 
 // INTERNAL INCLUDES
@@ -33,6 +34,12 @@ namespace Internal
 namespace SceneGraph
 {
 
+namespace
+{
+
+const unsigned int MINIMUM_BATCHED_ANIMATOR_COUNT = 16u; ///< Smaller animations are updated one animator at a time
+
+} // unnamed namespace
 
 Animation::Animation( float durationSeconds, float speedFactor, const Vector2& playRange, bool isLooping, Dali::Animation::EndAction endAction, Dali::Animation::EndAction disconnectAction )
 : mDurationSeconds(durationSeconds),
@@ -43,7 +50,10 @@ Animation::Animation( float durationSeconds, float speedFactor, const Vector2& p
   mState(Stopped),
   mElapsedSeconds(playRange.x*mDurationSeconds),
   mPlayCount(0),
-  mPlayRange( playRange )
+  mPlayRange( playRange ),
+  mAnimators(),
+  mAnimatorBatches(),
+  mAnimatorsChanged( false )
 {
 }
 
@@ -198,6 +208,7 @@ void Animation::AddAnimator( AnimatorBase* animator )
   animator->SetDisconnectAction( mDisconnectAction );
 
   mAnimators.PushBack( animator );
+  mAnimatorsChanged = true;
 }
 
 bool Animation::Update(BufferIndex bufferIndex, float elapsedSeconds)
@@ -250,54 +261,102 @@ void Animation::UpdateAnimators( BufferIndex bufferIndex, bool bake, bool animat
 {
   float elapsedSecondsClamped = Clamp( mElapsedSeconds, mPlayRange.x * mDurationSeconds,mPlayRange.y * mDurationSeconds );
 
-  //Loop through all animators
-  bool applied(true);
+  //Remove animators whose PropertyOwner has been destroyed
   for ( AnimatorIter iter = mAnimators.Begin(); iter != mAnimators.End(); )
   {
-    AnimatorBase *animator = *iter;
-
-    if( animator->Orphan() )
+    if( (*iter)->Orphan() )
     {
-      //Remove animators whose PropertyOwner has been destroyed
       iter = mAnimators.Erase(iter);
+      mAnimatorsChanged = true;
     }
     else
     {
-      if( animator->IsEnabled() )
+      ++iter;
+    }
+  }
+
+  if( mAnimatorsChanged )
+  {
+    BuildAnimatorBatches();
+  }
+
+  mAnimatorBatches.Update( bufferIndex, elapsedSecondsClamped, mSpeedFactor < 0.0f, bake );
+
+  //Loop through all animators
+  bool applied(true);
+  for ( AnimatorIter iter = mAnimators.Begin(), endIter = mAnimators.End(); iter != endIter; ++iter )
+  {
+    AnimatorBase *animator = *iter;
+
+    if( animator->IsEnabled() )
+    {
+      const float initialDelay(animator->GetInitialDelay());
+      if ( !animator->IsBatched() && ( elapsedSecondsClamped >= initialDelay || mSpeedFactor < 0.0f ) )
       {
-        const float initialDelay(animator->GetInitialDelay());
-        if (elapsedSecondsClamped >= initialDelay || mSpeedFactor < 0.0f )
+        // Calculate a progress specific to each individual animator
+        float progress(1.0f);
+        const float animatorDuration = animator->GetDuration();
+        if (animatorDuration > 0.0f) // animators can be "immediate"
         {
-          // Calculate a progress specific to each individual animator
-          float progress(1.0f);
-          const float animatorDuration = animator->GetDuration();
-          if (animatorDuration > 0.0f) // animators can be "immediate"
-          {
-            progress = Clamp((elapsedSecondsClamped - initialDelay) / animatorDuration, 0.0f , 1.0f );
-          }
-          animator->Update(bufferIndex, progress, bake);
+          progress = Clamp((elapsedSecondsClamped - initialDelay) / animatorDuration, 0.0f , 1.0f );
         }
-        applied = true;
-      }
-      else
-      {
-        applied = false;
-      }
-
-      if ( animationFinished )
-      {
-        animator->SetActive( false );
+        animator->Update(bufferIndex, progress, bake);
       }
+      applied = true;
+    }
+    else
+    {
+      applied = false;
+    }
 
-      if (applied)
-      {
-        INCREASE_COUNTER(PerformanceMonitor::ANIMATORS_APPLIED);
-      }
+    if ( animationFinished )
+    {
+      animator->SetActive( false );
+    }
 
-      ++iter;
+    if (applied)
+    {
+      INCREASE_COUNTER(PerformanceMonitor::ANIMATORS_APPLIED);
     }
   }
+}
+
+void Animation::BuildAnimatorBatches()
+{
+  mAnimatorsChanged = false;
+  mAnimatorBatches.Clear();
+
+  for ( AnimatorIter iter = mAnimators.Begin(), endIter = mAnimators.End(); iter != endIter; ++iter )
+  {
+    (*iter)->SetBatched( false );
+  }
+
+  const unsigned int count = mAnimators.Count();
+  if( count < MINIMUM_BATCHED_ANIMATOR_COUNT )
+  {
+    return;
+  }
+
+  // Find the properties which are changed by more than one animator
+  Dali::Vector< const PropertyBase* > properties;
+  properties.Reserve( count );
+  for ( AnimatorIter iter = mAnimators.Begin(), endIter = mAnimators.End(); iter != endIter; ++iter )
+  {
+    properties.PushBack( (*iter)->GetTargetProperty() );
+  }
+  std::sort( properties.Begin(), properties.End() );
+
+  for ( AnimatorIter iter = mAnimators.Begin(), endIter = mAnimators.End(); iter != endIter; ++iter )
+  {
+    AnimatorBase* animator = *iter;
+    const PropertyBase* property = animator->GetTargetProperty();
 
+    const std::pair< const PropertyBase**, const PropertyBase** > range = std::equal_range( properties.Begin(), properties.End(), property );
+    if( ( range.second - range.first == 1 ) && animator->AddToBatch( mAnimatorBatches ) )
+    {
+      animator->SetBatched( true );
+    }
+  }
 }
 
 } // namespace SceneGraph
@@ -25,6 +25,7 @@
 #include <dali/internal/common/message.h>
 #include <dali/internal/event/common/event-thread-services.h>
 #include <dali/internal/update/animation/scene-graph-animator.h>
+#include <dali/internal/update/animation/scene-graph-animator-batch.h>
 
 namespace Dali
 {
@@ -274,6 +275,13 @@ private:
    */
   void UpdateAnimators( BufferIndex bufferIndex, bool bake, bool animationFinished );
 
+  /**
+   * Sort the animators into batches, when the animation has enough animators.
+   * Animators which share a property with another animator of this animation are not batched,
+   * so that they are still applied in the order they were added.
+   */
+  void BuildAnimatorBatches();
+
   /**
    * Helper function to bake the result of the animation when it is stopped or
    * destroyed.
@@ -308,6 +316,8 @@ protected:
 
   Vector2 mPlayRange;
   AnimatorContainer mAnimators;
+  AnimatorBatches mAnimatorBatches;  ///< The animators which are updated together, by property type & alpha function
+  bool mAnimatorsChanged;            ///< Set when animators are added or removed, and the batches must be rebuilt
 };
 
 }; //namespace SceneGraph
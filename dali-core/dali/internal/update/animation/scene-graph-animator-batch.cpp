@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/update/animation/scene-graph-animator-batch.h>
+
+// INTERNAL INCLUDES
+#include <dali/public-api/math/math-utils.h>
+#include <dali/internal/update/animation/property-accessor.h>
+#include <dali/internal/update/animation/scene-graph-animator.h>
+#include <dali/internal/update/common/property-owner.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+
+namespace
+{
+
+/**
+ * Add an animator to the batch for its property type & alpha function, if its function interpolates linearly.
+ */
+template < typename PropertyType >
+bool AddToBatch( AnimatorBatches& batches, AnimatorBase& animator, PropertyOwner& propertyOwner, PropertyAccessor< PropertyType >& accessor, AnimatorFunctionBase& function )
+{
+  const AlphaFunction alphaFunction = animator.GetAlphaFunction();
+  if( ( alphaFunction.GetMode() != AlphaFunction::BUILTIN_FUNCTION ) || !accessor.IsSet() )
+  {
+    return false;
+  }
+
+  PropertyType value;
+  float currentWeight( 0.0f );
+  if( !function.GetLinearInterpolation( value, currentWeight ) )
+  {
+    return false;
+  }
+
+  AnimatorBatch< PropertyType >& batch = batches.GetBatch< PropertyType >( alphaFunction.GetBuiltinFunction() );
+  batch.Add( animator, propertyOwner, *accessor.GetAnimatableProperty(), value, currentWeight );
+  return true;
+}
+
+} // unnamed namespace
+
+AnimatorBatchBase::AnimatorBatchBase( Property::Type propertyType, AlphaFunction::BuiltinFunction alphaFunction )
+: mPropertyType( propertyType ),
+  mAlphaFunction( alphaFunction ),
+  mAnimators(),
+  mPropertyOwners(),
+  mDelays(),
+  mDurations(),
+  mCurrentWeights(),
+  mProgress(),
+  mAlpha(),
+  mApplied()
+{
+}
+
+AnimatorBatchBase::~AnimatorBatchBase()
+{
+}
+
+void AnimatorBatchBase::Update( BufferIndex bufferIndex, float elapsedSeconds, bool reverse, bool bake )
+{
+  const unsigned int count = mAnimators.Count();
+  mProgress.Resize( count );
+  mApplied.Resize( count );
+
+  // Calculate a progress specific to each individual animator
+  for( unsigned int i = 0u; i < count; ++i )
+  {
+    mApplied[i] = ( elapsedSeconds >= mDelays[i] ) || reverse;
+
+    float progress( 1.0f );
+    if( mDurations[i] > 0.0f ) // animators can be "immediate"
+    {
+      progress = Clamp( ( elapsedSeconds - mDelays[i] ) / mDurations[i], 0.0f, 1.0f );
+    }
+    mProgress[i] = progress;
+  }
+
+  mAlpha = mProgress;
+  AnimatorBase::ApplyBuiltinAlphaFunction( mAlphaFunction, mAlpha.Begin(), count );
+
+  // Animators of disabled property owners are skipped, as in Animation::UpdateAnimators()
+  for( unsigned int i = 0u; i < count; ++i )
+  {
+    mApplied[i] = mApplied[i] && mAnimators[i]->IsEnabled();
+  }
+
+  UpdateProperties( bufferIndex, bake );
+
+  for( unsigned int i = 0u; i < count; ++i )
+  {
+    if( mApplied[i] )
+    {
+      // The animated property is reset in the following frames
+      mPropertyOwners[i]->RequestReset();
+
+      mAnimators[i]->SetCurrentProgress( mProgress[i] );
+    }
+  }
+}
+
+void AnimatorBatchBase::AddAnimator( AnimatorBase& animator, PropertyOwner& propertyOwner, float currentWeight )
+{
+  mAnimators.PushBack( &animator );
+  mPropertyOwners.PushBack( &propertyOwner );
+  mDelays.PushBack( animator.GetInitialDelay() );
+  mDurations.PushBack( animator.GetDuration() );
+  mCurrentWeights.PushBack( currentWeight );
+}
+
+AnimatorBatches::AnimatorBatches()
+: mBatches()
+{
+}
+
+AnimatorBatches::~AnimatorBatches()
+{
+}
+
+void AnimatorBatches::Clear()
+{
+  mBatches.Clear();
+}
+
+void AnimatorBatches::Update( BufferIndex bufferIndex, float elapsedSeconds, bool reverse, bool bake )
+{
+  for( BatchContainer::Iterator iter = mBatches.Begin(), endIter = mBatches.End(); iter != endIter; ++iter )
+  {
+    ( *iter )->Update( bufferIndex, elapsedSeconds, reverse, bake );
+  }
+}
+
+bool AddAnimatorToBatch( AnimatorBatches& batches, AnimatorBase& animator, PropertyOwner& propertyOwner, PropertyAccessor<float>& accessor, AnimatorFunctionBase& function )
+{
+  return AddToBatch( batches, animator, propertyOwner, accessor, function );
+}
+
+bool AddAnimatorToBatch( AnimatorBatches& batches, AnimatorBase& animator, PropertyOwner& propertyOwner, PropertyAccessor<Vector2>& accessor, AnimatorFunctionBase& function )
+{
+  return AddToBatch( batches, animator, propertyOwner, accessor, function );
+}
+
+bool AddAnimatorToBatch( AnimatorBatches& batches, AnimatorBase& animator, PropertyOwner& propertyOwner, PropertyAccessor<Vector3>& accessor, AnimatorFunctionBase& function )
+{
+  return AddToBatch( batches, animator, propertyOwner, accessor, function );
+}
+
+bool AddAnimatorToBatch( AnimatorBatches& batches, AnimatorBase& animator, PropertyOwner& propertyOwner, PropertyAccessor<Vector4>& accessor, AnimatorFunctionBase& function )
+{
+  return AddToBatch( batches, animator, propertyOwner, accessor, function );
+}
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
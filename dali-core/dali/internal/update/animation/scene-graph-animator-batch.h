@@ -0,0 +1,297 @@
+#ifndef __DALI_INTERNAL_SCENE_GRAPH_ANIMATOR_BATCH_H__
+#define __DALI_INTERNAL_SCENE_GRAPH_ANIMATOR_BATCH_H__
+
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali/public-api/animation/alpha-function.h>
+#include <dali/public-api/common/dali-vector.h>
+#include <dali/public-api/object/property-types.h>
+#include <dali/devel-api/common/owner-container.h>
+#include <dali/internal/common/buffer-index.h>
+#include <dali/internal/update/common/animatable-property.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+
+class AnimatorBase;
+class PropertyOwner;
+
+/**
+ * The animators of an animation which change properties of the same type, with the same builtin alpha function.
+ *
+ * The animators are stored as arrays, which are evaluated in separate passes: the progress of each
+ * animator, then the alpha function of the batch, then the property values. Each pass is a simple
+ * loop without virtual calls, which the compiler can vectorize.
+ */
+class AnimatorBatchBase
+{
+public:
+
+  /**
+   * Constructor.
+   * @param[in] propertyType The type of the animated properties.
+   * @param[in] alphaFunction The builtin alpha function of the animators.
+   */
+  AnimatorBatchBase( Property::Type propertyType, AlphaFunction::BuiltinFunction alphaFunction );
+
+  /**
+   * Virtual destructor.
+   */
+  virtual ~AnimatorBatchBase();
+
+  /**
+   * Retrieve the type of the animated properties.
+   * @return The property type.
+   */
+  Property::Type GetPropertyType() const
+  {
+    return mPropertyType;
+  }
+
+  /**
+   * Retrieve the alpha function of the animators.
+   * @return The builtin alpha function.
+   */
+  AlphaFunction::BuiltinFunction GetAlphaFunction() const
+  {
+    return mAlphaFunction;
+  }
+
+  /**
+   * Retrieve the number of animators in the batch.
+   * @return The animator count.
+   */
+  unsigned int GetCount() const
+  {
+    return mAnimators.Count();
+  }
+
+  /**
+   * Update the animated properties.
+   * @param[in] bufferIndex The current update buffer index.
+   * @param[in] elapsedSeconds The elapsed time of the animation, clamped to its play range.
+   * @param[in] reverse True if the animation is played backwards; animators are then applied before their delay.
+   * @param[in] bake True if the final values should be baked.
+   */
+  void Update( BufferIndex bufferIndex, float elapsedSeconds, bool reverse, bool bake );
+
+protected:
+
+  /**
+   * Add the common data of an animator.
+   * @param[in] animator The animator.
+   * @param[in] propertyOwner The owner of the animated property.
+   * @param[in] currentWeight The weight of the current property value.
+   */
+  void AddAnimator( AnimatorBase& animator, PropertyOwner& propertyOwner, float currentWeight );
+
+  /**
+   * Write the property values, using the alpha values of each animator.
+   * @param[in] bufferIndex The current update buffer index.
+   * @param[in] bake True if the values should be baked.
+   */
+  virtual void UpdateProperties( BufferIndex bufferIndex, bool bake ) = 0;
+
+private:
+
+  // Undefined
+  AnimatorBatchBase( const AnimatorBatchBase& );
+
+  // Undefined
+  AnimatorBatchBase& operator=( const AnimatorBatchBase& );
+
+protected:
+
+  Property::Type mPropertyType;
+  AlphaFunction::BuiltinFunction mAlphaFunction;
+
+  Dali::Vector< AnimatorBase* > mAnimators;       ///< The animators (not owned)
+  Dali::Vector< PropertyOwner* > mPropertyOwners; ///< The owners of the animated properties
+  Dali::Vector< float > mDelays;                  ///< The initial delay of each animator
+  Dali::Vector< float > mDurations;               ///< The duration of each animator
+  Dali::Vector< float > mCurrentWeights;          ///< The weight of the current property value; 1 for AnimateTo, 0 for AnimateBy
+  Dali::Vector< float > mProgress;                ///< The progress of each animator, during Update()
+  Dali::Vector< float > mAlpha;                   ///< The alpha of each animator, during Update()
+  Dali::Vector< bool > mApplied;                  ///< Whether each animator is applied, during Update()
+};
+
+/**
+ * A batch of animators which change properties of type PropertyType.
+ */
+template < typename PropertyType >
+class AnimatorBatch : public AnimatorBatchBase
+{
+public:
+
+  /**
+   * Constructor.
+   * @param[in] alphaFunction The builtin alpha function of the animators.
+   */
+  AnimatorBatch( AlphaFunction::BuiltinFunction alphaFunction )
+  : AnimatorBatchBase( PropertyTypes::Get< PropertyType >(), alphaFunction )
+  {
+  }
+
+  /**
+   * Virtual destructor.
+   */
+  virtual ~AnimatorBatch()
+  {
+  }
+
+  /**
+   * Add an animator which interpolates linearly.
+   * @param[in] animator The animator.
+   * @param[in] propertyOwner The owner of the animated property.
+   * @param[in] property The animated property.
+   * @param[in] value The target or relative value.
+   * @param[in] currentWeight The weight of the current property value.
+   */
+  void Add( AnimatorBase& animator,
+            PropertyOwner& propertyOwner,
+            AnimatableProperty< PropertyType >& property,
+            const PropertyType& value,
+            float currentWeight )
+  {
+    AddAnimator( animator, propertyOwner, currentWeight );
+    mProperties.PushBack( &property );
+    mValues.PushBack( value );
+  }
+
+protected:
+
+  /**
+   * @copydoc AnimatorBatchBase::UpdateProperties()
+   */
+  virtual void UpdateProperties( BufferIndex bufferIndex, bool bake )
+  {
+    const unsigned int count = mAnimators.Count();
+    for( unsigned int i = 0u; i < count; ++i )
+    {
+      if( mApplied[i] )
+      {
+        AnimatableProperty< PropertyType >& property = *mProperties[i];
+        const PropertyType& current = property.Get( bufferIndex );
+
+        // Matches the AnimateTo & AnimateBy functions, since current * 1.0f == current & current * 0.0f == 0
+        const PropertyType result( current + ( mValues[i] - current * mCurrentWeights[i] ) * mAlpha[i] );
+        if( bake )
+        {
+          property.Bake( bufferIndex, result );
+        }
+        else
+        {
+          property.Set( bufferIndex, result );
+        }
+      }
+    }
+  }
+
+private:
+
+  Dali::Vector< AnimatableProperty< PropertyType >* > mProperties; ///< The animated properties
+  Dali::Vector< PropertyType > mValues;                            ///< The target or relative value of each animator
+};
+
+/**
+ * The animator batches of an animation.
+ */
+class AnimatorBatches
+{
+public:
+
+  /**
+   * Constructor.
+   */
+  AnimatorBatches();
+
+  /**
+   * Non-virtual destructor.
+   */
+  ~AnimatorBatches();
+
+  /**
+   * Remove all the batches.
+   */
+  void Clear();
+
+  /**
+   * Retrieve the batch for a property type and alpha function, creating it if necessary.
+   * @param[in] alphaFunction The builtin alpha function.
+   * @return The batch.
+   */
+  template < typename PropertyType >
+  AnimatorBatch< PropertyType >& GetBatch( AlphaFunction::BuiltinFunction alphaFunction )
+  {
+    const Property::Type propertyType = PropertyTypes::Get< PropertyType >();
+    for( BatchContainer::Iterator iter = mBatches.Begin(), endIter = mBatches.End(); iter != endIter; ++iter )
+    {
+      if( ( ( *iter )->GetPropertyType() == propertyType ) && ( ( *iter )->GetAlphaFunction() == alphaFunction ) )
+      {
+        return static_cast< AnimatorBatch< PropertyType >& >( **iter );
+      }
+    }
+
+    AnimatorBatch< PropertyType >* batch = new AnimatorBatch< PropertyType >( alphaFunction );
+    mBatches.PushBack( batch );
+    return *batch;
+  }
+
+  /**
+   * Retrieve the number of batches.
+   * @return The batch count.
+   */
+  unsigned int GetCount() const
+  {
+    return mBatches.Count();
+  }
+
+  /**
+   * @copydoc AnimatorBatchBase::Update()
+   */
+  void Update( BufferIndex bufferIndex, float elapsedSeconds, bool reverse, bool bake );
+
+private:
+
+  // Undefined
+  AnimatorBatches( const AnimatorBatches& );
+
+  // Undefined
+  AnimatorBatches& operator=( const AnimatorBatches& );
+
+private:
+
+  typedef OwnerContainer< AnimatorBatchBase* > BatchContainer;
+
+  BatchContainer mBatches;
+};
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // __DALI_INTERNAL_SCENE_GRAPH_ANIMATOR_BATCH_H__
@@ -42,10 +42,14 @@ typedef Dali::Animation::Interpolation Interpolation;
 
 struct AnimatorFunctionBase;
 
+template < typename PropertyType >
+class PropertyAccessor;
+
 namespace SceneGraph
 {
 
 class AnimatorBase;
+class AnimatorBatches;
 
 typedef OwnerContainer< AnimatorBase* > AnimatorContainer;
 
@@ -70,9 +74,11 @@ public:
     mInitialDelaySeconds(0.0f),
     mAlphaFunction(AlphaFunction::DEFAULT),
     mDisconnectAction(Dali::Animation::BakeFinal),
+    mCurrentProgress(0.0f),
     mActive(false),
     mEnabled(true),
-    mConnectedToSceneGraph(false)
+    mConnectedToSceneGraph(false),
+    mBatched(false)
   {
   }
 
@@ -158,80 +164,7 @@ public:
     AlphaFunction::Mode alphaFunctionMode( mAlphaFunction.GetMode() );
     if( alphaFunctionMode == AlphaFunction::BUILTIN_FUNCTION )
     {
-      switch(mAlphaFunction.GetBuiltinFunction())
-      {
-        case AlphaFunction::DEFAULT:
-        case AlphaFunction::LINEAR:
-        {
-          break;
-        }
-        case AlphaFunction::REVERSE:
-        {
-          result = 1.0f-progress;
-          break;
-        }
-        case AlphaFunction::EASE_IN_SQUARE:
-        {
-          result = progress * progress;
-          break;
-        }
-        case AlphaFunction::EASE_OUT_SQUARE:
-        {
-          result = 1.0f - (1.0f-progress) * (1.0f-progress);
-          break;
-        }
-        case AlphaFunction::EASE_IN:
-        {
-          result = progress * progress * progress;
-          break;
-        }
-        case AlphaFunction::EASE_OUT:
-        {
-          result = (progress-1.0f) * (progress-1.0f) * (progress-1.0f) + 1.0f;
-          break;
-        }
-        case AlphaFunction::EASE_IN_OUT:
-        {
-          result = progress*progress*(3.0f-2.0f*progress);
-          break;
-        }
-        case AlphaFunction::EASE_IN_SINE:
-        {
-          result = -1.0f * cosf(progress * Math::PI_2) + 1.0f;
-          break;
-        }
-        case AlphaFunction::EASE_OUT_SINE:
-        {
-          result = sinf(progress * Math::PI_2);
-          break;
-        }
-        case AlphaFunction::EASE_IN_OUT_SINE:
-        {
-          result = -0.5f * (cosf(Math::PI * progress) - 1.0f);
-          break;
-        }
-        case AlphaFunction::BOUNCE:
-        {
-          result = sinf(progress * Math::PI);
-          break;
-        }
-        case AlphaFunction::SIN:
-        {
-          result = 0.5f - cosf(progress * 2.0f * Math::PI) * 0.5f;
-          break;
-        }
-        case AlphaFunction::EASE_OUT_BACK:
-        {
-          const float sqrt2 = 1.70158f;
-          progress -= 1.0f;
-          result = 1.0f + progress * progress * ( ( sqrt2 + 1.0f ) * progress + sqrt2 );
-          break;
-        }
-        case AlphaFunction::COUNT:
-        {
-          break;
-        }
-      }
+      ApplyBuiltinAlphaFunction( mAlphaFunction.GetBuiltinFunction(), &result, 1u );
     }
     else if(  alphaFunctionMode == AlphaFunction::CUSTOM_FUNCTION )
     {
@@ -276,6 +209,127 @@ public:
     return result;
   }
 
+  /**
+   * Applies a builtin alpha function to an array of progress values.
+   * The function is selected once, so that each case is a simple loop over the values.
+   * @param[in] function The builtin alpha function.
+   * @param[in,out] values The progress values, which are replaced by the alpha values.
+   * @param[in] count The number of values.
+   */
+  static void ApplyBuiltinAlphaFunction( AlphaFunction::BuiltinFunction function, float* values, unsigned int count )
+  {
+    switch( function )
+    {
+      case AlphaFunction::DEFAULT:
+      case AlphaFunction::LINEAR:
+      {
+        break;
+      }
+      case AlphaFunction::REVERSE:
+      {
+        for( unsigned int i = 0u; i < count; ++i )
+        {
+          values[i] = 1.0f - values[i];
+        }
+        break;
+      }
+      case AlphaFunction::EASE_IN_SQUARE:
+      {
+        for( unsigned int i = 0u; i < count; ++i )
+        {
+          values[i] = values[i] * values[i];
+        }
+        break;
+      }
+      case AlphaFunction::EASE_OUT_SQUARE:
+      {
+        for( unsigned int i = 0u; i < count; ++i )
+        {
+          values[i] = 1.0f - (1.0f - values[i]) * (1.0f - values[i]);
+        }
+        break;
+      }
+      case AlphaFunction::EASE_IN:
+      {
+        for( unsigned int i = 0u; i < count; ++i )
+        {
+          values[i] = values[i] * values[i] * values[i];
+        }
+        break;
+      }
+      case AlphaFunction::EASE_OUT:
+      {
+        for( unsigned int i = 0u; i < count; ++i )
+        {
+          values[i] = (values[i] - 1.0f) * (values[i] - 1.0f) * (values[i] - 1.0f) + 1.0f;
+        }
+        break;
+      }
+      case AlphaFunction::EASE_IN_OUT:
+      {
+        for( unsigned int i = 0u; i < count; ++i )
+        {
+          values[i] = values[i] * values[i] * (3.0f - 2.0f * values[i]);
+        }
+        break;
+      }
+      case AlphaFunction::EASE_IN_SINE:
+      {
+        for( unsigned int i = 0u; i < count; ++i )
+        {
+          values[i] = -1.0f * cosf(values[i] * Math::PI_2) + 1.0f;
+        }
+        break;
+      }
+      case AlphaFunction::EASE_OUT_SINE:
+      {
+        for( unsigned int i = 0u; i < count; ++i )
+        {
+          values[i] = sinf(values[i] * Math::PI_2);
+        }
+        break;
+      }
+      case AlphaFunction::EASE_IN_OUT_SINE:
+      {
+        for( unsigned int i = 0u; i < count; ++i )
+        {
+          values[i] = -0.5f * (cosf(Math::PI * values[i]) - 1.0f);
+        }
+        break;
+      }
+      case AlphaFunction::BOUNCE:
+      {
+        for( unsigned int i = 0u; i < count; ++i )
+        {
+          values[i] = sinf(values[i] * Math::PI);
+        }
+        break;
+      }
+      case AlphaFunction::SIN:
+      {
+        for( unsigned int i = 0u; i < count; ++i )
+        {
+          values[i] = 0.5f - cosf(values[i] * 2.0f * Math::PI) * 0.5f;
+        }
+        break;
+      }
+      case AlphaFunction::EASE_OUT_BACK:
+      {
+        const float sqrt2 = 1.70158f;
+        for( unsigned int i = 0u; i < count; ++i )
+        {
+          const float progress = values[i] - 1.0f;
+          values[i] = 1.0f + progress * progress * ( ( sqrt2 + 1.0f ) * progress + sqrt2 );
+        }
+        break;
+      }
+      case AlphaFunction::COUNT:
+      {
+        break;
+      }
+    }
+  }
+
   /**
    * Whether to bake the animation if attached property owner is disconnected.
    * Property is only baked if the animator is active.
@@ -339,6 +393,46 @@ public:
    */
   virtual void Update(BufferIndex bufferIndex, float progress, bool bake) = 0;
 
+  /**
+   * Retrieve the property changed by the animator.
+   * @return The property, or NULL if the animator is orphan.
+   */
+  virtual const PropertyBase* GetTargetProperty() const = 0;
+
+  /**
+   * Add the animator to a batch of similar animators, which are updated together instead of by Update().
+   * @param[in] batches The batches of an animation.
+   * @return True if the animator was added, false if it must be updated individually.
+   */
+  virtual bool AddToBatch( AnimatorBatches& batches ) = 0;
+
+  /**
+   * Set the progress of the last update; this is used by animator batches, instead of Update().
+   * @param[in] progress The progress, before the alpha function is applied.
+   */
+  void SetCurrentProgress( float progress )
+  {
+    mCurrentProgress = progress;
+  }
+
+  /**
+   * Set whether the animator is updated by an animator batch.
+   * @param[in] batched True if the animator is in a batch.
+   */
+  void SetBatched( bool batched )
+  {
+    mBatched = batched;
+  }
+
+  /**
+   * Query whether the animator is updated by an animator batch.
+   * @return True if the animator is in a batch.
+   */
+  bool IsBatched() const
+  {
+    return mBatched;
+  }
+
 protected:
 
   /**
@@ -360,11 +454,49 @@ protected:
   AlphaFunction mAlphaFunction;
 
   Dali::Animation::EndAction mDisconnectAction;     ///< EndAction to apply when target object gets disconnected from the stage.
+  float mCurrentProgress;                           ///< The progress of the last update.
   bool mActive:1;                                   ///< Animator is "active" while it's running.
   bool mEnabled:1;                                  ///< Animator is "enabled" while its target object is valid and on the stage.
   bool mConnectedToSceneGraph:1;                    ///< True if ConnectToSceneGraph() has been called in update-thread.
+  bool mBatched:1;                                  ///< True if the animator is updated by an animator batch.
 };
 
+/**
+ * Add an animator to a batch; animators of property components are updated individually.
+ * @return False.
+ */
+template < typename PropertyAccessorType >
+inline bool AddAnimatorToBatch( AnimatorBatches& batches, AnimatorBase& animator, PropertyOwner& propertyOwner, PropertyAccessorType& accessor, AnimatorFunctionBase& function )
+{
+  return false;
+}
+
+/**
+ * Add an animator to a batch, if its function interpolates linearly and its alpha function is builtin.
+ * @param[in] batches The batches of an animation.
+ * @param[in] animator The animator.
+ * @param[in] propertyOwner The owner of the animated property.
+ * @param[in] accessor The animated property.
+ * @param[in] function The animator function.
+ * @return True if the animator was added.
+ */
+bool AddAnimatorToBatch( AnimatorBatches& batches, AnimatorBase& animator, PropertyOwner& propertyOwner, PropertyAccessor<float>& accessor, AnimatorFunctionBase& function );
+
+/**
+ * @copydoc AddAnimatorToBatch(AnimatorBatches&,AnimatorBase&,PropertyOwner&,PropertyAccessor<float>&,AnimatorFunctionBase&)
+ */
+bool AddAnimatorToBatch( AnimatorBatches& batches, AnimatorBase& animator, PropertyOwner& propertyOwner, PropertyAccessor<Vector2>& accessor, AnimatorFunctionBase& function );
+
+/**
+ * @copydoc AddAnimatorToBatch(AnimatorBatches&,AnimatorBase&,PropertyOwner&,PropertyAccessor<float>&,AnimatorFunctionBase&)
+ */
+bool AddAnimatorToBatch( AnimatorBatches& batches, AnimatorBase& animator, PropertyOwner& propertyOwner, PropertyAccessor<Vector3>& accessor, AnimatorFunctionBase& function );
+
+/**
+ * @copydoc AddAnimatorToBatch(AnimatorBatches&,AnimatorBase&,PropertyOwner&,PropertyAccessor<float>&,AnimatorFunctionBase&)
+ */
+bool AddAnimatorToBatch( AnimatorBatches& batches, AnimatorBase& animator, PropertyOwner& propertyOwner, PropertyAccessor<Vector4>& accessor, AnimatorFunctionBase& function );
+
 /**
  * An animator for a specific property type PropertyType.
  */
@@ -479,6 +611,9 @@ public:
       mPropertyAccessor.Set( bufferIndex, result );
     }
 
+    // The animated property is reset in the following frames
+    mPropertyOwner->RequestReset();
+
     mCurrentProgress = progress;
   }
 
@@ -490,6 +625,27 @@ public:
     return (mPropertyOwner == NULL);
   }
 
+  /**
+   * From AnimatorBase.
+   */
+  virtual const PropertyBase* GetTargetProperty() const
+  {
+    return mPropertyAccessor.GetProperty();
+  }
+
+  /**
+   * From AnimatorBase.
+   */
+  virtual bool AddToBatch( AnimatorBatches& batches )
+  {
+    if( NULL == mPropertyOwner )
+    {
+      return false;
+    }
+
+    return AddAnimatorToBatch( batches, *this, *mPropertyOwner, mPropertyAccessor, *mAnimatorFunction );
+  }
+
 private:
 
   /**
@@ -500,8 +656,7 @@ private:
             AnimatorFunctionBase* animatorFunction )
   : mPropertyOwner( propertyOwner ),
     mPropertyAccessor( property ),
-    mAnimatorFunction( animatorFunction ),
-    mCurrentProgress( 0.0f )
+    mAnimatorFunction( animatorFunction )
   {
     // WARNING - this object is created in the event-thread
     // The scene-graph mPropertyOwner object cannot be observed here
@@ -519,7 +674,6 @@ protected:
   PropertyAccessorType mPropertyAccessor;
 
   AnimatorFunctionBase* mAnimatorFunction;
-  float mCurrentProgress;
 };
 
 } // namespace SceneGraph
@@ -580,6 +734,42 @@ struct AnimatorFunctionBase
   {
     return property;
   }
+
+  /**
+   * Query whether the function interpolates linearly i.e. returns property + ( value - property * weight ) * alpha.
+   * Such functions can be evaluated by animator batches, without calling the "()" operator.
+   * @param[out] value The target or relative value.
+   * @param[out] currentWeight The weight of the current property value; 1 for targets and 0 for relative values.
+   * @return True if the function interpolates linearly.
+   */
+  virtual bool GetLinearInterpolation( float& value, float& currentWeight ) const
+  {
+    return false;
+  }
+
+  /**
+   * @copydoc GetLinearInterpolation(float&,float&) const
+   */
+  virtual bool GetLinearInterpolation( Vector2& value, float& currentWeight ) const
+  {
+    return false;
+  }
+
+  /**
+   * @copydoc GetLinearInterpolation(float&,float&) const
+   */
+  virtual bool GetLinearInterpolation( Vector3& value, float& currentWeight ) const
+  {
+    return false;
+  }
+
+  /**
+   * @copydoc GetLinearInterpolation(float&,float&) const
+   */
+  virtual bool GetLinearInterpolation( Vector4& value, float& currentWeight ) const
+  {
+    return false;
+  }
 };
 
 // Update functions
@@ -626,6 +816,13 @@ struct AnimateByFloat : public AnimatorFunctionBase
     return float(property + mRelative * alpha);
   }
 
+  bool GetLinearInterpolation( float& value, float& currentWeight ) const
+  {
+    value = mRelative;
+    currentWeight = 0.0f;
+    return true;
+  }
+
   float mRelative;
 };
 
@@ -641,6 +838,13 @@ struct AnimateToFloat : public AnimatorFunctionBase
     return float(property + ((mTarget - property) * alpha));
   }
 
+  bool GetLinearInterpolation( float& value, float& currentWeight ) const
+  {
+    value = mTarget;
+    currentWeight = 1.0f;
+    return true;
+  }
+
   float mTarget;
 };
 
@@ -656,6 +860,13 @@ struct AnimateByVector2 : public AnimatorFunctionBase
     return Vector2(property + mRelative * alpha);
   }
 
+  bool GetLinearInterpolation( Vector2& value, float& currentWeight ) const
+  {
+    value = mRelative;
+    currentWeight = 0.0f;
+    return true;
+  }
+
   Vector2 mRelative;
 };
 
@@ -671,6 +882,13 @@ struct AnimateToVector2 : public AnimatorFunctionBase
     return Vector2(property + ((mTarget - property) * alpha));
   }
 
+  bool GetLinearInterpolation( Vector2& value, float& currentWeight ) const
+  {
+    value = mTarget;
+    currentWeight = 1.0f;
+    return true;
+  }
+
   Vector2 mTarget;
 };
 
@@ -686,6 +904,13 @@ struct AnimateByVector3 : public AnimatorFunctionBase
     return Vector3(property + mRelative * alpha);
   }
 
+  bool GetLinearInterpolation( Vector3& value, float& currentWeight ) const
+  {
+    value = mRelative;
+    currentWeight = 0.0f;
+    return true;
+  }
+
   Vector3 mRelative;
 };
 
@@ -701,6 +926,13 @@ struct AnimateToVector3 : public AnimatorFunctionBase
     return Vector3(property + ((mTarget - property) * alpha));
   }
 
+  bool GetLinearInterpolation( Vector3& value, float& currentWeight ) const
+  {
+    value = mTarget;
+    currentWeight = 1.0f;
+    return true;
+  }
+
   Vector3 mTarget;
 };
 
@@ -716,6 +948,13 @@ struct AnimateByVector4 : public AnimatorFunctionBase
     return Vector4(property + mRelative * alpha);
   }
 
+  bool GetLinearInterpolation( Vector4& value, float& currentWeight ) const
+  {
+    value = mRelative;
+    currentWeight = 0.0f;
+    return true;
+  }
+
   Vector4 mRelative;
 };
 
@@ -731,6 +970,13 @@ struct AnimateToVector4 : public AnimatorFunctionBase
     return Vector4(property + ((mTarget - property) * alpha));
   }
 
+  bool GetLinearInterpolation( Vector4& value, float& currentWeight ) const
+  {
+    value = mTarget;
+    currentWeight = 1.0f;
+    return true;
+  }
+
   Vector4 mTarget;
 };
 
@@ -36,6 +36,8 @@ ConstraintBase::ConstraintBase( PropertyOwnerContainer& ownerSet )
 : mRemoveAction( Dali::Constraint::DEFAULT_REMOVE_ACTION ),
   mFirstApply( true ),
   mDisconnected( true ),
+  mInGraph( false ),
+  mThreadSafe( false ),
   mObservedOwners( ownerSet )
 {
 #ifdef DEBUG_ENABLED
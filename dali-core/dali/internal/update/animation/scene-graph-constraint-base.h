@@ -73,6 +73,7 @@ public:
     StartObservation();
 
     mDisconnected = false;
+    mInGraph = false;
   }
 
   /**
@@ -91,11 +92,61 @@ public:
     return mRemoveAction;
   }
 
+  /**
+   * @copydoc Dali::Constraint::SetThreadSafe()
+   */
+  void SetThreadSafe( bool threadSafe )
+  {
+    mThreadSafe = threadSafe;
+  }
+
+  /**
+   * Query whether the constraint function may be called on a worker thread, at the same time as other constraint functions.
+   * @return True if the constraint may be applied in parallel with other constraints.
+   */
+  bool IsThreadSafe() const
+  {
+    return mThreadSafe;
+  }
+
   /**
    * Constrain the associated scene object.
+   * This does not update the performance counters, as thread-safe constraints are applied by worker threads.
    * @param[in] updateBufferIndex The current update buffer index.
+   * @return True if the constraint function was called, false if the constraint was skipped.
+   */
+  virtual bool Apply( BufferIndex updateBufferIndex ) = 0;
+
+  /**
+   * Retrieve the property written by the constraint; this is used to order dependent constraints.
+   * @return The target property, or NULL if the constraint has been disconnected.
    */
-  virtual void Apply( BufferIndex updateBufferIndex ) = 0;
+  virtual const PropertyInputImpl* GetTargetProperty() const = 0;
+
+  /**
+   * Retrieve one of the properties read by the constraint; this is used to order dependent constraints.
+   * @param[in] index The index of the input.
+   * @return The input property, or NULL if there is no input with this index.
+   */
+  virtual const PropertyInputImpl* GetInputProperty( unsigned int index ) const = 0;
+
+  /**
+   * Query whether the dependencies of the constraint are known to a ConstraintGraph.
+   * @return True if the constraint has been added to a ConstraintGraph since it was connected.
+   */
+  bool IsInGraph() const
+  {
+    return mInGraph;
+  }
+
+  /**
+   * Set whether the dependencies of the constraint are known to a ConstraintGraph.
+   * @param[in] inGraph True if the constraint has been added to a ConstraintGraph.
+   */
+  void SetInGraph( bool inGraph )
+  {
+    mInGraph = inGraph;
+  }
 
   /**
    * Helper for internal test cases; only available for debug builds.
@@ -203,6 +254,8 @@ protected:
 
   bool mFirstApply   : 1;
   bool mDisconnected : 1;
+  bool mInGraph      : 1;
+  bool mThreadSafe   : 1;
 
 private:
 
@@ -0,0 +1,364 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/update/animation/scene-graph-constraint-graph.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cstring>
+#include <map>
+
+// INTERNAL INCLUDES
+#include <dali/internal/update/animation/scene-graph-constraint-base.h>
+#include <dali/internal/update/common/property-owner.h>
+#include <dali/internal/render/common/performance-monitor.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+
+namespace
+{
+
+const unsigned int MINIMUM_PARALLEL_BATCH_SIZE = 64u; ///< Smaller batches are applied on the update-thread
+const unsigned int MINIMUM_TASK_SIZE = 16u;           ///< The minimum number of constraints applied by each task
+const unsigned int TASKS_PER_THREAD = 2u;             ///< More tasks than threads balance constraints of different cost
+
+/**
+ * The batches which last wrote & read a property, during ConstraintGraph::Build().
+ * The values are the batch index plus one; zero means that the property has not been accessed.
+ */
+struct PropertyAccess
+{
+  PropertyAccess()
+  : writeEnd( 0u ),
+    readEnd( 0u )
+  {
+  }
+
+  unsigned int writeEnd;
+  unsigned int readEnd;
+};
+
+typedef std::map< const PropertyInputImpl*, PropertyAccess > PropertyAccessContainer;
+
+/**
+ * Apply a range of constraints in order.
+ * @return The number of constraint functions which were called.
+ */
+unsigned int ApplyConstraints( ConstraintBase** begin, ConstraintBase** end, BufferIndex updateBufferIndex )
+{
+  unsigned int appliedCount = 0u;
+  for( ConstraintBase** iter = begin; iter != end; ++iter )
+  {
+    if( ( *iter )->Apply( updateBufferIndex ) )
+    {
+      ++appliedCount;
+    }
+  }
+  return appliedCount;
+}
+
+} // unnamed namespace
+
+/**
+ * Applies part of a batch of independent constraints.
+ */
+class ConstraintGraph::BatchTask : public UpdateThreadPool::Task
+{
+public:
+
+  /**
+   * Constructor.
+   */
+  BatchTask()
+  : mBegin( NULL ),
+    mEnd( NULL ),
+    mUpdateBufferIndex( 0u ),
+    mAppliedCount( 0u )
+  {
+  }
+
+  /**
+   * Virtual destructor.
+   */
+  virtual ~BatchTask()
+  {
+  }
+
+  /**
+   * Set the constraints to apply.
+   * @param[in] begin The first constraint.
+   * @param[in] end The end of the constraints.
+   * @param[in] updateBufferIndex The current update buffer index.
+   */
+  void Set( ConstraintBase** begin, ConstraintBase** end, BufferIndex updateBufferIndex )
+  {
+    mBegin = begin;
+    mEnd = end;
+    mUpdateBufferIndex = updateBufferIndex;
+  }
+
+  /**
+   * @copydoc UpdateThreadPool::Task::Execute()
+   */
+  virtual void Execute()
+  {
+    mAppliedCount = ApplyConstraints( mBegin, mEnd, mUpdateBufferIndex );
+  }
+
+  /**
+   * Retrieve the number of constraint functions called by the last Execute().
+   * This is read on the update-thread once the task has completed, instead of updating a counter from each worker.
+   * @return The applied count.
+   */
+  unsigned int GetAppliedCount() const
+  {
+    return mAppliedCount;
+  }
+
+private:
+
+  ConstraintBase** mBegin;
+  ConstraintBase** mEnd;
+  BufferIndex mUpdateBufferIndex;
+  unsigned int mAppliedCount;
+};
+
+ConstraintGraph::ConstraintGraph()
+: mConstraints(),
+  mBuiltConstraints(),
+  mBatchedConstraints(),
+  mBatchEnds(),
+  mTasks(),
+  mParallelTasks(),
+  mParallelBegins(),
+  mThreadSafeCount( 0u ),
+  mConstraintsAdded( false )
+{
+}
+
+ConstraintGraph::~ConstraintGraph()
+{
+}
+
+void ConstraintGraph::Add( PropertyOwner& owner )
+{
+  ConstraintOwnerContainer& constraints = owner.GetConstraints();
+  if( constraints.IsEmpty() )
+  {
+    return;
+  }
+
+  // The constrained properties are reset in the following frames
+  owner.RequestReset();
+
+  const ConstraintIter endIter = constraints.End();
+  for( ConstraintIter iter = constraints.Begin(); iter != endIter; ++iter )
+  {
+    ConstraintBase* constraint = *iter;
+    mConstraints.PushBack( constraint );
+
+    if( constraint->IsThreadSafe() )
+    {
+      ++mThreadSafeCount;
+    }
+
+    if( !constraint->IsInGraph() )
+    {
+      mConstraintsAdded = true;
+    }
+  }
+}
+
+void ConstraintGraph::Apply( BufferIndex updateBufferIndex, UpdateThreadPool& threadPool )
+{
+  const unsigned int count = mConstraints.Count();
+  unsigned int appliedCount = 0u;
+
+  // Only the constraints whose functions are thread-safe are applied by the worker threads
+  if( ( threadPool.GetThreadCount() > 1u ) && ( mThreadSafeCount >= MINIMUM_PARALLEL_BATCH_SIZE ) )
+  {
+    Build();
+
+    ConstraintBase** begin = mBatchedConstraints.Begin();
+    for( unsigned int batch = 0u; batch < mBatchEnds.Count(); ++batch )
+    {
+      ConstraintBase** parallelBegin = mBatchedConstraints.Begin() + mParallelBegins[ batch ];
+      ConstraintBase** end = mBatchedConstraints.Begin() + mBatchEnds[ batch ];
+      appliedCount += ApplyConstraints( begin, parallelBegin, updateBufferIndex );
+      appliedCount += ApplyBatch( parallelBegin, end, updateBufferIndex, threadPool );
+      begin = end;
+    }
+  }
+  else
+  {
+    appliedCount = ApplyConstraints( mConstraints.Begin(), mConstraints.End(), updateBufferIndex );
+  }
+
+  INCREASE_BY( PerformanceMonitor::CONSTRAINTS_APPLIED, appliedCount );
+  INCREASE_BY( PerformanceMonitor::CONSTRAINTS_SKIPPED, count - appliedCount );
+  (void)count; // Avoid "unused variable count" when the performance counters are compiled out
+
+  mConstraints.Clear();
+  mThreadSafeCount = 0u;
+}
+
+void ConstraintGraph::Build()
+{
+  const unsigned int count = mConstraints.Count();
+
+  // The dependencies of a constraint do not change once connected, therefore the same sequence has the same batches
+  if( !mConstraintsAdded &&
+      ( count == mBuiltConstraints.Count() ) &&
+      ( ( 0u == count ) || ( 0 == memcmp( mConstraints.Begin(), mBuiltConstraints.Begin(), count * sizeof( ConstraintBase* ) ) ) ) )
+  {
+    return;
+  }
+
+  mConstraintsAdded = false;
+  mBuiltConstraints = mConstraints;
+
+  PropertyAccessContainer accesses;
+  Dali::Vector< unsigned int > batches;
+  batches.Resize( count );
+  unsigned int batchCount = 0u;
+
+  for( unsigned int i = 0u; i < count; ++i )
+  {
+    ConstraintBase& constraint = *mConstraints[i];
+    constraint.SetInGraph( true );
+
+    // A constraint follows the last writer of each input
+    unsigned int batch = 0u;
+    unsigned int index = 0u;
+    for( const PropertyInputImpl* input = constraint.GetInputProperty( index );
+         NULL != input;
+         input = constraint.GetInputProperty( ++index ) )
+    {
+      PropertyAccessContainer::const_iterator found = accesses.find( input );
+      if( found != accesses.end() )
+      {
+        batch = std::max( batch, found->second.writeEnd );
+      }
+    }
+
+    // A constraint follows the last writer and the readers of its target
+    const PropertyInputImpl* target = constraint.GetTargetProperty();
+    if( NULL != target )
+    {
+      PropertyAccess& access = accesses[ target ];
+      batch = std::max( batch, std::max( access.writeEnd, access.readEnd ) );
+      access.writeEnd = batch + 1u;
+    }
+
+    index = 0u;
+    for( const PropertyInputImpl* input = constraint.GetInputProperty( index );
+         NULL != input;
+         input = constraint.GetInputProperty( ++index ) )
+    {
+      PropertyAccess& access = accesses[ input ];
+      access.readEnd = std::max( access.readEnd, batch + 1u );
+    }
+
+    batches[i] = batch;
+    batchCount = std::max( batchCount, batch + 1u );
+  }
+
+  // Sort the constraints by batch, keeping the sequential order within each batch.
+  // Within a batch, the constraints which are not thread-safe come first; they are applied on the update-thread
+  const unsigned int partCount = batchCount * 2u;
+  Dali::Vector< unsigned int > partEnds;
+  partEnds.Resize( partCount, 0u );
+  for( unsigned int i = 0u; i < count; ++i )
+  {
+    batches[i] = batches[i] * 2u + ( mConstraints[i]->IsThreadSafe() ? 1u : 0u );
+    ++partEnds[ batches[i] ];
+  }
+
+  unsigned int end = 0u;
+  for( unsigned int part = 0u; part < partCount; ++part )
+  {
+    end += partEnds[ part ];
+    partEnds[ part ] = end;
+  }
+
+  mBatchedConstraints.Resize( count );
+  for( unsigned int i = count; i > 0u; --i )
+  {
+    mBatchedConstraints[ --partEnds[ batches[i - 1u] ] ] = mConstraints[i - 1u];
+  }
+
+  // partEnds now holds the start of each part; a part ends where the next one starts
+  mBatchEnds.Clear();
+  mBatchEnds.Resize( batchCount, count );
+  mParallelBegins.Clear();
+  mParallelBegins.Resize( batchCount, 0u );
+  for( unsigned int batch = 0u; batch < batchCount; ++batch )
+  {
+    mParallelBegins[ batch ] = partEnds[ batch * 2u + 1u ];
+    if( batch + 1u < batchCount )
+    {
+      mBatchEnds[ batch ] = partEnds[ batch * 2u + 2u ];
+    }
+  }
+}
+
+unsigned int ConstraintGraph::ApplyBatch( ConstraintBase** begin, ConstraintBase** end, BufferIndex updateBufferIndex, UpdateThreadPool& threadPool )
+{
+  const unsigned int size = end - begin;
+  const unsigned int taskCount = std::min( threadPool.GetThreadCount() * TASKS_PER_THREAD, size / MINIMUM_TASK_SIZE );
+
+  if( ( size < MINIMUM_PARALLEL_BATCH_SIZE ) || ( taskCount < 2u ) )
+  {
+    return ApplyConstraints( begin, end, updateBufferIndex );
+  }
+
+  while( mTasks.Count() < taskCount )
+  {
+    mTasks.PushBack( new BatchTask() );
+  }
+
+  mParallelTasks.clear();
+  for( unsigned int i = 0u; i < taskCount; ++i )
+  {
+    BatchTask* task = mTasks[i];
+    task->Set( begin + ( size * i ) / taskCount, begin + ( size * ( i + 1u ) ) / taskCount, updateBufferIndex );
+    mParallelTasks.push_back( task );
+  }
+
+  threadPool.Execute( mParallelTasks );
+
+  unsigned int appliedCount = 0u;
+  for( unsigned int i = 0u; i < taskCount; ++i )
+  {
+    appliedCount += mTasks[i]->GetAppliedCount();
+  }
+  return appliedCount;
+}
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,134 @@
+#ifndef __DALI_INTERNAL_SCENE_GRAPH_CONSTRAINT_GRAPH_H__
+#define __DALI_INTERNAL_SCENE_GRAPH_CONSTRAINT_GRAPH_H__
+
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali/public-api/common/dali-vector.h>
+#include <dali/devel-api/common/owner-container.h>
+#include <dali/internal/update/common/scene-graph-buffers.h>
+#include <dali/internal/update/common/update-thread-pool.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+
+class ConstraintBase;
+class PropertyOwner;
+
+/**
+ * The constraints of the scene-graph, ordered by their dependencies.
+ *
+ * The constraints are added each frame, in the order in which they would be applied sequentially.
+ * A constraint depends on the earlier constraints which write its inputs, write its target property,
+ * or read its target property. Each constraint is placed in the first batch after those it depends on;
+ * the constraints in a batch are independent. When the thread pool has more than one thread, the
+ * thread-safe constraints of a batch are applied in parallel, and the others on the update-thread.
+ * The result matches a sequential application.
+ *
+ * The batches are only rebuilt when the constraints, or their order, change between frames.
+ */
+class ConstraintGraph
+{
+public:
+
+  typedef Dali::Vector< ConstraintBase* > ConstraintContainer;
+
+  /**
+   * Constructor.
+   */
+  ConstraintGraph();
+
+  /**
+   * Non-virtual destructor.
+   */
+  ~ConstraintGraph();
+
+  /**
+   * Add the constraints of a property owner, to be applied by the next Apply().
+   * The owner is reset in the following frames, since its constrained properties are written.
+   * @param[in] owner The property owner.
+   */
+  void Add( PropertyOwner& owner );
+
+  /**
+   * Apply the constraints which were added since the last call; afterwards no constraints are pending.
+   * @param[in] updateBufferIndex The current update buffer index.
+   * @param[in] threadPool The threads used to apply independent constraints.
+   */
+  void Apply( BufferIndex updateBufferIndex, UpdateThreadPool& threadPool );
+
+  /**
+   * Retrieve the number of batches of independent constraints, from the last parallel Apply().
+   * @return The batch count.
+   */
+  unsigned int GetBatchCount() const
+  {
+    return mBatchEnds.Count();
+  }
+
+private:
+
+  class BatchTask;
+
+  /**
+   * Sort the constraints into batches, if the constraints have changed since the last build.
+   */
+  void Build();
+
+  /**
+   * Apply the thread-safe constraints of a batch, using the thread pool if there are enough of them.
+   * @param[in] begin The first thread-safe constraint of the batch.
+   * @param[in] end The end of the batch.
+   * @param[in] updateBufferIndex The current update buffer index.
+   * @param[in] threadPool The threads used to apply the constraints.
+   * @return The number of constraint functions which were called.
+   */
+  unsigned int ApplyBatch( ConstraintBase** begin, ConstraintBase** end, BufferIndex updateBufferIndex, UpdateThreadPool& threadPool );
+
+  // Undefined
+  ConstraintGraph( const ConstraintGraph& );
+
+  // Undefined
+  ConstraintGraph& operator=( const ConstraintGraph& );
+
+private:
+
+  ConstraintContainer mConstraints;              ///< The constraints added this frame, in sequential order (not owned)
+  ConstraintContainer mBuiltConstraints;         ///< The constraints from which the batches were built, in sequential order
+  ConstraintContainer mBatchedConstraints;       ///< The constraints, sorted into batches
+  Dali::Vector< unsigned int > mBatchEnds;       ///< The end index of each batch within mBatchedConstraints
+  OwnerContainer< BatchTask* > mTasks;           ///< The tasks used to apply part of a batch; these are reused between frames
+  UpdateThreadPool::TaskContainer mParallelTasks; ///< The tasks executed by the thread pool
+  Dali::Vector< unsigned int > mParallelBegins;  ///< The index of the first thread-safe constraint of each batch
+  unsigned int mThreadSafeCount;                 ///< The number of thread-safe constraints added this frame
+  bool mConstraintsAdded;                        ///< Set when a constraint was connected since the last build
+};
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // __DALI_INTERNAL_SCENE_GRAPH_CONSTRAINT_GRAPH_H__
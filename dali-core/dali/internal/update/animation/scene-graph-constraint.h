@@ -25,7 +25,6 @@
 #include <dali/internal/update/common/animatable-property.h>
 #include <dali/internal/update/common/property-owner.h>
 #include <dali/internal/update/animation/scene-graph-constraint-base.h>
-#include <dali/internal/render/common/performance-monitor.h>
 
 namespace Dali
 {
@@ -98,11 +97,11 @@ public:
   /**
    * @copydoc Dali::Internal::SceneGraph::ConstraintBase::Apply()
    */
-  virtual void Apply( BufferIndex updateBufferIndex )
+  virtual bool Apply( BufferIndex updateBufferIndex )
   {
     if ( mDisconnected )
     {
-      return; // Early-out when property owners have been disconnected
+      return false; // Early-out when property owners have been disconnected
     }
 
     if ( mFunc->InputsInitialized() &&
@@ -121,12 +120,26 @@ public:
         mTargetProperty.Set( updateBufferIndex, current );
       }
 
-      INCREASE_COUNTER(PerformanceMonitor::CONSTRAINTS_APPLIED);
-    }
-    else
-    {
-      INCREASE_COUNTER(PerformanceMonitor::CONSTRAINTS_SKIPPED);
+      return true;
     }
+
+    return false;
+  }
+
+  /**
+   * @copydoc Dali::Internal::SceneGraph::ConstraintBase::GetTargetProperty()
+   */
+  virtual const PropertyInputImpl* GetTargetProperty() const
+  {
+    return mTargetProperty.GetProperty();
+  }
+
+  /**
+   * @copydoc Dali::Internal::SceneGraph::ConstraintBase::GetInputProperty()
+   */
+  virtual const PropertyInputImpl* GetInputProperty( unsigned int index ) const
+  {
+    return mFunc ? mFunc->GetInput( index ) : NULL;
   }
 
 private:
@@ -37,6 +37,12 @@ PropertyOwnerMessageBase::~PropertyOwnerMessageBase()
 {
 }
 
+bool PropertyOwnerMessageBase::IsDamageTracked() const
+{
+  // The owner is reset after every message, which marks it as changed
+  return true;
+}
+
 } // namespace SceneGraph
 
 } // namespace Internal
@@ -56,6 +56,11 @@ public:
    */
   virtual ~PropertyOwnerMessageBase();
 
+  /**
+   * @copydoc MessageBase::IsDamageTracked
+   */
+  virtual bool IsDamageTracked() const;
+
 private:
 
   // Undefined
@@ -89,8 +94,20 @@ public:
                     MemberFunction member,
                     typename ParameterType< P >::PassingType value )
   {
-    // Reserve some memory inside the message queue
-    unsigned int* slot = eventThreadServices.ReserveMessageSlot( sizeof( AnimatablePropertyMessage ) );
+    unsigned int* slot( NULL );
+    if( member == &AnimatableProperty<P>::Bake )
+    {
+      // Replace an earlier message which baked the same property, since the last flush
+      slot = eventThreadServices.ReserveCoalescedMessageSlot( sizeof( AnimatablePropertyMessage ), property );
+    }
+    else
+    {
+      // The result depends on the earlier messages
+      eventThreadServices.InvalidateCoalescedMessage( property );
+
+      // Reserve some memory inside the message queue
+      slot = eventThreadServices.ReserveMessageSlot( sizeof( AnimatablePropertyMessage ) );
+    }
 
     // Construct message in the message queue memory; note that delete should not be called on the return value
     new (slot) AnimatablePropertyMessage( sceneObject, property, member, value );
@@ -109,6 +126,7 @@ public:
   virtual void Process( BufferIndex updateBufferIndex )
   {
     (mProperty->*mMemberFunction)( updateBufferIndex, mParam );
+    mSceneObject->RequestReset();
   }
 
 private:
@@ -168,6 +186,9 @@ public:
                     MemberFunction member,
                     float value )
   {
+    // An earlier message which baked the whole property must still be applied first
+    eventThreadServices.InvalidateCoalescedMessage( property );
+
     // Reserve some memory inside the message queue
     unsigned int* slot = eventThreadServices.ReserveMessageSlot( sizeof( AnimatablePropertyComponentMessage ) );
 
@@ -188,6 +209,7 @@ public:
   virtual void Process( BufferIndex updateBufferIndex )
   {
     (mProperty->*mMemberFunction)( updateBufferIndex, mParam );
+    mSceneObject->RequestReset();
   }
 
 private:
@@ -269,6 +291,7 @@ public:
     DALI_ASSERT_DEBUG( mProperty && "Message does not have an object" );
     (mProperty->*mMemberFunction)( updateBufferIndex,
                                    ParameterType< P >::PassObject( mParam ) );
+    mSceneObject->RequestReset();
   }
 
 private:
@@ -42,6 +42,11 @@ PropertyOwner* PropertyOwner::New()
 PropertyOwner::~PropertyOwner()
 {
   Destroy();
+
+  if( 0u != mResetFrames )
+  {
+    mResetList->Remove( *this );
+  }
 }
 
 void PropertyOwner::AddObserver(Observer& observer)
@@ -115,6 +120,9 @@ void PropertyOwner::InstallCustomProperty(PropertyBase* property)
   DALI_ASSERT_DEBUG( NULL != property );
 
   mCustomProperties.PushBack( property );
+
+  // The new property has been baked with its initial value
+  RequestReset();
 }
 
 void PropertyOwner::ResetToBaseValues( BufferIndex updateBufferIndex )
@@ -130,6 +138,13 @@ void PropertyOwner::ResetToBaseValues( BufferIndex updateBufferIndex )
   ResetDefaultProperties( updateBufferIndex );
 }
 
+void PropertyOwner::SetResetList( ResetList& resetList )
+{
+  DALI_ASSERT_DEBUG( 0u == mResetFrames );
+
+  mResetList = &resetList;
+}
+
 ConstraintOwnerContainer& PropertyOwner::GetConstraints()
 {
   return mConstraints;
@@ -159,6 +174,9 @@ void PropertyOwner::RemoveConstraint( ConstraintBase* constraint )
 }
 
 PropertyOwner::PropertyOwner()
+: mResetList( NULL ),
+  mResetIndex( 0u ),
+  mResetFrames( 0u )
 {
 }
 
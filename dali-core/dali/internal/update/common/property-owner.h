@@ -25,6 +25,7 @@
 #include <dali/devel-api/common/owner-container.h>
 #include <dali/internal/common/message.h>
 #include <dali/internal/update/common/property-base.h>
+#include <dali/internal/update/common/reset-list.h>
 #include <dali/internal/update/common/scene-graph-buffers.h>
 #include <dali/internal/update/common/uniform-map.h>
 #include <dali/internal/update/animation/scene-graph-constraint-declarations.h>
@@ -161,6 +162,37 @@ public:
    */
   void ResetToBaseValues( BufferIndex updateBufferIndex );
 
+  /**
+   * Set the list which resets the properties of this object, when requested with RequestReset().
+   * @param[in] resetList The reset list.
+   */
+  void SetResetList( ResetList& resetList );
+
+  /**
+   * Request that the properties are reset to their base values, at the start of the following frames.
+   * This should be called whenever an animatable property or any other per-frame state is written.
+   */
+  void RequestReset()
+  {
+    if( NULL != mResetList )
+    {
+      if( 0u == mResetFrames )
+      {
+        mResetList->Add( *this );
+      }
+      mResetFrames = ResetList::RESET_FRAME_COUNT;
+    }
+  }
+
+  /**
+   * Query whether the properties will be reset, i.e. whether they were written in the last ResetList::RESET_FRAME_COUNT frames.
+   * @return True if the object is in the reset list.
+   */
+  bool IsResetPending() const
+  {
+    return 0u != mResetFrames;
+  }
+
   // Constraints
 
   /**
@@ -216,6 +248,8 @@ protected:
 
 private:
 
+  friend class ResetList;
+
   // Undefined
   PropertyOwner(const PropertyOwner&);
 
@@ -242,6 +276,10 @@ private:
   ObserverContainer mObservers; ///< Container of observer raw-pointers (not owned)
 
   ConstraintOwnerContainer mConstraints; ///< Container of owned constraints
+
+  ResetList* mResetList;     ///< The list which resets the properties, or NULL (not owned)
+  unsigned int mResetIndex;  ///< The index of this object in the reset list
+  unsigned int mResetFrames; ///< The number of frames for which the properties will be reset; zero when not in the reset list
 };
 
 } // namespace SceneGraph
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/update/common/reset-list.h>
+
+// INTERNAL INCLUDES
+#include <dali/internal/update/common/property-owner.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+
+ResetList::ResetList()
+: mOwners()
+{
+}
+
+ResetList::~ResetList()
+{
+  // The owners may outlive the list e.g. when waiting in the discard queue
+  for( Dali::Vector< PropertyOwner* >::Iterator iter = mOwners.Begin(), endIter = mOwners.End(); iter != endIter; ++iter )
+  {
+    (*iter)->mResetFrames = 0u;
+    (*iter)->mResetList = NULL;
+  }
+}
+
+void ResetList::Add( PropertyOwner& owner )
+{
+  DALI_ASSERT_DEBUG( 0u == owner.mResetFrames && "Property owner is already in the reset list" );
+
+  owner.mResetIndex = mOwners.Count();
+  mOwners.PushBack( &owner );
+}
+
+void ResetList::Remove( PropertyOwner& owner )
+{
+  DALI_ASSERT_DEBUG( owner.mResetIndex < mOwners.Count() && mOwners[ owner.mResetIndex ] == &owner );
+
+  // Move the last owner into the empty slot
+  PropertyOwner* last = mOwners[ mOwners.Count() - 1u ];
+  last->mResetIndex = owner.mResetIndex;
+  mOwners[ owner.mResetIndex ] = last;
+  mOwners.Resize( mOwners.Count() - 1u );
+
+  owner.mResetFrames = 0u;
+}
+
+unsigned int ResetList::ResetToBaseValues( BufferIndex updateBufferIndex )
+{
+  const unsigned int resetCount = mOwners.Count();
+
+  unsigned int index = 0u;
+  while( index < mOwners.Count() )
+  {
+    PropertyOwner& owner = *mOwners[ index ];
+    owner.ResetToBaseValues( updateBufferIndex );
+
+    if( 0u == --owner.mResetFrames )
+    {
+      // The last owner is moved to this index, and reset next
+      Remove( owner );
+    }
+    else
+    {
+      ++index;
+    }
+  }
+
+  return resetCount;
+}
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,121 @@
+#ifndef __DALI_INTERNAL_SCENE_GRAPH_RESET_LIST_H__
+#define __DALI_INTERNAL_SCENE_GRAPH_RESET_LIST_H__
+
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali/public-api/common/dali-vector.h>
+#include <dali/internal/update/common/scene-graph-buffers.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+
+class PropertyOwner;
+
+/**
+ * The list of property owners whose properties must be reset to their base values at the start of the next frames.
+ *
+ * A property which is set (rather than baked) needs to be reset in both buffers, therefore an owner
+ * stays in the list for RESET_FRAME_COUNT frames after the last time its properties were written.
+ * Owners are added with PropertyOwner::RequestReset(); an owner is never added twice.
+ */
+class ResetList
+{
+public:
+
+  /**
+   * The number of frames for which an owner is reset, after its properties were written.
+   */
+  static const unsigned int RESET_FRAME_COUNT = 2u;
+
+  /**
+   * Constructor.
+   */
+  ResetList();
+
+  /**
+   * Destructor; any remaining owners are removed from the list.
+   */
+  ~ResetList();
+
+  /**
+   * Add an owner to the list.
+   * @pre The owner is not in the list.
+   * @param[in] owner The property owner.
+   */
+  void Add( PropertyOwner& owner );
+
+  /**
+   * Remove an owner from the list e.g. when the owner is destroyed.
+   * @pre The owner is in the list.
+   * @param[in] owner The property owner.
+   */
+  void Remove( PropertyOwner& owner );
+
+  /**
+   * Reset the properties of the owners in the list to their base values.
+   * Owners which have been reset for RESET_FRAME_COUNT frames are removed from the list.
+   * @param[in] updateBufferIndex The buffer to reset.
+   * @return The number of property owners which were reset.
+   */
+  unsigned int ResetToBaseValues( BufferIndex updateBufferIndex );
+
+  /**
+   * Retrieve the number of owners in the list.
+   * @return The owner count.
+   */
+  unsigned int Count() const
+  {
+    return mOwners.Count();
+  }
+
+  /**
+   * Retrieve the owners in the list i.e. those whose properties were written in the last RESET_FRAME_COUNT frames.
+   * @return The owners.
+   */
+  const Dali::Vector< PropertyOwner* >& GetOwners() const
+  {
+    return mOwners;
+  }
+
+private:
+
+  // Undefined
+  ResetList( const ResetList& );
+
+  // Undefined
+  ResetList& operator=( const ResetList& );
+
+private:
+
+  Dali::Vector< PropertyOwner* > mOwners; ///< The owners to reset (not owned)
+};
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // __DALI_INTERNAL_SCENE_GRAPH_RESET_LIST_H__
@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/update/common/update-thread-pool.h>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/threading/thread.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+
+/**
+ * A thread which executes the tasks of the pool, until the pool is stopped.
+ */
+class UpdateThreadPool::WorkerThread : public Thread
+{
+public:
+
+  /**
+   * Constructor.
+   * @param[in] pool The pool to take tasks from.
+   */
+  WorkerThread( UpdateThreadPool& pool )
+  : mPool( pool )
+  {
+  }
+
+  /**
+   * Virtual destructor.
+   */
+  virtual ~WorkerThread()
+  {
+  }
+
+protected:
+
+  /**
+   * @copydoc Dali::Thread::Run()
+   */
+  virtual void Run()
+  {
+    while( Task* task = mPool.WaitForTask() )
+    {
+      task->Execute();
+      mPool.TaskFinished();
+    }
+  }
+
+private:
+
+  UpdateThreadPool& mPool;
+};
+
+UpdateThreadPool::UpdateThreadPool()
+: mWorkerThreads(),
+  mConditionalWait(),
+  mTasks( NULL ),
+  mNextTask( 0u ),
+  mPendingTasks( 0u ),
+  mStopping( false )
+{
+}
+
+UpdateThreadPool::~UpdateThreadPool()
+{
+  StopWorkerThreads();
+}
+
+void UpdateThreadPool::SetThreadCount( unsigned int threadCount )
+{
+  // The calling thread is one of the threads
+  const unsigned int workerCount = ( threadCount > 1u ) ? threadCount - 1u : 0u;
+
+  if( workerCount != mWorkerThreads.Count() )
+  {
+    StopWorkerThreads();
+
+    for( unsigned int i = 0u; i < workerCount; ++i )
+    {
+      WorkerThread* thread = new WorkerThread( *this );
+      mWorkerThreads.PushBack( thread );
+      thread->Start();
+    }
+  }
+}
+
+unsigned int UpdateThreadPool::GetThreadCount() const
+{
+  return mWorkerThreads.Count() + 1u;
+}
+
+void UpdateThreadPool::Execute( const TaskContainer& tasks )
+{
+  if( tasks.empty() )
+  {
+    return;
+  }
+
+  {
+    ConditionalWait::ScopedLock lock( mConditionalWait );
+    mTasks = &tasks;
+    mNextTask = 0u;
+    mPendingTasks = tasks.size();
+  }
+
+  if( !mWorkerThreads.IsEmpty() )
+  {
+    // Wake the worker threads
+    mConditionalWait.Notify();
+  }
+
+  // The calling thread executes tasks too, until every task has been started
+  while( true )
+  {
+    Task* task = NULL;
+    {
+      ConditionalWait::ScopedLock lock( mConditionalWait );
+      task = TakeTask();
+    }
+
+    if( NULL == task )
+    {
+      break;
+    }
+
+    task->Execute();
+    TaskFinished();
+  }
+
+  // Wait for the tasks still running on the worker threads
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+  while( 0u != mPendingTasks )
+  {
+    mConditionalWait.Wait( lock );
+  }
+  mTasks = NULL;
+}
+
+UpdateThreadPool::Task* UpdateThreadPool::WaitForTask()
+{
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+
+  while( !mStopping )
+  {
+    Task* task = TakeTask();
+    if( NULL != task )
+    {
+      return task;
+    }
+
+    mConditionalWait.Wait( lock );
+  }
+
+  return NULL;
+}
+
+UpdateThreadPool::Task* UpdateThreadPool::TakeTask()
+{
+  Task* task = NULL;
+
+  if( ( NULL != mTasks ) && ( mNextTask < mTasks->size() ) )
+  {
+    task = ( *mTasks )[ mNextTask ];
+    ++mNextTask;
+  }
+
+  return task;
+}
+
+void UpdateThreadPool::TaskFinished()
+{
+  bool batchFinished = false;
+  {
+    ConditionalWait::ScopedLock lock( mConditionalWait );
+    --mPendingTasks;
+    batchFinished = ( 0u == mPendingTasks );
+  }
+
+  if( batchFinished )
+  {
+    // Wake the thread waiting in Execute()
+    mConditionalWait.Notify();
+  }
+}
+
+void UpdateThreadPool::StopWorkerThreads()
+{
+  if( mWorkerThreads.IsEmpty() )
+  {
+    return;
+  }
+
+  {
+    ConditionalWait::ScopedLock lock( mConditionalWait );
+    mStopping = true;
+  }
+  mConditionalWait.Notify();
+
+  for( OwnerContainer< WorkerThread* >::Iterator iter = mWorkerThreads.Begin(), endIter = mWorkerThreads.End(); iter != endIter; ++iter )
+  {
+    ( *iter )->Join();
+  }
+  mWorkerThreads.Clear();
+
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+  mStopping = false;
+}
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
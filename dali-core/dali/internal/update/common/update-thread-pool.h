@@ -0,0 +1,151 @@
+#ifndef __DALI_INTERNAL_SCENE_GRAPH_UPDATE_THREAD_POOL_H__
+#define __DALI_INTERNAL_SCENE_GRAPH_UPDATE_THREAD_POOL_H__
+
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/common/owner-container.h>
+#include <dali/devel-api/threading/conditional-wait.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+
+/**
+ * A pool of worker threads which help the update-thread to process independent parts of the scene-graph.
+ *
+ * The tasks of a batch are taken from a shared queue; a thread which has finished a task takes the next one,
+ * so the work is balanced between the threads. The calling (update) thread also executes tasks,
+ * therefore a pool with a thread count of one executes everything on the calling thread.
+ */
+class UpdateThreadPool
+{
+public:
+
+  /**
+   * A unit of work which can be executed on any thread of the pool.
+   */
+  class Task
+  {
+  public:
+
+    /**
+     * Execute the task.
+     */
+    virtual void Execute() = 0;
+
+  protected:
+
+    /**
+     * Protected virtual destructor; tasks are not owned by the pool.
+     */
+    virtual ~Task()
+    {
+    }
+  };
+
+  typedef std::vector< Task* > TaskContainer;
+
+  /**
+   * Constructor; the pool initially has a thread count of one, i.e. no worker threads.
+   */
+  UpdateThreadPool();
+
+  /**
+   * Destructor; this stops the worker threads.
+   */
+  ~UpdateThreadPool();
+
+  /**
+   * Set the number of threads used to execute tasks, including the calling thread.
+   * This must not be called whilst Execute() is in progress.
+   * @param[in] threadCount The number of threads; zero is treated as one.
+   */
+  void SetThreadCount( unsigned int threadCount );
+
+  /**
+   * Retrieve the number of threads used to execute tasks, including the calling thread.
+   * @return The thread count.
+   */
+  unsigned int GetThreadCount() const;
+
+  /**
+   * Execute a batch of tasks, and wait until they have all finished.
+   * @param[in] tasks The tasks to execute; these are started in order.
+   */
+  void Execute( const TaskContainer& tasks );
+
+private:
+
+  class WorkerThread;
+
+  /**
+   * Called by the worker threads; takes the next task, blocking until one is available.
+   * @return The task to execute, or NULL if the worker thread should exit.
+   */
+  Task* WaitForTask();
+
+  /**
+   * Take the next task of the current batch, without blocking.
+   * @pre The lock is held.
+   * @return The task to execute, or NULL if every task has been started.
+   */
+  Task* TakeTask();
+
+  /**
+   * Called when a task has been executed.
+   */
+  void TaskFinished();
+
+  /**
+   * Stop & destroy the worker threads.
+   */
+  void StopWorkerThreads();
+
+  // Undefined
+  UpdateThreadPool( const UpdateThreadPool& );
+
+  // Undefined
+  UpdateThreadPool& operator=( const UpdateThreadPool& );
+
+private:
+
+  OwnerContainer< WorkerThread* > mWorkerThreads; ///< The worker threads; the calling thread is not included
+
+  ConditionalWait mConditionalWait;               ///< Guards the state below, and wakes waiting threads
+  const TaskContainer* mTasks;                    ///< The current batch of tasks, or NULL
+  unsigned int mNextTask;                         ///< The index of the next task to start
+  unsigned int mPendingTasks;                     ///< The number of tasks which have not finished yet
+  bool mStopping;                                 ///< Set when the worker threads should exit
+};
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // __DALI_INTERNAL_SCENE_GRAPH_UPDATE_THREAD_POOL_H__
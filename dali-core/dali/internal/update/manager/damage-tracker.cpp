@@ -0,0 +1,400 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/update/manager/damage-tracker.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cfloat>
+#include <cstring>
+
+// INTERNAL INCLUDES
+#include <dali/public-api/math/math-utils.h>
+#include <dali/internal/update/common/reset-list.h>
+#include <dali/internal/update/nodes/node.h>
+#include <dali/internal/render/common/render-instruction.h>
+#include <dali/internal/render/common/render-instruction-container.h>
+#include <dali/internal/render/common/render-item.h>
+#include <dali/internal/render/common/render-list.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+
+namespace
+{
+
+const Vector4 EMPTY_REGION( FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX );
+const Vector4 VIEWPORT_REGION( -1.0f, -1.0f, 1.0f, 1.0f );
+
+/**
+ * Extend a region to include some bounds.
+ */
+inline void AddToRegion( Vector4& region, const Vector4& bounds )
+{
+  region.x = std::min( region.x, bounds.x );
+  region.y = std::min( region.y, bounds.y );
+  region.z = std::max( region.z, bounds.z );
+  region.w = std::max( region.w, bounds.w );
+}
+
+/**
+ * Calculate the bounds of an item in normalized device coordinates, by projecting the corners of its node.
+ * @param[in] projection The projection matrix.
+ * @param[in] modelView The model-view matrix of the item.
+ * @param[in] size The size of the node.
+ * @param[in] bounded Whether the content of the node is drawn within its size; otherwise it may cover the viewport.
+ * @return The bounds (min x, min y, max x, max y).
+ */
+Vector4 CalculateBounds( const Matrix& projection, const Matrix& modelView, const Vector3& size, bool bounded )
+{
+  if( !bounded )
+  {
+    return VIEWPORT_REGION;
+  }
+
+  Matrix modelViewProjection( false );
+  Matrix::Multiply( modelViewProjection, modelView, projection );
+
+  // A flat node only needs the four corners of its front face
+  const Vector3 halfSize( size * 0.5f );
+  const unsigned int cornerCount = EqualsZero( size.z ) ? 4u : 8u;
+
+  Vector4 bounds( EMPTY_REGION );
+  for( unsigned int i = 0u; i < cornerCount; ++i )
+  {
+    const Vector4 corner( ( i & 1u ) ? halfSize.x : -halfSize.x,
+                          ( i & 2u ) ? halfSize.y : -halfSize.y,
+                          ( i & 4u ) ? halfSize.z : -halfSize.z,
+                          1.0f );
+    const Vector4 clip( modelViewProjection * corner );
+
+    // A corner at or behind the camera does not project to a bounded region
+    if( clip.w < Math::MACHINE_EPSILON_1 )
+    {
+      return VIEWPORT_REGION;
+    }
+
+    const float x = clip.x / clip.w;
+    const float y = clip.y / clip.w;
+    bounds.x = std::min( bounds.x, x );
+    bounds.y = std::min( bounds.y, y );
+    bounds.z = std::max( bounds.z, x );
+    bounds.w = std::max( bounds.w, y );
+  }
+
+  return bounds;
+}
+
+/**
+ * Order keys by renderer, then node.
+ */
+template< typename KeyType >
+bool CompareKeys( const KeyType& lhs, const KeyType& rhs )
+{
+  if( lhs.renderer != rhs.renderer )
+  {
+    return lhs.renderer < rhs.renderer;
+  }
+  return lhs.node < rhs.node;
+}
+
+} // unnamed namespace
+
+DamageTracker::InstructionState::InstructionState()
+: viewMatrix(),
+  projectionMatrix(),
+  viewport(),
+  clearColor(),
+  isViewportSet( false ),
+  isClearColorSet( false ),
+  isValid( false ),
+  items(),
+  keys()
+{
+}
+
+DamageTracker::DamageTracker()
+: mStates(),
+  mItems(),
+  mMatched(),
+  mDirtyCaches()
+{
+}
+
+DamageTracker::~DamageTracker()
+{
+}
+
+void DamageTracker::Update( BufferIndex updateBufferIndex,
+                            RenderInstructionContainer& instructions,
+                            const ResetList& resetList,
+                            bool instructionsUpdated,
+                            bool damageAll )
+{
+  const size_t count = instructions.Count( updateBufferIndex );
+
+  if( !instructionsUpdated )
+  {
+    // The instructions are those of an earlier frame, which has not changed since
+    mDirtyCaches.Clear();
+    for( size_t i = 0; i < count; ++i )
+    {
+      RenderInstruction& instruction = instructions.At( updateBufferIndex, i );
+      instruction.mIsFullyDamaged = damageAll;
+      instruction.mDamagedRegion = EMPTY_REGION;
+      MarkDirtyCaches( instruction, damageAll );
+    }
+    return;
+  }
+
+  unsigned int onscreenCount( 0u );
+  for( size_t i = 0; i < count; ++i )
+  {
+    if( 0u == instructions.At( updateBufferIndex, i ).mOffscreenTextureId )
+    {
+      ++onscreenCount;
+    }
+    else
+    {
+      // The off-screen target may be drawn on-screen
+      damageAll = true;
+    }
+  }
+
+  // Render tasks were added or removed
+  if( onscreenCount != mStates.Count() )
+  {
+    damageAll = true;
+    mStates.Clear();
+    for( unsigned int i = 0u; i < onscreenCount; ++i )
+    {
+      mStates.PushBack( new InstructionState() );
+    }
+  }
+
+  // Only the changes to nodes can be localised
+  const Dali::Vector< PropertyOwner* >& owners = resetList.GetOwners();
+  for( Dali::Vector< PropertyOwner* >::ConstIterator iter = owners.Begin(), endIter = owners.End(); !damageAll && iter != endIter; ++iter )
+  {
+    damageAll = ( NULL == dynamic_cast< const Node* >( *iter ) );
+  }
+
+  unsigned int stateIndex( 0u );
+  for( size_t i = 0; i < count; ++i )
+  {
+    RenderInstruction& instruction = instructions.At( updateBufferIndex, i );
+    if( 0u == instruction.mOffscreenTextureId )
+    {
+      UpdateInstruction( updateBufferIndex, instruction, *mStates[ stateIndex++ ], damageAll );
+    }
+  }
+}
+
+void DamageTracker::UpdateInstruction( BufferIndex updateBufferIndex, RenderInstruction& instruction, InstructionState& state, bool damageAll )
+{
+  const Matrix& viewMatrix = *instruction.GetViewMatrix( updateBufferIndex );
+  const Matrix& projectionMatrix = *instruction.GetProjectionMatrix( updateBufferIndex );
+
+  // Any change to the camera, viewport or clear color damages the whole surface
+  damageAll = damageAll ||
+              !state.isValid ||
+              state.viewMatrix != viewMatrix ||
+              state.projectionMatrix != projectionMatrix ||
+              state.isViewportSet != instruction.mIsViewportSet ||
+              ( instruction.mIsViewportSet && state.viewport != instruction.mViewport ) ||
+              state.isClearColorSet != instruction.mIsClearColorSet ||
+              ( instruction.mIsClearColorSet && state.clearColor != instruction.mClearColor );
+
+  state.viewMatrix = viewMatrix;
+  state.projectionMatrix = projectionMatrix;
+  state.viewport = instruction.mViewport;
+  state.isViewportSet = instruction.mIsViewportSet;
+  state.clearColor = instruction.mClearColor;
+  state.isClearColorSet = instruction.mIsClearColorSet;
+  state.isValid = true;
+
+  CollectItems( updateBufferIndex, instruction );
+
+  Vector4 damagedRegion( EMPTY_REGION );
+  mDirtyCaches.Clear();
+  if( !damageAll )
+  {
+    damageAll = !CompareItems( state, damagedRegion );
+  }
+
+  instruction.mIsFullyDamaged = damageAll;
+  instruction.mDamagedRegion = damagedRegion;
+  MarkDirtyCaches( instruction, damageAll );
+
+  // Keep the items for the next frame
+  state.items.Swap( mItems );
+
+  const unsigned int count = state.items.Count();
+  state.keys.Resize( count );
+  for( unsigned int i = 0u; i < count; ++i )
+  {
+    state.keys[i].renderer = state.items[i].renderer;
+    state.keys[i].node = state.items[i].node;
+    state.keys[i].index = i;
+  }
+  std::sort( state.keys.Begin(), state.keys.End(), CompareKeys< Key > );
+}
+
+void DamageTracker::CollectItems( BufferIndex updateBufferIndex, const RenderInstruction& instruction )
+{
+  const Matrix& projectionMatrix = *instruction.GetProjectionMatrix( updateBufferIndex );
+
+  mItems.Clear();
+
+  const RenderListContainer::SizeType listCount = instruction.RenderListCount();
+  for( RenderListContainer::SizeType listIndex = 0; listIndex < listCount; ++listIndex )
+  {
+    const RenderList* renderList = instruction.GetRenderList( listIndex );
+    if( NULL == renderList )
+    {
+      continue;
+    }
+
+    const RenderItemContainer::SizeType itemCount = renderList->Count();
+    for( RenderItemContainer::SizeType itemIndex = 0; itemIndex < itemCount; ++itemIndex )
+    {
+      const RenderItem& renderItem = renderList->GetItem( itemIndex );
+      const Node& node = renderItem.GetNode();
+      const Matrix& modelView = renderItem.GetModelViewMatrix();
+
+      mItems.Resize( mItems.Count() + 1u );
+      Item& item = mItems[ mItems.Count() - 1u ];
+      item.renderer = &renderItem.GetRenderer();
+      item.node = &node;
+      item.list = listIndex;
+      item.cachedLayer = renderList->GetCachedLayer();
+      memcpy( item.modelView, modelView.AsFloat(), sizeof( item.modelView ) );
+      item.color = node.GetWorldColor( updateBufferIndex );
+      item.size = node.GetSize( updateBufferIndex );
+      item.bounds = CalculateBounds( projectionMatrix, modelView, item.size, node.IsContentBounded() );
+      item.changed = node.IsResetPending();
+    }
+  }
+}
+
+bool DamageTracker::CompareItems( const InstructionState& state, Vector4& damagedRegion )
+{
+  const unsigned int previousCount = state.items.Count();
+  mMatched.Resize( previousCount );
+  if( previousCount > 0u )
+  {
+    memset( mMatched.Begin(), 0, previousCount );
+  }
+
+  unsigned int nextIndex( 0u );
+  for( Dali::Vector< Item >::ConstIterator iter = mItems.Begin(), endIter = mItems.End(); iter != endIter; ++iter )
+  {
+    const Item& item = *iter;
+
+    const Key key = { item.renderer, item.node, 0u };
+    Dali::Vector< Key >::ConstIterator found = std::lower_bound( state.keys.Begin(), state.keys.End(), key, CompareKeys< Key > );
+    if( found == state.keys.End() || found->renderer != item.renderer || found->node != item.node )
+    {
+      // A new item
+      AddToRegion( damagedRegion, item.bounds );
+      AddDirtyCache( item.cachedLayer );
+      continue;
+    }
+
+    // The items which remain must be drawn in the same order, otherwise where they overlap would change
+    const unsigned int index = found->index;
+    if( index < nextIndex || mMatched[ index ] )
+    {
+      return false;
+    }
+    nextIndex = index + 1u;
+    mMatched[ index ] = 1;
+
+    const Item& previous = state.items[ index ];
+    if( item.changed ||
+        item.list != previous.list ||
+        item.color != previous.color ||
+        item.size != previous.size ||
+        0 != memcmp( item.modelView, previous.modelView, sizeof( item.modelView ) ) )
+    {
+      AddToRegion( damagedRegion, previous.bounds );
+      AddToRegion( damagedRegion, item.bounds );
+      AddDirtyCache( previous.cachedLayer );
+      AddDirtyCache( item.cachedLayer );
+    }
+    else if( item.cachedLayer != previous.cachedLayer )
+    {
+      // The render cache was enabled or disabled; what is drawn is the same
+      AddDirtyCache( previous.cachedLayer );
+      AddDirtyCache( item.cachedLayer );
+    }
+  }
+
+  // The items which were removed
+  for( unsigned int i = 0u; i < previousCount; ++i )
+  {
+    if( !mMatched[i] )
+    {
+      AddToRegion( damagedRegion, state.items[i].bounds );
+      AddDirtyCache( state.items[i].cachedLayer );
+    }
+  }
+
+  return true;
+}
+
+void DamageTracker::AddDirtyCache( const Layer* layer )
+{
+  if( NULL != layer &&
+      mDirtyCaches.End() == std::find( mDirtyCaches.Begin(), mDirtyCaches.End(), layer ) )
+  {
+    mDirtyCaches.PushBack( layer );
+  }
+}
+
+void DamageTracker::MarkDirtyCaches( RenderInstruction& instruction, bool damageAll )
+{
+  const RenderListContainer::SizeType listCount = instruction.RenderListCount();
+  for( RenderListContainer::SizeType listIndex = 0; listIndex < listCount; ++listIndex )
+  {
+    RenderList* renderList = instruction.GetRenderList( listIndex );
+    if( NULL == renderList || NULL == renderList->GetCachedLayer() )
+    {
+      continue;
+    }
+
+    const bool dirty = damageAll ||
+                       mDirtyCaches.End() != std::find( mDirtyCaches.Begin(), mDirtyCaches.End(), renderList->GetCachedLayer() );
+
+    const unsigned int flags = renderList->GetFlags() & ~RenderList::RENDER_CACHE_DIRTY;
+    renderList->ClearFlags();
+    renderList->SetFlags( dirty ? ( flags | RenderList::RENDER_CACHE_DIRTY ) : flags );
+  }
+}
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
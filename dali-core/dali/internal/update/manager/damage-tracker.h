@@ -0,0 +1,192 @@
+#ifndef __DALI_INTERNAL_SCENE_GRAPH_DAMAGE_TRACKER_H__
+#define __DALI_INTERNAL_SCENE_GRAPH_DAMAGE_TRACKER_H__
+
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali/public-api/common/dali-vector.h>
+#include <dali/public-api/math/matrix.h>
+#include <dali/public-api/math/vector3.h>
+#include <dali/public-api/math/vector4.h>
+#include <dali/public-api/math/viewport.h>
+#include <dali/devel-api/common/owner-container.h>
+#include <dali/internal/common/buffer-index.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+class Layer;
+class Node;
+class RenderInstruction;
+class RenderInstructionContainer;
+class ResetList;
+
+/**
+ * Finds the regions of the surface which change from frame to frame, by comparing the render items
+ * of the on-screen render instructions with those of the previous frame.
+ *
+ * The damaged region of an instruction covers the previous and current bounds of each item which was
+ * added, removed or changed, in normalized device coordinates. An item has changed if the properties of
+ * its node were written in the last frames, or if its model-view matrix, color or size differ.
+ * Changes which are not found this way, e.g. to the camera, resources or off-screen render targets,
+ * damage the whole surface.
+ *
+ * The render lists drawn into the render cache of a layer are marked when any item of the layer changed,
+ * so the cache is redrawn.
+ */
+class DamageTracker
+{
+public:
+
+  /**
+   * Constructor.
+   */
+  DamageTracker();
+
+  /**
+   * Non-virtual destructor.
+   */
+  ~DamageTracker();
+
+  /**
+   * Calculate the damaged region of each on-screen instruction of the frame.
+   * @param[in] updateBufferIndex The current update buffer index.
+   * @param[in] instructions The render instructions.
+   * @param[in] resetList The list of property owners which were written in the last frames.
+   * @param[in] instructionsUpdated False if the instructions were not prepared this frame, because nothing has changed.
+   * @param[in] damageAll True if the whole surface is damaged, e.g. after changes which are not tracked.
+   */
+  void Update( BufferIndex updateBufferIndex,
+               RenderInstructionContainer& instructions,
+               const ResetList& resetList,
+               bool instructionsUpdated,
+               bool damageAll );
+
+private:
+
+  /**
+   * The state of a render item, as drawn in a frame.
+   */
+  struct Item
+  {
+    const void* renderer;  ///< The renderer, which identifies the item with the node
+    const Node* node;      ///< The node
+    unsigned int list;     ///< The index of the render list
+    const Layer* cachedLayer; ///< The layer whose render cache the item is drawn into, or NULL
+    float modelView[16];   ///< The model-view matrix
+    Vector4 color;         ///< The world color of the node
+    Vector3 size;          ///< The size of the node
+    Vector4 bounds;        ///< The bounds in normalized device coordinates (min x, min y, max x, max y)
+    bool changed;          ///< Whether the properties of the node were written
+  };
+
+  /**
+   * Finds the items of the previous frame by renderer & node.
+   */
+  struct Key
+  {
+    const void* renderer;
+    const Node* node;
+    unsigned int index;    ///< The index of the item
+  };
+
+  /**
+   * The state of an on-screen instruction, as drawn in the previous frame.
+   */
+  struct InstructionState
+  {
+    InstructionState();
+
+    Matrix viewMatrix;
+    Matrix projectionMatrix;
+    Viewport viewport;            ///< The viewport if set
+    Vector4 clearColor;           ///< The clear color if set
+    bool isViewportSet:1;
+    bool isClearColorSet:1;
+    bool isValid:1;               ///< False until the instruction has been drawn
+    Dali::Vector< Item > items;   ///< The items in drawing order
+    Dali::Vector< Key > keys;     ///< The keys of the items, sorted by renderer & node
+  };
+
+  typedef OwnerContainer< InstructionState* > InstructionStateContainer;
+
+  /**
+   * Compare an on-screen instruction with its previous state, then store its state.
+   * @param[in] updateBufferIndex The current update buffer index.
+   * @param[in] instruction The instruction.
+   * @param[in] state The state of the instruction in the previous frame.
+   * @param[in] damageAll True if the whole surface is damaged.
+   */
+  void UpdateInstruction( BufferIndex updateBufferIndex, RenderInstruction& instruction, InstructionState& state, bool damageAll );
+
+  /**
+   * Fill in the current items of an instruction.
+   * @param[in] updateBufferIndex The current update buffer index.
+   * @param[in] instruction The instruction.
+   */
+  void CollectItems( BufferIndex updateBufferIndex, const RenderInstruction& instruction );
+
+  /**
+   * Compare the current items with those of the previous frame.
+   * @param[in] state The state of the instruction in the previous frame.
+   * @param[out] damagedRegion The bounds of the changed items.
+   * @return False if the items were reordered, in which case the whole surface is damaged.
+   */
+  bool CompareItems( const InstructionState& state, Vector4& damagedRegion );
+
+  /**
+   * Add a layer to the render caches which must be redrawn.
+   * @param[in] layer The cached layer, or NULL if the item is not cached.
+   */
+  void AddDirtyCache( const Layer* layer );
+
+  /**
+   * Mark the render lists of an instruction whose render cache must be redrawn.
+   * @param[in] instruction The instruction.
+   * @param[in] damageAll True if all the render caches must be redrawn.
+   */
+  void MarkDirtyCaches( RenderInstruction& instruction, bool damageAll );
+
+private:
+
+  // Undefined
+  DamageTracker( const DamageTracker& );
+
+  // Undefined
+  DamageTracker& operator=( const DamageTracker& );
+
+private:
+
+  InstructionStateContainer mStates;  ///< The states of the on-screen instructions, in order
+  Dali::Vector< Item > mItems;        ///< The current items of an instruction; swapped into its state
+  Dali::Vector< char > mMatched;      ///< Whether each previous item was matched with a current item
+  Dali::Vector< const Layer* > mDirtyCaches; ///< The cached layers with changed items in the current instruction
+};
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // __DALI_INTERNAL_SCENE_GRAPH_DAMAGE_TRACKER_H__
@@ -22,7 +22,9 @@
 
 // INTERNAL INCLUDES
 #include <dali/devel-api/common/owner-container.h>
+#include <dali/internal/update/animation/scene-graph-constraint-graph.h>
 #include <dali/internal/update/common/discard-queue.h>
+#include <dali/internal/update/common/reset-list.h>
 #include <dali/internal/update/controllers/scene-controller.h>
 
 namespace Dali
@@ -52,11 +54,13 @@ public:
    *
    * @param[in] sceneGraphBuffers Helper to get the correct buffer index
    * @param[in] discardQueue Queue to discard objects that might still be in use in the render thread.
+   * @param[in] resetList The list used to reset the properties of the objects.
    **/
-  ObjectOwnerContainer( SceneGraphBuffers& sceneGraphBuffers, DiscardQueue& discardQueue )
+  ObjectOwnerContainer( SceneGraphBuffers& sceneGraphBuffers, DiscardQueue& discardQueue, ResetList& resetList )
   : mSceneController( NULL ),
     mSceneGraphBuffers( sceneGraphBuffers ),
-    mDiscardQueue( discardQueue )
+    mDiscardQueue( discardQueue ),
+    mResetList( resetList )
   {
   }
 
@@ -81,6 +85,9 @@ public:
 
     mObjectContainer.PushBack( pointer );
 
+    pointer->SetResetList( mResetList );
+    pointer->RequestReset();
+
     pointer->ConnectToSceneGraph(*mSceneController, mSceneGraphBuffers.GetUpdateBufferIndex() );
   }
 
@@ -104,30 +111,15 @@ public:
   }
 
   /**
-   * @brief Method to call ResetToBaseValues on all the objects owned.
-   *
-   * @param[in] bufferIndex Buffer index for double buffered values.
-   **/
-  void ResetToBaseValues( BufferIndex bufferIndex )
-  {
-    for ( Iterator iter = mObjectContainer.Begin(); iter != mObjectContainer.End(); ++iter)
-    {
-      Type* object = (*iter);
-      object->ResetToBaseValues( bufferIndex );
-    }
-  }
-
-  /**
-   * @brief Method to call ConstrainObjects on all the objects owned.
+   * @brief Method to add the constraints of all the objects owned to a ConstraintGraph.
    *
-   * @param[in] bufferIndex Buffer index for double buffered values.
+   * @param[in] constraintGraph The graph which applies the constraints.
    **/
-  void ConstrainObjects( BufferIndex bufferIndex )
+  void GatherConstraints( ConstraintGraph& constraintGraph )
   {
     for ( Iterator iter = mObjectContainer.Begin(); iter != mObjectContainer.End(); ++iter)
     {
-      Type* object = (*iter);
-      ConstrainPropertyOwner( *object, bufferIndex );
+      constraintGraph.Add( **iter );
     }
   }
 
@@ -141,6 +133,7 @@ private:
   ObjectContainer mObjectContainer;       ///< Container for the objects owned
   SceneGraphBuffers& mSceneGraphBuffers;  ///< Reference to a SceneGraphBuffers to get the indexBuffer
   DiscardQueue& mDiscardQueue;            ///< Discard queue used for removed objects
+  ResetList& mResetList;                  ///< The list used to reset the properties of the objects
 };
 
 } // namespace SceneGraph
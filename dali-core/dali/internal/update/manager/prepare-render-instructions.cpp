@@ -18,6 +18,9 @@
 // CLASS HEADER
 #include <dali/internal/update/manager/prepare-render-instructions.h>
 
+// EXTERNAL INCLUDES
+#include <cmath>
+
 // INTERNAL INCLUDES
 #include <dali/public-api/shader-effects/shader-effect.h>
 #include <dali/public-api/actors/layer.h>
@@ -53,6 +56,32 @@ namespace Internal
 namespace SceneGraph
 {
 
+/**
+ * Check whether the size of a node, oriented by its world matrix, is inside the view frustum
+ * @param updateBufferIndex to read the frustum from
+ * @param cameraAttachment The camera used to render
+ * @param worldMatrix of the node
+ * @param size of the node
+ * @return false if the node is outside the view frustum
+ */
+inline bool IsInsideFrustum( BufferIndex updateBufferIndex,
+                             SceneGraph::CameraAttachment& cameraAttachment,
+                             const Matrix& worldMatrix,
+                             const Vector3& size )
+{
+  const float* matrix = worldMatrix.AsFloat();
+  const Vector3 halfSize( size * 0.5f );
+
+  // The radius of the sphere around the box; the columns of the matrix include the world scale
+  const Vector3 halfExtents( fabsf( matrix[0] ) * halfSize.x + fabsf( matrix[4] ) * halfSize.y + fabsf( matrix[8] )  * halfSize.z,
+                             fabsf( matrix[1] ) * halfSize.x + fabsf( matrix[5] ) * halfSize.y + fabsf( matrix[9] )  * halfSize.z,
+                             fabsf( matrix[2] ) * halfSize.x + fabsf( matrix[6] ) * halfSize.y + fabsf( matrix[10] ) * halfSize.z );
+
+  // Do a fast sphere check, then check the oriented box
+  return cameraAttachment.CheckSphereInFrustum( updateBufferIndex, worldMatrix.GetTranslation3(), halfExtents.Length() ) &&
+         cameraAttachment.CheckOBBInFrustum( updateBufferIndex, worldMatrix, halfSize );
+}
+
 /**
  * Add a renderer to the list
  * @param updateBufferIndex to read the model matrix from
@@ -61,17 +90,28 @@ namespace SceneGraph
  * @param viewMatrix used to calculate modelview matrix for the item
  * @param cameraAttachment The camera used to render
  * @param isLayer3d Whether we are processing a 3D layer or not
+ * @param cull Whether to cull the renderer against the view frustum
+ * @return false if the renderer was culled
  */
-inline void AddRendererToRenderList( BufferIndex updateBufferIndex,
+inline bool AddRendererToRenderList( BufferIndex updateBufferIndex,
                                      RenderList& renderList,
                                      RenderableAttachment& renderable,
                                      const Matrix& viewMatrix,
                                      SceneGraph::CameraAttachment& cameraAttachment,
-                                     bool isLayer3d )
+                                     bool isLayer3d,
+                                     bool cull )
 {
   const Node& parentNode = renderable.GetParent();
   const Matrix& worldMatrix = parentNode.GetWorldMatrix( updateBufferIndex );
 
+  // Check for cull against view frustum
+  if( cull &&
+      renderable.IsBoundedBySize() &&
+      !IsInsideFrustum( updateBufferIndex, cameraAttachment, worldMatrix, parentNode.GetSize( updateBufferIndex ) ) )
+  {
+    return false;
+  }
+
   // Get the next free RenderItem and initialization
   RenderItem& item = renderList.GetNextFreeItem();
   const Render::Renderer& renderer = renderable.GetRenderer();
@@ -90,6 +130,8 @@ inline void AddRendererToRenderList( BufferIndex updateBufferIndex,
 
   // save MV matrix onto the item
   Matrix::Multiply( item.GetModelViewMatrix(), worldMatrix, viewMatrix );
+
+  return true;
 }
 
 /**
@@ -100,38 +142,25 @@ inline void AddRendererToRenderList( BufferIndex updateBufferIndex,
  * @param viewMatrix used to calculate modelview matrix for the item
  * @param cameraAttachment The camera used to render
  * @param isLayer3d Whether we are processing a 3D layer or not
+ * @param cull Whether to cull the renderer against the view frustum
+ * @return false if the renderer was culled
  */
-inline void AddRendererToRenderList( BufferIndex updateBufferIndex,
+inline bool AddRendererToRenderList( BufferIndex updateBufferIndex,
                                      RenderList& renderList,
                                      NodeRenderer& renderable,
                                      const Matrix& viewMatrix,
                                      SceneGraph::CameraAttachment& cameraAttachment,
-                                     bool isLayer3d )
+                                     bool isLayer3d,
+                                     bool cull )
 {
   // Check for cull against view frustum
   const Matrix& worldMatrix = renderable.mNode->GetWorldMatrix( updateBufferIndex );
   bool inside = true;
 
-  if ( renderable.mRenderer->GetMaterial().GetShader()->GeometryHintEnabled( Dali::ShaderEffect::HINT_DOESNT_MODIFY_GEOMETRY ) )
+  const Shader* shader = renderable.mRenderer->GetMaterial().GetShader();
+  if ( cull && shader && shader->GeometryHintEnabled( Dali::ShaderEffect::HINT_DOESNT_MODIFY_GEOMETRY ) )
   {
-    const Vector3& position = worldMatrix.GetTranslation3();
-    const Vector3& scale = renderable.mNode->GetScale( updateBufferIndex );
-    const Vector3& halfSize = renderable.mNode->GetSize( updateBufferIndex ) * scale * 0.5f;
-
-    // Do a fast sphere check
-    if ( cameraAttachment.CheckSphereInFrustum( updateBufferIndex, position, halfSize.Length() ) )
-    {
-      // Check geometry AABB
-      //TODO: Take into account orientation
-      if ( !cameraAttachment.CheckAABBInFrustum( updateBufferIndex, position, halfSize ) )
-      {
-        inside = false;
-      }
-    }
-    else
-    {
-      inside = false;
-    }
+    inside = IsInsideFrustum( updateBufferIndex, cameraAttachment, worldMatrix, renderable.mNode->GetSize( updateBufferIndex ) );
   }
 
   if ( inside )
@@ -154,6 +183,8 @@ inline void AddRendererToRenderList( BufferIndex updateBufferIndex,
     // save MV matrix onto the item
     Matrix::Multiply( item.GetModelViewMatrix(), worldMatrix, viewMatrix );
   }
+
+  return inside;
 }
 
 /**
@@ -165,6 +196,7 @@ inline void AddRendererToRenderList( BufferIndex updateBufferIndex,
  * @param viewMatrix used to calculate modelview matrix for the items
  * @param cameraAttachment The camera used to render
  * @param isLayer3d Whether we are processing a 3D layer or not
+ * @param cull Whether to cull the renderers against the view frustum
  */
 inline void AddRenderersToRenderList( BufferIndex updateBufferIndex,
                                       RenderList& renderList,
@@ -172,17 +204,23 @@ inline void AddRenderersToRenderList( BufferIndex updateBufferIndex,
                                       NodeRendererContainer& renderers,
                                       const Matrix& viewMatrix,
                                       SceneGraph::CameraAttachment& cameraAttachment,
-                                      bool isLayer3d )
+                                      bool isLayer3d,
+                                      bool cull )
 {
   DALI_LOG_INFO( gRenderListLogFilter, Debug::Verbose, "AddRenderersToRenderList()\n");
 
+  unsigned int culledCount( 0u );
+
   // Add renderer for each attachment
   unsigned int index(0);
   const RenderableAttachmentIter endIter = attachments.end();
   for ( RenderableAttachmentIter iter = attachments.begin(); iter != endIter; ++iter )
   {
     RenderableAttachment& attachment = **iter;
-    AddRendererToRenderList( updateBufferIndex, renderList, attachment, viewMatrix, cameraAttachment, isLayer3d );
+    if( !AddRendererToRenderList( updateBufferIndex, renderList, attachment, viewMatrix, cameraAttachment, isLayer3d, cull ) )
+    {
+      ++culledCount;
+    }
 
     DALI_LOG_INFO( gRenderListLogFilter, Debug::Verbose, "  List[%d].renderer = %p\n", index, &(attachment.GetRenderer()));
     ++index;
@@ -191,8 +229,13 @@ inline void AddRenderersToRenderList( BufferIndex updateBufferIndex,
   unsigned int rendererCount( renderers.Size() );
   for( unsigned int i(0); i<rendererCount; ++i )
   {
-    AddRendererToRenderList( updateBufferIndex, renderList, renderers[i], viewMatrix, cameraAttachment, isLayer3d );
+    if( !AddRendererToRenderList( updateBufferIndex, renderList, renderers[i], viewMatrix, cameraAttachment, isLayer3d, cull ) )
+    {
+      ++culledCount;
+    }
   }
+
+  renderList.SetCulledCount( culledCount );
 }
 
 /**
@@ -236,80 +279,6 @@ inline bool TryReuseCachedRenderers( Layer& layer,
 }
 
 
-/**
- * Function which sorts render items by depth index then by instance
- * ptrs of shader/geometry/material.
- * @param lhs item
- * @param rhs item
- * @return true if left item is greater than right
- */
-bool CompareItems( const RendererWithSortAttributes& lhs, const RendererWithSortAttributes& rhs )
-{
-  // @todo MESH_REWORK Consider replacing all these sortAttributes with a single long int that
-  // encapsulates the same data (e.g. the middle-order bits of the ptrs)
-  if( lhs.renderItem->GetDepthIndex() == rhs.renderItem->GetDepthIndex() )
-  {
-    if( lhs.shader == rhs.shader )
-    {
-      if( lhs.textureResourceId == rhs.textureResourceId )
-      {
-        return lhs.geometry < rhs.geometry;
-      }
-      return lhs.textureResourceId < rhs.textureResourceId;
-    }
-    return lhs.shader < rhs.shader;;
-  }
-  return lhs.renderItem->GetDepthIndex() < rhs.renderItem->GetDepthIndex();
-}
-/**
- * Function which sorts the render items by Z function, then
- * by instance ptrs of shader/geometry/material.
- * @param lhs item
- * @param rhs item
- * @return true if left item is greater than right
- */
-bool CompareItems3D( const RendererWithSortAttributes& lhs, const RendererWithSortAttributes& rhs )
-{
-  bool lhsIsOpaque = lhs.renderItem->IsOpaque();
-  if( lhsIsOpaque ==  rhs.renderItem->IsOpaque())
-  {
-    if( lhsIsOpaque )
-    {
-      //If both RenderItems are opaque, sort using shader, then material then geometry
-      if( lhs.shader == rhs.shader )
-      {
-        if( lhs.textureResourceId == rhs.textureResourceId )
-        {
-          return lhs.geometry < rhs.geometry;
-        }
-        return lhs.textureResourceId < rhs.textureResourceId;
-      }
-      return lhs.shader < rhs.shader;
-    }
-    else
-    {
-      //If both RenderItems are transparent, sort using z,then shader, then material, then geometry
-      if( Equals(lhs.zValue, rhs.zValue) )
-      {
-        if( lhs.shader == rhs.shader )
-        {
-          if( lhs.textureResourceId == rhs.textureResourceId )
-          {
-            return lhs.geometry < rhs.geometry;
-          }
-          return lhs.textureResourceId < rhs.textureResourceId;
-        }
-        return lhs.shader < rhs.shader;
-      }
-      return lhs.zValue > rhs.zValue;
-    }
-  }
-  else
-  {
-    return lhsIsOpaque;
-  }
-}
-
 /**
  * Sort color render items
  * @param colorRenderList to sort
@@ -319,20 +288,20 @@ bool CompareItems3D( const RendererWithSortAttributes& lhs, const RendererWithSo
 inline void SortColorRenderItems( BufferIndex bufferIndex, RenderList& renderList, Layer& layer, RendererSortingHelper& sortingHelper )
 {
   const size_t renderableCount = renderList.Count();
-  // reserve space if needed
-  const unsigned int oldcapacity = sortingHelper.size();
+  RendererSortAttributesContainer& sortAttributes = sortingHelper.GetSortAttributes();
+  const unsigned int oldcapacity = sortAttributes.size();
   if( oldcapacity < renderableCount )
   {
-    sortingHelper.reserve( renderableCount );
+    sortAttributes.reserve( renderableCount );
     // add real objects (reserve does not construct objects)
-    sortingHelper.insert( sortingHelper.begin() + oldcapacity,
-                          (renderableCount - oldcapacity),
-                          RendererWithSortAttributes() );
+    sortAttributes.insert( sortAttributes.begin() + oldcapacity,
+                           (renderableCount - oldcapacity),
+                           RendererWithSortAttributes() );
   }
   else
   {
     // clear extra elements from helper, does not decrease capability
-    sortingHelper.resize( renderableCount );
+    sortAttributes.resize( renderableCount );
   }
 
   // calculate the sorting value, once per item by calling the layers sort function
@@ -343,13 +312,13 @@ inline void SortColorRenderItems( BufferIndex bufferIndex, RenderList& renderLis
     {
       RenderItem& item = renderList.GetItem( index );
 
-      item.GetRenderer().SetSortAttributes( bufferIndex, sortingHelper[ index ] );
+      item.GetRenderer().SetSortAttributes( bufferIndex, sortAttributes[ index ] );
 
       // the default sorting function should get inlined here
-      sortingHelper[ index ].zValue = Internal::Layer::ZValue( item.GetModelViewMatrix().GetTranslation3() ) - item.GetDepthIndex();
+      sortAttributes[ index ].zValue = Internal::Layer::ZValue( item.GetModelViewMatrix().GetTranslation3() ) - item.GetDepthIndex();
 
       // keep the renderitem pointer in the helper so we can quickly reorder items after sort
-      sortingHelper[ index ].renderItem = &item;
+      sortAttributes[ index ].renderItem = &item;
     }
   }
   else
@@ -359,32 +328,27 @@ inline void SortColorRenderItems( BufferIndex bufferIndex, RenderList& renderLis
     {
       RenderItem& item = renderList.GetItem( index );
 
-      item.GetRenderer().SetSortAttributes( bufferIndex, sortingHelper[ index ] );
-      sortingHelper[ index ].zValue = (*sortFunction)( item.GetModelViewMatrix().GetTranslation3() ) - item.GetDepthIndex();
+      item.GetRenderer().SetSortAttributes( bufferIndex, sortAttributes[ index ] );
+      sortAttributes[ index ].zValue = (*sortFunction)( item.GetModelViewMatrix().GetTranslation3() ) - item.GetDepthIndex();
 
       // keep the renderitem pointer in the helper so we can quickly reorder items after sort
-      sortingHelper[ index ].renderItem = &item;
+      sortAttributes[ index ].renderItem = &item;
     }
   }
 
-  if( layer.GetBehavior() ==  Dali::Layer::LAYER_3D)
-  {
-    // sort the renderers back to front, Z Axis point from near plane to far plane
-    std::stable_sort( sortingHelper.begin(), sortingHelper.end(), CompareItems3D );
-  }
-  else
-  {
-    // sort the renderers based on DepthIndex
-    std::stable_sort( sortingHelper.begin(), sortingHelper.end(), CompareItems );
-  }
+  // sort 3D layers back to front, Z Axis point from near plane to far plane; other layers by depth index
+  sortingHelper.Sort( layer.GetBehavior() == Dali::Layer::LAYER_3D );
+
+  // the sort replaces the attributes, so take the reference again
+  const RendererSortAttributesContainer& sortedAttributes = sortingHelper.GetSortAttributes();
 
   // reorder/repopulate the renderitems in renderlist to correct order based on sortinghelper
   DALI_LOG_INFO( gRenderListLogFilter, Debug::Verbose, "Sorted Transparent List:\n");
   RenderItemContainer::Iterator renderListIter = renderList.GetContainer().Begin();
   for( unsigned int index = 0; index < renderableCount; ++index, ++renderListIter )
   {
-    *renderListIter = sortingHelper[ index ].renderItem;
-    DALI_LOG_INFO( gRenderListLogFilter, Debug::Verbose, "  sortedList[%d] = %p\n", index, &sortingHelper[ index ].renderItem->GetRenderer() );
+    *renderListIter = sortedAttributes[ index ].renderItem;
+    DALI_LOG_INFO( gRenderListLogFilter, Debug::Verbose, "  sortedList[%d] = %p\n", index, &sortedAttributes[ index ].renderItem->GetRenderer() );
   }
 }
 
@@ -398,6 +362,7 @@ inline void SortColorRenderItems( BufferIndex bufferIndex, RenderList& renderLis
  * @param instruction to fill in
  * @param sortingHelper to use for sorting the renderitems (to avoid reallocating)
  * @param tryReuseRenderList whether to try to reuse the cached items from the instruction
+ * @param cull Whether to cull the renderers against the view frustum
  */
 inline void AddColorRenderers( BufferIndex updateBufferIndex,
                                Layer& layer,
@@ -406,7 +371,8 @@ inline void AddColorRenderers( BufferIndex updateBufferIndex,
                                bool stencilRenderablesExist,
                                RenderInstruction& instruction,
                                RendererSortingHelper& sortingHelper,
-                               bool tryReuseRenderList )
+                               bool tryReuseRenderList,
+                               bool cull )
 {
   RenderList& renderList = instruction.GetNextFreeRenderList( layer.colorRenderables.size() );
   renderList.SetClipping( layer.IsClipping(), layer.GetClippingBox() );
@@ -421,7 +387,7 @@ inline void AddColorRenderers( BufferIndex updateBufferIndex,
     }
   }
 
-  AddRenderersToRenderList( updateBufferIndex, renderList, layer.colorRenderables, layer.colorRenderers, viewMatrix, cameraAttachment, layer.GetBehavior() == Dali::Layer::LAYER_3D );
+  AddRenderersToRenderList( updateBufferIndex, renderList, layer.colorRenderables, layer.colorRenderers, viewMatrix, cameraAttachment, layer.GetBehavior() == Dali::Layer::LAYER_3D, cull );
   SortColorRenderItems( updateBufferIndex, renderList, layer, sortingHelper );
 
   //Set render flags
@@ -449,6 +415,11 @@ inline void AddColorRenderers( BufferIndex updateBufferIndex,
     flags |= RenderList::DEPTH_CLEAR;
   }
 
+  if( layer.IsBatchingEnabled() )
+  {
+    flags |= RenderList::BATCHING_ENABLED;
+  }
+
   renderList.ClearFlags();
   renderList.SetFlags( flags );
 }
@@ -461,6 +432,7 @@ inline void AddColorRenderers( BufferIndex updateBufferIndex,
  * @param stencilRenderablesExist is true if there are stencil renderers on this layer
  * @param instruction to fill in
  * @param tryReuseRenderList whether to try to reuse the cached items from the instruction
+ * @param cull Whether to cull the renderers against the view frustum
  */
 inline void AddOverlayRenderers( BufferIndex updateBufferIndex,
                                  Layer& layer,
@@ -468,7 +440,8 @@ inline void AddOverlayRenderers( BufferIndex updateBufferIndex,
                                  SceneGraph::CameraAttachment& cameraAttachment,
                                  bool stencilRenderablesExist,
                                  RenderInstruction& instruction,
-                                 bool tryReuseRenderList )
+                                 bool tryReuseRenderList,
+                                 bool cull )
 {
   RenderList& overlayRenderList = instruction.GetNextFreeRenderList( layer.overlayRenderables.size() );
   overlayRenderList.SetClipping( layer.IsClipping(), layer.GetClippingBox() );
@@ -489,7 +462,7 @@ inline void AddOverlayRenderers( BufferIndex updateBufferIndex,
       return;
     }
   }
-  AddRenderersToRenderList( updateBufferIndex, overlayRenderList, layer.overlayRenderables, layer.overlayRenderers, viewMatrix, cameraAttachment, layer.GetBehavior() == Dali::Layer::LAYER_3D );
+  AddRenderersToRenderList( updateBufferIndex, overlayRenderList, layer.overlayRenderables, layer.overlayRenderers, viewMatrix, cameraAttachment, layer.GetBehavior() == Dali::Layer::LAYER_3D, cull );
 }
 
 /**
@@ -523,7 +496,8 @@ inline void AddStencilRenderers( BufferIndex updateBufferIndex,
       return;
     }
   }
-  AddRenderersToRenderList( updateBufferIndex, stencilRenderList, layer.stencilRenderables, layer.stencilRenderers, viewMatrix, cameraAttachment, layer.GetBehavior() == Dali::Layer::LAYER_3D );
+  // Stencils affect the drawing of the other renderers; these are never culled
+  AddRenderersToRenderList( updateBufferIndex, stencilRenderList, layer.stencilRenderables, layer.stencilRenderers, viewMatrix, cameraAttachment, layer.GetBehavior() == Dali::Layer::LAYER_3D, false );
 }
 
 /**
@@ -533,6 +507,7 @@ inline void AddStencilRenderers( BufferIndex updateBufferIndex,
  * @param renderTask to get the view matrix
  * @param sortingHelper to use for sorting the renderitems (to avoid reallocating)
  * @param renderTracker An optional render tracker object
+ * @param culledCount The number of renderables in the sub-trees which were culled
  * @param instructions container
  */
 void PrepareRenderInstruction( BufferIndex updateBufferIndex,
@@ -540,6 +515,7 @@ void PrepareRenderInstruction( BufferIndex updateBufferIndex,
                                RenderTask& renderTask,
                                RendererSortingHelper& sortingHelper,
                                RenderTracker* renderTracker,
+                               unsigned int culledCount,
                                RenderInstructionContainer& instructions )
 {
   // Retrieve the RenderInstruction buffer from the RenderInstructionContainer
@@ -550,6 +526,7 @@ void PrepareRenderInstruction( BufferIndex updateBufferIndex,
 
   const Matrix& viewMatrix = renderTask.GetViewMatrix( updateBufferIndex );
   SceneGraph::CameraAttachment& cameraAttachment = renderTask.GetCameraAttachment();
+  const bool cull = renderTask.GetCullMode();
 
   const SortedLayersIter endIter = sortedLayers.end();
   for ( SortedLayersIter iter = sortedLayers.begin(); iter != endIter; ++iter )
@@ -561,6 +538,10 @@ void PrepareRenderInstruction( BufferIndex updateBufferIndex,
     const bool overlayRenderablesExist( !layer.overlayRenderables.empty() || !layer.overlayRenderers.Empty() );
     const bool tryReuseRenderList( viewMatrixHasNotChanged && layer.CanReuseRenderers(renderTask.GetCamera()) );
 
+    // The render cache has no stencil buffer, and is only kept for the on-screen instructions
+    const bool useRenderCache( layer.IsRenderCacheEnabled() && !stencilRenderablesExist && 0u == instruction.mOffscreenTextureId );
+    const RenderListContainer::SizeType firstListIndex = instruction.RenderListCount();
+
     // Ignore stencils if there's nothing to test
     if( stencilRenderablesExist &&
         ( colorRenderablesExist || overlayRenderablesExist ) )
@@ -577,18 +558,35 @@ void PrepareRenderInstruction( BufferIndex updateBufferIndex,
                          stencilRenderablesExist,
                          instruction,
                          sortingHelper,
-                         tryReuseRenderList );
+                         tryReuseRenderList,
+                         cull );
     }
 
     if ( overlayRenderablesExist )
     {
       AddOverlayRenderers( updateBufferIndex, layer, viewMatrix, cameraAttachment, stencilRenderablesExist,
-                           instruction, tryReuseRenderList );
+                           instruction, tryReuseRenderList, cull );
+    }
+
+    if( useRenderCache )
+    {
+      // The damage tracker marks the lists whose items changed, so the render cache is redrawn
+      for( RenderListContainer::SizeType index = firstListIndex; index < instruction.RenderListCount(); ++index )
+      {
+        instruction.GetRenderList( index )->SetCachedLayer( &layer );
+      }
     }
   }
 
   instruction.mRenderTracker = renderTracker;
-  instruction.mCullMode = renderTask.GetCullMode();
+  instruction.mCullMode = cull;
+
+  // The renderables culled from the lists, including the lists reused from the previous frame
+  instruction.mCulledCount = culledCount;
+  for( RenderListContainer::SizeType index = 0; index < instruction.RenderListCount(); ++index )
+  {
+    instruction.mCulledCount += instruction.GetRenderList( index )->GetCulledCount();
+  }
 
   // inform the render instruction that all renderers have been added and this frame is complete
   instruction.UpdateCompleted();
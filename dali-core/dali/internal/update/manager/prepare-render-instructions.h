@@ -21,7 +21,7 @@
 // INTERNAL INCLUDES
 #include <dali/internal/common/buffer-index.h>
 #include <dali/internal/update/manager/sorted-layers.h>
-#include <dali/integration-api/resource-declarations.h>
+#include <dali/internal/update/manager/renderer-sorting-helper.h>
 
 namespace Dali
 {
@@ -32,35 +32,6 @@ namespace Internal
 namespace SceneGraph
 {
 class RenderTracker;
-class RenderItem;
-class Shader;
-class RenderGeometry;
-class MaterialDataProvider;
-
-/**
- * Structure to store information for sorting the renderers.
- * (Note, depthIndex is stored within the renderItem).
- */
-struct RendererWithSortAttributes
-{
-  RendererWithSortAttributes()
-  : renderItem( NULL ),
-    shader(NULL),
-    textureResourceId( Integration::InvalidResourceId ),
-    geometry(NULL),
-    zValue(0.0f)
-  {
-  }
-
-  RenderItem*                   renderItem;       ///< The render item that is being sorted (includes depth index)
-  const Shader*                 shader;           ///< The shader instance
-  Integration::ResourceId       textureResourceId;///< The first texture resource ID of the sampler instance, is InvalidResourceId if the material doesn't have any samplers
-  const RenderGeometry*         geometry;         ///< The geometry instance
-  float                         zValue;           ///< The zValue of the given renderer (either distance from camera, or a custom calculated value)
-};
-
-typedef std::vector< RendererWithSortAttributes > RendererSortingHelper;
-
 class RenderTask;
 class RenderInstructionContainer;
 
@@ -79,6 +50,7 @@ class RenderInstructionContainer;
  * @param[in] sortedLayers The layers containing lists of opaque/transparent renderables.
  * @param[in] renderTask The rendering task information.
  * @param[in] renderTracker A tracker object if we need to know when this render instruction has actually rendered, or NULL if tracking is not required
+ * @param[in] culledCount The number of renderables in the sub-trees which were culled before preparing the instruction.
  * @param[out] instructions The rendering instructions for the next frame.
  */
 void PrepareRenderInstruction( BufferIndex updateBufferIndex,
@@ -86,6 +58,7 @@ void PrepareRenderInstruction( BufferIndex updateBufferIndex,
                                RenderTask& renderTask,
                                RendererSortingHelper& sortingHelper,
                                RenderTracker* renderTracker,
+                               unsigned int culledCount,
                                RenderInstructionContainer& instructions );
 
 } // namespace SceneGraph
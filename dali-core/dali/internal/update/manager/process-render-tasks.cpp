@@ -27,6 +27,7 @@
 #include <dali/internal/update/render-tasks/scene-graph-render-task.h>
 #include <dali/internal/update/render-tasks/scene-graph-render-task-list.h>
 #include <dali/internal/update/node-attachments/scene-graph-renderable-attachment.h>
+#include <dali/internal/update/node-attachments/scene-graph-camera-attachment.h>
 #include <dali/internal/update/nodes/scene-graph-layer.h>
 #include <dali/internal/render/common/render-item.h>
 #include <dali/internal/render/common/render-tracker.h>
@@ -97,13 +98,16 @@ static Layer* FindLayer( Node& node )
 /**
  * Rebuild the Layer::opaqueRenderables, transparentRenderables and overlayRenderables members,
  * including only renderable-attachments which are included in the current render-task.
+ * When culling is enabled, sub-trees whose bounds are outside the view frustum are skipped.
  * Returns true if all renderable attachments have finshed acquiring resources.
  */
 static bool AddRenderablesForTask( BufferIndex updateBufferIndex,
                                    Node& node,
                                    Layer& currentLayer,
                                    RenderTask& renderTask,
-                                   int inheritedDrawMode )
+                                   int inheritedDrawMode,
+                                   bool cull,
+                                   unsigned int& culledCount )
 {
   bool resourcesFinished = true;
 
@@ -135,6 +139,20 @@ static bool AddRenderablesForTask( BufferIndex updateBufferIndex,
 
   inheritedDrawMode |= node.GetDrawMode();
 
+  // Reject the whole sub-tree if it cannot be seen; stencils are never culled, since they affect the drawing of other nodes
+  if ( cull && DrawMode::STENCIL != inheritedDrawMode )
+  {
+    Vector3 center;
+    Vector3 halfExtents;
+    if ( node.GetSubtreeBounds( center, halfExtents ) &&
+         !renderTask.GetCameraAttachment().CheckAABBInFrustum( updateBufferIndex, center, halfExtents ) )
+    {
+      culledCount += node.GetSubtreeRenderableCount();
+
+      // The sub-tree is not drawn, therefore its resources are not required
+      return resourcesFinished;
+    }
+  }
 
   if ( node.HasAttachment() )
   {
@@ -217,7 +235,7 @@ static bool AddRenderablesForTask( BufferIndex updateBufferIndex,
   for ( NodeIter iter = children.Begin(); iter != endIter; ++iter )
   {
     Node& child = **iter;
-    bool childResourcesComplete = AddRenderablesForTask( updateBufferIndex, child, *layer, renderTask, inheritedDrawMode );
+    bool childResourcesComplete = AddRenderablesForTask( updateBufferIndex, child, *layer, renderTask, inheritedDrawMode, cull, culledCount );
     resourcesFinished = !childResourcesComplete ? childResourcesComplete : resourcesFinished;
   }
 
@@ -288,11 +306,14 @@ void ProcessRenderTasks( BufferIndex updateBufferIndex,
     {
       ClearRenderables( sortedLayers );
 
+      unsigned int culledCount = 0u;
       resourcesFinished = AddRenderablesForTask( updateBufferIndex,
                                                  *sourceNode,
                                                  *layer,
                                                  renderTask,
-                                                 sourceNode->GetDrawMode() );
+                                                 sourceNode->GetDrawMode(),
+                                                 renderTask.GetCullMode(),
+                                                 culledCount );
 
       // Set update trackers to complete, or get render trackers to pass onto render thread
       RenderTracker* renderTracker = NULL;
@@ -317,6 +338,7 @@ void ProcessRenderTasks( BufferIndex updateBufferIndex,
                                 renderTask,
                                 sortingHelper,
                                 renderTracker,
+                                culledCount,
                                 instructions );
     }
 
@@ -363,17 +385,21 @@ void ProcessRenderTasks( BufferIndex updateBufferIndex,
     {
       ClearRenderables( sortedLayers );
 
+      unsigned int culledCount = 0u;
       resourcesFinished = AddRenderablesForTask( updateBufferIndex,
                                                  *sourceNode,
                                                  *layer,
                                                  renderTask,
-                                                 sourceNode->GetDrawMode() );
+                                                 sourceNode->GetDrawMode(),
+                                                 renderTask.GetCullMode(),
+                                                 culledCount );
 
       PrepareRenderInstruction( updateBufferIndex,
                                 sortedLayers,
                                 renderTask,
                                 sortingHelper,
                                 NULL,
+                                culledCount,
                                 instructions );
     }
 
@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/update/manager/renderer-sorting-helper.h>
+
+// EXTERNAL INCLUDES
+#include <cstring>
+
+// INTERNAL INCLUDES
+#include <dali/internal/render/common/render-item.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+
+namespace
+{
+
+// The sort key, from the most significant bit:
+//   1 bit   transparent (3D layers only)
+//   32 bits depth index (2D layers), or Z value from back to front (transparent items in 3D layers)
+//   8 bits  shader
+//   12 bits texture
+//   11 bits geometry
+const unsigned int GEOMETRY_BITS = 11u;
+const unsigned int TEXTURE_BITS = 12u;
+const unsigned int SHADER_BITS = 8u;
+const unsigned int DEPTH_BITS = 32u;
+
+const unsigned int TEXTURE_SHIFT = GEOMETRY_BITS;
+const unsigned int SHADER_SHIFT = TEXTURE_SHIFT + TEXTURE_BITS;
+const unsigned int DEPTH_SHIFT = SHADER_SHIFT + SHADER_BITS;
+const unsigned int TRANSPARENT_SHIFT = DEPTH_SHIFT + DEPTH_BITS;
+
+const unsigned int RADIX_BITS = 8u;
+const unsigned int RADIX_SIZE = 1u << RADIX_BITS;
+const unsigned int RADIX_PASSES = 64u / RADIX_BITS;
+
+const unsigned int MINIMUM_ID_TABLE_SIZE = 64u;
+
+/**
+ * Map a depth index to an unsigned value with the same order.
+ */
+inline uint32_t OrderedDepth( int depthIndex )
+{
+  return static_cast< uint32_t >( depthIndex ) ^ 0x80000000u;
+}
+
+/**
+ * Map a Z value to an unsigned value which orders from back to front i.e. decreasing Z.
+ */
+inline uint32_t OrderedZValue( float zValue )
+{
+  uint32_t bits;
+  memcpy( &bits, &zValue, sizeof( bits ) );
+
+  // Flip all bits of negative values and the sign bit of positive values, for increasing order; then reverse
+  const uint32_t increasing = bits ^ ( ( bits & 0x80000000u ) ? 0xFFFFFFFFu : 0x80000000u );
+  return ~increasing;
+}
+
+} // unnamed namespace
+
+RendererSortingHelper::IdTable::IdTable( unsigned int maximumId )
+: mEntries(),
+  mCount( 0u ),
+  mMaximumId( maximumId )
+{
+}
+
+void RendererSortingHelper::IdTable::Clear()
+{
+  if( mCount > 0u )
+  {
+    memset( mEntries.Begin(), 0, mEntries.Count() * sizeof( Entry ) );
+    mCount = 0u;
+  }
+}
+
+unsigned int RendererSortingHelper::IdTable::GetId( uintptr_t value )
+{
+  if( ( mCount + 1u ) * 2u > mEntries.Count() )
+  {
+    Grow();
+  }
+
+  const unsigned int mask = mEntries.Count() - 1u;
+  unsigned int index = static_cast< unsigned int >( ( value >> 3u ) ^ value ) * 2654435761u & mask;
+  while( 0u != mEntries[index].id )
+  {
+    if( value == mEntries[index].value )
+    {
+      return mEntries[index].id - 1u;
+    }
+    index = ( index + 1u ) & mask;
+  }
+
+  ++mCount;
+  mEntries[index].value = value;
+  mEntries[index].id = ( mCount <= mMaximumId ) ? mCount : mMaximumId + 1u;
+  return mEntries[index].id - 1u;
+}
+
+void RendererSortingHelper::IdTable::Grow()
+{
+  Dali::Vector< Entry > entries;
+  entries.Swap( mEntries );
+
+  const Entry unused = { 0u, 0u };
+  mEntries.Resize( entries.Empty() ? MINIMUM_ID_TABLE_SIZE : entries.Count() * 2u, unused );
+
+  // Keep the existing numbers
+  const unsigned int mask = mEntries.Count() - 1u;
+  for( Dali::Vector< Entry >::Iterator iter = entries.Begin(), endIter = entries.End(); iter != endIter; ++iter )
+  {
+    if( 0u != iter->id )
+    {
+      unsigned int index = static_cast< unsigned int >( ( iter->value >> 3u ) ^ iter->value ) * 2654435761u & mask;
+      while( 0u != mEntries[index].id )
+      {
+        index = ( index + 1u ) & mask;
+      }
+      mEntries[index] = *iter;
+    }
+  }
+}
+
+RendererSortingHelper::RendererSortingHelper()
+: mSortAttributes(),
+  mSorted(),
+  mItems(),
+  mBuffer(),
+  mShaderIds( ( 1u << SHADER_BITS ) - 1u ),
+  mTextureIds( ( 1u << TEXTURE_BITS ) - 1u ),
+  mGeometryIds( ( 1u << GEOMETRY_BITS ) - 1u )
+{
+}
+
+RendererSortingHelper::~RendererSortingHelper()
+{
+}
+
+void RendererSortingHelper::Sort( bool layer3d )
+{
+  const unsigned int count = mSortAttributes.size();
+  if( count < 2u )
+  {
+    return;
+  }
+
+  CalculateKeys( layer3d );
+  RadixSort();
+
+  // Reorder the attributes
+  mSorted.resize( count );
+  for( unsigned int i = 0u; i < count; ++i )
+  {
+    mSorted[i] = mSortAttributes[ mItems[i].index ];
+  }
+  mSortAttributes.swap( mSorted );
+}
+
+void RendererSortingHelper::CalculateKeys( bool layer3d )
+{
+  const unsigned int count = mSortAttributes.size();
+  mItems.Resize( count );
+
+  mShaderIds.Clear();
+  mTextureIds.Clear();
+  mGeometryIds.Clear();
+
+  for( unsigned int i = 0u; i < count; ++i )
+  {
+    const RendererWithSortAttributes& attributes = mSortAttributes[i];
+
+    uint64_t key = ( static_cast< uint64_t >( mShaderIds.GetId( reinterpret_cast< uintptr_t >( attributes.shader ) ) ) << SHADER_SHIFT ) |
+                   ( static_cast< uint64_t >( mTextureIds.GetId( attributes.textureResourceId ) ) << TEXTURE_SHIFT ) |
+                   static_cast< uint64_t >( mGeometryIds.GetId( reinterpret_cast< uintptr_t >( attributes.geometry ) ) );
+
+    if( !layer3d )
+    {
+      key |= static_cast< uint64_t >( OrderedDepth( attributes.renderItem->GetDepthIndex() ) ) << DEPTH_SHIFT;
+    }
+    else if( !attributes.renderItem->IsOpaque() )
+    {
+      // Opaque items are drawn first, in any order
+      key |= ( static_cast< uint64_t >( 1u ) << TRANSPARENT_SHIFT ) |
+             ( static_cast< uint64_t >( OrderedZValue( attributes.zValue ) ) << DEPTH_SHIFT );
+    }
+
+    mItems[i].key = key;
+    mItems[i].index = i;
+  }
+}
+
+void RendererSortingHelper::RadixSort()
+{
+  const unsigned int count = mItems.Count();
+  mBuffer.Resize( count );
+
+  // Count the digits of every pass at once
+  unsigned int histograms[ RADIX_PASSES ][ RADIX_SIZE ];
+  memset( histograms, 0, sizeof( histograms ) );
+  for( unsigned int i = 0u; i < count; ++i )
+  {
+    uint64_t key = mItems[i].key;
+    for( unsigned int pass = 0u; pass < RADIX_PASSES; ++pass )
+    {
+      ++histograms[pass][ key & ( RADIX_SIZE - 1u ) ];
+      key >>= RADIX_BITS;
+    }
+  }
+
+  SortItem* source = mItems.Begin();
+  SortItem* destination = mBuffer.Begin();
+  for( unsigned int pass = 0u; pass < RADIX_PASSES; ++pass )
+  {
+    unsigned int* histogram = histograms[pass];
+    const unsigned int shift = pass * RADIX_BITS;
+
+    // The pass would not move any item
+    if( histogram[ ( source[0].key >> shift ) & ( RADIX_SIZE - 1u ) ] == count )
+    {
+      continue;
+    }
+
+    // Convert the counts to offsets
+    unsigned int offset = 0u;
+    for( unsigned int digit = 0u; digit < RADIX_SIZE; ++digit )
+    {
+      const unsigned int digitCount = histogram[digit];
+      histogram[digit] = offset;
+      offset += digitCount;
+    }
+
+    for( unsigned int i = 0u; i < count; ++i )
+    {
+      destination[ histogram[ ( source[i].key >> shift ) & ( RADIX_SIZE - 1u ) ]++ ] = source[i];
+    }
+
+    SortItem* swap = source;
+    source = destination;
+    destination = swap;
+  }
+
+  if( source != mItems.Begin() )
+  {
+    mItems.Swap( mBuffer );
+  }
+}
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,195 @@
+#ifndef __DALI_INTERNAL_SCENE_GRAPH_RENDERER_SORTING_HELPER_H__
+#define __DALI_INTERNAL_SCENE_GRAPH_RENDERER_SORTING_HELPER_H__
+
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <stdint.h>
+
+// INTERNAL INCLUDES
+#include <dali/public-api/common/dali-vector.h>
+#include <dali/public-api/common/vector-wrapper.h>
+#include <dali/integration-api/resource-declarations.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+class RenderItem;
+class Shader;
+class RenderGeometry;
+
+/**
+ * Structure to store information for sorting the renderers.
+ * (Note, depthIndex is stored within the renderItem).
+ */
+struct RendererWithSortAttributes
+{
+  RendererWithSortAttributes()
+  : renderItem( NULL ),
+    shader(NULL),
+    textureResourceId( Integration::InvalidResourceId ),
+    geometry(NULL),
+    zValue(0.0f)
+  {
+  }
+
+  RenderItem*                   renderItem;       ///< The render item that is being sorted (includes depth index)
+  const Shader*                 shader;           ///< The shader instance
+  Integration::ResourceId       textureResourceId;///< The first texture resource ID of the sampler instance, is InvalidResourceId if the material doesn't have any samplers
+  const RenderGeometry*         geometry;         ///< The geometry instance
+  float                         zValue;           ///< The zValue of the given renderer (either distance from camera, or a custom calculated value)
+};
+
+typedef std::vector< RendererWithSortAttributes > RendererSortAttributesContainer;
+
+/**
+ * Sorts the render items of a layer, using a packed 64-bit key per item and an LSD radix sort.
+ *
+ * For 2D layers the key holds the depth index, then the shader, texture & geometry.
+ * For 3D layers the key holds the opacity (opaque items first), then the Z value of transparent items
+ * (back to front), then the shader, texture & geometry.
+ *
+ * Shaders, textures & geometries are numbered in the order they are first seen in each sort; this groups
+ * the items which share them, to reduce state changes. When a layer uses more of them than fit in the key,
+ * the remainder share the last number, and are kept in their original order. The sort is stable.
+ *
+ * The buffers are kept between sorts to avoid reallocating.
+ */
+class RendererSortingHelper
+{
+public:
+
+  /**
+   * Constructor.
+   */
+  RendererSortingHelper();
+
+  /**
+   * Non-virtual destructor.
+   */
+  ~RendererSortingHelper();
+
+  /**
+   * Retrieve the attributes of the items to sort; these are resized and filled in before Sort().
+   * @return The sort attributes.
+   */
+  RendererSortAttributesContainer& GetSortAttributes()
+  {
+    return mSortAttributes;
+  }
+
+  /**
+   * Sort the attributes.
+   * @param[in] layer3d True if the items are from a 3D layer.
+   */
+  void Sort( bool layer3d );
+
+private:
+
+  /**
+   * Numbers the distinct values of a sort attribute, in the order they are first seen.
+   */
+  class IdTable
+  {
+  public:
+
+    /**
+     * Constructor.
+     * @param[in] maximumId The largest number, which is shared by any further values.
+     */
+    IdTable( unsigned int maximumId );
+
+    /**
+     * Remove the numbered values.
+     */
+    void Clear();
+
+    /**
+     * Retrieve the number of a value, numbering it if necessary.
+     * @param[in] value The value.
+     * @return The number.
+     */
+    unsigned int GetId( uintptr_t value );
+
+  private:
+
+    /**
+     * Double the size of the table.
+     */
+    void Grow();
+
+    struct Entry
+    {
+      uintptr_t value;
+      unsigned int id;  ///< The number plus one; zero means that the entry is unused
+    };
+
+    Dali::Vector< Entry > mEntries;
+    unsigned int mCount;
+    unsigned int mMaximumId;
+  };
+
+  /**
+   * A sort key & the index of its item.
+   */
+  struct SortItem
+  {
+    uint64_t key;
+    unsigned int index;
+  };
+
+  /**
+   * Calculate the sort keys.
+   * @param[in] layer3d True if the items are from a 3D layer.
+   */
+  void CalculateKeys( bool layer3d );
+
+  /**
+   * Sort mItems by key, using 8 bits per pass; passes where every key has the same digit are skipped.
+   */
+  void RadixSort();
+
+  // Undefined
+  RendererSortingHelper( const RendererSortingHelper& );
+
+  // Undefined
+  RendererSortingHelper& operator=( const RendererSortingHelper& );
+
+private:
+
+  RendererSortAttributesContainer mSortAttributes; ///< The attributes of the items to sort
+  RendererSortAttributesContainer mSorted;         ///< The attributes in sorted order, swapped with mSortAttributes
+  Dali::Vector< SortItem > mItems;                 ///< The keys to sort
+  Dali::Vector< SortItem > mBuffer;                ///< Used by each pass of the radix sort
+  IdTable mShaderIds;
+  IdTable mTextureIds;
+  IdTable mGeometryIds;
+};
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // __DALI_INTERNAL_SCENE_GRAPH_RENDERER_SORTING_HELPER_H__
@@ -0,0 +1,280 @@
+#ifndef __DALI_INTERNAL_SCENE_GRAPH_TRANSFORM_MANAGER_PROPERTY_H__
+#define __DALI_INTERNAL_SCENE_GRAPH_TRANSFORM_MANAGER_PROPERTY_H__
+
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali/public-api/object/property-types.h>
+#include <dali/internal/event/common/property-input-impl.h>
+#include <dali/internal/update/manager/transform-manager.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+
+/**
+ * Base class for the read-only properties which expose the world transform of a node.
+ * The values are read from the WorldTransform published by the TransformManager.
+ */
+class TransformManagerInput : public PropertyInputImpl
+{
+public:
+
+  /**
+   * Constructor; the property reads the identity transform until SetWorldTransform() is called.
+   */
+  TransformManagerInput()
+  : mWorldTransform( &TransformManager::GetIdentityTransform() )
+  {
+  }
+
+  /**
+   * Virtual destructor.
+   */
+  virtual ~TransformManagerInput()
+  {
+  }
+
+  /**
+   * Set the world transform to read from.
+   * @param[in] worldTransform The world transform of the owning node.
+   */
+  void SetWorldTransform( const WorldTransform& worldTransform )
+  {
+    mWorldTransform = &worldTransform;
+  }
+
+  /**
+   * @copydoc Dali::Internal::PropertyInputImpl::InputInitialized()
+   */
+  virtual bool InputInitialized() const
+  {
+    // A constraint cannot use the property until it has been inherited (at least once).
+    return mWorldTransform->inherited;
+  }
+
+  /**
+   * @copydoc Dali::Internal::PropertyInputImpl::InputChanged()
+   */
+  virtual bool InputChanged() const
+  {
+    return mWorldTransform->reinherited;
+  }
+
+protected:
+
+  const WorldTransform* mWorldTransform; ///< The world transform of the owning node
+};
+
+/**
+ * A read-only Vector3 property (world position or world scale) of a node.
+ */
+class TransformManagerVector3Input : public TransformManagerInput
+{
+public:
+
+  typedef Vector3 ( WorldTransform::*Member )[2];
+
+  /**
+   * Constructor.
+   * @param[in] member The WorldTransform member to read from.
+   */
+  TransformManagerVector3Input( Member member )
+  : mMember( member )
+  {
+  }
+
+  /**
+   * @copydoc Dali::Internal::PropertyInputImpl::GetType()
+   */
+  virtual Dali::Property::Type GetType() const
+  {
+    return Dali::PropertyTypes::Get<Vector3>();
+  }
+
+  /**
+   * @copydoc Dali::Internal::PropertyInputImpl::GetVector3()
+   */
+  virtual const Vector3& GetVector3( BufferIndex bufferIndex ) const
+  {
+    return ( mWorldTransform->*mMember )[ bufferIndex ];
+  }
+
+  /**
+   * @copydoc Dali::Internal::PropertyInputImpl::GetConstraintInputVector3()
+   */
+  virtual const Vector3& GetConstraintInputVector3( BufferIndex bufferIndex ) const
+  {
+    // For inherited properties, constraints work with the value from the previous frame.
+    // This is because constraints are applied to position etc, before world-position is calculated.
+    return ( mWorldTransform->*mMember )[ bufferIndex ? 0u : 1u ];
+  }
+
+  /**
+   * Retrieve the property value.
+   * @param[in] bufferIndex The buffer to read.
+   * @return The property value.
+   */
+  const Vector3& operator[]( BufferIndex bufferIndex ) const
+  {
+    return ( mWorldTransform->*mMember )[ bufferIndex ];
+  }
+
+private:
+
+  // Undefined
+  TransformManagerVector3Input( const TransformManagerVector3Input& property );
+
+  // Undefined
+  TransformManagerVector3Input& operator=( const TransformManagerVector3Input& rhs );
+
+private:
+
+  Member mMember; ///< The WorldTransform member to read from
+};
+
+/**
+ * The read-only world orientation property of a node.
+ */
+class TransformManagerQuaternionInput : public TransformManagerInput
+{
+public:
+
+  /**
+   * Constructor.
+   */
+  TransformManagerQuaternionInput()
+  {
+  }
+
+  /**
+   * @copydoc Dali::Internal::PropertyInputImpl::GetType()
+   */
+  virtual Dali::Property::Type GetType() const
+  {
+    return Dali::PropertyTypes::Get<Quaternion>();
+  }
+
+  /**
+   * @copydoc Dali::Internal::PropertyInputImpl::GetQuaternion()
+   */
+  virtual const Quaternion& GetQuaternion( BufferIndex bufferIndex ) const
+  {
+    return mWorldTransform->orientation[ bufferIndex ];
+  }
+
+  /**
+   * @copydoc Dali::Internal::PropertyInputImpl::GetConstraintInputQuaternion()
+   */
+  virtual const Quaternion& GetConstraintInputQuaternion( BufferIndex bufferIndex ) const
+  {
+    // For inherited properties, constraints work with the value from the previous frame.
+    // This is because constraints are applied to position etc, before world-position is calculated.
+    return mWorldTransform->orientation[ bufferIndex ? 0u : 1u ];
+  }
+
+  /**
+   * Retrieve the property value.
+   * @param[in] bufferIndex The buffer to read.
+   * @return The property value.
+   */
+  const Quaternion& operator[]( BufferIndex bufferIndex ) const
+  {
+    return mWorldTransform->orientation[ bufferIndex ];
+  }
+
+private:
+
+  // Undefined
+  TransformManagerQuaternionInput( const TransformManagerQuaternionInput& property );
+
+  // Undefined
+  TransformManagerQuaternionInput& operator=( const TransformManagerQuaternionInput& rhs );
+};
+
+/**
+ * The read-only world matrix property of a node.
+ */
+class TransformManagerMatrixInput : public TransformManagerInput
+{
+public:
+
+  /**
+   * Constructor.
+   */
+  TransformManagerMatrixInput()
+  {
+  }
+
+  /**
+   * @copydoc Dali::Internal::PropertyInputImpl::GetType()
+   */
+  virtual Dali::Property::Type GetType() const
+  {
+    return Dali::PropertyTypes::Get<Matrix>();
+  }
+
+  /**
+   * @copydoc Dali::Internal::PropertyInputImpl::GetMatrix()
+   */
+  virtual const Matrix& GetMatrix( BufferIndex bufferIndex ) const
+  {
+    return mWorldTransform->matrix[ bufferIndex ];
+  }
+
+  /**
+   * @copydoc Dali::Internal::PropertyInputImpl::GetConstraintInputMatrix()
+   */
+  virtual const Matrix& GetConstraintInputMatrix( BufferIndex bufferIndex ) const
+  {
+    // For inherited properties, constraints work with the value from the previous frame.
+    // This is because constraints are applied to position etc, before world-position is calculated.
+    return mWorldTransform->matrix[ bufferIndex ? 0u : 1u ];
+  }
+
+  /**
+   * Retrieve the property value.
+   * @param[in] bufferIndex The buffer to read.
+   * @return The property value.
+   */
+  const Matrix& operator[]( BufferIndex bufferIndex ) const
+  {
+    return mWorldTransform->matrix[ bufferIndex ];
+  }
+
+private:
+
+  // Undefined
+  TransformManagerMatrixInput( const TransformManagerMatrixInput& property );
+
+  // Undefined
+  TransformManagerMatrixInput& operator=( const TransformManagerMatrixInput& rhs );
+};
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // __DALI_INTERNAL_SCENE_GRAPH_TRANSFORM_MANAGER_PROPERTY_H__
@@ -0,0 +1,751 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/update/manager/transform-manager.h>
+
+// EXTERNAL INCLUDES
+#include <cmath>
+#include <cstring>
+#include <cfloat>
+
+// INTERNAL INCLUDES
+#include <dali/public-api/common/dali-common.h>
+#include <dali/public-api/math/math-utils.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+
+namespace
+{
+
+const unsigned int INVALID_INDEX = static_cast< unsigned int >( -1 );
+
+// Layout of the inheritance flags; the lowest two bits hold the PositionInheritanceMode
+const unsigned char POSITION_INHERITANCE_MASK = 0x03;
+const unsigned char INHERIT_ORIENTATION       = 0x04;
+const unsigned char INHERIT_SCALE             = 0x08;
+const unsigned char INHIBIT_LOCAL_TRANSFORM   = 0x10;
+
+const unsigned char DEFAULT_INHERITANCE = INHERIT_PARENT_POSITION | INHERIT_ORIENTATION | INHERIT_SCALE;
+
+// Layout of the content flags
+const unsigned char UNBOUNDED_CONTENT = 0x01;
+const unsigned char UNBOUNDED_SUBTREE = 0x02;
+
+// The bounds of a component without content; these are replaced by the first component merged in
+const Vector3 EMPTY_BOUNDS_MIN( FLT_MAX, FLT_MAX, FLT_MAX );
+const Vector3 EMPTY_BOUNDS_MAX( -FLT_MAX, -FLT_MAX, -FLT_MAX );
+
+/**
+ * Reorder a packed array.
+ * @param[in,out] array The array to reorder.
+ * @param[in] order The previous packed index for each new packed index.
+ */
+template< typename T >
+void Reorder( Dali::Vector< T >& array, const Dali::Vector< unsigned int >& order )
+{
+  const unsigned int count = order.Count();
+
+  Dali::Vector< T > reordered;
+  reordered.Resize( count );
+  for( unsigned int i = 0; i < count; ++i )
+  {
+    reordered[i] = array[ order[i] ];
+  }
+  array.Swap( reordered );
+}
+
+/**
+ * Calculate the world position of a component, which has a parent.
+ * @see Dali::PositionInheritanceMode for how the modes are expected to work.
+ */
+inline void InheritWorldPosition( PositionInheritanceMode mode,
+                                  const Vector3& parentOrigin,
+                                  const Vector3& anchorPoint,
+                                  const Vector3& size,
+                                  const Vector3& localPosition,
+                                  const Vector3& localScale,
+                                  const Vector3& worldScale,
+                                  const Quaternion& worldOrientation,
+                                  const Vector3& parentSize,
+                                  const Vector3& parentWorldPosition,
+                                  const Quaternion& parentWorldOrientation,
+                                  const Vector3& parentWorldScale,
+                                  Vector3& worldPosition )
+{
+  switch( mode )
+  {
+    case INHERIT_PARENT_POSITION:
+    {
+      Vector3 finalPosition( -0.5f, -0.5f, -0.5f );
+
+      finalPosition += parentOrigin;
+      finalPosition *= parentSize;
+      finalPosition += localPosition;
+      finalPosition *= parentWorldScale;
+
+      if( !parentWorldOrientation.IsIdentity() )
+      {
+        finalPosition *= parentWorldOrientation;
+      }
+
+      // check if a node needs to be offsetted locally (only applies when AnchorPoint is not central)
+      // dont use operator== as that does a slower comparison (and involves function calls)
+      Vector3 localOffset( 0.5f, 0.5f, 0.5f ); // AnchorPoint::CENTER
+      localOffset -= anchorPoint;
+
+      if( ( fabsf( localOffset.x ) >= Math::MACHINE_EPSILON_0 ) ||
+          ( fabsf( localOffset.y ) >= Math::MACHINE_EPSILON_0 ) ||
+          ( fabsf( localOffset.z ) >= Math::MACHINE_EPSILON_0 ) )
+      {
+        localOffset *= size;
+
+        Vector3 scale = worldScale;
+
+        // Pick up sign of local scale
+        if( localScale.x < 0.0f )
+        {
+          scale.x = -scale.x;
+        }
+        if( localScale.y < 0.0f )
+        {
+          scale.y = -scale.y;
+        }
+        if( localScale.z < 0.0f )
+        {
+          scale.z = -scale.z;
+        }
+
+        // If the anchor-point is not central, then position is affected by the local orientation & scale
+        localOffset *= scale;
+
+        if( !worldOrientation.IsIdentity() )
+        {
+          localOffset *= worldOrientation;
+        }
+
+        finalPosition += localOffset;
+      }
+
+      finalPosition += parentWorldPosition;
+      worldPosition = finalPosition;
+      break;
+    }
+
+    case USE_PARENT_POSITION_PLUS_LOCAL_POSITION:
+    {
+      // copy parents position plus local transform
+      worldPosition = parentWorldPosition + localPosition;
+      break;
+    }
+
+    case USE_PARENT_POSITION:
+    {
+      // copy parents position
+      worldPosition = parentWorldPosition;
+      break;
+    }
+
+    case DONT_INHERIT_POSITION:
+    {
+      // use local position as world position
+      worldPosition = localPosition;
+      break;
+    }
+  }
+}
+
+} // unnamed namespace
+
+TransformManager::TransformManager()
+: mWorldTransformPool(),
+  mFirstDirty( INVALID_INDEX ),
+  mReorder( false ),
+  mBoundsChanged( false )
+{
+}
+
+TransformManager::~TransformManager()
+{
+  // The world transforms are released with the memory pool
+}
+
+TransformId TransformManager::CreateTransform()
+{
+  TransformId id;
+  if( mFreeIds.Empty() )
+  {
+    id = mIdToIndex.Count();
+    mIdToIndex.PushBack( INVALID_INDEX );
+    mWorldTransform.PushBack( NULL );
+  }
+  else
+  {
+    id = *( mFreeIds.End() - 1 );
+    mFreeIds.Erase( mFreeIds.End() - 1 );
+  }
+
+  const unsigned int index = mComponentId.Count();
+  mIdToIndex[ id ] = index;
+  mWorldTransform[ id ] = mWorldTransformPool.Allocate();
+
+  mComponentId.PushBack( id );
+  mParent.PushBack( INVALID_INDEX );
+  mParentOrigin.PushBack( Vector3::ZERO );
+  mAnchorPoint.PushBack( Vector3::ZERO );
+  mSize.PushBack( Vector3::ZERO );
+  mPosition.PushBack( Vector3::ZERO );
+  mOrientation.PushBack( Quaternion() );
+  mScale.PushBack( Vector3::ONE );
+  mInheritance.PushBack( DEFAULT_INHERITANCE );
+  mWorldPosition.PushBack( Vector3::ZERO );
+  mWorldOrientation.PushBack( Quaternion() );
+  mWorldScale.PushBack( Vector3::ONE );
+  mDirty.PushBack( 0u );
+  mBoundsMin.PushBack( EMPTY_BOUNDS_MIN );
+  mBoundsMax.PushBack( EMPTY_BOUNDS_MAX );
+  mSubtreeBoundsMin.PushBack( EMPTY_BOUNDS_MIN );
+  mSubtreeBoundsMax.PushBack( EMPTY_BOUNDS_MAX );
+  mRenderableCount.PushBack( 0u );
+  mSubtreeRenderableCount.PushBack( 0u );
+  mContentFlags.PushBack( 0u );
+  mBoundsDirty.PushBack( 0u );
+
+  return id;
+}
+
+void TransformManager::RemoveTransform( TransformId id )
+{
+  DALI_ASSERT_DEBUG( id < mIdToIndex.Count() && mIdToIndex[ id ] != INVALID_INDEX );
+
+  const unsigned int index = mIdToIndex[ id ];
+  const unsigned int last = mComponentId.Count() - 1u;
+
+  // The bounds of the parent no longer include the component
+  unsigned int parent = mParent[ index ];
+  if( parent == last )
+  {
+    parent = index;
+  }
+
+  // The last component is moved into the vacant slot; any remaining children lose their parent
+  for( unsigned int i = 0; i <= last; ++i )
+  {
+    if( mParent[i] == index )
+    {
+      mParent[i] = INVALID_INDEX;
+    }
+    else if( mParent[i] == last )
+    {
+      mParent[i] = index;
+    }
+  }
+  if( index != last )
+  {
+    mIdToIndex[ mComponentId[ last ] ] = index;
+    mReorder = true;
+  }
+
+  mComponentId.Remove( mComponentId.Begin() + index );
+  mParent.Remove( mParent.Begin() + index );
+  mParentOrigin.Remove( mParentOrigin.Begin() + index );
+  mAnchorPoint.Remove( mAnchorPoint.Begin() + index );
+  mSize.Remove( mSize.Begin() + index );
+  mPosition.Remove( mPosition.Begin() + index );
+  mOrientation.Remove( mOrientation.Begin() + index );
+  mScale.Remove( mScale.Begin() + index );
+  mInheritance.Remove( mInheritance.Begin() + index );
+  mWorldPosition.Remove( mWorldPosition.Begin() + index );
+  mWorldOrientation.Remove( mWorldOrientation.Begin() + index );
+  mWorldScale.Remove( mWorldScale.Begin() + index );
+  mDirty.Remove( mDirty.Begin() + index );
+  mBoundsMin.Remove( mBoundsMin.Begin() + index );
+  mBoundsMax.Remove( mBoundsMax.Begin() + index );
+  mSubtreeBoundsMin.Remove( mSubtreeBoundsMin.Begin() + index );
+  mSubtreeBoundsMax.Remove( mSubtreeBoundsMax.Begin() + index );
+  mRenderableCount.Remove( mRenderableCount.Begin() + index );
+  mSubtreeRenderableCount.Remove( mSubtreeRenderableCount.Begin() + index );
+  mContentFlags.Remove( mContentFlags.Begin() + index );
+  mBoundsDirty.Remove( mBoundsDirty.Begin() + index );
+
+  if( index < last && mDirty[ index ] )
+  {
+    SetDirty( index );
+  }
+  if( index < last && mBoundsDirty[ index ] )
+  {
+    SetBoundsDirty( index );
+  }
+  if( parent != INVALID_INDEX )
+  {
+    SetBoundsDirty( parent );
+  }
+
+  // The render-thread may still be reading the world transform of the previous frame
+  mRemoved.PushBack( mWorldTransform[ id ] );
+
+  mIdToIndex[ id ] = INVALID_INDEX;
+  mWorldTransform[ id ] = NULL;
+  mFreeIds.PushBack( id );
+}
+
+const WorldTransform& TransformManager::GetWorldTransform( TransformId id ) const
+{
+  DALI_ASSERT_DEBUG( id < mWorldTransform.Count() && mWorldTransform[ id ] );
+
+  return *mWorldTransform[ id ];
+}
+
+const WorldTransform& TransformManager::GetIdentityTransform()
+{
+  static const WorldTransform identity;
+  return identity;
+}
+
+void TransformManager::SetParent( TransformId id, TransformId parentId )
+{
+  const unsigned int index = mIdToIndex[ id ];
+
+  // The bounds of the previous parent no longer include the component
+  if( mParent[ index ] != INVALID_INDEX )
+  {
+    SetBoundsDirty( mParent[ index ] );
+  }
+
+  if( parentId == INVALID_TRANSFORM_ID )
+  {
+    mParent[ index ] = INVALID_INDEX;
+  }
+  else
+  {
+    const unsigned int parentIndex = mIdToIndex[ parentId ];
+    mParent[ index ] = parentIndex;
+
+    // The linear update requires the parent to be stored before the child
+    if( parentIndex > index )
+    {
+      mReorder = true;
+    }
+  }
+
+  SetDirty( index );
+}
+
+void TransformManager::SetLocalTransform( TransformId id,
+                                          const Vector3& parentOrigin,
+                                          const Vector3& anchorPoint,
+                                          const Vector3& size,
+                                          const Vector3& position,
+                                          const Quaternion& orientation,
+                                          const Vector3& scale )
+{
+  const unsigned int index = mIdToIndex[ id ];
+
+  mParentOrigin[ index ] = parentOrigin;
+  mAnchorPoint[ index ] = anchorPoint;
+  mSize[ index ] = size;
+  mPosition[ index ] = position;
+  mOrientation[ index ] = orientation;
+  mScale[ index ] = scale;
+
+  SetDirty( index );
+}
+
+void TransformManager::SetInheritance( TransformId id,
+                                       PositionInheritanceMode positionInheritanceMode,
+                                       bool inheritOrientation,
+                                       bool inheritScale,
+                                       bool inhibitLocalTransform )
+{
+  const unsigned int index = mIdToIndex[ id ];
+
+  unsigned char inheritance = static_cast< unsigned char >( positionInheritanceMode ) & POSITION_INHERITANCE_MASK;
+  if( inheritOrientation )
+  {
+    inheritance |= INHERIT_ORIENTATION;
+  }
+  if( inheritScale )
+  {
+    inheritance |= INHERIT_SCALE;
+  }
+  if( inhibitLocalTransform )
+  {
+    inheritance |= INHIBIT_LOCAL_TRANSFORM;
+  }
+
+  if( mInheritance[ index ] != inheritance )
+  {
+    mInheritance[ index ] = inheritance;
+    SetDirty( index );
+  }
+}
+
+void TransformManager::SetContent( TransformId id, unsigned int renderableCount, bool bounded )
+{
+  const unsigned int index = mIdToIndex[ id ];
+
+  const unsigned char contentFlags = bounded ? 0u : UNBOUNDED_CONTENT;
+  if( mRenderableCount[ index ] != renderableCount ||
+      ( mContentFlags[ index ] & UNBOUNDED_CONTENT ) != contentFlags )
+  {
+    mRenderableCount[ index ] = renderableCount;
+    mContentFlags[ index ] = ( mContentFlags[ index ] & ~UNBOUNDED_CONTENT ) | contentFlags;
+    SetBoundsDirty( index );
+  }
+}
+
+bool TransformManager::GetSubtreeBounds( TransformId id, Vector3& center, Vector3& halfExtents ) const
+{
+  const unsigned int index = mIdToIndex[ id ];
+
+  if( ( mContentFlags[ index ] & UNBOUNDED_SUBTREE ) || 0u == mSubtreeRenderableCount[ index ] )
+  {
+    return false;
+  }
+
+  center = ( mSubtreeBoundsMin[ index ] + mSubtreeBoundsMax[ index ] ) * 0.5f;
+  halfExtents = ( mSubtreeBoundsMax[ index ] - mSubtreeBoundsMin[ index ] ) * 0.5f;
+  return true;
+}
+
+unsigned int TransformManager::GetSubtreeRenderableCount( TransformId id ) const
+{
+  return mSubtreeRenderableCount[ mIdToIndex[ id ] ];
+}
+
+void TransformManager::Update( BufferIndex updateBufferIndex )
+{
+  // Release the world transforms which were removed two updates ago; these are no longer rendered
+  Dali::Vector< WorldTransform* >& discarded = mDiscarded[ updateBufferIndex ];
+  for( Dali::Vector< WorldTransform* >::Iterator iter = discarded.Begin(), endIter = discarded.End(); iter != endIter; ++iter )
+  {
+    mWorldTransformPool.Free( *iter );
+  }
+  discarded.Clear();
+  discarded.Swap( mRemoved );
+
+  if( mReorder )
+  {
+    ReorderComponents();
+  }
+
+  Dali::Vector< TransformId >& updated = mUpdated[ updateBufferIndex ];
+  updated.Clear();
+
+  // Parents are stored before their children; everything before the first dirty component is clean
+  const unsigned int count = mComponentId.Count();
+  for( unsigned int i = mFirstDirty; i < count; ++i )
+  {
+    const unsigned int parent = mParent[i];
+    if( parent != INVALID_INDEX && mDirty[ parent ] )
+    {
+      mDirty[i] = 1u;
+    }
+
+    if( !mDirty[i] )
+    {
+      continue;
+    }
+
+    const unsigned char inheritance = mInheritance[i];
+
+    if( parent == INVALID_INDEX )
+    {
+      // Components without a parent (i.e. root nodes) use the local transform
+      mWorldPosition[i] = mPosition[i];
+      mWorldOrientation[i] = mOrientation[i];
+      mWorldScale[i] = mScale[i];
+    }
+    else
+    {
+      // With a non-central anchor-point, the world rotation and scale affects the world position.
+      // Therefore the world rotation & scale must be updated before the world position.
+      if( inheritance & INHERIT_ORIENTATION )
+      {
+        const Quaternion& localOrientation = mOrientation[i];
+        if( localOrientation.IsIdentity() )
+        {
+          mWorldOrientation[i] = mWorldOrientation[ parent ];
+        }
+        else
+        {
+          Quaternion finalOrientation( mWorldOrientation[ parent ] );
+          finalOrientation *= localOrientation;
+          mWorldOrientation[i] = finalOrientation;
+        }
+      }
+      else
+      {
+        mWorldOrientation[i] = mOrientation[i];
+      }
+
+      if( inheritance & INHERIT_SCALE )
+      {
+        mWorldScale[i] = mWorldScale[ parent ] * mScale[i];
+      }
+      else
+      {
+        mWorldScale[i] = mScale[i];
+      }
+
+      InheritWorldPosition( static_cast< PositionInheritanceMode >( inheritance & POSITION_INHERITANCE_MASK ),
+                            mParentOrigin[i],
+                            mAnchorPoint[i],
+                            mSize[i],
+                            mPosition[i],
+                            mScale[i],
+                            mWorldScale[i],
+                            mWorldOrientation[i],
+                            mSize[ parent ],
+                            mWorldPosition[ parent ],
+                            mWorldOrientation[ parent ],
+                            mWorldScale[ parent ],
+                            mWorldPosition[i] );
+    }
+
+    // Publish the results
+    const TransformId id = mComponentId[i];
+    WorldTransform& world = *mWorldTransform[ id ];
+
+    world.position[ updateBufferIndex ] = mWorldPosition[i];
+    world.orientation[ updateBufferIndex ] = mWorldOrientation[i];
+    world.scale[ updateBufferIndex ] = mWorldScale[i];
+
+    if( inheritance & INHIBIT_LOCAL_TRANSFORM )
+    {
+      world.matrix[ updateBufferIndex ].SetTransformComponents( mWorldScale[i],
+                                                                mWorldOrientation[i] / mOrientation[i],
+                                                                mWorldPosition[i] - mPosition[i] );
+    }
+    else
+    {
+      world.matrix[ updateBufferIndex ].SetTransformComponents( mWorldScale[i], mWorldOrientation[i], mWorldPosition[i] );
+    }
+
+    world.reinherited = 1u;
+    world.inherited = 1u;
+
+    // The bounds of the size, oriented by the world matrix; this is the axis-aligned box around the oriented box
+    const float* matrix = world.matrix[ updateBufferIndex ].AsFloat();
+    const Vector3 halfSize( mSize[i] * 0.5f );
+    const Vector3 center( matrix[12], matrix[13], matrix[14] );
+    const Vector3 halfExtents( fabsf( matrix[0] ) * halfSize.x + fabsf( matrix[4] ) * halfSize.y + fabsf( matrix[8] )  * halfSize.z,
+                               fabsf( matrix[1] ) * halfSize.x + fabsf( matrix[5] ) * halfSize.y + fabsf( matrix[9] )  * halfSize.z,
+                               fabsf( matrix[2] ) * halfSize.x + fabsf( matrix[6] ) * halfSize.y + fabsf( matrix[10] ) * halfSize.z );
+    mBoundsMin[i] = center - halfExtents;
+    mBoundsMax[i] = center + halfExtents;
+    SetBoundsDirty( i );
+
+    updated.PushBack( id );
+  }
+
+  if( mBoundsChanged )
+  {
+    UpdateSubtreeBounds();
+  }
+
+  // Components recalculated in the previous update, but not in this one, copy the previous values
+  Dali::Vector< TransformId >& previouslyUpdated = mUpdated[ 1u - updateBufferIndex ];
+  for( Dali::Vector< TransformId >::Iterator iter = previouslyUpdated.Begin(), endIter = previouslyUpdated.End(); iter != endIter; ++iter )
+  {
+    const unsigned int index = mIdToIndex[ *iter ];
+    if( index != INVALID_INDEX && !mDirty[ index ] )
+    {
+      WorldTransform& world = *mWorldTransform[ *iter ];
+      const BufferIndex previousBufferIndex = 1u - updateBufferIndex;
+
+      world.position[ updateBufferIndex ] = world.position[ previousBufferIndex ];
+      world.orientation[ updateBufferIndex ] = world.orientation[ previousBufferIndex ];
+      world.scale[ updateBufferIndex ] = world.scale[ previousBufferIndex ];
+      world.matrix[ updateBufferIndex ] = world.matrix[ previousBufferIndex ];
+      world.reinherited = 0u;
+    }
+  }
+  previouslyUpdated.Clear();
+
+  // Clear the dirty flags for the next update
+  for( Dali::Vector< TransformId >::Iterator iter = updated.Begin(), endIter = updated.End(); iter != endIter; ++iter )
+  {
+    mDirty[ mIdToIndex[ *iter ] ] = 0u;
+  }
+  mFirstDirty = INVALID_INDEX;
+}
+
+void TransformManager::UpdateSubtreeBounds()
+{
+  const unsigned int count = mComponentId.Count();
+
+  // Children are stored after their parents, therefore a reverse pass reaches the parents after their children
+  for( unsigned int i = count; i-- > 0u; )
+  {
+    const unsigned int parent = mParent[i];
+    if( mBoundsDirty[i] && parent != INVALID_INDEX )
+    {
+      mBoundsDirty[ parent ] = 1u;
+    }
+  }
+
+  // Start from the own bounds of each changed component
+  for( unsigned int i = 0u; i < count; ++i )
+  {
+    if( mBoundsDirty[i] )
+    {
+      const unsigned char contentFlags = mContentFlags[i] & UNBOUNDED_CONTENT;
+      mContentFlags[i] = contentFlags | ( contentFlags ? UNBOUNDED_SUBTREE : 0u );
+      mSubtreeRenderableCount[i] = mRenderableCount[i];
+      if( mRenderableCount[i] > 0u )
+      {
+        mSubtreeBoundsMin[i] = mBoundsMin[i];
+        mSubtreeBoundsMax[i] = mBoundsMax[i];
+      }
+      else
+      {
+        mSubtreeBoundsMin[i] = EMPTY_BOUNDS_MIN;
+        mSubtreeBoundsMax[i] = EMPTY_BOUNDS_MAX;
+      }
+    }
+  }
+
+  // Merge the sub-trees into their changed parents; unchanged children keep the bounds from the previous update
+  for( unsigned int i = count; i-- > 0u; )
+  {
+    const unsigned int parent = mParent[i];
+    if( parent != INVALID_INDEX && mBoundsDirty[ parent ] )
+    {
+      if( mSubtreeRenderableCount[i] > 0u )
+      {
+        mSubtreeBoundsMin[ parent ] = Min( mSubtreeBoundsMin[ parent ], mSubtreeBoundsMin[i] );
+        mSubtreeBoundsMax[ parent ] = Max( mSubtreeBoundsMax[ parent ], mSubtreeBoundsMax[i] );
+        mSubtreeRenderableCount[ parent ] += mSubtreeRenderableCount[i];
+      }
+      mContentFlags[ parent ] |= ( mContentFlags[i] & UNBOUNDED_SUBTREE );
+    }
+  }
+
+  memset( mBoundsDirty.Begin(), 0, count * sizeof( unsigned char ) );
+  mBoundsChanged = false;
+}
+
+void TransformManager::ReorderComponents()
+{
+  const unsigned int count = mComponentId.Count();
+
+  // Gather the children of each component, in packed order
+  Dali::Vector< unsigned int > firstChild;
+  firstChild.Resize( count + 1u, 0u );
+  for( unsigned int i = 0; i < count; ++i )
+  {
+    if( mParent[i] != INVALID_INDEX )
+    {
+      ++firstChild[ mParent[i] + 1u ];
+    }
+  }
+  for( unsigned int i = 0; i < count; ++i )
+  {
+    firstChild[ i + 1u ] += firstChild[i];
+  }
+
+  Dali::Vector< unsigned int > children;
+  children.Resize( firstChild[ count ] );
+  Dali::Vector< unsigned int > nextChild( firstChild );
+  for( unsigned int i = 0; i < count; ++i )
+  {
+    if( mParent[i] != INVALID_INDEX )
+    {
+      children[ nextChild[ mParent[i] ]++ ] = i;
+    }
+  }
+
+  // Breadth-first from the components without parent, so that parents precede their children
+  Dali::Vector< unsigned int > order;
+  order.Reserve( count );
+  for( unsigned int i = 0; i < count; ++i )
+  {
+    if( mParent[i] == INVALID_INDEX )
+    {
+      order.PushBack( i );
+    }
+  }
+  for( unsigned int head = 0; head < order.Count(); ++head )
+  {
+    const unsigned int index = order[ head ];
+    for( unsigned int child = firstChild[ index ]; child < firstChild[ index + 1u ]; ++child )
+    {
+      order.PushBack( children[ child ] );
+    }
+  }
+  DALI_ASSERT_DEBUG( order.Count() == count && "Cyclic transform hierarchy" );
+
+  // Remap the parent indices before the arrays are reordered
+  Dali::Vector< unsigned int > newIndex;
+  newIndex.Resize( count );
+  for( unsigned int i = 0; i < count; ++i )
+  {
+    newIndex[ order[i] ] = i;
+  }
+  for( unsigned int i = 0; i < count; ++i )
+  {
+    if( mParent[i] != INVALID_INDEX )
+    {
+      mParent[i] = newIndex[ mParent[i] ];
+    }
+  }
+
+  Reorder( mComponentId, order );
+  Reorder( mParent, order );
+  Reorder( mParentOrigin, order );
+  Reorder( mAnchorPoint, order );
+  Reorder( mSize, order );
+  Reorder( mPosition, order );
+  Reorder( mOrientation, order );
+  Reorder( mScale, order );
+  Reorder( mInheritance, order );
+  Reorder( mWorldPosition, order );
+  Reorder( mWorldOrientation, order );
+  Reorder( mWorldScale, order );
+  Reorder( mDirty, order );
+  Reorder( mBoundsMin, order );
+  Reorder( mBoundsMax, order );
+  Reorder( mSubtreeBoundsMin, order );
+  Reorder( mSubtreeBoundsMax, order );
+  Reorder( mRenderableCount, order );
+  Reorder( mSubtreeRenderableCount, order );
+  Reorder( mContentFlags, order );
+  Reorder( mBoundsDirty, order );
+
+  for( unsigned int i = 0; i < count; ++i )
+  {
+    mIdToIndex[ mComponentId[i] ] = i;
+  }
+
+  // The dirty components may have moved anywhere
+  mFirstDirty = 0u;
+  mReorder = false;
+}
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,305 @@
+#ifndef __DALI_INTERNAL_SCENE_GRAPH_TRANSFORM_MANAGER_H__
+#define __DALI_INTERNAL_SCENE_GRAPH_TRANSFORM_MANAGER_H__
+
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali/public-api/actors/actor-enumerations.h>
+#include <dali/public-api/common/dali-vector.h>
+#include <dali/public-api/math/matrix.h>
+#include <dali/public-api/math/quaternion.h>
+#include <dali/public-api/math/vector3.h>
+#include <dali/internal/common/buffer-index.h>
+#include <dali/internal/common/memory-pool-object-allocator.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+
+/**
+ * Identifies a transform component within the TransformManager.
+ * Ids are stable for the lifetime of the component, whereas the packed index of the component may change.
+ */
+typedef unsigned int TransformId;
+
+static const TransformId INVALID_TRANSFORM_ID = static_cast< TransformId >( -1 );
+
+/**
+ * The world (inherited) transform of a component, as published by the TransformManager.
+ *
+ * The values are double-buffered; the update-thread writes to the update buffer, whilst the event & render
+ * threads read from the other buffer. Instances are allocated from a memory pool and never move, therefore
+ * they can be safely referenced from nodes.
+ */
+struct WorldTransform
+{
+  /**
+   * Constructor; initializes to the identity transform.
+   */
+  WorldTransform()
+  : reinherited( 0u ),
+    inherited( 0u )
+  {
+    for( unsigned int i = 0; i < 2; ++i )
+    {
+      position[i] = Vector3::ZERO;
+      orientation[i] = Quaternion();
+      scale[i] = Vector3::ONE;
+      matrix[i] = Matrix::IDENTITY;
+    }
+  }
+
+  // The flags are stored first; the memory pool reuses the start of a freed block for its own book-keeping
+  unsigned int reinherited; ///< Non-zero if the values were recalculated in the current or previous update
+  unsigned int inherited;   ///< Non-zero once the values have been calculated at least once
+
+  Vector3    position[2];    ///< The double-buffered world position
+  Quaternion orientation[2]; ///< The double-buffered world orientation
+  Vector3    scale[2];       ///< The double-buffered world scale
+  Matrix     matrix[2];      ///< The double-buffered world matrix
+};
+
+/**
+ * The TransformManager is a data-oriented store for the transforms of scene-graph nodes.
+ *
+ * The local transform inputs and the inherited world transforms are held in contiguous arrays
+ * (structure of arrays), ordered so that every parent is stored before its children. The world transforms
+ * are therefore calculated with a single linear pass, starting from the first dirty component; a component
+ * is recalculated when either its local transform, or the world transform of its parent, has changed.
+ *
+ * The results are published into a double-buffered WorldTransform per component, which is read by the
+ * event & render threads.
+ *
+ * The TransformManager also keeps the world-space bounds of each component, and of its sub-tree, for culling.
+ * These are only read by the update-thread, and are recalculated for the changed components & their ancestors.
+ */
+class TransformManager
+{
+public:
+
+  /**
+   * Constructor.
+   */
+  TransformManager();
+
+  /**
+   * Destructor.
+   */
+  ~TransformManager();
+
+  /**
+   * Create a new transform component. The component has no parent, and an identity transform.
+   * @return The id of the new component.
+   */
+  TransformId CreateTransform();
+
+  /**
+   * Remove a transform component.
+   * The WorldTransform of the component remains valid until the current frame has been rendered.
+   * @param[in] id The id of the component to remove.
+   */
+  void RemoveTransform( TransformId id );
+
+  /**
+   * Retrieve the world transform published for a component.
+   * @param[in] id The id of the component.
+   * @return The world transform; this remains at the same address until the component is removed.
+   */
+  const WorldTransform& GetWorldTransform( TransformId id ) const;
+
+  /**
+   * Set the parent of a component.
+   * Components without a parent use their local transform as world transform.
+   * @param[in] id The id of the component.
+   * @param[in] parentId The id of the parent component, or INVALID_TRANSFORM_ID to remove the parent.
+   */
+  void SetParent( TransformId id, TransformId parentId );
+
+  /**
+   * Set the local transform of a component; the component will be recalculated in the next Update().
+   * @param[in] id The id of the component.
+   * @param[in] parentOrigin The parent-origin of the component.
+   * @param[in] anchorPoint The anchor-point of the component.
+   * @param[in] size The size of the component.
+   * @param[in] position The local position.
+   * @param[in] orientation The local orientation.
+   * @param[in] scale The local scale.
+   */
+  void SetLocalTransform( TransformId id,
+                          const Vector3& parentOrigin,
+                          const Vector3& anchorPoint,
+                          const Vector3& size,
+                          const Vector3& position,
+                          const Quaternion& orientation,
+                          const Vector3& scale );
+
+  /**
+   * Set how a component inherits the transform of its parent; the component will be recalculated in the next Update().
+   * @param[in] id The id of the component.
+   * @param[in] positionInheritanceMode How the position is inherited.
+   * @param[in] inheritOrientation Whether the orientation of the parent is inherited.
+   * @param[in] inheritScale Whether the scale of the parent is inherited.
+   * @param[in] inhibitLocalTransform Whether the local transform is excluded from the world matrix.
+   */
+  void SetInheritance( TransformId id,
+                       PositionInheritanceMode positionInheritanceMode,
+                       bool inheritOrientation,
+                       bool inheritScale,
+                       bool inhibitLocalTransform );
+
+  /**
+   * Set the content of a component, which is included in the bounds of its sub-tree.
+   * @param[in] id The id of the component.
+   * @param[in] renderableCount The number of renderers & renderable attachments of the component.
+   * @param[in] bounded True if the content is drawn within the size of the component; otherwise the sub-tree cannot be culled.
+   */
+  void SetContent( TransformId id, unsigned int renderableCount, bool bounded );
+
+  /**
+   * Retrieve the world-space bounds of a component and its descendants, as calculated by the last Update().
+   * The bounds contain the size of each component, oriented by its world matrix.
+   * @param[in] id The id of the component.
+   * @param[out] center The center of the axis-aligned bounding box.
+   * @param[out] halfExtents The half extents of the axis-aligned bounding box.
+   * @return False if the sub-tree has content which may be drawn outside the bounds.
+   */
+  bool GetSubtreeBounds( TransformId id, Vector3& center, Vector3& halfExtents ) const;
+
+  /**
+   * Retrieve the number of renderables in the sub-tree of a component, including those of invisible components.
+   * @param[in] id The id of the component.
+   * @return The renderable count.
+   */
+  unsigned int GetSubtreeRenderableCount( TransformId id ) const;
+
+  /**
+   * Recalculate the world transforms of the dirty components, and publish them into the update buffer.
+   * Components which were recalculated in the previous update, and are clean now, copy the previous values.
+   * @param[in] updateBufferIndex The current update buffer index.
+   */
+  void Update( BufferIndex updateBufferIndex );
+
+  /**
+   * Retrieve the identity world transform; this is used by nodes before a transform component is created.
+   * @return The identity world transform.
+   */
+  static const WorldTransform& GetIdentityTransform();
+
+  /**
+   * Query the number of transform components.
+   * @return The number of components.
+   */
+  unsigned int GetComponentCount() const
+  {
+    return mComponentId.Count();
+  }
+
+private:
+
+  /**
+   * Sort the packed arrays so that every parent precedes its children.
+   */
+  void ReorderComponents();
+
+  /**
+   * Recalculate the sub-tree bounds of the components whose bounds have changed, and of their ancestors.
+   */
+  void UpdateSubtreeBounds();
+
+  /**
+   * Mark the bounds of a packed component as changed.
+   * @param[in] index The packed index.
+   */
+  void SetBoundsDirty( unsigned int index )
+  {
+    mBoundsDirty[ index ] = 1u;
+    mBoundsChanged = true;
+  }
+
+  /**
+   * Mark a packed component as dirty.
+   * @param[in] index The packed index.
+   */
+  void SetDirty( unsigned int index )
+  {
+    mDirty[ index ] = 1u;
+    if( index < mFirstDirty )
+    {
+      mFirstDirty = index;
+    }
+  }
+
+  // Undefined
+  TransformManager( const TransformManager& );
+
+  // Undefined
+  TransformManager& operator=( const TransformManager& );
+
+private:
+
+  // Indexed by component id
+  Dali::Vector< unsigned int >    mIdToIndex;           ///< The packed index of each component id, or invalid for unused ids
+  Dali::Vector< WorldTransform* > mWorldTransform;      ///< The published world transform of each component id
+  Dali::Vector< TransformId >     mFreeIds;             ///< Ids available for reuse
+
+  // Packed arrays, parent before child
+  Dali::Vector< TransformId >  mComponentId;            ///< The id of the component at each packed index
+  Dali::Vector< unsigned int > mParent;                 ///< The packed index of the parent, or invalid for no parent
+  Dali::Vector< Vector3 >      mParentOrigin;           ///< Local parent-origin
+  Dali::Vector< Vector3 >      mAnchorPoint;            ///< Local anchor-point
+  Dali::Vector< Vector3 >      mSize;                   ///< Size
+  Dali::Vector< Vector3 >      mPosition;               ///< Local position
+  Dali::Vector< Quaternion >   mOrientation;            ///< Local orientation
+  Dali::Vector< Vector3 >      mScale;                  ///< Local scale
+  Dali::Vector< unsigned char > mInheritance;           ///< Inheritance mode & flags
+  Dali::Vector< Vector3 >      mWorldPosition;          ///< Current world position
+  Dali::Vector< Quaternion >   mWorldOrientation;       ///< Current world orientation
+  Dali::Vector< Vector3 >      mWorldScale;             ///< Current world scale
+  Dali::Vector< unsigned char > mDirty;                 ///< Non-zero if the component must be recalculated
+  Dali::Vector< Vector3 >      mBoundsMin;              ///< Minimum of the world-space bounds of the component
+  Dali::Vector< Vector3 >      mBoundsMax;              ///< Maximum of the world-space bounds of the component
+  Dali::Vector< Vector3 >      mSubtreeBoundsMin;       ///< Minimum of the world-space bounds of the sub-tree
+  Dali::Vector< Vector3 >      mSubtreeBoundsMax;       ///< Maximum of the world-space bounds of the sub-tree
+  Dali::Vector< unsigned int > mRenderableCount;        ///< The number of renderables of the component
+  Dali::Vector< unsigned int > mSubtreeRenderableCount; ///< The number of renderables of the sub-tree
+  Dali::Vector< unsigned char > mContentFlags;          ///< Whether the content of the component & the sub-tree is unbounded
+  Dali::Vector< unsigned char > mBoundsDirty;           ///< Non-zero if the sub-tree bounds must be recalculated
+
+  Dali::Vector< TransformId >  mUpdated[2];             ///< The components recalculated, for each update buffer
+  Dali::Vector< WorldTransform* > mRemoved;             ///< World transforms removed since the last update
+  Dali::Vector< WorldTransform* > mDiscarded[2];        ///< Removed world transforms, released once no longer rendered
+
+  MemoryPoolObjectAllocator< WorldTransform > mWorldTransformPool; ///< Pool for the published world transforms
+
+  unsigned int mFirstDirty;                             ///< The packed index of the first dirty component
+  bool mReorder;                                        ///< Whether the packed arrays need reordering
+  bool mBoundsChanged;                                  ///< Whether any component has mBoundsDirty set
+};
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // __DALI_INTERNAL_SCENE_GRAPH_TRANSFORM_MANAGER_H__
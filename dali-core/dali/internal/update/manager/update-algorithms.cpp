@@ -20,6 +20,7 @@
 
 // EXTERNAL INCLUDES
 #include <algorithm>
+#include <utility>
 
 // INTERNAL INCLUDES
 #include <dali/public-api/actors/draw-mode.h>
@@ -29,7 +30,7 @@
 #include <dali/internal/update/nodes/node.h>
 #include <dali/internal/update/node-attachments/node-attachment.h>
 #include <dali/internal/update/node-attachments/scene-graph-renderable-attachment.h>
-#include <dali/internal/update/animation/scene-graph-constraint-base.h>
+#include <dali/internal/update/animation/scene-graph-constraint-graph.h>
 #include <dali/internal/update/nodes/scene-graph-layer.h>
 #include <dali/internal/render/renderers/render-renderer.h>
 
@@ -52,34 +53,14 @@ Debug::Filter* gUpdateFilter = Debug::Filter::New(Debug::Concise, false, "LOG_UP
  *********************** Apply Constraints ************************************
  ******************************************************************************/
 
-
-/**
- * Constrain the local properties of the PropertyOwner.
- * @param propertyOwner to constrain
- * @param updateBufferIndex buffer index to use
- * @return The number of constraints that are still being applied
- */
-void ConstrainPropertyOwner( PropertyOwner& propertyOwner, BufferIndex updateBufferIndex )
-{
-  ConstraintOwnerContainer& constraints = propertyOwner.GetConstraints();
-
-  const ConstraintIter endIter = constraints.End();
-  for( ConstraintIter iter = constraints.Begin(); iter != endIter; ++iter )
-  {
-    ConstraintBase& constraint = **iter;
-    constraint.Apply( updateBufferIndex );
-  }
-}
-
 /**
- * Recursively apply the constraints on the nodes
- * @param node to constraint
- * @param updateBufferIndex buffer index to use
- * @return number of active constraints
+ * Recursively add the constraints of the nodes to the graph
+ * @param node to constrain
+ * @param constraintGraph which applies the constraints
  */
-void ConstrainNodes( Node& node, BufferIndex updateBufferIndex )
+void GatherNodeConstraints( Node& node, ConstraintGraph& constraintGraph )
 {
-  ConstrainPropertyOwner( node, updateBufferIndex );
+  constraintGraph.Add( node );
 
   if( node.HasAttachment() )
   {
@@ -88,19 +69,19 @@ void ConstrainNodes( Node& node, BufferIndex updateBufferIndex )
     PropertyOwner* propertyOwner = dynamic_cast< PropertyOwner* >( &attachment );
     if( propertyOwner != NULL )
     {
-      ConstrainPropertyOwner( *propertyOwner, updateBufferIndex );
+      constraintGraph.Add( *propertyOwner );
     }
   }
 
   /**
-   *  Constrain the children next
+   *  Add the constraints of the children next
    */
   NodeContainer& children = node.GetChildren();
   const NodeIter endIter = children.End();
   for ( NodeIter iter = children.Begin(); iter != endIter; ++iter )
   {
     Node& child = **iter;
-    ConstrainNodes( child, updateBufferIndex );
+    GatherNodeConstraints( child, constraintGraph );
   }
 }
 
@@ -135,160 +116,199 @@ inline void UpdateNodeOpacity( Node& node, int nodeDirtyFlags, BufferIndex updat
   }
 }
 
-inline void UpdateRootNodeTransformValues( Layer& rootNode, int nodeDirtyFlags, BufferIndex updateBufferIndex )
+
+/**
+ * The results of updating a part of the node tree.
+ * These are gathered without modifying shared objects, so that sub-trees can be updated in parallel;
+ * the results are applied afterwards, on the update-thread, in tree order.
+ */
+struct NodeUpdateResults
 {
-  // If the transform values need to be reinherited
-  if ( nodeDirtyFlags & TransformFlag )
-  {
-    rootNode.SetWorldPosition( updateBufferIndex, rootNode.GetPosition( updateBufferIndex ) );
-    rootNode.SetWorldOrientation( updateBufferIndex, rootNode.GetOrientation( updateBufferIndex ) );
-    rootNode.SetWorldScale   ( updateBufferIndex, rootNode.GetScale   ( updateBufferIndex ) );
-  }
-  else
+  typedef std::pair< Layer*, RenderableAttachment* > LayerRenderable;
+
+  /**
+   * Clear the results, keeping the allocated memory.
+   */
+  void Clear()
   {
-    // Copy previous value, in case they changed in the previous frame
-    rootNode.CopyPreviousWorldOrientation( updateBufferIndex );
-    rootNode.CopyPreviousWorldScale( updateBufferIndex );
-    rootNode.CopyPreviousWorldPosition( updateBufferIndex );
+    renderables.clear();
+    changedLayers.clear();
+    transformChangedNodes.clear();
+    contentChangedNodes.clear();
+    attachmentUpdates.clear();
+    dirtyFlags = NothingFlag;
   }
-}
+
+  std::vector< LayerRenderable > renderables;  ///< Renderables which are ready to render, with their layer
+  std::vector< Layer* > changedLayers;         ///< Layers which cannot reuse the renderers of the previous frame
+  std::vector< Node* > transformChangedNodes;  ///< Nodes whose local transform has changed
+  std::vector< Node* > contentChangedNodes;    ///< Nodes whose content, included in the bounds of the sub-tree, has changed
+  AttachmentUpdateContainer attachmentUpdates; ///< Attachments awaiting NodeAttachment::Update()
+  int dirtyFlags;                              ///< The cumulative (ORed) dirty flags of the updated nodes
+};
 
 /**
- * Updates transform values for the given node if the transform flag is dirty.
-  * Note that this will cause the size dirty flag to be set. This is why we pass
- * the dirty flags in by reference.
- * @param[in]     node The node to update
- * @param[in,out] nodeDirtyFlags A reference to the dirty flags, these may be modified by this function
- * @param[in]     updateBufferIndex The current index to use for this frame
+ * Updates a part of the node tree; either a complete sub-tree which may be executed on any thread,
+ * or a part of the tree which is updated directly by the update-thread.
  */
-inline void UpdateNodeTransformValues( Node& node, int& nodeDirtyFlags, BufferIndex updateBufferIndex )
+class NodeUpdateTask : public UpdateThreadPool::Task
 {
-  // If the transform values need to be reinherited
-  if( nodeDirtyFlags & TransformFlag )
+public:
+
+  /**
+   * Constructor.
+   */
+  NodeUpdateTask()
+  : mNode( NULL ),
+    mParentFlags( NothingFlag ),
+    mLayer( NULL ),
+    mInheritedDrawMode( DrawMode::NORMAL ),
+    mUpdateBufferIndex( 0 ),
+    mResourceManager( NULL )
   {
-    // With a non-central anchor-point, the world rotation and scale affects the world position.
-    // Therefore the world rotation & scale must be updated before the world position.
-    if( node.IsOrientationInherited() )
-    {
-      node.InheritWorldOrientation( updateBufferIndex );
-    }
-    else
-    {
-      node.SetWorldOrientation( updateBufferIndex, node.GetOrientation( updateBufferIndex ) );
-    }
+    mResults.Clear();
+  }
 
-    if( node.IsScaleInherited() )
-    {
-      node.InheritWorldScale( updateBufferIndex );
-    }
-    else
-    {
-      node.SetWorldScale( updateBufferIndex, node.GetScale( updateBufferIndex ) );
-    }
+  /**
+   * Virtual destructor.
+   */
+  virtual ~NodeUpdateTask()
+  {
+  }
 
-    node.InheritWorldPosition( updateBufferIndex );
+  /**
+   * Prepare the task for the current traversal; this clears the previous results.
+   * @param[in] node The root of the sub-tree to update, or NULL if the update-thread adds the results directly.
+   * @param[in] parentFlags The dirty flags of the parent node.
+   * @param[in] layer The layer of the parent node.
+   * @param[in] inheritedDrawMode The draw mode inherited from the parent node.
+   * @param[in] updateBufferIndex The current update buffer index.
+   * @param[in] resourceManager The resource manager.
+   */
+  void Reset( Node* node, int parentFlags, Layer* layer, int inheritedDrawMode, BufferIndex updateBufferIndex, ResourceManager& resourceManager )
+  {
+    mNode = node;
+    mParentFlags = parentFlags;
+    mLayer = layer;
+    mInheritedDrawMode = inheritedDrawMode;
+    mUpdateBufferIndex = updateBufferIndex;
+    mResourceManager = &resourceManager;
+    mResults.Clear();
   }
-  else
+
+  /**
+   * @copydoc UpdateThreadPool::Task::Execute()
+   */
+  virtual void Execute();
+
+  /**
+   * Retrieve the results of the task.
+   * @return The results.
+   */
+  NodeUpdateResults& GetResults()
   {
-    // Copy inherited values, if those changed in the previous frame
-    node.CopyPreviousWorldOrientation( updateBufferIndex );
-    node.CopyPreviousWorldScale( updateBufferIndex );
-    node.CopyPreviousWorldPosition( updateBufferIndex );
-    node.CopyPreviousSize( updateBufferIndex );
+    return mResults;
   }
+
+private:
+
+  Node* mNode;                    ///< The root of the sub-tree
+  int mParentFlags;               ///< The dirty flags of the parent of mNode
+  Layer* mLayer;                  ///< The layer of the parent of mNode
+  int mInheritedDrawMode;         ///< The draw mode inherited by mNode
+  BufferIndex mUpdateBufferIndex; ///< The current update buffer index
+  ResourceManager* mResourceManager;
+
+  NodeUpdateResults mResults;     ///< The results of the update
+};
+
+UpdateNodesWorkspace::UpdateNodesWorkspace()
+: tasks(),
+  taskCount( 0u ),
+  parallelTasks(),
+  attachmentUpdates()
+{
 }
 
-inline void UpdateNodeWorldMatrix( Node &node, int nodeDirtyFlags, BufferIndex updateBufferIndex )
+UpdateNodesWorkspace::~UpdateNodesWorkspace()
 {
-  // If world-matrix needs to be recalculated
-  if ( nodeDirtyFlags & TransformFlag )
-  {
-    if( node.GetInhibitLocalTransform() )
-    {
-      node.SetWorldMatrix( updateBufferIndex,
-                           node.GetWorldScale(updateBufferIndex),
-                           node.GetWorldOrientation(updateBufferIndex) / node.GetOrientation(updateBufferIndex),
-                           node.GetWorldPosition(updateBufferIndex) - node.GetPosition(updateBufferIndex) );
-    }
-    else
-    {
-      node.SetWorldMatrix( updateBufferIndex,
-                           node.GetWorldScale(updateBufferIndex),
-                           node.GetWorldOrientation(updateBufferIndex),
-                           node.GetWorldPosition(updateBufferIndex) );
-    }
-  }
-  else
+}
+
+namespace
+{
+
+/**
+ * Layers, and the children of nodes with at least this many children, are updated as separate tasks.
+ */
+const unsigned int MINIMUM_CHILDREN_FOR_TASK = 8u;
+
+/**
+ * Tasks are only created near the root of the tree, where the sub-trees are largest.
+ */
+const unsigned int MAXIMUM_TASK_DEPTH = 4u;
+
+/**
+ * Start the next part of the node tree; the results of the tasks are applied in the order they were started.
+ * @param[in] workspace The workspace of the traversal.
+ * @return The next task.
+ */
+NodeUpdateTask& NextTask( UpdateNodesWorkspace& workspace )
+{
+  if( workspace.taskCount == workspace.tasks.Count() )
   {
-    node.CopyPreviousWorldMatrix( updateBufferIndex );
+    workspace.tasks.PushBack( new NodeUpdateTask );
   }
+
+  return *workspace.tasks[ workspace.taskCount++ ];
 }
 
-inline void UpdateNodeWorldMatrix( Node& node, RenderableAttachment& updatedRenderable, int nodeDirtyFlags, BufferIndex updateBufferIndex )
+/**
+ * Retrieve the results of the part of the tree which the update-thread is currently updating.
+ * @param[in] workspace The workspace of the traversal.
+ * @return The results.
+ */
+NodeUpdateResults& CurrentResults( UpdateNodesWorkspace& workspace )
 {
-  /**
-   * If world-matrix needs to be recalculated.
-   */
-  if ( ( nodeDirtyFlags & TransformFlag ) ||
-         updatedRenderable.IsScaleForSizeDirty() )
+  return workspace.tasks[ workspace.taskCount - 1u ]->GetResults();
+}
+
+} // unnamed namespace
+
+/**
+ * Updates the local transform of the given node, if the transform flag is dirty.
+ * The world transform is calculated by TransformManager::Update(), once the whole tree has been traversed.
+ * @param[in] node The node to update
+ * @param[in] ownDirtyFlags The dirty flags of the node, excluding those inherited from the parent
+ * @param[in] nodeDirtyFlags The dirty flags of the node, including those inherited from the parent
+ * @param[in] updateBufferIndex The current index to use for this frame
+ * @param[out] results The node is added here, if its local transform must be passed to the TransformManager
+ */
+inline void UpdateNodeTransformValues( Node& node, int ownDirtyFlags, int nodeDirtyFlags, BufferIndex updateBufferIndex, NodeUpdateResults& results )
+{
+  // If the local transform has changed
+  if( ownDirtyFlags & TransformFlag )
   {
-    if( updatedRenderable.UsesGeometryScaling() )
-    {
-      // TODO: MESH_REWORK : remove scale for size
-      Vector3 scaling;
-      updatedRenderable.GetScaleForSize( node.GetSize( updateBufferIndex ), scaling );
-      if( node.GetInhibitLocalTransform() )
-      {
-        node.SetWorldMatrix( updateBufferIndex,
-                             node.GetWorldScale(updateBufferIndex) * scaling,
-                             node.GetWorldOrientation(updateBufferIndex) / node.GetOrientation(updateBufferIndex),
-                             node.GetWorldPosition(updateBufferIndex) - node.GetPosition(updateBufferIndex) );
-      }
-      else
-      {
-        node.SetWorldMatrix( updateBufferIndex,
-                             node.GetWorldScale(updateBufferIndex) * scaling,
-                             node.GetWorldOrientation(updateBufferIndex),
-                             node.GetWorldPosition(updateBufferIndex) );
-      }
-    }
-    else
-    {
-      // no scaling, i.e. Image
-      if( node.GetInhibitLocalTransform() )
-      {
-        node.SetWorldMatrix( updateBufferIndex,
-                             node.GetWorldScale(updateBufferIndex),
-                             node.GetWorldOrientation(updateBufferIndex) / node.GetOrientation(updateBufferIndex),
-                             node.GetWorldPosition(updateBufferIndex) - node.GetPosition(updateBufferIndex) );
-      }
-      else
-      {
-        node.SetWorldMatrix( updateBufferIndex,
-                             node.GetWorldScale(updateBufferIndex),
-                             node.GetWorldOrientation(updateBufferIndex),
-                             node.GetWorldPosition(updateBufferIndex) );
-      }
-    }
+    results.transformChangedNodes.push_back( &node );
   }
-  else
+  else if( !( nodeDirtyFlags & TransformFlag ) )
   {
-    node.CopyPreviousWorldMatrix( updateBufferIndex );
+    node.CopyPreviousSize( updateBufferIndex );
   }
 }
 
 /**
  * Update an attachment.
+ * The specialised processing of NodeAttachment::Update() is deferred until the world transforms are known.
  * @return An updated renderable attachment if one was ready.
  */
 inline RenderableAttachment* UpdateAttachment( NodeAttachment& attachment,
                                                Node& node,
                                                BufferIndex updateBufferIndex,
                                                ResourceManager& resourceManager,
-                                               int nodeDirtyFlags )
+                                               int nodeDirtyFlags,
+                                               AttachmentUpdateContainer& attachmentUpdates )
 {
-  // Allow attachments to do specialised processing during updates
-  attachment.Update( updateBufferIndex, node, nodeDirtyFlags );
+  attachmentUpdates.push_back( AttachmentUpdate( node, nodeDirtyFlags ) );
 
   RenderableAttachment* renderable = attachment.GetRenderable(); // not all scene objects render
   if( renderable )
@@ -309,47 +329,48 @@ inline RenderableAttachment* UpdateAttachment( NodeAttachment& attachment,
   return renderable;
 }
 
-inline void AddRenderableToLayer( Layer& layer,
-                                  RenderableAttachment& renderable,
-                                  BufferIndex updateBufferIndex,
-                                  int inheritedDrawMode )
-{
-  // The renderables are stored into the opaque list temporarily for PrepareRenderables()
-  // step. The list is cleared by ProcessRenderTasks().
-  layer.colorRenderables.push_back( &renderable );
-}
-
 /**
- * This is called recursively for all children of the root Node
+ * Update a single node, and its attachment.
+ * Only the node itself is modified; the changes to shared objects are added to the results.
+ * @param[in] node The node to update.
+ * @param[in] parentFlags The dirty flags of the parent node.
+ * @param[in] updateBufferIndex The current update buffer index.
+ * @param[in] resourceManager The resource manager.
+ * @param[in,out] layer The layer of the parent; this is changed to the node, if the node is a layer.
+ * @param[in,out] inheritedDrawMode The draw mode inherited from the parent; this is changed to the draw mode for the children.
+ * @param[out] nodeDirtyFlags The dirty flags of the node, including those inherited from the parent.
+ * @param[out] results The results of the update.
+ * @return False if the node is invisible, in which case the children should not be updated.
  */
-inline int UpdateNodesAndAttachments( Node& node,
-                                      int parentFlags,
-                                      BufferIndex updateBufferIndex,
-                                      ResourceManager& resourceManager,
-                                      RenderQueue& renderQueue,
-                                      Layer& currentLayer,
-                                      int inheritedDrawMode )
+inline bool UpdateNode( Node& node,
+                        int parentFlags,
+                        BufferIndex updateBufferIndex,
+                        ResourceManager& resourceManager,
+                        Layer*& layer,
+                        int& inheritedDrawMode,
+                        int& nodeDirtyFlags,
+                        NodeUpdateResults& results )
 {
-  Layer* layer = &currentLayer;
-
   // Short-circuit for invisible nodes
   if ( !node.IsVisible( updateBufferIndex ) )
   {
-    return 0;
+    return false;
   }
 
   // If the node was not previously visible
   BufferIndex previousBuffer = updateBufferIndex ? 0u : 1u;
   if ( !node.IsVisible( previousBuffer ) )
   {
-    // The node was skipped in the previous update; it must recalculate everything
+    // The node was skipped in the previous update; it must recalculate everything.
+    // The visibility was written recently, so the node is already in the reset list; this is safe from a task.
     node.SetAllDirtyFlags();
   }
 
   // Some dirty flags are inherited from parent
-  int nodeDirtyFlags( node.GetDirtyFlags() | ( parentFlags & InheritedDirtyFlags ) );
+  const int ownDirtyFlags( node.GetDirtyFlags() );
+  nodeDirtyFlags = ownDirtyFlags | ( parentFlags & InheritedDirtyFlags );
 
-  int cumulativeDirtyFlags = nodeDirtyFlags;
+  results.dirtyFlags |= nodeDirtyFlags;
 
   if ( node.IsLayer() )
   {
@@ -366,9 +387,7 @@ inline int UpdateNodesAndAttachments( Node& node,
 
   UpdateNodeOpacity( node, nodeDirtyFlags, updateBufferIndex );
 
-  // Note: nodeDirtyFlags are passed in by reference and may be modified by the following function.
-  // It is important that the modified version of these flags are used by the RenderableAttachment.
-  UpdateNodeTransformValues( node, nodeDirtyFlags, updateBufferIndex );
+  UpdateNodeTransformValues( node, ownDirtyFlags, nodeDirtyFlags, updateBufferIndex, results );
 
   // Setting STENCIL will override OVERLAY_2D, if that would otherwise have been inherited.
   inheritedDrawMode |= node.GetDrawMode();
@@ -382,23 +401,19 @@ inline int UpdateNodesAndAttachments( Node& node,
                                                          node,
                                                          updateBufferIndex,
                                                          resourceManager,
-                                                         nodeDirtyFlags );
-
+                                                         nodeDirtyFlags,
+                                                         results.attachmentUpdates );
 
     if( NULL != renderable )
     {
-      // Update the world matrix after renderable update; the ScaleForSize property should now be calculated
-      UpdateNodeWorldMatrix( node, *renderable, nodeDirtyFlags, updateBufferIndex );
-
       // The attachment is ready to render, so it is added to a set of renderables.
-      AddRenderableToLayer( *layer, *renderable, updateBufferIndex, inheritedDrawMode );
+      results.renderables.push_back( NodeUpdateResults::LayerRenderable( layer, renderable ) );
     }
   }
-  else if( node.IsObserved() || node.GetRendererCount() )
+
+  if( node.CheckContent() )
   {
-    // This node is being used as a property input for an animation, constraint,
-    // camera or bone. Ensure it's matrix is updated
-    UpdateNodeWorldMatrix( node, nodeDirtyFlags, updateBufferIndex );
+    results.contentChangedNodes.push_back( &node );
   }
 
   if( node.ResolveVisibility(updateBufferIndex) )
@@ -406,30 +421,143 @@ inline int UpdateNodesAndAttachments( Node& node,
     node.PrepareRender( updateBufferIndex );
   }
 
-
   // if any child node has moved or had its sort modifier changed, layer is not clean and old frame cannot be reused
   // also if node has been deleted, dont reuse old render items
-  if( nodeDirtyFlags & RenderableUpdateFlags )
+  if( ( nodeDirtyFlags & RenderableUpdateFlags ) &&
+      ( results.changedLayers.empty() || results.changedLayers.back() != layer ) )
   {
-    layer->SetReuseRenderers( updateBufferIndex, false );
+    results.changedLayers.push_back( layer );
   }
 
-  // recurse children
+  return true;
+}
+
+/**
+ * This is called recursively for all children of the root Node
+ */
+void UpdateNodesAndAttachments( Node& node,
+                                int parentFlags,
+                                BufferIndex updateBufferIndex,
+                                ResourceManager& resourceManager,
+                                Layer& currentLayer,
+                                int inheritedDrawMode,
+                                NodeUpdateResults& results )
+{
+  Layer* layer = &currentLayer;
+  int nodeDirtyFlags( NothingFlag );
+
+  if( UpdateNode( node, parentFlags, updateBufferIndex, resourceManager, layer, inheritedDrawMode, nodeDirtyFlags, results ) )
+  {
+    // recurse children
+    NodeContainer& children = node.GetChildren();
+    const NodeIter endIter = children.End();
+    for ( NodeIter iter = children.Begin(); iter != endIter; ++iter )
+    {
+      Node& child = **iter;
+      UpdateNodesAndAttachments( child,
+                                 nodeDirtyFlags,
+                                 updateBufferIndex,
+                                 resourceManager,
+                                 *layer,
+                                 inheritedDrawMode,
+                                 results );
+    }
+  }
+}
+
+void NodeUpdateTask::Execute()
+{
+  UpdateNodesAndAttachments( *mNode, mParentFlags, mUpdateBufferIndex, *mResourceManager, *mLayer, mInheritedDrawMode, mResults );
+}
+
+/**
+ * Update the children of a node; layers and large sub-trees are split into separate tasks.
+ * @param[in] node The parent node, which has been updated.
+ * @param[in] nodeDirtyFlags The dirty flags of the parent node.
+ * @param[in] updateBufferIndex The current update buffer index.
+ * @param[in] resourceManager The resource manager.
+ * @param[in] layer The layer of the parent node.
+ * @param[in] inheritedDrawMode The draw mode inherited by the children.
+ * @param[in] depth The depth of the children, relative to the root node.
+ * @param[in] workspace The workspace of the traversal.
+ */
+void UpdateChildrenInTasks( Node& node,
+                            int nodeDirtyFlags,
+                            BufferIndex updateBufferIndex,
+                            ResourceManager& resourceManager,
+                            Layer& layer,
+                            int inheritedDrawMode,
+                            unsigned int depth,
+                            UpdateNodesWorkspace& workspace )
+{
   NodeContainer& children = node.GetChildren();
   const NodeIter endIter = children.End();
   for ( NodeIter iter = children.Begin(); iter != endIter; ++iter )
   {
     Node& child = **iter;
-    cumulativeDirtyFlags |=UpdateNodesAndAttachments( child,
-                                                      nodeDirtyFlags,
-                                                      updateBufferIndex,
-                                                      resourceManager,
-                                                      renderQueue,
-                                                      *layer,
-                                                      inheritedDrawMode );
+
+    if( depth > MAXIMUM_TASK_DEPTH )
+    {
+      UpdateNodesAndAttachments( child, nodeDirtyFlags, updateBufferIndex, resourceManager, layer, inheritedDrawMode, CurrentResults( workspace ) );
+    }
+    else if( child.IsLayer() || child.GetChildren().Count() >= MINIMUM_CHILDREN_FOR_TASK )
+    {
+      // The sub-tree is updated by the thread pool
+      NodeUpdateTask& task = NextTask( workspace );
+      task.Reset( &child, nodeDirtyFlags, &layer, inheritedDrawMode, updateBufferIndex, resourceManager );
+      workspace.parallelTasks.push_back( &task );
+
+      // Continue with the next part of the tree
+      NextTask( workspace ).Reset( NULL, NothingFlag, NULL, DrawMode::NORMAL, updateBufferIndex, resourceManager );
+    }
+    else
+    {
+      Layer* childLayer = &layer;
+      int childDrawMode = inheritedDrawMode;
+      int childDirtyFlags( NothingFlag );
+
+      if( UpdateNode( child, nodeDirtyFlags, updateBufferIndex, resourceManager, childLayer, childDrawMode, childDirtyFlags, CurrentResults( workspace ) ) )
+      {
+        UpdateChildrenInTasks( child, childDirtyFlags, updateBufferIndex, resourceManager, *childLayer, childDrawMode, depth + 1u, workspace );
+      }
+    }
   }
+}
 
-  return cumulativeDirtyFlags;
+/**
+ * Apply the results of a part of the node tree.
+ * @param[in] results The results to apply.
+ * @param[in] updateBufferIndex The current update buffer index.
+ * @param[in,out] attachmentUpdates The attachments awaiting update are appended here.
+ * @return The cumulative dirty flags of the updated nodes.
+ */
+int ApplyResults( NodeUpdateResults& results, BufferIndex updateBufferIndex, AttachmentUpdateContainer& attachmentUpdates )
+{
+  // The renderables are stored into the opaque list temporarily for PrepareRenderables()
+  // step. The list is cleared by ProcessRenderTasks().
+  for( std::vector< NodeUpdateResults::LayerRenderable >::iterator iter = results.renderables.begin(), endIter = results.renderables.end(); iter != endIter; ++iter )
+  {
+    iter->first->colorRenderables.push_back( iter->second );
+  }
+
+  for( std::vector< Layer* >::iterator iter = results.changedLayers.begin(), endIter = results.changedLayers.end(); iter != endIter; ++iter )
+  {
+    ( *iter )->SetReuseRenderers( updateBufferIndex, false );
+  }
+
+  for( std::vector< Node* >::iterator iter = results.transformChangedNodes.begin(), endIter = results.transformChangedNodes.end(); iter != endIter; ++iter )
+  {
+    ( *iter )->UpdateLocalTransform( updateBufferIndex );
+  }
+
+  for( std::vector< Node* >::iterator iter = results.contentChangedNodes.begin(), endIter = results.contentChangedNodes.end(); iter != endIter; ++iter )
+  {
+    ( *iter )->UpdateContent();
+  }
+
+  attachmentUpdates.insert( attachmentUpdates.end(), results.attachmentUpdates.begin(), results.attachmentUpdates.end() );
+
+  return results.dirtyFlags;
 }
 
 /**
@@ -438,7 +566,9 @@ inline int UpdateNodesAndAttachments( Node& node,
 int UpdateNodesAndAttachments( Layer& rootNode,
                                BufferIndex updateBufferIndex,
                                ResourceManager& resourceManager,
-                               RenderQueue& renderQueue )
+                               RenderQueue& renderQueue,
+                               UpdateThreadPool& threadPool,
+                               UpdateNodesWorkspace& workspace )
 {
   DALI_ASSERT_DEBUG( rootNode.IsRoot() );
 
@@ -458,32 +588,69 @@ int UpdateNodesAndAttachments( Layer& rootNode,
 
   int nodeDirtyFlags( rootNode.GetDirtyFlags() );
 
-  int cumulativeDirtyFlags = nodeDirtyFlags;
+  workspace.taskCount = 0u;
+  workspace.parallelTasks.clear();
+
+  NodeUpdateTask& rootTask = NextTask( workspace );
+  rootTask.Reset( NULL, NothingFlag, NULL, DrawMode::NORMAL, updateBufferIndex, resourceManager );
+  NodeUpdateResults& rootResults = rootTask.GetResults();
+  rootResults.dirtyFlags = nodeDirtyFlags;
 
   UpdateRootNodeOpacity( rootNode, nodeDirtyFlags, updateBufferIndex );
 
-  UpdateRootNodeTransformValues( rootNode, nodeDirtyFlags, updateBufferIndex );
+  // The root node has no parent, therefore only its own flags are considered
+  UpdateNodeTransformValues( rootNode, nodeDirtyFlags, nodeDirtyFlags, updateBufferIndex, rootResults );
 
   DrawMode::Type drawMode( rootNode.GetDrawMode() );
 
-  // recurse children
-  NodeContainer& children = rootNode.GetChildren();
-  const NodeIter endIter = children.End();
-  for ( NodeIter iter = children.Begin(); iter != endIter; ++iter )
+  if( threadPool.GetThreadCount() > 1u )
   {
-    Node& child = **iter;
-    cumulativeDirtyFlags |= UpdateNodesAndAttachments( child,
-                                                       nodeDirtyFlags,
-                                                       updateBufferIndex,
-                                                       resourceManager,
-                                                       renderQueue,
-                                                       rootNode,
-                                                       drawMode );
+    UpdateChildrenInTasks( rootNode, nodeDirtyFlags, updateBufferIndex, resourceManager, rootNode, drawMode, 1u, workspace );
+
+    threadPool.Execute( workspace.parallelTasks );
+  }
+  else
+  {
+    // recurse children
+    NodeContainer& children = rootNode.GetChildren();
+    const NodeIter endIter = children.End();
+    for ( NodeIter iter = children.Begin(); iter != endIter; ++iter )
+    {
+      Node& child = **iter;
+      UpdateNodesAndAttachments( child,
+                                 nodeDirtyFlags,
+                                 updateBufferIndex,
+                                 resourceManager,
+                                 rootNode,
+                                 drawMode,
+                                 rootResults );
+    }
+  }
+
+  // Apply the results in tree order, so that the output does not depend on the number of threads
+  int cumulativeDirtyFlags = NothingFlag;
+  for( unsigned int i = 0u; i < workspace.taskCount; ++i )
+  {
+    cumulativeDirtyFlags |= ApplyResults( workspace.tasks[i]->GetResults(), updateBufferIndex, workspace.attachmentUpdates );
   }
 
   return cumulativeDirtyFlags;
 }
 
+void UpdateAttachments( AttachmentUpdateContainer& attachmentUpdates, BufferIndex updateBufferIndex )
+{
+  const AttachmentUpdateIter endIter = attachmentUpdates.end();
+  for( AttachmentUpdateIter iter = attachmentUpdates.begin(); iter != endIter; ++iter )
+  {
+    Node& node = *iter->node;
+
+    // Allow attachments to do specialised processing during updates
+    node.GetAttachment().Update( updateBufferIndex, node, iter->nodeDirtyFlags );
+  }
+
+  attachmentUpdates.clear();
+}
+
 } // namespace SceneGraph
 
 } // namespace Internal
@@ -18,8 +18,13 @@
  *
  */
 
+// EXTERNAL INCLUDES
+#include <vector>
+
 // INTERNAL INCLUDES
+#include <dali/devel-api/common/owner-container.h>
 #include <dali/internal/common/buffer-index.h>
+#include <dali/internal/update/common/update-thread-pool.h>
 
 namespace Dali
 {
@@ -32,40 +37,91 @@ class ResourceManager;
 namespace SceneGraph
 {
 
+class ConstraintGraph;
 class Layer;
 class Node;
 class PropertyOwner;
 class RenderQueue;
 
 /**
- * Recursively apply the constraints on the nodes.
- * @param[in] node to constraint.
- * @param[in] updateBufferIndex The current update buffer index.
-  */
-void ConstrainNodes( Node& node, BufferIndex updateBufferIndex );
+ * A node attachment awaiting NodeAttachment::Update(); this is called once the world transforms have been calculated.
+ */
+struct AttachmentUpdate
+{
+  AttachmentUpdate( Node& node, int nodeDirtyFlags )
+  : node( &node ),
+    nodeDirtyFlags( nodeDirtyFlags )
+  {
+  }
+
+  Node* node;         ///< The node which owns the attachment
+  int nodeDirtyFlags; ///< The dirty flags of the node, including those inherited from the parent
+};
+
+typedef std::vector< AttachmentUpdate > AttachmentUpdateContainer;
+typedef AttachmentUpdateContainer::iterator AttachmentUpdateIter;
+
+class NodeUpdateTask;
 
 /**
- * Constrain the local properties of the PropertyOwner.
- * @param[in] propertyOwner The PropertyOwner to constrain
- * @param[in] updateBufferIndex The current update buffer index.
+ * Storage used by UpdateNodesAndAttachments(); this is kept between frames to avoid reallocation.
+ */
+struct UpdateNodesWorkspace
+{
+  /**
+   * Constructor.
+   */
+  UpdateNodesWorkspace();
+
+  /**
+   * Non-virtual destructor.
+   */
+  ~UpdateNodesWorkspace();
+
+  OwnerContainer< NodeUpdateTask* > tasks;       ///< The parts of the node tree, in tree order; these are reused between frames
+  unsigned int taskCount;                        ///< The number of tasks used by the current traversal
+  UpdateThreadPool::TaskContainer parallelTasks; ///< The tasks executed by the thread pool
+  AttachmentUpdateContainer attachmentUpdates;   ///< The attachments to update with UpdateAttachments()
+};
+
+/**
+ * Recursively add the constraints of the nodes & their attachments to a ConstraintGraph, in depth-first order.
+ * @param[in] node The root of the nodes to constrain.
+ * @param[in] constraintGraph The graph which applies the constraints.
  */
-void ConstrainPropertyOwner( PropertyOwner& propertyOwner, BufferIndex updateBufferIndex );
+void GatherNodeConstraints( Node& node, ConstraintGraph& constraintGraph );
 
 /**
  * Update a tree of nodes, and attached objects.
  * The inherited properties of each node are recalculated if necessary.
  * When a renderable attachment is ready to render, PrepareResources() is called and
  * it is added to the list for its Layer.
+ * The local transforms of dirty nodes are passed to the TransformManager; the world transforms
+ * are not available until TransformManager::Update() has been called.
+ * When the thread pool has more than one thread, layers and large sub-trees are updated in parallel;
+ * the results are applied in tree order, therefore the output matches a sequential update.
  * @param[in] rootNode The root of a tree of nodes.
  * @param[in] updateBufferIndex The current update buffer index.
  * @param[in] resourceManager The resource manager.
  * @param[in] renderQueue Used to query messages for the next Render.
+ * @param[in] threadPool The threads used to update independent sub-trees.
+ * @param[in,out] workspace The storage for the traversal; attachments to update are added to workspace.attachmentUpdates.
  * @return The cumulative (ORed) dirty flags for the updated nodes
  */
 int UpdateNodesAndAttachments( Layer& rootNode,
                                BufferIndex updateBufferIndex,
                                ResourceManager& resourceManager,
-                               RenderQueue& renderQueue );
+                               RenderQueue& renderQueue,
+                               UpdateThreadPool& threadPool,
+                               UpdateNodesWorkspace& workspace );
+
+/**
+ * Call NodeAttachment::Update() for the attachments gathered by UpdateNodesAndAttachments().
+ * This must be called after the world transforms have been calculated.
+ * @param[in,out] attachmentUpdates The attachments to update; the container is cleared afterwards.
+ * @param[in] updateBufferIndex The current update buffer index.
+ */
+void UpdateAttachments( AttachmentUpdateContainer& attachmentUpdates, BufferIndex updateBufferIndex );
 
 } // namespace SceneGraph
 
@@ -20,7 +20,6 @@
 
 // INTERNAL INCLUDES
 #include <dali/public-api/common/stage.h>
-#include <dali/devel-api/common/set-wrapper.h>
 #include <dali/devel-api/common/owner-container.h>
 #include <dali/devel-api/threading/mutex.h>
 
@@ -39,15 +38,20 @@
 
 #include <dali/internal/update/animation/scene-graph-animator.h>
 #include <dali/internal/update/animation/scene-graph-animation.h>
+#include <dali/internal/update/animation/scene-graph-constraint-graph.h>
 #include <dali/internal/update/common/discard-queue.h>
+#include <dali/internal/update/common/reset-list.h>
 #include <dali/internal/update/common/scene-graph-buffers.h>
+#include <dali/internal/update/common/update-thread-pool.h>
 #include <dali/internal/update/controllers/render-message-dispatcher.h>
 #include <dali/internal/update/controllers/scene-controller-impl.h>
 #include <dali/internal/update/gestures/scene-graph-pan-gesture.h>
+#include <dali/internal/update/manager/damage-tracker.h>
 #include <dali/internal/update/manager/object-owner-container.h>
 #include <dali/internal/update/manager/prepare-render-algorithms.h>
 #include <dali/internal/update/manager/process-render-tasks.h>
 #include <dali/internal/update/manager/sorted-layers.h>
+#include <dali/internal/update/manager/transform-manager.h>
 #include <dali/internal/update/manager/update-algorithms.h>
 #include <dali/internal/update/manager/update-manager-debug.h>
 #include <dali/internal/update/node-attachments/scene-graph-camera-attachment.h>
@@ -110,9 +114,9 @@ namespace SceneGraph
 namespace
 {
 
-void DestroyNodeSet( std::set<Node*>& nodeSet )
+void DestroyNodeSet( NodeSet& nodeSet )
 {
-  for( std::set<Node*>::iterator iter = nodeSet.begin(); iter != nodeSet.end(); ++iter )
+  for( NodeSet::Iterator iter = nodeSet.Begin(), endIter = nodeSet.End(); iter != endIter; ++iter )
   {
     Node* node( *iter );
 
@@ -121,7 +125,7 @@ void DestroyNodeSet( std::set<Node*>& nodeSet )
 
     delete node;
   }
-  nodeSet.clear();
+  nodeSet.Clear();
 }
 
 } //namespace
@@ -174,9 +178,9 @@ struct UpdateManager::Impl
     systemLevelTaskList ( completeStatusManager ),
     root( NULL ),
     systemLevelRoot( NULL ),
-    renderers( sceneGraphBuffers, discardQueue ),
-    geometries( sceneGraphBuffers, discardQueue ),
-    materials( sceneGraphBuffers, discardQueue ),
+    renderers( sceneGraphBuffers, discardQueue, resetList ),
+    geometries( sceneGraphBuffers, discardQueue, resetList ),
+    materials( sceneGraphBuffers, discardQueue, resetList ),
     messageQueue( renderController, sceneGraphBuffers ),
     keepRenderingSeconds( 0.0f ),
     animationFinishedDuringUpdate( false ),
@@ -184,6 +188,7 @@ struct UpdateManager::Impl
     previousUpdateScene( false ),
     frameCounter( 0 ),
     renderSortingHelper(),
+    damageTracker(),
     renderTaskWaiting( false )
   {
     sceneController = new SceneControllerImpl( renderMessageDispatcher, renderQueue, discardQueue, textureCache, completeStatusManager );
@@ -255,11 +260,17 @@ struct UpdateManager::Impl
   RenderTaskList                      taskList;                      ///< The list of scene graph render-tasks
   RenderTaskList                      systemLevelTaskList;           ///< Separate render-tasks for system-level content
 
+  TransformManager                    transformManager;              ///< Calculates the world transforms of the nodes
+  UpdateThreadPool                    threadPool;                    ///< The threads used to update the node tree
+  UpdateNodesWorkspace                nodesWorkspace;                ///< Storage used to update the node tree
+  ResetList                           resetList;                     ///< The objects whose properties are reset to base values in the next frames
+  ConstraintGraph                     constraintGraph;               ///< Orders the constraints by their dependencies, and applies them
+
   Layer*                              root;                          ///< The root node (root is a layer)
   Layer*                              systemLevelRoot;               ///< A separate root-node for system-level content
-  std::set< Node* >                   activeDisconnectedNodes;       ///< A container of new or modified nodes (without parent) owned by UpdateManager
-  std::set< Node* >                   connectedNodes;                ///< A container of connected (with parent) nodes owned by UpdateManager
-  std::set< Node* >                   disconnectedNodes;             ///< A container of inactive disconnected nodes (without parent) owned by UpdateManager
+  NodeSet                             activeDisconnectedNodes;       ///< A container of new or modified nodes (without parent) owned by UpdateManager
+  NodeSet                             connectedNodes;                ///< A container of connected (with parent) nodes owned by UpdateManager
+  NodeSet                             disconnectedNodes;             ///< A container of inactive disconnected nodes (without parent) owned by UpdateManager
 
   SortedLayerPointers                 sortedLayers;                  ///< A container of Layer pointers sorted by depth
   SortedLayerPointers                 systemLevelSortedLayers;       ///< A separate container of system-level Layers
@@ -288,6 +299,7 @@ struct UpdateManager::Impl
 
   int                                 frameCounter;                  ///< Frame counter used in debugging to choose which frame to debug and which to ignore.
   RendererSortingHelper               renderSortingHelper;           ///< helper used to sort transparent renderers
+  DamageTracker                       damageTracker;                 ///< Finds the regions of the surface which change between frames
 
   GestureContainer                    gestures;                      ///< A container of owned gesture detectors
   bool                                renderTaskWaiting;             ///< A REFRESH_ONCE render task is waiting to be rendered
@@ -344,6 +356,9 @@ void UpdateManager::InstallRoot( SceneGraph::Layer* layer, bool systemLevel )
   }
 
   layer->SetRoot(true);
+  layer->CreateTransform( mImpl->transformManager );
+  layer->SetResetList( mImpl->resetList );
+  layer->RequestReset();
 }
 
 void UpdateManager::AddNode( Node* node )
@@ -351,7 +366,10 @@ void UpdateManager::AddNode( Node* node )
   DALI_ASSERT_ALWAYS( NULL != node );
   DALI_ASSERT_ALWAYS( NULL == node->GetParent() ); // Should not have a parent yet
 
-  mImpl->activeDisconnectedNodes.insert( node ); // Takes ownership of node
+  mImpl->activeDisconnectedNodes.Insert( *node ); // Takes ownership of node
+  node->CreateTransform( mImpl->transformManager );
+  node->SetResetList( mImpl->resetList );
+  node->RequestReset();
 }
 
 void UpdateManager::ConnectNode( Node* parent, Node* node )
@@ -361,13 +379,13 @@ void UpdateManager::ConnectNode( Node* parent, Node* node )
   DALI_ASSERT_ALWAYS( NULL == node->GetParent() ); // Should not have a parent yet
 
   // Move from active/disconnectedNodes to connectedNodes
-  std::set<Node*>::size_type removed = mImpl->activeDisconnectedNodes.erase( node );
+  bool removed = mImpl->activeDisconnectedNodes.Erase( *node );
   if( !removed )
   {
-    removed = mImpl->disconnectedNodes.erase( node );
+    removed = mImpl->disconnectedNodes.Erase( *node );
     DALI_ASSERT_ALWAYS( removed );
   }
-  mImpl->connectedNodes.insert( node );
+  mImpl->connectedNodes.Insert( *node );
 
   node->SetActive( true );
 
@@ -390,9 +408,9 @@ void UpdateManager::SetNodeActive( Node* node )
   DALI_ASSERT_ALWAYS( NULL == node->GetParent() ); // Should not have a parent yet
 
   // Move from disconnectedNodes to activeDisconnectedNodes (reset properties next frame)
-  std::set<Node*>::size_type removed = mImpl->disconnectedNodes.erase( node );
+  const bool removed = mImpl->disconnectedNodes.Erase( *node );
   DALI_ASSERT_ALWAYS( removed );
-  mImpl->activeDisconnectedNodes.insert( node );
+  mImpl->activeDisconnectedNodes.Insert( *node );
 
   node->SetActive( true );
 }
@@ -404,10 +422,10 @@ void UpdateManager::DestroyNode( Node* node )
 
   // Transfer ownership from new/disconnectedNodes to the discard queue
   // This keeps the nodes alive, until the render-thread has finished with them
-  std::set<Node*>::size_type removed = mImpl->activeDisconnectedNodes.erase( node );
+  bool removed = mImpl->activeDisconnectedNodes.Erase( *node );
   if( !removed )
   {
-    removed = mImpl->disconnectedNodes.erase( node );
+    removed = mImpl->disconnectedNodes.Erase( *node );
     DALI_ASSERT_ALWAYS( removed );
   }
   mImpl->discardQueue.Add( mSceneGraphBuffers.GetUpdateBufferIndex(), node );
@@ -437,6 +455,8 @@ void UpdateManager::AddObject( PropertyOwner* object )
   DALI_ASSERT_DEBUG( NULL != object );
 
   mImpl->customObjects.PushBack( object );
+  object->SetResetList( mImpl->resetList );
+  object->RequestReset();
 }
 
 void UpdateManager::RemoveObject( PropertyOwner* object )
@@ -566,6 +586,8 @@ void UpdateManager::AddShader( Shader* shader )
   }
 
   mImpl->shaders.PushBack( shader );
+  shader->SetResetList( mImpl->resetList );
+  shader->RequestReset();
 
   // Allows the shader to dispatch texture requests to the cache
   shader->Initialize( mImpl->renderQueue, mImpl->sceneController->GetTextureCache() );
@@ -610,6 +632,17 @@ void UpdateManager::SetShaderProgram( Shader* shader,
   }
 }
 
+void UpdateManager::WarmUpProgram( Internal::ShaderDataPtr shaderData )
+{
+  typedef MessageValue1< RenderManager, Internal::ShaderDataPtr > DerivedType;
+
+  // Reserve some memory inside the render queue
+  unsigned int* slot = mImpl->renderQueue.ReserveMessageSlot( mSceneGraphBuffers.GetUpdateBufferIndex(), sizeof( DerivedType ) );
+
+  // Construct message in the render queue memory; note that delete should not be called on the return value
+  new (slot) DerivedType( &mImpl->renderManager, &RenderManager::WarmUpProgram, shaderData );
+}
+
 void UpdateManager::SaveBinary( Internal::ShaderDataPtr shaderData )
 {
   DALI_ASSERT_DEBUG( shaderData && "No NULL shader data pointers please." );
@@ -667,6 +700,16 @@ unsigned int* UpdateManager::ReserveMessageSlot( std::size_t size, bool updateSc
   return mImpl->messageQueue.ReserveMessageSlot( size, updateScene );
 }
 
+unsigned int* UpdateManager::ReserveCoalescedMessageSlot( std::size_t size, const void* property )
+{
+  return mImpl->messageQueue.ReserveCoalescedMessageSlot( size, property );
+}
+
+void UpdateManager::InvalidateCoalescedMessage( const void* property )
+{
+  mImpl->messageQueue.InvalidateCoalescedMessage( property );
+}
+
 void UpdateManager::EventProcessingStarted()
 {
   mImpl->messageQueue.EventProcessingStarted();
@@ -684,36 +727,21 @@ void UpdateManager::ResetProperties( BufferIndex bufferIndex )
   // Clear the "animations finished" flag; This should be set if any (previously playing) animation is stopped
   mImpl->animationFinishedDuringUpdate = false;
 
-  // Animated properties have to be reset to their original value each frame
+  // Animated properties have to be reset to their original value each frame.
+  // Only the objects which were written during the previous frames are in the reset list.
+  const unsigned int resetCount = mImpl->resetList.ResetToBaseValues( bufferIndex );
+  INCREASE_BY( PerformanceMonitor::PROPERTY_OWNERS_RESET, resetCount );
+  (void)resetCount; // Avoid "unused variable resetCount" when the performance counters are compiled out
 
-  // Reset root properties
-  if ( mImpl->root )
+  // If a Node is disconnected, it may still be "active"; it was reset above if required
+  NodeSet& activeDisconnectedNodes = mImpl->activeDisconnectedNodes;
+  for( NodeSet::Iterator iter = activeDisconnectedNodes.Begin(), endIter = activeDisconnectedNodes.End(); iter != endIter; ++iter )
   {
-    mImpl->root->ResetToBaseValues( bufferIndex );
-  }
-  if ( mImpl->systemLevelRoot )
-  {
-    mImpl->systemLevelRoot->ResetToBaseValues( bufferIndex );
-  }
-
-  // Reset the Connected Nodes
-  const std::set<Node*>::iterator endIter = mImpl->connectedNodes.end();
-  for( std::set<Node*>::iterator iter = mImpl->connectedNodes.begin(); endIter != iter; ++iter )
-  {
-    (*iter)->ResetToBaseValues( bufferIndex );
+    (*iter)->SetActive( false );
   }
 
-  // If a Node is disconnected, it may still be "active" (requires a reset in next frame)
-  for( std::set<Node*>::iterator iter = mImpl->activeDisconnectedNodes.begin(); mImpl->activeDisconnectedNodes.end() != iter; iter = mImpl->activeDisconnectedNodes.begin() )
-  {
-    Node* node = *iter;
-    node->ResetToBaseValues( bufferIndex );
-    node->SetActive( false );
-
-    // Move everything from activeDisconnectedNodes to disconnectedNodes (no need to reset again)
-    mImpl->activeDisconnectedNodes.erase( iter );
-    mImpl->disconnectedNodes.insert( node );
-  }
+  // Move everything from activeDisconnectedNodes to disconnectedNodes
+  activeDisconnectedNodes.MoveTo( mImpl->disconnectedNodes );
 
   // Reset system-level render-task list properties to base values
   const RenderTaskList::RenderTaskContainer& systemLevelTasks = mImpl->systemLevelTaskList.GetTasks();
@@ -731,23 +759,6 @@ void UpdateManager::ResetProperties( BufferIndex bufferIndex )
     (*iter)->ResetToBaseValues( bufferIndex );
   }
 
-  // Reset custom object properties to base values
-  for (OwnerContainer<PropertyOwner*>::Iterator iter = mImpl->customObjects.Begin(); iter != mImpl->customObjects.End(); ++iter)
-  {
-    (*iter)->ResetToBaseValues( bufferIndex );
-  }
-
-  mImpl->materials.ResetToBaseValues( bufferIndex );
-  mImpl->geometries.ResetToBaseValues( bufferIndex );
-  mImpl->renderers.ResetToBaseValues( bufferIndex );
-
-
-  // Reset animatable shader properties to base values
-  for (ShaderIter iter = mImpl->shaders.Begin(); iter != mImpl->shaders.End(); ++iter)
-  {
-    (*iter)->ResetToBaseValues( bufferIndex );
-  }
-
   PERF_MONITOR_END(PerformanceMonitor::RESET_PROPERTIES);
 }
 
@@ -805,6 +816,8 @@ void UpdateManager::ApplyConstraints( BufferIndex bufferIndex )
 {
   PERF_MONITOR_START(PerformanceMonitor::APPLY_CONSTRAINTS);
 
+  ConstraintGraph& constraintGraph = mImpl->constraintGraph;
+
   // constrain custom objects... (in construction order)
   OwnerContainer< PropertyOwner* >& customObjects = mImpl->customObjects;
 
@@ -812,18 +825,18 @@ void UpdateManager::ApplyConstraints( BufferIndex bufferIndex )
   for ( OwnerContainer< PropertyOwner* >::Iterator iter = customObjects.Begin(); endIter != iter; ++iter )
   {
     PropertyOwner& object = **iter;
-    ConstrainPropertyOwner( object, bufferIndex );
+    constraintGraph.Add( object );
   }
 
   // constrain nodes... (in Depth First traversal order)
   if ( mImpl->root )
   {
-    ConstrainNodes( *(mImpl->root), bufferIndex );
+    GatherNodeConstraints( *(mImpl->root), constraintGraph );
   }
 
   if ( mImpl->systemLevelRoot )
   {
-    ConstrainNodes( *(mImpl->systemLevelRoot), bufferIndex );
+    GatherNodeConstraints( *(mImpl->systemLevelRoot), constraintGraph );
   }
 
   // constrain other property-owners after nodes as they are more likely to depend on a node's
@@ -832,16 +845,13 @@ void UpdateManager::ApplyConstraints( BufferIndex bufferIndex )
   // e.g. ShaderEffect uniform a function of Actor's position.
   // Mesh vertex a function of Actor's position or world position.
 
-  // TODO: refactor this code (and reset nodes) as these are all just lists of property-owners
-  // they can be all processed in a super-list of property-owners.
-
   // Constrain system-level render-tasks
   const RenderTaskList::RenderTaskContainer& systemLevelTasks = mImpl->systemLevelTaskList.GetTasks();
 
   for ( RenderTaskList::RenderTaskContainer::ConstIterator iter = systemLevelTasks.Begin(); iter != systemLevelTasks.End(); ++iter )
   {
     RenderTask& task = **iter;
-    ConstrainPropertyOwner( task, bufferIndex );
+    constraintGraph.Add( task );
   }
 
   // Constrain render-tasks
@@ -850,13 +860,13 @@ void UpdateManager::ApplyConstraints( BufferIndex bufferIndex )
   for ( RenderTaskList::RenderTaskContainer::ConstIterator iter = tasks.Begin(); iter != tasks.End(); ++iter )
   {
     RenderTask& task = **iter;
-    ConstrainPropertyOwner( task, bufferIndex );
+    constraintGraph.Add( task );
   }
 
   // Constrain Materials and geometries
-  mImpl->materials.ConstrainObjects( bufferIndex );
-  mImpl->geometries.ConstrainObjects( bufferIndex );
-  mImpl->renderers.ConstrainObjects( bufferIndex );
+  mImpl->materials.GatherConstraints( constraintGraph );
+  mImpl->geometries.GatherConstraints( constraintGraph );
+  mImpl->renderers.GatherConstraints( constraintGraph );
 
   // constrain shaders... (in construction order)
   ShaderContainer& shaders = mImpl->shaders;
@@ -864,9 +874,12 @@ void UpdateManager::ApplyConstraints( BufferIndex bufferIndex )
   for ( ShaderIter iter = shaders.Begin(); iter != shaders.End(); ++iter )
   {
     Shader& shader = **iter;
-    ConstrainPropertyOwner( shader, bufferIndex );
+    constraintGraph.Add( shader );
   }
 
+  // The constraints are applied in the order above, or in batches of independent constraints on the thread pool
+  constraintGraph.Apply( bufferIndex, mImpl->threadPool );
+
   PERF_MONITOR_END(PerformanceMonitor::APPLY_CONSTRAINTS);
 }
 
@@ -944,16 +957,26 @@ void UpdateManager::UpdateNodes( BufferIndex bufferIndex )
   mImpl->nodeDirtyFlags = UpdateNodesAndAttachments( *( mImpl->root ),
                                                      bufferIndex,
                                                      mImpl->resourceManager,
-                                                     mImpl->renderQueue );
+                                                     mImpl->renderQueue,
+                                                     mImpl->threadPool,
+                                                     mImpl->nodesWorkspace );
 
   if ( mImpl->systemLevelRoot )
   {
     mImpl->nodeDirtyFlags |= UpdateNodesAndAttachments( *( mImpl->systemLevelRoot ),
                                                         bufferIndex,
                                                         mImpl->resourceManager,
-                                                        mImpl->renderQueue );
+                                                        mImpl->renderQueue,
+                                                        mImpl->threadPool,
+                                                        mImpl->nodesWorkspace );
   }
 
+  // Calculate the world transforms of the nodes whose local transforms, or parents, have changed
+  mImpl->transformManager.Update( bufferIndex );
+
+  // Attachments such as cameras depend on the world transform of their node
+  UpdateAttachments( mImpl->nodesWorkspace.attachmentUpdates, bufferIndex );
+
   PERF_MONITOR_END( PerformanceMonitor::UPDATE_NODES );
 }
 
@@ -1067,6 +1090,14 @@ unsigned int UpdateManager::Update( float elapsedSeconds,
     }
   }
 
+  // 15) Find the regions of the surface which changed since the previous frame.
+  //     Only the changes to property owners can be localised; other messages & new resources damage the whole surface.
+  mImpl->damageTracker.Update( bufferIndex,
+                               mImpl->renderInstructions,
+                               mImpl->resetList,
+                               updateScene || mImpl->previousUpdateScene,
+                               resourceChanged || !mImpl->messageQueue.WasDamageTracked() );
+
   // check the countdown and notify (note, at the moment this is only done for normal tasks, not for systemlevel tasks)
   bool doRenderOnceNotify = false;
   mImpl->renderTaskWaiting = false;
@@ -1185,6 +1216,36 @@ void UpdateManager::KeepRendering( float durationSeconds )
   mImpl->keepRenderingSeconds = std::max( mImpl->keepRenderingSeconds, durationSeconds );
 }
 
+void UpdateManager::SetUpdateThreadCount( unsigned int threadCount )
+{
+  mImpl->threadPool.SetThreadCount( threadCount );
+}
+
+void UpdateManager::SetTextureMemoryBudget( std::size_t budget )
+{
+  typedef MessageValue1< RenderManager, std::size_t > DerivedType;
+
+  // Reserve some memory inside the render queue
+  unsigned int* slot = mImpl->renderQueue.ReserveMessageSlot( mSceneGraphBuffers.GetUpdateBufferIndex(), sizeof( DerivedType ) );
+
+  // Construct message in the render queue memory; note that delete should not be called on the return value
+  new (slot) DerivedType( &mImpl->renderManager, &RenderManager::SetTextureMemoryBudget, budget );
+}
+
+void UpdateManager::SetTextureUploadBudget( std::size_t budget )
+{
+  // The bitmaps created from now on are not complete until the render thread has uploaded them
+  mImpl->resourceManager.SetIncrementalTextureUploads( budget > 0u );
+
+  typedef MessageValue1< RenderManager, std::size_t > DerivedType;
+
+  // Reserve some memory inside the render queue
+  unsigned int* slot = mImpl->renderQueue.ReserveMessageSlot( mSceneGraphBuffers.GetUpdateBufferIndex(), sizeof( DerivedType ) );
+
+  // Construct message in the render queue memory; note that delete should not be called on the return value
+  new (slot) DerivedType( &mImpl->renderManager, &RenderManager::SetTextureUploadBudget, budget );
+}
+
 void UpdateManager::SetLayerDepths( const SortedLayerPointers& layers, bool systemLevel )
 {
   if ( !systemLevel )
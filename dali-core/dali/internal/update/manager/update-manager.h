@@ -301,6 +301,12 @@ public:
    */
   void SetShaderProgram( Shader* shader, Internal::ShaderDataPtr shaderData, bool modifiesGeometry );
 
+  /**
+   * Create & link a shader program before any Shader uses it
+   * @param[in] shaderData    Source code, hash over source, and optional compiled binary for the shader program
+   */
+  void WarmUpProgram( Internal::ShaderDataPtr shaderData );
+
   /**
    * @brief Accept compiled shaders passed back on render thread for saving.
    * @param[in] shaderData Source code, hash over source, and corresponding compiled binary to be saved.
@@ -344,6 +350,16 @@ public:
    */
   unsigned int* ReserveMessageSlot( std::size_t size, bool updateScene = true );
 
+  /**
+   * @copydoc EventThreadServices::ReserveCoalescedMessageSlot
+   */
+  unsigned int* ReserveCoalescedMessageSlot( std::size_t size, const void* property );
+
+  /**
+   * @copydoc EventThreadServices::InvalidateCoalescedMessage
+   */
+  void InvalidateCoalescedMessage( const void* property );
+
   /**
    * @return the current event-buffer index.
    */
@@ -465,6 +481,24 @@ public:
    */
   void KeepRendering( float durationSeconds );
 
+  /**
+   * Set the number of threads used to update the node tree.
+   * @param[in] threadCount The number of threads, including the update-thread.
+   */
+  void SetUpdateThreadCount( unsigned int threadCount );
+
+  /**
+   * Set the GPU memory budget of the bitmap textures.
+   * @param[in] budget The budget in bytes, or zero for no budget.
+   */
+  void SetTextureMemoryBudget( std::size_t budget );
+
+  /**
+   * Set the number of bytes of new bitmaps uploaded per frame.
+   * @param[in] budget The budget in bytes, or zero to upload each bitmap as a whole.
+   */
+  void SetTextureUploadBudget( std::size_t budget );
+
   /**
    * Sets the depths of all layers.
    * @param layers The layers in depth order.
@@ -790,6 +824,17 @@ inline void SetShaderProgramMessage( UpdateManager& manager,
   new (slot) LocalType( &manager, &UpdateManager::SetShaderProgram, &shader, shaderData, modifiesGeometry );
 }
 
+inline void WarmUpProgramMessage( UpdateManager& manager, Internal::ShaderDataPtr shaderData )
+{
+  typedef MessageValue1< UpdateManager, Internal::ShaderDataPtr > LocalType;
+
+  // Reserve some memory inside the message queue
+  unsigned int* slot = manager.ReserveMessageSlot( sizeof( LocalType ) );
+
+  // Construct message in the message queue memory; note that delete should not be called on the return value
+  new (slot) LocalType( &manager, &UpdateManager::WarmUpProgram, shaderData );
+}
+
 inline void SetBackgroundColorMessage( UpdateManager& manager, const Vector4& color )
 {
   typedef MessageValue1< UpdateManager, Vector4 > LocalType;
@@ -823,6 +868,57 @@ inline void KeepRenderingMessage( UpdateManager& manager, float durationSeconds
   new (slot) LocalType( &manager, &UpdateManager::KeepRendering, durationSeconds );
 }
 
+/**
+ * Create a message for setting the number of threads used to update the scene-graph.
+ * The nodes are not marked as requiring an update, as the count only changes how they are updated.
+ * @param[in] manager The update manager
+ * @param[in] threadCount The number of threads, including the update-thread; zero or one updates on the update-thread alone
+ */
+inline void SetUpdateThreadCountMessage( UpdateManager& manager, unsigned int threadCount )
+{
+  typedef MessageValue1< UpdateManager, unsigned int > LocalType;
+
+  // Reserve some memory inside the message queue
+  unsigned int* slot = manager.ReserveMessageSlot( sizeof( LocalType ), false );
+
+  // Construct message in the message queue memory; note that delete should not be called on the return value
+  new (slot) LocalType( &manager, &UpdateManager::SetUpdateThreadCount, threadCount );
+}
+
+/**
+ * Create a message for setting the GPU memory budget of the bitmap textures.
+ * When over budget, the render-thread deletes the least recently drawn textures until back within it.
+ * @param[in] manager The update manager
+ * @param[in] budget The budget in bytes; zero means no budget, so textures are never deleted to save memory
+ */
+inline void SetTextureMemoryBudgetMessage( UpdateManager& manager, std::size_t budget )
+{
+  typedef MessageValue1< UpdateManager, std::size_t > LocalType;
+
+  // Reserve some memory inside the message queue
+  unsigned int* slot = manager.ReserveMessageSlot( sizeof( LocalType ) );
+
+  // Construct message in the message queue memory; note that delete should not be called on the return value
+  new (slot) LocalType( &manager, &UpdateManager::SetTextureMemoryBudget, budget );
+}
+
+/**
+ * Create a message for setting the number of bytes of new bitmaps uploaded to GL per frame.
+ * With a budget, bitmaps are uploaded a band of rows at a time and only complete once fully uploaded.
+ * @param[in] manager The update manager
+ * @param[in] budget The budget in bytes per frame; zero means no budget, so each bitmap is uploaded as a whole
+ */
+inline void SetTextureUploadBudgetMessage( UpdateManager& manager, std::size_t budget )
+{
+  typedef MessageValue1< UpdateManager, std::size_t > LocalType;
+
+  // Reserve some memory inside the message queue
+  unsigned int* slot = manager.ReserveMessageSlot( sizeof( LocalType ) );
+
+  // Construct message in the message queue memory; note that delete should not be called on the return value
+  new (slot) LocalType( &manager, &UpdateManager::SetTextureUploadBudget, budget );
+}
+
 /**
  * Create a message for setting the depth of a layer
  * @param[in] manager The update manager
@@ -18,6 +18,9 @@
 // CLASS HEADER
 #include <dali/internal/update/node-attachments/scene-graph-camera-attachment.h>
 
+// EXTERNAL HEADERS
+#include <cmath>
+
 // INTERNAL HEADERS
 #include <dali/public-api/common/dali-common.h>
 #include <dali/internal/update/nodes/node.h>
@@ -522,6 +525,28 @@ bool CameraAttachment::CheckAABBInFrustum( BufferIndex bufferIndex, const Vector
   return true;
 }
 
+bool CameraAttachment::CheckOBBInFrustum( BufferIndex bufferIndex, const Matrix& worldMatrix, const Vector3& halfSize )
+{
+  const FrustumPlanes& planes = mFrustum[ bufferIndex ];
+  const float* matrix = worldMatrix.AsFloat();
+  const Vector3 xAxis( matrix[0] * halfSize.x, matrix[1] * halfSize.x, matrix[2] * halfSize.x );
+  const Vector3 yAxis( matrix[4] * halfSize.y, matrix[5] * halfSize.y, matrix[6] * halfSize.y );
+  const Vector3 zAxis( matrix[8] * halfSize.z, matrix[9] * halfSize.z, matrix[10] * halfSize.z );
+  const Vector3 origin( matrix[12], matrix[13], matrix[14] );
+
+  for ( uint32_t i = 0; i < 6; ++i )
+  {
+    // The box is outside if its nearest corner is behind one of the planes
+    const Vector3& normal = planes.mPlanes[ i ].mNormal;
+    const float radius = fabsf( normal.Dot( xAxis ) ) + fabsf( normal.Dot( yAxis ) ) + fabsf( normal.Dot( zAxis ) );
+    if ( ( planes.mPlanes[ i ].mDistance + normal.Dot( origin ) ) < -radius )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
 unsigned int CameraAttachment::UpdateProjection( BufferIndex updateBufferIndex )
 {
   unsigned int retval( mUpdateProjectionFlag );
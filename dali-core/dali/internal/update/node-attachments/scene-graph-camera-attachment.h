@@ -219,6 +219,17 @@ public:
    */
   bool CheckAABBInFrustum( BufferIndex bufferIndex, const Vector3& origin, const Vector3& extents );
 
+  /**
+   * @brief Check to see if an oriented bounding box lies within the view frustum.
+   *
+   * @param bufferIndex The buffer to read from.
+   * @param worldMatrix The world matrix of the box; the box is centered on its translation.
+   * @param halfSize The half length of the box in each axis, before the world matrix is applied.
+   *
+   * @return false if the box lies outside of the frustum.
+   */
+  bool CheckOBBInFrustum( BufferIndex bufferIndex, const Matrix& worldMatrix, const Vector3& halfSize );
+
   /**
    * Retrieve the projection-matrix; this is double buffered for input handling.
    * @param[in] bufferIndex The buffer to read from.
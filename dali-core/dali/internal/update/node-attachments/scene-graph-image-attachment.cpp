@@ -439,6 +439,12 @@ BlendingMode::Type RenderableAttachment::GetBlendingMode() const
   return mBlendingMode;
 }
 
+bool ImageAttachment::IsBoundedBySize() const
+{
+  // The default shader draws the quad at the size of the node
+  return ( NULL == mShader ) || mShader->GeometryHintEnabled( Dali::ShaderEffect::HINT_DOESNT_MODIFY_GEOMETRY );
+}
+
 bool ImageAttachment::IsFullyOpaque( BufferIndex updateBufferIndex )
 {
   bool fullyOpaque = true;
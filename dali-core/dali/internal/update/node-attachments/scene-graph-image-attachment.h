@@ -22,6 +22,7 @@
 #include <dali/public-api/actors/image-actor.h>
 #include <dali/public-api/math/rect.h>
 #include <dali/public-api/shader-effects/shader-effect.h>
+#include <dali/internal/common/pooled-allocation.h>
 #include <dali/internal/event/common/event-thread-services.h>
 #include <dali/internal/update/node-attachments/scene-graph-renderable-attachment.h>
 #include <dali/internal/update/resources/bitmap-metadata.h>
@@ -63,6 +64,22 @@ public:
    */
   static ImageAttachment* New( unsigned int textureId );
 
+  /**
+   * Allocate the memory of a ImageAttachment from a memory pool, see PooledAllocation.
+   */
+  static void* operator new( std::size_t size )
+  {
+    return PooledAllocation< ImageAttachment >::Allocate( size );
+  }
+
+  /**
+   * Return the memory of a ImageAttachment to the memory pool, see PooledAllocation.
+   */
+  static void operator delete( void* memory, std::size_t size )
+  {
+    PooledAllocation< ImageAttachment >::Free( memory, size );
+  }
+
   /**
    * Virtual destructor
    */
@@ -195,6 +212,11 @@ public:
    */
   virtual bool IsFullyOpaque( BufferIndex updateBufferIndex );
 
+  /**
+   * @copydoc RenderableAttachment::IsBoundedBySize()
+   */
+  virtual bool IsBoundedBySize() const;
+
 protected:
 
   /**
@@ -136,6 +136,15 @@ public: // API
    */
   void GetScaleForSize( const Vector3& nodeSize, Vector3& scaling );
 
+  /**
+   * Query whether the attachment is drawn within the size of its node; only then can it be culled.
+   * @return True if the geometry is contained by the size of the node.
+   */
+  virtual bool IsBoundedBySize() const
+  {
+    return false;
+  }
+
 
 public: // For use during in the update algorithm only
 
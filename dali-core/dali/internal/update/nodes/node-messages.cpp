@@ -39,6 +39,12 @@ NodePropertyMessageBase::~NodePropertyMessageBase()
 {
 }
 
+bool NodePropertyMessageBase::IsDamageTracked() const
+{
+  // The node is reset after every message, which marks it as changed
+  return true;
+}
+
 void NodePropertyMessageBase::NotifyUpdateManager( Node* node )
 {
   mUpdateManager.SetNodeActive( node );
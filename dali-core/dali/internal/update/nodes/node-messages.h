@@ -49,6 +49,11 @@ public:
    */
   virtual ~NodePropertyMessageBase();
 
+  /**
+   * @copydoc MessageBase::IsDamageTracked
+   */
+  virtual bool IsDamageTracked() const;
+
 protected:
 
   /**
@@ -93,8 +98,20 @@ public:
                     MemberFunction member,
                     typename ParameterType< P >::PassingType value )
   {
-    // Reserve some memory inside the message queue
-    unsigned int* slot = eventThreadServices.ReserveMessageSlot( sizeof( NodePropertyMessage ) );
+    unsigned int* slot( NULL );
+    if( member == &AnimatableProperty<P>::Bake )
+    {
+      // Replace an earlier message which baked the same property, since the last flush
+      slot = eventThreadServices.ReserveCoalescedMessageSlot( sizeof( NodePropertyMessage ), property );
+    }
+    else
+    {
+      // The result depends on the earlier messages
+      eventThreadServices.InvalidateCoalescedMessage( property );
+
+      // Reserve some memory inside the message queue
+      slot = eventThreadServices.ReserveMessageSlot( sizeof( NodePropertyMessage ) );
+    }
 
     // Construct message in the message queue memory; note that delete should not be called on the return value
     new (slot) NodePropertyMessage( eventThreadServices.GetUpdateManager(), node, property, member, value );
@@ -113,6 +130,7 @@ public:
   virtual void Process( BufferIndex updateBufferIndex )
   {
     (mProperty->*mMemberFunction)( updateBufferIndex, mParam );
+    mNode->RequestReset();
 
     if( ! mNode->IsActive() )
     {
@@ -180,6 +198,9 @@ public:
                     MemberFunction member,
                     float value )
   {
+    // An earlier message which baked the whole property must still be applied first
+    eventThreadServices.InvalidateCoalescedMessage( property );
+
     // Reserve some memory inside the message queue
     unsigned int* slot = eventThreadServices.ReserveMessageSlot( sizeof( NodePropertyComponentMessage ) );
 
@@ -200,6 +221,7 @@ public:
   virtual void Process( BufferIndex updateBufferIndex )
   {
     (mProperty->*mMemberFunction)( updateBufferIndex, mParam );
+    mNode->RequestReset();
 
     if( ! mNode->IsActive() )
     {
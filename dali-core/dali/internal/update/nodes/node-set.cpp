@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/update/nodes/node-set.h>
+
+// INTERNAL INCLUDES
+#include <dali/internal/update/nodes/node.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+
+NodeSet::NodeSet()
+: mNodes()
+{
+}
+
+NodeSet::~NodeSet()
+{
+}
+
+void NodeSet::Insert( Node& node )
+{
+  DALI_ASSERT_DEBUG( !Contains( node ) );
+
+  node.mSetIndex = mNodes.Count();
+  mNodes.PushBack( &node );
+}
+
+bool NodeSet::Erase( Node& node )
+{
+  if( !Contains( node ) )
+  {
+    return false;
+  }
+
+  // Move the last node into the empty slot
+  Node* last = mNodes[ mNodes.Count() - 1u ];
+  last->mSetIndex = node.mSetIndex;
+  mNodes[ node.mSetIndex ] = last;
+  mNodes.Resize( mNodes.Count() - 1u );
+
+  return true;
+}
+
+bool NodeSet::Contains( const Node& node ) const
+{
+  return ( node.mSetIndex < mNodes.Count() ) && ( mNodes[ node.mSetIndex ] == &node );
+}
+
+void NodeSet::MoveTo( NodeSet& destination )
+{
+  destination.mNodes.Reserve( destination.mNodes.Count() + mNodes.Count() );
+
+  for( Iterator iter = mNodes.Begin(), endIter = mNodes.End(); iter != endIter; ++iter )
+  {
+    destination.Insert( **iter );
+  }
+
+  mNodes.Clear();
+}
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
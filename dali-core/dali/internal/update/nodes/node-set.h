@@ -0,0 +1,161 @@
+#ifndef __DALI_INTERNAL_SCENE_GRAPH_NODE_SET_H__
+#define __DALI_INTERNAL_SCENE_GRAPH_NODE_SET_H__
+
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali/internal/update/nodes/node-declarations.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+
+/**
+ * An unordered set of nodes, stored densely in slots of a vector.
+ *
+ * Each node remembers its slot, therefore insertion, removal and membership tests are O(1)
+ * and do not allocate (once the vector has grown). A node may be in only one NodeSet at a time.
+ * Removal moves the last node into the empty slot, so the order of iteration is not preserved.
+ */
+class NodeSet
+{
+public:
+
+  typedef NodeContainer::Iterator Iterator;
+  typedef NodeContainer::ConstIterator ConstIterator;
+
+  /**
+   * Constructor.
+   */
+  NodeSet();
+
+  /**
+   * Non-virtual destructor; the nodes are not owned.
+   */
+  ~NodeSet();
+
+  /**
+   * Insert a node.
+   * @pre The node is not in a NodeSet.
+   * @param[in] node The node to insert.
+   */
+  void Insert( Node& node );
+
+  /**
+   * Remove a node, if it is in this set.
+   * @param[in] node The node to remove.
+   * @return True if the node was removed.
+   */
+  bool Erase( Node& node );
+
+  /**
+   * Query whether a node is in this set.
+   * @param[in] node The node.
+   * @return True if the node is in this set.
+   */
+  bool Contains( const Node& node ) const;
+
+  /**
+   * Move every node into another set; this set is empty afterwards.
+   * @param[in] destination The set to insert the nodes into.
+   */
+  void MoveTo( NodeSet& destination );
+
+  /**
+   * Remove every node.
+   */
+  void Clear()
+  {
+    mNodes.Clear();
+  }
+
+  /**
+   * Reserve space for a number of nodes.
+   * @param[in] capacity The number of nodes.
+   */
+  void Reserve( unsigned int capacity )
+  {
+    mNodes.Reserve( capacity );
+  }
+
+  /**
+   * Retrieve the number of nodes.
+   * @return The node count.
+   */
+  unsigned int Count() const
+  {
+    return mNodes.Count();
+  }
+
+  /**
+   * @return An iterator to the first node.
+   */
+  Iterator Begin()
+  {
+    return mNodes.Begin();
+  }
+
+  /**
+   * @return An iterator past the last node.
+   */
+  Iterator End()
+  {
+    return mNodes.End();
+  }
+
+  /**
+   * @return A const iterator to the first node.
+   */
+  ConstIterator Begin() const
+  {
+    return mNodes.Begin();
+  }
+
+  /**
+   * @return A const iterator past the last node.
+   */
+  ConstIterator End() const
+  {
+    return mNodes.End();
+  }
+
+private:
+
+  // Undefined
+  NodeSet( const NodeSet& );
+
+  // Undefined
+  NodeSet& operator=( const NodeSet& );
+
+private:
+
+  NodeContainer mNodes; ///< The nodes (not owned)
+};
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // __DALI_INTERNAL_SCENE_GRAPH_NODE_SET_H__
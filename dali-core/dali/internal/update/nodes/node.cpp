@@ -20,6 +20,9 @@
 
 // INTERNAL INCLUDES
 #include <dali/internal/update/node-attachments/node-attachment.h>
+#include <dali/internal/update/node-attachments/scene-graph-renderable-attachment.h>
+#include <dali/internal/update/rendering/scene-graph-material.h>
+#include <dali/internal/render/shaders/scene-graph-shader.h>
 #include <dali/internal/update/common/discard-queue.h>
 #include <dali/public-api/common/dali-common.h>
 #include <dali/public-api/common/constants.h>
@@ -51,15 +54,19 @@ Node::Node()
   mScale( Vector3::ONE ),
   mVisible( true ),
   mColor( Color::WHITE ),
-  mWorldPosition(), // zero initialized by default
+  mWorldPosition( &WorldTransform::position ), // zero initialized by default
   mWorldOrientation(), // initialized to identity by default
-  mWorldScale( Vector3::ONE ),
+  mWorldScale( &WorldTransform::scale ), // initialized to one by default
   mWorldMatrix(),
   mWorldColor( Color::WHITE ),
+  mTransformManager( NULL ),
+  mTransformId( INVALID_TRANSFORM_ID ),
   mParent( NULL ),
   mExclusiveRenderTask( NULL ),
   mAttachment( NULL ),
   mChildren(),
+  mSetIndex( 0u ),
+  mRenderableCount( 0u ),
   mRegenerateUniformMap( 0 ),
   mDepth(0u),
   mDirtyFlags(AllFlags),
@@ -68,6 +75,7 @@ Node::Node()
   mInheritScale( true ),
   mInhibitLocalTransform( false ),
   mIsActive( true ),
+  mContentBounded( true ),
   mDrawMode( DrawMode::NORMAL ),
   mPositionInheritanceMode( DEFAULT_POSITION_INHERITANCE_MODE ),
   mColorMode( DEFAULT_COLOR_MODE )
@@ -90,6 +98,96 @@ void Node::OnDestroy()
 
   // Animators, Constraints etc. should be disconnected from the child's properties.
   PropertyOwner::Destroy();
+
+  if( mTransformManager )
+  {
+    // The world transform remains readable until the current frame has been rendered
+    mTransformManager->RemoveTransform( mTransformId );
+    mTransformManager = NULL;
+    mTransformId = INVALID_TRANSFORM_ID;
+  }
+}
+
+void Node::CreateTransform( TransformManager& transformManager )
+{
+  DALI_ASSERT_DEBUG( !mTransformManager );
+
+  mTransformManager = &transformManager;
+  mTransformId = transformManager.CreateTransform();
+
+  const WorldTransform& worldTransform = transformManager.GetWorldTransform( mTransformId );
+  mWorldPosition.SetWorldTransform( worldTransform );
+  mWorldOrientation.SetWorldTransform( worldTransform );
+  mWorldScale.SetWorldTransform( worldTransform );
+  mWorldMatrix.SetWorldTransform( worldTransform );
+}
+
+void Node::UpdateLocalTransform( BufferIndex updateBufferIndex )
+{
+  DALI_ASSERT_DEBUG( mTransformManager );
+
+  mTransformManager->SetInheritance( mTransformId,
+                                     mPositionInheritanceMode,
+                                     mInheritOrientation,
+                                     mInheritScale,
+                                     mInhibitLocalTransform );
+
+  mTransformManager->SetLocalTransform( mTransformId,
+                                        mParentOrigin.mValue,
+                                        mAnchorPoint.mValue,
+                                        mSize[ updateBufferIndex ],
+                                        mPosition[ updateBufferIndex ],
+                                        mOrientation[ updateBufferIndex ],
+                                        mScale[ updateBufferIndex ] );
+}
+
+bool Node::CheckContent()
+{
+  unsigned int renderableCount = mRenderer.Size();
+
+  // Stencils affect the drawing of other nodes; these are never culled
+  bool bounded = ( mDrawMode != DrawMode::STENCIL );
+
+  for( unsigned int i = 0u; i < mRenderer.Size(); ++i )
+  {
+    const Shader* shader = mRenderer[i]->GetMaterial().GetShader();
+    if( NULL == shader || !shader->GeometryHintEnabled( Dali::ShaderEffect::HINT_DOESNT_MODIFY_GEOMETRY ) )
+    {
+      bounded = false;
+    }
+  }
+
+  if( mAttachment )
+  {
+    RenderableAttachment* renderable = mAttachment->GetRenderable();
+    if( renderable )
+    {
+      ++renderableCount;
+      bounded = bounded && renderable->IsBoundedBySize();
+    }
+  }
+
+  const bool changed = ( renderableCount != mRenderableCount ) || ( bounded != mContentBounded );
+  mRenderableCount = renderableCount;
+  mContentBounded = bounded;
+  return changed;
+}
+
+void Node::UpdateContent()
+{
+  DALI_ASSERT_DEBUG( mTransformManager );
+
+  mTransformManager->SetContent( mTransformId, mRenderableCount, mContentBounded );
+}
+
+bool Node::GetSubtreeBounds( Vector3& center, Vector3& halfExtents ) const
+{
+  return mTransformManager && mTransformManager->GetSubtreeBounds( mTransformId, center, halfExtents );
+}
+
+unsigned int Node::GetSubtreeRenderableCount() const
+{
+  return mTransformManager ? mTransformManager->GetSubtreeRenderableCount( mTransformId ) : 0u;
 }
 
 void Node::Attach( NodeAttachment& object )
@@ -208,7 +306,7 @@ void Node::ConnectChild( Node* childNode )
   }
 }
 
-void Node::DisconnectChild( BufferIndex updateBufferIndex, Node& childNode, std::set<Node*>& connectedNodes,  std::set<Node*>& disconnectedNodes )
+void Node::DisconnectChild( BufferIndex updateBufferIndex, Node& childNode, NodeSet& connectedNodes, NodeSet& disconnectedNodes )
 {
   DALI_ASSERT_ALWAYS( this != &childNode );
   DALI_ASSERT_ALWAYS( childNode.GetParent() == this );
@@ -332,9 +430,14 @@ void Node::SetParent(Node& parentNode)
 
   mParent = &parentNode;
   mDepth = mParent->GetDepth() + 1u;
+
+  if( mTransformManager )
+  {
+    mTransformManager->SetParent( mTransformId, parentNode.mTransformId );
+  }
 }
 
-void Node::RecursiveDisconnectFromSceneGraph( BufferIndex updateBufferIndex, std::set<Node*>& connectedNodes,  std::set<Node*>& disconnectedNodes )
+void Node::RecursiveDisconnectFromSceneGraph( BufferIndex updateBufferIndex, NodeSet& connectedNodes, NodeSet& disconnectedNodes )
 {
   DALI_ASSERT_ALWAYS(!mIsRoot);
   DALI_ASSERT_ALWAYS(mParent != NULL);
@@ -352,6 +455,11 @@ void Node::RecursiveDisconnectFromSceneGraph( BufferIndex updateBufferIndex, std
   mParent = NULL;
   mDepth = 0u;
 
+  if( mTransformManager )
+  {
+    mTransformManager->SetParent( mTransformId, INVALID_TRANSFORM_ID );
+  }
+
   // Remove all child pointers
   mChildren.Clear();
 
@@ -362,9 +470,9 @@ void Node::RecursiveDisconnectFromSceneGraph( BufferIndex updateBufferIndex, std
   }
 
   // Move into disconnectedNodes
-  std::set<Node*>::size_type removed = connectedNodes.erase( this );
+  const bool removed = connectedNodes.Erase( *this );
   DALI_ASSERT_ALWAYS( removed );
-  disconnectedNodes.insert( this );
+  disconnectedNodes.Insert( *this );
 }
 
 } // namespace SceneGraph
@@ -21,19 +21,21 @@
 // INTERNAL INCLUDES
 #include <dali/public-api/actors/actor-enumerations.h>
 #include <dali/public-api/actors/draw-mode.h>
-#include <dali/devel-api/common/set-wrapper.h>
 #include <dali/public-api/math/quaternion.h>
 #include <dali/public-api/math/math-utils.h>
 #include <dali/public-api/math/vector3.h>
 #include <dali/internal/common/message.h>
+#include <dali/internal/common/pooled-allocation.h>
 #include <dali/internal/event/common/event-thread-services.h>
 #include <dali/internal/update/common/animatable-property.h>
 #include <dali/internal/update/common/property-owner.h>
 #include <dali/internal/update/common/property-vector3.h>
 #include <dali/internal/update/common/scene-graph-buffers.h>
 #include <dali/internal/update/common/inherited-property.h>
+#include <dali/internal/update/manager/transform-manager-property.h>
 #include <dali/integration-api/debug.h>
 #include <dali/internal/update/nodes/node-declarations.h>
+#include <dali/internal/update/nodes/node-set.h>
 #include <dali/internal/update/node-attachments/node-attachment-declarations.h>
 #include <dali/internal/render/data-providers/node-data-provider.h>
 #include <dali/internal/update/rendering/scene-graph-renderer.h>
@@ -106,6 +108,22 @@ public:
    */
   static Node* New();
 
+  /**
+   * Allocate the memory of a Node from a memory pool, see PooledAllocation.
+   */
+  static void* operator new( std::size_t size )
+  {
+    return PooledAllocation< Node >::Allocate( size );
+  }
+
+  /**
+   * Return the memory of a Node to the memory pool, see PooledAllocation.
+   */
+  static void operator delete( void* memory, std::size_t size )
+  {
+    PooledAllocation< Node >::Free( memory, size );
+  }
+
   /**
    * Virtual destructor
    */
@@ -280,7 +298,7 @@ public:
    * @param[in] connectedNodes Disconnected Node attachments should be removed from here.
    * @param[in] disconnectedNodes Disconnected Node attachments should be added here.
    */
-  void DisconnectChild( BufferIndex updateBufferIndex, Node& childNode, std::set<Node*>& connectedNodes,  std::set<Node*>& disconnectedNodes );
+  void DisconnectChild( BufferIndex updateBufferIndex, Node& childNode, NodeSet& connectedNodes, NodeSet& disconnectedNodes );
 
   /**
    * Retrieve the children a Node.
@@ -309,6 +327,7 @@ public:
   void SetDirtyFlag(NodePropertyFlags flag)
   {
     mDirtyFlags |= flag;
+    RequestReset();
   }
 
   /**
@@ -317,6 +336,7 @@ public:
   void SetAllDirtyFlags()
   {
     mDirtyFlags = AllFlags;
+    RequestReset();
   }
 
   /**
@@ -351,6 +371,7 @@ public:
   {
     mParentOrigin.mValue = origin;
     mParentOrigin.OnSet();
+    RequestReset();
   }
 
   /**
@@ -370,6 +391,7 @@ public:
   {
     mAnchorPoint.mValue = anchor;
     mAnchorPoint.OnSet();
+    RequestReset();
   }
 
   /**
@@ -392,117 +414,6 @@ public:
     mPosition.Bake( updateBufferIndex, position );
   }
 
-  /**
-   * Sets the world of the node derived from the position of all its parents.
-   * @param[in] updateBufferIndex The current update buffer index.
-   * @param[in] position The world position.
-   */
-  void SetWorldPosition( BufferIndex updateBufferIndex, const Vector3& position )
-  {
-    mWorldPosition.Set( updateBufferIndex, position );
-  }
-
-  /**
-   * Sets the position of the node derived from the position of all its parents.
-   * This method should only be called when the parent's world position is up-to-date.
-   * With a non-central anchor-point, the local orientation and scale affects the world position.
-   * Therefore the world orientation & scale must be updated before the world position.
-   * @pre The node has a parent.
-   * @param[in] updateBufferIndex The current update buffer index.
-   */
-  void InheritWorldPosition(BufferIndex updateBufferIndex)
-  {
-    DALI_ASSERT_DEBUG(mParent != NULL);
-
-    switch( mPositionInheritanceMode )
-    {
-      case INHERIT_PARENT_POSITION  : ///@see Dali::PositionInheritanceMode for how these modes are expected to work
-      {
-        Vector3 finalPosition(-0.5f, -0.5f, -0.5f);
-
-        finalPosition += mParentOrigin.mValue;
-        finalPosition *= mParent->GetSize(updateBufferIndex);
-        finalPosition += mPosition[updateBufferIndex];
-        finalPosition *= mParent->GetWorldScale(updateBufferIndex);
-        const Quaternion& parentWorldOrientation = mParent->GetWorldOrientation(updateBufferIndex);
-        if(!parentWorldOrientation.IsIdentity())
-        {
-          finalPosition *= parentWorldOrientation;
-        }
-
-        // check if a node needs to be offsetted locally (only applies when AnchorPoint is not central)
-        // dont use operator== as that does a slower comparison (and involves function calls)
-        Vector3 localOffset(0.5f, 0.5f, 0.5f);    // AnchorPoint::CENTER
-        localOffset -= mAnchorPoint.mValue;
-
-        if( ( fabsf( localOffset.x ) >= Math::MACHINE_EPSILON_0 ) ||
-            ( fabsf( localOffset.y ) >= Math::MACHINE_EPSILON_0 ) ||
-            ( fabsf( localOffset.z ) >= Math::MACHINE_EPSILON_0 ) )
-        {
-          localOffset *= mSize[updateBufferIndex];
-
-          Vector3 scale = mWorldScale[updateBufferIndex];
-
-          // Pick up sign of local scale
-          if (mScale[updateBufferIndex].x < 0.0f)
-          {
-            scale.x = -scale.x;
-          }
-          if (mScale[updateBufferIndex].y < 0.0f)
-          {
-            scale.y = -scale.y;
-          }
-          if (mScale[updateBufferIndex].z < 0.0f)
-          {
-            scale.z = -scale.z;
-          }
-
-          // If the anchor-point is not central, then position is affected by the local orientation & scale
-          localOffset *= scale;
-          const Quaternion& localWorldOrientation = mWorldOrientation[updateBufferIndex];
-          if(!localWorldOrientation.IsIdentity())
-          {
-            localOffset *= localWorldOrientation;
-          }
-          finalPosition += localOffset;
-        }
-
-        finalPosition += mParent->GetWorldPosition(updateBufferIndex);
-        mWorldPosition.Set( updateBufferIndex, finalPosition );
-        break;
-      }
-      case USE_PARENT_POSITION_PLUS_LOCAL_POSITION :
-      {
-        // copy parents position plus local transform
-        mWorldPosition.Set( updateBufferIndex, mParent->GetWorldPosition(updateBufferIndex) + mPosition[updateBufferIndex] );
-        break;
-      }
-      case USE_PARENT_POSITION :
-      {
-        // copy parents position
-        mWorldPosition.Set( updateBufferIndex, mParent->GetWorldPosition(updateBufferIndex) );
-        break;
-      }
-      case DONT_INHERIT_POSITION :
-      {
-        // use local position as world position
-        mWorldPosition.Set( updateBufferIndex, mPosition[updateBufferIndex] );
-        break;
-      }
-    }
-  }
-
-  /**
-   * Copies the previous inherited position, if this changed in the previous frame.
-   * This method should be called instead of InheritWorldPosition i.e. if the inherited position
-   * does not need to be recalculated in the current frame.
-   * @param[in] updateBufferIndex The current update buffer index.
-   */
-  void CopyPreviousWorldPosition( BufferIndex updateBufferIndex )
-  {
-    mWorldPosition.CopyPrevious( updateBufferIndex );
-  }
-
   /**
    * Retrieve the position of the node derived from the position of all its parents.
    * @return The world position.
@@ -552,51 +463,6 @@ public:
     mOrientation.Bake( updateBufferIndex, orientation );
   }
 
-  /**
-   * Sets the orientation of the node derived from the rotation of all its parents.
-   * @param[in] updateBufferIndex The current update buffer index.
-   * @param[in] orientation The world orientation.
-   */
-  void SetWorldOrientation( BufferIndex updateBufferIndex, const Quaternion& orientation )
-  {
-    mWorldOrientation.Set( updateBufferIndex, orientation );
-  }
-
-  /**
-   * Sets the orientation of the node derived from the rotation of all its parents.
-   * This method should only be called when the parents world orientation is up-to-date.
-   * @pre The node has a parent.
-   * @param[in] updateBufferIndex The current update buffer index.
-   */
-  void InheritWorldOrientation( BufferIndex updateBufferIndex )
-  {
-    DALI_ASSERT_DEBUG(mParent != NULL);
-
-    const Quaternion& localOrientation = mOrientation[updateBufferIndex];
-
-    if(localOrientation.IsIdentity())
-    {
-      mWorldOrientation.Set( updateBufferIndex, mParent->GetWorldOrientation(updateBufferIndex) );
-    }
-    else
-    {
-      Quaternion finalOrientation( mParent->GetWorldOrientation(updateBufferIndex) );
-      finalOrientation *= localOrientation;
-      mWorldOrientation.Set( updateBufferIndex, finalOrientation );
-    }
-  }
-
-  /**
-   * Copies the previous inherited orientation, if this changed in the previous frame.
-   * This method should be called instead of InheritWorldOrientation i.e. if the inherited orientation
-   * does not need to be recalculated in the current frame.
-   * @param[in] updateBufferIndex The current update buffer index.
-   */
-  void CopyPreviousWorldOrientation( BufferIndex updateBufferIndex )
-  {
-    mWorldOrientation.CopyPrevious( updateBufferIndex );
-  }
-
   /**
    * Retrieve the orientation of the node derived from the rotation of all its parents.
    * @param[in] bufferIndex The buffer to read from.
@@ -640,40 +506,6 @@ public:
     return mScale[bufferIndex];
   }
 
-  /**
-   * Sets the scale of the node derived from the scale of all its parents and a pre-scale
-   * @param[in] updateBufferIndex The current update buffer index.
-   * @param[in] scale The world scale.
-   */
-  void SetWorldScale(BufferIndex updateBufferIndex, const Vector3& scale)
-  {
-    mWorldScale.Set( updateBufferIndex, scale );
-  }
-
-  /**
-   * Sets the scale of the node derived from the scale of all its parents and a pre-scale.
-   * This method should only be called when the parents world scale is up-to-date.
-   * @pre The node has a parent.
-   * @param[in] updateBufferIndex The current update buffer index.
-   */
-  void InheritWorldScale(BufferIndex updateBufferIndex)
-  {
-    DALI_ASSERT_DEBUG(mParent != NULL);
-
-    mWorldScale.Set( updateBufferIndex, mParent->GetWorldScale(updateBufferIndex) * mScale[updateBufferIndex] );
-  }
-
-  /**
-   * Copies the previous inherited scale, if this changed in the previous frame.
-   * This method should be called instead of InheritWorldScale i.e. if the inherited scale
-   * does not need to be recalculated in the current frame.
-   * @param[in] updateBufferIndex The current update buffer index.
-   */
-  void CopyPreviousWorldScale( BufferIndex updateBufferIndex )
-  {
-    mWorldScale.CopyPrevious( updateBufferIndex );
-  }
-
   /**
    * Retrieve the scale of the node derived from the scale of all its parents.
    * @param[in] bufferIndex The buffer to read from.
@@ -863,37 +695,72 @@ public:
   bool ResolveVisibility( BufferIndex updateBufferIndex );
 
   /**
-   * Set the world-matrix of a node, with scale + rotation + translation.
-   * Scale and rotation are centered at the origin.
-   * Translation is applied independently of the scale or rotatation axis.
+   * Create the transform component of the node; the world transform is then read from the TransformManager.
+   * This is called by the UpdateManager when it takes ownership of the node.
+   * @param[in] transformManager The transform manager.
+   */
+  void CreateTransform( TransformManager& transformManager );
+
+  /**
+   * Copy the local transform of the node into the TransformManager.
+   * The world transform is recalculated during the next TransformManager::Update().
    * @param[in] updateBufferIndex The current update buffer index.
-   * @param[in] scale The scale.
-   * @param[in] rotation The rotation.
-   * @param[in] translation The translation.
    */
-  void SetWorldMatrix( BufferIndex updateBufferIndex, const Vector3& scale, const Quaternion& rotation, const Vector3& translation )
+  void UpdateLocalTransform( BufferIndex updateBufferIndex );
+
+  /**
+   * Check whether the content of the node, which is included in the bounds of its sub-tree, has changed.
+   * Only the node is modified, therefore this can be called while sub-trees are updated in parallel.
+   * @return True if the content has changed, in which case UpdateContent() should be called.
+   */
+  bool CheckContent();
+
+  /**
+   * Copy the content of the node into the TransformManager.
+   * The bounds of the sub-tree are recalculated during the next TransformManager::Update().
+   */
+  void UpdateContent();
+
+  /**
+   * Query whether the content of the node is drawn within its size, as found by the last CheckContent().
+   * @return True if the content is bounded by the size of the node.
+   */
+  bool IsContentBounded() const
   {
-    mWorldMatrix.Get( updateBufferIndex ).SetTransformComponents( scale, rotation, translation );
-    mWorldMatrix.SetDirty( updateBufferIndex );
+    return mContentBounded;
   }
 
   /**
-   * Retrieve the cached world-matrix of a node.
-   * @param[in] bufferIndex The buffer to read from.
-   * @return The world-matrix.
+   * Retrieve the world-space bounds of the node and its descendants, as calculated by the last TransformManager::Update().
+   * @param[out] center The center of the axis-aligned bounding box.
+   * @param[out] halfExtents The half extents of the axis-aligned bounding box.
+   * @return False if the sub-tree has no content, or content which may be drawn outside the bounds.
    */
-  const Matrix& GetWorldMatrix( BufferIndex bufferIndex ) const
+  bool GetSubtreeBounds( Vector3& center, Vector3& halfExtents ) const;
+
+  /**
+   * Retrieve the number of renderers & renderable attachments of the node and its descendants.
+   * @return The renderable count.
+   */
+  unsigned int GetSubtreeRenderableCount() const;
+
+  /**
+   * Retrieve the id of the transform component of the node.
+   * @return The transform id, or INVALID_TRANSFORM_ID if the component has not been created.
+   */
+  TransformId GetTransformId() const
   {
-    return mWorldMatrix[ bufferIndex ];
+    return mTransformId;
   }
 
   /**
-   * Copy previous frames world matrix
-   * @param[in] updateBufferIndex The current update buffer index.
+   * Retrieve the cached world-matrix of a node.
+   * @param[in] bufferIndex The buffer to read from.
+   * @return The world-matrix.
    */
-  void CopyPreviousWorldMatrix( BufferIndex updateBufferIndex )
+  const Matrix& GetWorldMatrix( BufferIndex bufferIndex ) const
   {
-    mWorldMatrix.CopyPrevious( updateBufferIndex );
+    return mWorldMatrix[ bufferIndex ];
   }
 
   /**
@@ -1045,6 +912,8 @@ public: // From UniformMapDataProvider
 
 private:
 
+  friend class NodeSet;
+
   // Undefined
   Node(const Node&);
 
@@ -1063,7 +932,7 @@ private:
    * @param[in] connectedNodes Disconnected Node attachments should be removed from here.
    * @param[in] disconnectedNodes Disconnected Node attachments should be added here.
    */
-  void RecursiveDisconnectFromSceneGraph( BufferIndex updateBufferIndex, std::set<Node*>& connectedNodes, std::set<Node*>& disconnectedNodes );
+  void RecursiveDisconnectFromSceneGraph( BufferIndex updateBufferIndex, NodeSet& connectedNodes, NodeSet& disconnectedNodes );
 
 public: // Default properties
 
@@ -1079,14 +948,16 @@ public: // Default properties
 
   // Inherited properties; read-only from public API
 
-  InheritedVector3    mWorldPosition;     ///< Full inherited position
-  InheritedQuaternion mWorldOrientation;  ///< Full inherited orientation
-  InheritedVector3    mWorldScale;        ///< Full inherited scale
-  InheritedMatrix     mWorldMatrix;       ///< Full inherited world matrix
-  InheritedColor      mWorldColor;        ///< Full inherited color
+  TransformManagerVector3Input    mWorldPosition;     ///< Full inherited position
+  TransformManagerQuaternionInput mWorldOrientation;  ///< Full inherited orientation
+  TransformManagerVector3Input    mWorldScale;        ///< Full inherited scale
+  TransformManagerMatrixInput     mWorldMatrix;       ///< Full inherited world matrix
+  InheritedColor                  mWorldColor;        ///< Full inherited color
 
 protected:
 
+  TransformManager*   mTransformManager;             ///< The store of the world transforms; NULL until CreateTransform() is called
+  TransformId         mTransformId;                  ///< The id of the transform component of this node
   Node*               mParent;                       ///< Pointer to parent node (a child is owned by its parent)
   RenderTask*         mExclusiveRenderTask;          ///< Nodes can be marked as exclusive to a single RenderTask
 
@@ -1094,6 +965,8 @@ protected:
   RendererContainer   mRenderer;                     ///< Container of renderers; not owned
 
   NodeContainer       mChildren;                     ///< Container of children; not owned
+  unsigned int        mSetIndex;                     ///< The slot of this node in the NodeSet which contains it
+  unsigned int        mRenderableCount;              ///< The number of renderers & renderable attachments, as passed to the TransformManager
 
   CollectedUniformMap mCollectedUniformMap[2];      ///< Uniform maps of the node
   unsigned int        mUniformMapChanged[2];        ///< Records if the uniform map has been altered this frame
@@ -1108,6 +981,7 @@ protected:
   bool mInheritScale:1;                              ///< Whether the parent's scale should be inherited.
   bool mInhibitLocalTransform:1;                     ///< whether local transform should be applied.
   bool mIsActive:1;                                  ///< When a Node is marked "active" it has been disconnected, and its properties have not been modified
+  bool mContentBounded:1;                            ///< Whether the content is drawn within the size of the node, as passed to the TransformManager
 
   DrawMode::Type          mDrawMode:2;               ///< How the Node and its children should be drawn
   PositionInheritanceMode mPositionInheritanceMode:2;///< Determines how position is inherited, 2 bits is enough
@@ -43,6 +43,8 @@ Layer::Layer()
   mBehavior( Dali::Layer::LAYER_2D ),
   mIsClipping( false ),
   mDepthTestDisabled( false ),
+  mBatchingEnabled( false ),
+  mRenderCacheEnabled( false ),
   mIsDefaultSortFunction( true )
 {
   // layer starts off dirty
@@ -100,6 +102,28 @@ bool Layer::IsDepthTestDisabled() const
   return ( mBehavior == Dali::Layer::LAYER_2D ) || mDepthTestDisabled;
 }
 
+void Layer::SetBatchingEnabled( bool enable )
+{
+  if( mBatchingEnabled != enable )
+  {
+    // the flags of cached render lists must be updated
+    mAllChildTransformsClean[ 0 ] = false;
+    mAllChildTransformsClean[ 1 ] = false;
+    mBatchingEnabled = enable;
+  }
+}
+
+void Layer::SetRenderCacheEnabled( bool enable )
+{
+  if( mRenderCacheEnabled != enable )
+  {
+    // the cached render lists must be marked again
+    mAllChildTransformsClean[ 0 ] = false;
+    mAllChildTransformsClean[ 1 ] = false;
+    mRenderCacheEnabled = enable;
+  }
+}
+
 } // namespace SceneGraph
 
 } // namespace Internal
@@ -83,6 +83,22 @@ public:
    */
   static SceneGraph::Layer* New();
 
+  /**
+   * Allocate the memory of a Layer from a memory pool, see PooledAllocation.
+   */
+  static void* operator new( std::size_t size )
+  {
+    return PooledAllocation< Layer >::Allocate( size );
+  }
+
+  /**
+   * Return the memory of a Layer to the memory pool, see PooledAllocation.
+   */
+  static void operator delete( void* memory, std::size_t size )
+  {
+    PooledAllocation< Layer >::Free( memory, size );
+  }
+
   /**
    * Virtual destructor
    */
@@ -169,6 +185,32 @@ public:
    */
   bool IsDepthTestDisabled() const;
 
+  /**
+   * @copydoc Dali::Layer::SetBatchingEnabled()
+   */
+  void SetBatchingEnabled( bool enable );
+
+  /**
+   * @copydoc Dali::Layer::IsBatchingEnabled()
+   */
+  bool IsBatchingEnabled() const
+  {
+    return mBatchingEnabled;
+  }
+
+  /**
+   * @copydoc Dali::Layer::SetRenderCacheEnabled()
+   */
+  void SetRenderCacheEnabled( bool enable );
+
+  /**
+   * @copydoc Dali::Layer::IsRenderCacheEnabled()
+   */
+  bool IsRenderCacheEnabled() const
+  {
+    return mRenderCacheEnabled;
+  }
+
   /**
    * Enables the reuse of the model view matrices of all renderers for this layer
    * @param[in] updateBufferIndex The current update buffer index.
@@ -241,6 +283,8 @@ private:
                                       /// this allows us to cache render items when layer is "static"
   bool mIsClipping:1;                 ///< True when clipping is enabled
   bool mDepthTestDisabled:1;          ///< Whether depth test is disabled.
+  bool mBatchingEnabled:1;            ///< Whether the draw calls are batched.
+  bool mRenderCacheEnabled:1;         ///< Whether the layer is drawn through a texture, which is redrawn when it changes.
   bool mIsDefaultSortFunction:1;      ///< whether the default depth sort function is used
 
 };
@@ -332,6 +376,44 @@ inline void SetDepthTestDisabledMessage( EventThreadServices& eventThreadService
   new (slot) LocalType( &layer, &Layer::SetDepthTestDisabled, disable );
 }
 
+/**
+ * Create a message for enabling/disabling batching.
+ *
+ * @see Dali::Layer::SetBatchingEnabled().
+ *
+ * @param[in] layer The layer
+ * @param[in] enable \e true enables batching.
+ */
+inline void SetBatchingEnabledMessage( EventThreadServices& eventThreadServices, const Layer& layer, bool enable )
+{
+  typedef MessageValue1< Layer, bool > LocalType;
+
+  // Reserve some memory inside the message queue
+  unsigned int* slot = eventThreadServices.ReserveMessageSlot( sizeof( LocalType ) );
+
+  // Construct message in the message queue memory; note that delete should not be called on the return value
+  new (slot) LocalType( &layer, &Layer::SetBatchingEnabled, enable );
+}
+
+/**
+ * Create a message for enabling/disabling the render cache.
+ *
+ * @see Dali::Layer::SetRenderCacheEnabled().
+ *
+ * @param[in] layer The layer
+ * @param[in] enable \e true enables the render cache.
+ */
+inline void SetRenderCacheEnabledMessage( EventThreadServices& eventThreadServices, const Layer& layer, bool enable )
+{
+  typedef MessageValue1< Layer, bool > LocalType;
+
+  // Reserve some memory inside the message queue
+  unsigned int* slot = eventThreadServices.ReserveMessageSlot( sizeof( LocalType ) );
+
+  // Construct message in the message queue memory; note that delete should not be called on the return value
+  new (slot) LocalType( &layer, &Layer::SetRenderCacheEnabled, enable );
+}
+
 } // namespace SceneGraph
 
 } // namespace Internal
@@ -19,8 +19,8 @@
 #include <dali/internal/update/queue/update-message-queue.h>
 
 // INTERNAL INCLUDES
+#include <dali/public-api/common/dali-vector.h>
 #include <dali/public-api/common/vector-wrapper.h>
-#include <dali/devel-api/threading/mutex.h>
 #include <dali/integration-api/render-controller.h>
 #include <dali/internal/common/message.h>
 #include <dali/internal/common/message-buffer.h>
@@ -46,11 +46,215 @@ static const std::size_t INITIAL_BUFFER_SIZE =  32768;
 static const std::size_t MAX_BUFFER_CAPACITY = 73728; // Avoid keeping buffers which exceed this
 static const std::size_t MAX_FREE_BUFFER_COUNT = 3; // Allow this number of buffers to be recycled
 
-// A queue of message buffers
-typedef vector< MessageBuffer* > MessageBufferQueue;
-typedef MessageBufferQueue::iterator MessageBufferIter;
+/**
+ * A message buffer, which can be linked into a QueuedBufferList.
+ */
+struct QueuedBuffer
+{
+  QueuedBuffer( std::size_t initialCapacity )
+  : buffer( initialCapacity ),
+    next( NULL ),
+    sceneUpdate( false )
+  {
+  }
+
+  MessageBuffer buffer;
+  QueuedBuffer* next; ///< The next buffer in the list
+  bool sceneUpdate;   ///< Whether a message in the buffer requires a scene-graph node tree update; set before the buffer is pushed
+};
+
+/**
+ * A list of buffers shared by one producer thread and one consumer thread, without locking.
+ * The producer pushes one buffer at a time; the consumer takes the whole list at once.
+ *
+ * The consumer only ever replaces the head with NULL, therefore a push is retried at most once,
+ * and a take is a single atomic exchange.
+ */
+class QueuedBufferList
+{
+public:
+
+  QueuedBufferList()
+  : mHead( NULL )
+  {
+  }
+
+  /**
+   * Push a buffer; called by the producer.
+   * @param[in] buffer The buffer.
+   */
+  void Push( QueuedBuffer* buffer )
+  {
+    QueuedBuffer* head = mHead;
+    while( true )
+    {
+      buffer->next = head;
+
+      // Full barrier; the buffer contents are visible to the consumer before the buffer is
+      QueuedBuffer* previousHead = __sync_val_compare_and_swap( &mHead, head, buffer );
+      if( previousHead == head )
+      {
+        break;
+      }
+      head = previousHead;
+    }
+  }
+
+  /**
+   * Take all the buffers; called by the consumer.
+   * @return The first buffer pushed, or NULL if the list was empty. The buffers are linked in the order they were pushed.
+   */
+  QueuedBuffer* TakeAll()
+  {
+    QueuedBuffer* head = __sync_lock_test_and_set( &mHead, static_cast< QueuedBuffer* >( NULL ) );
+
+    // Reverse the list, which was built from the last buffer pushed
+    QueuedBuffer* first( NULL );
+    while( NULL != head )
+    {
+      QueuedBuffer* next = head->next;
+      head->next = first;
+      first = head;
+      head = next;
+    }
+
+    return first;
+  }
+
+  /**
+   * Retrieve the buffers without taking them; called by the consumer.
+   * A pushed buffer is not changed by the producer, therefore the list can be read while more buffers are pushed.
+   * @return The last buffer pushed, or NULL if the list is empty. The buffers are linked in the reverse order they were pushed.
+   */
+  const QueuedBuffer* Peek() const
+  {
+    return mHead;
+  }
+
+private:
+
+  QueuedBuffer* volatile mHead;
+};
+
+/**
+ * The messages which may be replaced by a later message for the same property, in the current buffer.
+ * This is an open-addressing hash table, which is cleared when the buffer is flushed.
+ */
+class CoalescedMessageTable
+{
+public:
+
+  struct Entry
+  {
+    const void* property; ///< The property, or NULL if the entry is unused
+    std::size_t offset;   ///< The offset of the message within the buffer
+    std::size_t size;     ///< The size of the message, or zero if it cannot be replaced
+  };
+
+  CoalescedMessageTable()
+  : mEntries(),
+    mCount( 0u )
+  {
+  }
+
+  /**
+   * Find the entry of a property.
+   * @param[in] property The property.
+   * @return The entry, or NULL if the property has no entry.
+   */
+  Entry* Find( const void* property )
+  {
+    if( 0u == mCount )
+    {
+      return NULL;
+    }
+
+    Entry& entry = Probe( mEntries, property );
+    return ( NULL != entry.property ) ? &entry : NULL;
+  }
+
+  /**
+   * Find the entry of a property, adding an entry which cannot be replaced if necessary.
+   * @param[in] property The property.
+   * @return The entry; this is valid until the table is changed.
+   */
+  Entry& Insert( const void* property )
+  {
+    if( ( mCount + 1u ) * 2u > mEntries.Count() )
+    {
+      Grow();
+    }
+
+    Entry& entry = Probe( mEntries, property );
+    if( NULL == entry.property )
+    {
+      entry.property = property;
+      entry.size = 0u;
+      ++mCount;
+    }
+
+    return entry;
+  }
+
+  /**
+   * Remove all the entries.
+   */
+  void Clear()
+  {
+    if( mCount > 0u )
+    {
+      for( Dali::Vector< Entry >::Iterator iter = mEntries.Begin(), endIter = mEntries.End(); iter != endIter; ++iter )
+      {
+        iter->property = NULL;
+      }
+      mCount = 0u;
+    }
+  }
+
+private:
+
+  /**
+   * Find the entry of a property, or the unused entry where it would be added.
+   */
+  static Entry& Probe( Dali::Vector< Entry >& entries, const void* property )
+  {
+    const std::size_t mask = entries.Count() - 1u;
+    std::size_t index = ( ( reinterpret_cast< std::size_t >( property ) >> 3u ) * 2654435761u ) & mask;
+    while( ( NULL != entries[index].property ) && ( property != entries[index].property ) )
+    {
+      index = ( index + 1u ) & mask;
+    }
+    return entries[index];
+  }
 
-typedef Dali::Mutex MessageQueueMutex;
+  /**
+   * Double the capacity, which is always a power of two.
+   */
+  void Grow()
+  {
+    const Entry unused = { NULL, 0u, 0u };
+
+    Dali::Vector< Entry > entries;
+    entries.Resize( mEntries.Empty() ? 64u : mEntries.Count() * 2u, unused );
+
+    for( Dali::Vector< Entry >::Iterator iter = mEntries.Begin(), endIter = mEntries.End(); iter != endIter; ++iter )
+    {
+      if( NULL != iter->property )
+      {
+        Probe( entries, iter->property ) = *iter;
+      }
+    }
+
+    mEntries.Swap( entries );
+  }
+
+  Dali::Vector< Entry > mEntries;
+  unsigned int mCount;
+};
+
+// Buffers which can be reused by the event-thread
+typedef vector< QueuedBuffer* > QueuedBufferContainer;
+typedef QueuedBufferContainer::iterator QueuedBufferIter;
 
 } // unnamed namespace
 
@@ -67,6 +271,7 @@ struct MessageQueue::Impl
     sceneGraphBuffers(buffers),
     processingEvents(false),
     queueWasEmpty(true),
+    damageTracked(true),
     sceneUpdateFlag( false ),
     sceneUpdate( 0 ),
     currentMessageBuffer(NULL)
@@ -76,44 +281,47 @@ struct MessageQueue::Impl
   ~Impl()
   {
     // Delete the current buffer
-    delete currentMessageBuffer;
+    DeleteBuffer( currentMessageBuffer );
 
     // Delete the unprocessed buffers
-    const MessageBufferIter processQueueEndIter = processQueue.end();
-    for ( MessageBufferIter iter = processQueue.begin(); iter != processQueueEndIter; ++iter )
-    {
-      MessageBuffer* unprocessedBuffer = *iter;
-      DeleteBufferContents( unprocessedBuffer );
-      delete unprocessedBuffer;
-    }
+    DeleteBufferList( processList.TakeAll() );
 
     // Delete the recycled buffers
-    const MessageBufferIter recycleQueueEndIter = recycleQueue.end();
-    for ( MessageBufferIter iter = recycleQueue.begin(); iter != recycleQueueEndIter; ++iter )
+    DeleteBufferList( recycleList.TakeAll() );
+
+    const QueuedBufferIter freeQueueEndIter = freeQueue.end();
+    for ( QueuedBufferIter iter = freeQueue.begin(); iter != freeQueueEndIter; ++iter )
     {
-      MessageBuffer* recycledBuffer = *iter;
-      DeleteBufferContents( recycledBuffer );
-      delete recycledBuffer;
+      DeleteBuffer( *iter );
     }
+  }
 
-    const MessageBufferIter freeQueueEndIter = freeQueue.end();
-    for ( MessageBufferIter iter = freeQueue.begin(); iter != freeQueueEndIter; ++iter )
+  void DeleteBufferList( QueuedBuffer* buffer )
+  {
+    while( NULL != buffer )
     {
-      MessageBuffer* freeBuffer = *iter;
-      DeleteBufferContents( freeBuffer );
-      delete freeBuffer;
+      QueuedBuffer* next = buffer->next;
+      DeleteBuffer( buffer );
+      buffer = next;
     }
   }
 
-  void DeleteBufferContents( MessageBuffer* buffer )
+  void DeleteBuffer( QueuedBuffer* buffer )
   {
-    for( MessageBuffer::Iterator iter = buffer->Begin(); iter.IsValid(); iter.Next() )
+    if( NULL == buffer )
+    {
+      return;
+    }
+
+    for( MessageBuffer::Iterator iter = buffer->buffer.Begin(); iter.IsValid(); iter.Next() )
     {
       MessageBase* message = reinterpret_cast< MessageBase* >( iter.Get() );
 
       // Call virtual destructor explictly; since delete will not be called after placement new
       message->~MessageBase();
     }
+
+    delete buffer;
   }
 
   RenderController&        renderController;     ///< render controller
@@ -121,15 +329,16 @@ struct MessageQueue::Impl
 
   bool                     processingEvents;     ///< Whether messages queued will be flushed by core
   bool                     queueWasEmpty;        ///< Flag whether the queue was empty during the Update()
+  bool                     damageTracked;        ///< Flag whether the changes of all the messages processed during the Update() are damage-tracked
   bool                     sceneUpdateFlag;      ///< true when there is a new message that requires a scene-graph node tree update
-  int                      sceneUpdate;          ///< Non zero when there is a message in the queue requiring a scene-graph node tree update
+  int                      sceneUpdate;          ///< Non zero when a message processed recently required a scene-graph node tree update; used by the update-thread
 
-  MessageQueueMutex        queueMutex;           ///< queueMutex must be locked whilst accessing processQueue or recycleQueue
-  MessageBufferQueue       processQueue;         ///< to process in the next update
-  MessageBufferQueue       recycleQueue;         ///< to recycle MessageBuffers after the messages have been processed
+  QueuedBufferList         processList;          ///< to process in the next update; pushed by the event-thread, taken by the update-thread
+  QueuedBufferList         recycleList;          ///< to recycle buffers after the messages have been processed; pushed by the update-thread, taken by the event-thread
 
-  MessageBuffer*           currentMessageBuffer; ///< can be used without locking
-  MessageBufferQueue       freeQueue;            ///< buffers from the recycleQueue; can be used without locking
+  QueuedBuffer*            currentMessageBuffer; ///< used by the event-thread
+  CoalescedMessageTable    coalescedMessages;    ///< the messages in currentMessageBuffer which may be replaced; used by the event-thread
+  QueuedBufferContainer    freeQueue;            ///< buffers from the recycleList; used by the event-thread
 };
 
 MessageQueue::MessageQueue( Integration::RenderController& controller, const SceneGraph::SceneGraphBuffers& buffers )
@@ -159,14 +368,14 @@ unsigned int* MessageQueue::ReserveMessageSlot( unsigned int requestedSize, bool
 
   if ( !mImpl->currentMessageBuffer )
   {
-    const MessageBufferIter endIter = mImpl->freeQueue.end();
+    const QueuedBufferIter endIter = mImpl->freeQueue.end();
 
     // Find the largest recycled buffer from freeQueue
-    MessageBufferIter nextBuffer = endIter;
-    for ( MessageBufferIter iter = mImpl->freeQueue.begin(); iter != endIter; ++iter )
+    QueuedBufferIter nextBuffer = endIter;
+    for ( QueuedBufferIter iter = mImpl->freeQueue.begin(); iter != endIter; ++iter )
     {
       if ( endIter == nextBuffer ||
-           (*nextBuffer)->GetCapacity() < (*iter)->GetCapacity() )
+           (*nextBuffer)->buffer.GetCapacity() < (*iter)->buffer.GetCapacity() )
       {
         nextBuffer = iter;
       }
@@ -180,7 +389,7 @@ unsigned int* MessageQueue::ReserveMessageSlot( unsigned int requestedSize, bool
     }
     else
     {
-      mImpl->currentMessageBuffer = new MessageBuffer( INITIAL_BUFFER_SIZE );
+      mImpl->currentMessageBuffer = new QueuedBuffer( INITIAL_BUFFER_SIZE );
     }
   }
 
@@ -191,7 +400,43 @@ unsigned int* MessageQueue::ReserveMessageSlot( unsigned int requestedSize, bool
     mImpl->renderController.RequestProcessEventsOnIdle();
   }
 
-  return mImpl->currentMessageBuffer->ReserveMessageSlot( requestedSize );
+  return mImpl->currentMessageBuffer->buffer.ReserveMessageSlot( requestedSize );
+}
+
+unsigned int* MessageQueue::ReserveCoalescedMessageSlot( unsigned int requestedSize, const void* property )
+{
+  CoalescedMessageTable::Entry& entry = mImpl->coalescedMessages.Insert( property );
+
+  if( requestedSize == entry.size )
+  {
+    DALI_ASSERT_DEBUG( NULL != mImpl->currentMessageBuffer );
+
+    // The earlier message has not been flushed, and no other message has changed the property since
+    unsigned int* slot = mImpl->currentMessageBuffer->buffer.GetSlot( entry.offset );
+
+    // Call virtual destructor explictly; since delete will not be called after placement new
+    reinterpret_cast< MessageBase* >( slot )->~MessageBase();
+
+    INCREASE_COUNTER(PerformanceMonitor::MESSAGES_COALESCED);
+
+    return slot;
+  }
+
+  unsigned int* slot = ReserveMessageSlot( requestedSize, true );
+
+  entry.offset = mImpl->currentMessageBuffer->buffer.GetSlotOffset( slot );
+  entry.size = requestedSize;
+
+  return slot;
+}
+
+void MessageQueue::InvalidateCoalescedMessage( const void* property )
+{
+  CoalescedMessageTable::Entry* entry = mImpl->coalescedMessages.Find( property );
+  if( NULL != entry )
+  {
+    entry->size = 0u;
+  }
 }
 
 bool MessageQueue::FlushQueue()
@@ -201,21 +446,29 @@ bool MessageQueue::FlushQueue()
   // If there're messages to flush
   if ( messagesToProcess )
   {
-    // queueMutex must be locked whilst accessing processQueue or recycleQueue
-    MessageQueueMutex::ScopedLock lock( mImpl->queueMutex );
+    // The hand-off never waits for the update-thread; this measures the time taken by the atomic operations
+    PERF_MONITOR_START(PerformanceMonitor::MESSAGE_QUEUE_CONTENTION);
 
-    mImpl->processQueue.push_back( mImpl->currentMessageBuffer );
+    // The flag travels with the buffer, so it is only seen by the update which processes the messages
+    mImpl->currentMessageBuffer->sceneUpdate = mImpl->sceneUpdateFlag;
+    mImpl->sceneUpdateFlag = false;
+
+    mImpl->processList.Push( mImpl->currentMessageBuffer );
     mImpl->currentMessageBuffer = NULL;
+    mImpl->coalescedMessages.Clear();
 
     // Grab any recycled MessageBuffers
-    while ( !mImpl->recycleQueue.empty() )
+    QueuedBuffer* recycled = mImpl->recycleList.TakeAll();
+
+    PERF_MONITOR_END(PerformanceMonitor::MESSAGE_QUEUE_CONTENTION);
+
+    while ( NULL != recycled )
     {
-      MessageBuffer* recycled = mImpl->recycleQueue.back();
-      mImpl->recycleQueue.pop_back();
+      QueuedBuffer* next = recycled->next;
 
       // Guard against excessive message buffer growth
       if ( MAX_FREE_BUFFER_COUNT < mImpl->freeQueue.size() ||
-           MAX_BUFFER_CAPACITY   < recycled->GetCapacity() )
+           MAX_BUFFER_CAPACITY   < recycled->buffer.GetCapacity() )
       {
         delete recycled;
       }
@@ -223,12 +476,8 @@ bool MessageQueue::FlushQueue()
       {
         mImpl->freeQueue.push_back( recycled );
       }
-    }
 
-    if( mImpl->sceneUpdateFlag )
-    {
-      mImpl->sceneUpdate |= 2;
-      mImpl->sceneUpdateFlag = false;
+      recycled = next;
     }
   }
 
@@ -241,35 +490,41 @@ void MessageQueue::ProcessMessages( BufferIndex updateBufferIndex )
 {
   PERF_MONITOR_START(PerformanceMonitor::PROCESS_MESSAGES);
 
-  // queueMutex must be locked whilst accessing queue
-  MessageQueueMutex::ScopedLock lock( mImpl->queueMutex );
+  // No lock is held while processing; buffers flushed meanwhile are processed in the next update
+  QueuedBuffer* buffer = mImpl->processList.TakeAll();
 
-  const MessageBufferIter processQueueEndIter = mImpl->processQueue.end();
-  for ( MessageBufferIter iter = mImpl->processQueue.begin(); iter != processQueueEndIter ; ++iter )
+  mImpl->queueWasEmpty = ( NULL == buffer ); // Flag whether we processed anything
+  mImpl->damageTracked = true;
+
+  while ( NULL != buffer )
   {
-    MessageBuffer* buffer = *iter;
+    QueuedBuffer* next = buffer->next;
+
+    if( buffer->sceneUpdate )
+    {
+      mImpl->sceneUpdate |= 2;
+    }
 
-    for( MessageBuffer::Iterator iter = buffer->Begin(); iter.IsValid(); iter.Next() )
+    for( MessageBuffer::Iterator iter = buffer->buffer.Begin(); iter.IsValid(); iter.Next() )
     {
       MessageBase* message = reinterpret_cast< MessageBase* >( iter.Get() );
 
       message->Process( updateBufferIndex  );
+      mImpl->damageTracked = mImpl->damageTracked && message->IsDamageTracked();
 
       // Call virtual destructor explictly; since delete will not be called after placement new
       message->~MessageBase();
     }
-    buffer->Reset();
+    buffer->buffer.Reset();
 
     // Pass back for use in the event-thread
-    mImpl->recycleQueue.push_back( buffer );
+    mImpl->recycleList.Push( buffer );
+
+    buffer = next;
   }
 
   mImpl->sceneUpdate >>= 1;
 
-  mImpl->queueWasEmpty = mImpl->processQueue.empty(); // Flag whether we processed anything
-
-  mImpl->processQueue.clear();
-
   PERF_MONITOR_END(PerformanceMonitor::PROCESS_MESSAGES);
 }
 
@@ -278,9 +533,28 @@ bool MessageQueue::WasEmpty() const
   return mImpl->queueWasEmpty;
 }
 
+bool MessageQueue::WasDamageTracked() const
+{
+  return mImpl->damageTracked;
+}
+
 bool MessageQueue::IsSceneUpdateRequired() const
 {
-  return mImpl->sceneUpdate;
+  if( mImpl->sceneUpdate )
+  {
+    return true;
+  }
+
+  // The buffers flushed since the last ProcessMessages(); their flags are only cleared when they are processed
+  for( const QueuedBuffer* buffer = mImpl->processList.Peek(); NULL != buffer; buffer = buffer->next )
+  {
+    if( buffer->sceneUpdate )
+    {
+      return true;
+    }
+  }
+
+  return false;
 }
 
 } // namespace Update
@@ -45,6 +45,7 @@ namespace Update
 
 /**
  * Used by UpdateManager to receive messages from the event-thread.
+ * Flushed message buffers are handed to the update-thread, and recycled afterwards, without locking.
  */
 class MessageQueue
 {
@@ -77,7 +78,21 @@ public:
   unsigned int* ReserveMessageSlot( unsigned int size, bool updateScene );
 
   /**
-   * Flushes the message queue
+   * Reserve space for a message which replaces any earlier message for the same property, since the last flush.
+   * @param[in] size the message size with respect to the size of type 'char'
+   * @param[in] property The property changed by the message.
+   * @return A pointer to the first char allocated for the message; this is the slot of the earlier message if it was replaced.
+   */
+  unsigned int* ReserveCoalescedMessageSlot( unsigned int size, const void* property );
+
+  /**
+   * Prevent an earlier message for a property from being replaced.
+   * @param[in] property The property.
+   */
+  void InvalidateCoalescedMessage( const void* property );
+
+  /**
+   * Flushes the message queue; this never waits for the update-thread.
    * @return true if there are messages to process
    */
   bool FlushQueue();
@@ -86,6 +101,7 @@ public:
 
   /**
    * Called once per update; process the previously flushed messages.
+   * No lock is held while the messages are processed.
    * @param updateBufferIndex to use
    */
   void ProcessMessages( BufferIndex updateBufferIndex );
@@ -95,9 +111,17 @@ public:
    */
   bool WasEmpty() const;
 
+  /**
+   * Query whether the changes made by all the messages processed this frame are damage-tracked.
+   * @see MessageBase::IsDamageTracked()
+   * @return True if the damaged region of the surface can be found from the changed property owners.
+   */
+  bool WasDamageTracked() const;
+
   /**
    * Query whether the queue contains at least one message that requires that the scene-graph
-   * node tree be updated.
+   * node tree be updated, or such a message was processed by the last ProcessMessages().
+   * This should be called by the update-thread.
    * @return A flag, true if the scene graph needs an update
    */
   bool IsSceneUpdateRequired() const;
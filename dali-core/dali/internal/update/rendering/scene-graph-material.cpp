@@ -141,6 +141,7 @@ Material::BlendPolicy Material::GetBlendPolicy() const
 void Material::SetBlendingOptions( BufferIndex updateBufferIndex, unsigned int options )
 {
   mBlendingOptions.Set( updateBufferIndex, options );
+  RequestReset();
 }
 
 const Vector4& Material::GetBlendColor(BufferIndex bufferIndex) const
@@ -119,7 +119,11 @@ CompleteStatusManager::CompleteState CompleteStatusManager::GetStatus( Integrati
     }
     else if( mResourceManager.IsResourceLoaded(id) )
     {
-      readiness = CompleteStatusManager::COMPLETE;
+      // A texture uploaded over several frames is not complete until all of it has been uploaded
+      if( !mResourceManager.IsResourceUploading(id) )
+      {
+        readiness = CompleteStatusManager::COMPLETE;
+      }
     }
     else if( mResourceManager.IsResourceLoadFailed(id) )
     {
@@ -39,7 +39,8 @@ struct ResourcePostProcessRequest
   enum PostProcess
   {
     UPLOADED,
-    DELETED
+    DELETED,
+    RELOAD    ///< The texture was evicted after its pixels were discarded; the resource must be loaded again
   };
 
   ResourceId   id;
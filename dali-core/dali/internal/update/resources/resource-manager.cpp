@@ -93,7 +93,8 @@ struct ResourceManager::ResourceManagerImpl
     mDiscardQueue(discardQueue),
     mRenderQueue(renderQueue),
     mNotificationCount(0),
-    cacheUpdated(false)
+    cacheUpdated(false),
+    incrementalUploads(false)
   {
   }
 
@@ -111,6 +112,7 @@ struct ResourceManager::ResourceManagerImpl
   RenderQueue&             mRenderQueue;
   unsigned int             mNotificationCount;
   bool                     cacheUpdated; ///< returned by UpdateCache(). Set true in NotifyTickets to indicate a change in a resource
+  bool                     incrementalUploads; ///< True if new bitmap textures are uploaded over several frames
 
   /**
    * These containers are used to processs requests, and ResourceCache callbacks.
@@ -131,6 +133,16 @@ struct ResourceManager::ResourceManagerImpl
   LiveRequestContainer oldFailedRequests;
   DeadRequestContainer deadRequests;
 
+  /**
+   * The IDs of resources loaded from a file, which can be loaded again if their texture is evicted.
+   */
+  LiveRequestContainer reloadableRequests;
+
+  /**
+   * The IDs of bitmaps whose textures are being uploaded over several frames; they are not complete until uploaded.
+   */
+  LiveRequestContainer uploadingRequests;
+
   /**
    * This is the resource cache. It's filled/emptied from within Core::Update()
    */
@@ -185,6 +197,20 @@ bool ResourceManager::UpdateCache( BufferIndex updateBufferIndex )
 
   mImpl->mPlatformAbstraction.GetResources(*this);
 
+  // 3) Textures uploaded over several frames become complete once the upload is reported by the render thread
+  if( !mImpl->uploadingRequests.empty() )
+  {
+    const std::vector< ResourcePostProcessRequest >& postProcessList = mImpl->mResourcePostProcessQueue[ updateBufferIndex ];
+    for( std::vector< ResourcePostProcessRequest >::const_iterator iter = postProcessList.begin(); iter != postProcessList.end(); ++iter )
+    {
+      if( iter->postProcess == ResourcePostProcessRequest::UPLOADED &&
+          mImpl->uploadingRequests.find( iter->id ) != mImpl->uploadingRequests.end() )
+      {
+        mImpl->cacheUpdated = true;
+      }
+    }
+  }
+
   return mImpl->cacheUpdated;
 }
 
@@ -204,6 +230,7 @@ void ResourceManager::PostProcessResources( BufferIndex updateBufferIndex )
     {
       case ResourcePostProcessRequest::UPLOADED:
       {
+        RemoveId( mImpl->uploadingRequests, ppRequest.id );
         SendToClient( UploadedMessage( *mImpl->mResourceClient, ppRequest.id ) );
         break;
       }
@@ -212,12 +239,22 @@ void ResourceManager::PostProcessResources( BufferIndex updateBufferIndex )
         // TextureObservers handled in TextureCache
         break;
       }
+      case ResourcePostProcessRequest::RELOAD:
+      {
+        SendToClient( ReloadRequiredMessage( *mImpl->mResourceClient, ppRequest.id ) );
+        break;
+      }
     }
   }
 
   mImpl->mResourcePostProcessQueue[ updateBufferIndex ].clear();
 }
 
+void ResourceManager::SetIncrementalTextureUploads( bool incremental )
+{
+  mImpl->incrementalUploads = incremental;
+}
+
 
 /********************************************************************************
  *************************** CoreImpl direct interface  *************************
@@ -248,6 +285,11 @@ void ResourceManager::HandleLoadResourceRequest( ResourceId id, const ResourceTy
   // Add ID to the loading set
   mImpl->loadingRequests.insert(id);
 
+  if( !typePath.path.empty() )
+  {
+    mImpl->reloadableRequests.insert(id);
+  }
+
   // Make the load request last
   mImpl->mPlatformAbstraction.LoadResource(ResourceRequest(id, *typePath.type, typePath.path, priority));
 }
@@ -275,6 +317,11 @@ void ResourceManager::HandleAddBitmapImageRequest( ResourceId id, BitmapPtr bitm
   mImpl->oldCompleteRequests.insert(id);
   mImpl->mBitmapMetadata.insert(BitmapMetadataPair(id, BitmapMetadata::New( bitmap.Get() )));
   mImpl->mTextureCacheDispatcher.DispatchCreateTextureForBitmap( id, bitmap.Get() );
+
+  if( mImpl->incrementalUploads )
+  {
+    mImpl->uploadingRequests.insert(id);
+  }
 }
 
 void ResourceManager::HandleAddNativeImageRequest(ResourceId id, NativeImageInterfacePtr nativeImage)
@@ -388,6 +435,9 @@ void ResourceManager::HandleDiscardResourceRequest( ResourceId deadId, ResourceT
 
   DALI_LOG_INFO(Debug::Filter::gResource, Debug::General, "ResourceManager: HandleDiscardResourceRequest(id:%u)\n", deadId);
 
+  RemoveId(mImpl->reloadableRequests, deadId);
+  RemoveId(mImpl->uploadingRequests, deadId);
+
   // Search for the ID in one of the live containers
   // IDs are only briefly held in the new-completed or failed containers; check those last
   // Try removing from the old-completed requests
@@ -506,6 +556,11 @@ bool ResourceManager::IsResourceLoadFailed(ResourceId id)
   return loadFailed;
 }
 
+bool ResourceManager::IsResourceUploading(ResourceId id)
+{
+  return mImpl->uploadingRequests.find(id) != mImpl->uploadingRequests.end();
+}
+
 BitmapMetadata ResourceManager::GetBitmapMetadata(ResourceId id)
 {
   BitmapMetadata metadata;
@@ -578,6 +633,16 @@ void ResourceManager::LoadResponse( ResourceId id, ResourceTypeId type, Resource
         {
           mImpl->mTextureCacheDispatcher.DispatchCreateTextureForBitmap( id, bitmap );
           mImpl->mBitmapMetadata.insert(BitmapMetadataPair(id, BitmapMetadata::New(bitmap)));
+
+          if( mImpl->incrementalUploads )
+          {
+            mImpl->uploadingRequests.insert(id);
+          }
+
+          if( mImpl->reloadableRequests.find(id) != mImpl->reloadableRequests.end() )
+          {
+            mImpl->mTextureCacheDispatcher.DispatchSetTextureReloadable( id );
+          }
         }
 
         break;
@@ -149,6 +149,13 @@ public: // Used by ResourceClient
    */
   void PostProcessResources( BufferIndex updateBufferIndex );
 
+  /**
+   * Set whether the textures of new bitmaps are uploaded over several frames; if so, the bitmaps
+   * are not complete until the upload is reported by the render thread.
+   * @param[in] incremental True if the textures are uploaded incrementally.
+   */
+  void SetIncrementalTextureUploads( bool incremental );
+
   /********************************************************************************
    *************************** CoreImpl direct interface  *************************
    ********************************************************************************/
@@ -301,6 +308,13 @@ public: // Used by ResourceClient
    */
   bool IsResourceLoadFailed(ResourceId id);
 
+  /**
+   * Check if the texture of a loaded bitmap is still being uploaded over several frames.
+   * @param[in] id The ID of a bitmap resource.
+   * @return true if the texture has not been completely uploaded yet
+   */
+  bool IsResourceUploading(ResourceId id);
+
   /**
    * Get bitmap metadata. This stores meta data about the resource, but
    * doesn't keep track of the resource
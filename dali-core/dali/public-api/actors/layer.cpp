@@ -148,6 +148,26 @@ bool Layer::IsDepthTestDisabled() const
   return GetImplementation(*this).IsDepthTestDisabled();
 }
 
+void Layer::SetBatchingEnabled( bool enable )
+{
+  GetImplementation(*this).SetBatchingEnabled( enable );
+}
+
+bool Layer::IsBatchingEnabled() const
+{
+  return GetImplementation(*this).IsBatchingEnabled();
+}
+
+void Layer::SetRenderCacheEnabled( bool enable )
+{
+  GetImplementation(*this).SetRenderCacheEnabled( enable );
+}
+
+bool Layer::IsRenderCacheEnabled() const
+{
+  return GetImplementation(*this).IsRenderCacheEnabled();
+}
+
 void Layer::SetSortFunction(SortFunctionType function)
 {
   GetImplementation(*this).SetSortFunction(function);
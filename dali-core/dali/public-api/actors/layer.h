@@ -330,6 +330,52 @@ public:
    */
   bool IsDepthTestDisabled() const;
 
+  // Batching
+
+  /**
+   * @brief Whether to batch the draw calls of the actors in the layer.
+   *
+   * When enabled, consecutive image actors which are drawn with the same image, shader, color and blending options
+   * are drawn with a single draw call; their vertices are transformed on the CPU. This reduces the number of draw calls
+   * for layers which contain many small actors e.g. icons, but costs some CPU time when the actors move.
+   * Actors with a custom shader effect are only batched if it has ShaderEffect::HINT_DOESNT_MODIFY_GEOMETRY, since the
+   * vertices of a batch are already in world coordinates.
+   * By default batching is disabled.
+   *
+   * @param[in] enable \e true enables batching.
+   */
+  void SetBatchingEnabled( bool enable );
+
+  /**
+   * @brief Retrieves whether batching is enabled.
+   *
+   * @return \e true if batching is enabled.
+   */
+  bool IsBatchingEnabled() const;
+
+  // Render cache
+
+  /**
+   * @brief Whether to draw the layer through a texture, which is only redrawn when the layer changes.
+   *
+   * When enabled, the actors of the layer are drawn once into an off-screen texture the size of the surface,
+   * and later frames draw that texture instead while nothing in the layer changes. The texture is redrawn when a property
+   * of an actor in the layer changes, when an image, shader or material changes, or when the camera moves.
+   * This suits layers which are costly to draw but rarely change, e.g. toolbars or background panels.
+   * The texture costs memory the size of the surface. Actors are blended as if by the default blending
+   * equation; layers which use stencil actors are not cached. By default the render cache is disabled.
+   *
+   * @param[in] enable \e true enables the render cache.
+   */
+  void SetRenderCacheEnabled( bool enable );
+
+  /**
+   * @brief Retrieves whether the render cache is enabled.
+   *
+   * @return \e true if the render cache is enabled.
+   */
+  bool IsRenderCacheEnabled() const;
+
   // Sorting
 
   /**
@@ -104,6 +104,16 @@ Constraint::RemoveAction Constraint::GetRemoveAction() const
   return GetImplementation(*this).GetRemoveAction();
 }
 
+void Constraint::SetThreadSafe( bool threadSafe )
+{
+  GetImplementation(*this).SetThreadSafe( threadSafe );
+}
+
+bool Constraint::IsThreadSafe() const
+{
+  return GetImplementation(*this).IsThreadSafe();
+}
+
 void Constraint::SetTag( const unsigned int tag )
 {
   GetImplementation(*this).SetTag( tag );
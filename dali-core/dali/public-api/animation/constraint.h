@@ -465,6 +465,24 @@ public:
    */
   RemoveAction GetRemoveAction() const;
 
+  /**
+   * @brief Set whether the constraint function may be called on a worker thread, at the same time as other constraint functions.
+   *
+   * This allows large numbers of independent constraints to be applied in parallel, when the update uses several threads.
+   * The function must then only read its inputs and write the value passed to it, without changing any shared state.
+   * The default value is false, so the function is called on the update thread.
+   * @param[in] threadSafe True if the constraint function is thread-safe.
+   * @pre This should be called before the constraint is applied.
+   */
+  void SetThreadSafe( bool threadSafe );
+
+  /**
+   * @brief Query whether the constraint function may be called on a worker thread.
+   *
+   * @return True if the constraint function is thread-safe.
+   */
+  bool IsThreadSafe() const;
+
   /**
    * @brief Set a tag for the constraint so it can be identified later
    *
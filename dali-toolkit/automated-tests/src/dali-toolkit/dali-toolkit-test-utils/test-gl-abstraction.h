@@ -56,6 +56,16 @@ public:
   void PreRender();
   void PostRender();
 
+  inline bool IsInstancedDrawingSupported()
+  {
+    return mIsInstancedDrawingSupported;
+  }
+
+  inline bool IsVertexArrayObjectSupported()
+  {
+    return mIsVertexArrayObjectSupported;
+  }
+
   /* OpenGL ES 2.0 */
 
   inline void ActiveTexture( GLenum textureUnit )
@@ -81,6 +91,9 @@ public:
 
   inline void BindBuffer( GLenum target, GLuint buffer )
   {
+    std::stringstream out;
+    out << target << ", " << buffer;
+    mVertexArrayTrace.PushCall("BindBuffer", out.str());
   }
 
   inline void BindFramebuffer( GLenum target, GLuint framebuffer )
@@ -415,6 +428,10 @@ public:
   inline void DisableVertexAttribArray(GLuint index)
   {
     SetVertexAttribArray( index, false );
+
+    std::stringstream out;
+    out << index;
+    mVertexArrayTrace.PushCall("DisableVertexAttribArray", out.str());
   }
 
   inline void DrawArrays(GLenum mode, GLint first, GLsizei count)
@@ -441,6 +458,10 @@ public:
   inline void EnableVertexAttribArray(GLuint index)
   {
     SetVertexAttribArray( index, true);
+
+    std::stringstream out;
+    out << index;
+    mVertexArrayTrace.PushCall("EnableVertexAttribArray", out.str());
   }
 
   inline void Finish(void)
@@ -1111,6 +1132,9 @@ public:
 
   inline void VertexAttribPointer(GLuint indx, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void* ptr)
   {
+    std::stringstream out;
+    out << indx << ", " << size << ", " << type << ", " << stride;
+    mVertexArrayTrace.PushCall("VertexAttribPointer", out.str());
   }
 
   inline void Viewport(GLint x, GLint y, GLsizei width, GLsizei height)
@@ -1236,14 +1260,28 @@ public:
 
   inline void BindVertexArray(GLuint array)
   {
+    std::stringstream out;
+    out << array;
+    mVertexArrayTrace.PushCall("BindVertexArray", out.str());
   }
 
   inline void DeleteVertexArrays(GLsizei n, const GLuint* arrays)
   {
+    std::stringstream out;
+    out << n << ", " << arrays[0];
+    mVertexArrayTrace.PushCall("DeleteVertexArrays", out.str());
   }
 
   inline void GenVertexArrays(GLsizei n, GLuint* arrays)
   {
+    for( GLsizei i = 0; i < n; ++i )
+    {
+      arrays[i] = ++mLastVertexArrayIdUsed;
+    }
+
+    std::stringstream out;
+    out << n << ", " << arrays[0];
+    mVertexArrayTrace.PushCall("GenVertexArrays", out.str());
   }
 
   inline GLboolean IsVertexArray(GLuint array)
@@ -1400,10 +1438,16 @@ public:
 
   inline void DrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instanceCount)
   {
+    std::stringstream out;
+    out << mode << ", " << first << ", " << count << ", " << instanceCount;
+    mDrawTrace.PushCall("DrawArraysInstanced", out.str());
   }
 
   inline void DrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const GLvoid* indices, GLsizei instanceCount)
   {
+    std::stringstream out;
+    out << mode << ", " << count << ", " << type << ", indices, " << instanceCount;
+    mDrawTrace.PushCall("DrawElementsInstanced", out.str());
   }
 
   inline GLsync FenceSync(GLenum condition, GLbitfield flags)
@@ -1551,6 +1595,8 @@ public:
 public: // TEST FUNCTIONS
   inline void SetCompileStatus( GLuint value ) { mCompileStatus = value; }
   inline void SetLinkStatus( GLuint value ) { mLinkStatus = value; }
+  inline void SetInstancedDrawingSupported( bool supported ) { mIsInstancedDrawingSupported = supported; }
+  inline void SetVertexArrayObjectSupported( bool supported ) { mIsVertexArrayObjectSupported = supported; }
   inline void SetGetAttribLocationResult(  int result) { mGetAttribLocationResult = result; }
   inline void SetGetErrorResult(  GLenum result) { mGetErrorResult = result; }
   inline void SetGetStringResult(  GLubyte* result) { mGetStringResult = result; }
@@ -1603,6 +1649,11 @@ public: // TEST FUNCTIONS
   inline void ResetDrawCallStack() { mDrawTrace.Reset(); }
   inline TraceCallStack& GetDrawTrace() { return mDrawTrace; }
 
+  //Methods for vertex array & attribute verification
+  inline void EnableVertexArrayCallTrace(bool enable) { mVertexArrayTrace.Enable(enable); }
+  inline void ResetVertexArrayCallStack() { mVertexArrayTrace.Reset(); }
+  inline TraceCallStack& GetVertexArrayTrace() { return mVertexArrayTrace; }
+
   template <typename T>
   inline bool GetUniformValue( const char* name, T& value ) const
   {
@@ -1765,6 +1816,8 @@ private:
   BufferDataCalls mBufferDataCalls;
   BufferSubDataCalls mBufferSubDataCalls;
   GLuint     mLinkStatus;
+  bool       mIsInstancedDrawingSupported;
+  bool       mIsVertexArrayObjectSupported;
   GLint      mGetAttribLocationResult;
   GLenum     mGetErrorResult;
   GLubyte*   mGetStringResult;
@@ -1819,10 +1872,12 @@ private:
   TraceCallStack mTextureTrace;
   TraceCallStack mTexParamaterTrace;
   TraceCallStack mDrawTrace;
+  TraceCallStack mVertexArrayTrace;
 
   // Shaders & Uniforms
   GLuint mLastShaderIdUsed;
   GLuint mLastProgramIdUsed;
+  GLuint mLastVertexArrayIdUsed;
   GLuint mLastUniformIdUsed;
   typedef std::map< std::string, GLint > UniformIDMap;
   typedef std::map< GLuint, UniformIDMap > ProgramUniformMap;